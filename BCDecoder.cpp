@@ -0,0 +1,630 @@
+#include "BCDecoder.h"
+#include <cstring>
+
+namespace BCDecoder
+{
+	float HalfToFloat(uint16_t half)
+	{
+		uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+		uint32_t exponent = (half >> 10) & 0x1F;
+		uint32_t mantissa = half & 0x3FF;
+
+		uint32_t bits;
+		if (exponent == 0)
+		{
+			if (mantissa == 0)
+			{
+				bits = sign;
+			}
+			else
+			{
+				//denormal, normalize it
+				exponent = 127 - 15 + 1;
+				while ((mantissa & 0x400) == 0)
+				{
+					mantissa <<= 1;
+					exponent--;
+				}
+				mantissa &= 0x3FF;
+				bits = sign | (exponent << 23) | (mantissa << 13);
+			}
+		}
+		else if (exponent == 31)
+		{
+			bits = sign | 0x7F800000 | (mantissa << 13);
+		}
+		else
+		{
+			bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+		}
+
+		float value;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	uint16_t FloatToHalf(float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+		int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+		uint32_t mantissa = bits & 0x7FFFFF;
+
+		if (((bits >> 23) & 0xFF) == 0xFF)
+		{
+			//inf or nan
+			return sign | 0x7C00 | (mantissa ? 0x200 : 0);
+		}
+		if (exponent >= 31)
+		{
+			return sign | 0x7C00;
+		}
+		if (exponent <= 0)
+		{
+			if (exponent < -10)
+			{
+				return sign;
+			}
+			//denormal
+			mantissa |= 0x800000;
+			uint32_t shift = (uint32_t)(14 - exponent);
+			uint32_t half = mantissa >> shift;
+			uint32_t rest = mantissa & ((1u << shift) - 1);
+			uint32_t halfway = 1u << (shift - 1);
+			if (rest > halfway || (rest == halfway && (half & 1)))
+			{
+				half++;
+			}
+			return sign | (uint16_t)half;
+		}
+
+		uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+		uint32_t rest = mantissa & 0x1FFF;
+		if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+		{
+			//may carry into the exponent, which is still the right answer
+			half++;
+		}
+		return sign | (uint16_t)half;
+	}
+
+	static void Unpack565(uint16_t color, float out[4])
+	{
+		out[0] = (float)((color >> 11) & 0x1F) / 31.0f;
+		out[1] = (float)((color >> 5) & 0x3F) / 63.0f;
+		out[2] = (float)(color & 0x1F) / 31.0f;
+		out[3] = 1.0f;
+	}
+
+	void DecodeBC1(const uint8_t* block, float outRGBA[16][4])
+	{
+		uint16_t color0 = (uint16_t)(block[0] | (block[1] << 8));
+		uint16_t color1 = (uint16_t)(block[2] | (block[3] << 8));
+		uint32_t indices = (uint32_t)block[4] | ((uint32_t)block[5] << 8) | ((uint32_t)block[6] << 16) | ((uint32_t)block[7] << 24);
+
+		float palette[4][4];
+		Unpack565(color0, palette[0]);
+		Unpack565(color1, palette[1]);
+		if (color0 > color1)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+				palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+			}
+			palette[2][3] = 1.0f;
+			palette[3][3] = 1.0f;
+		}
+		else
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				palette[2][c] = (palette[0][c] + palette[1][c]) * 0.5f;
+				palette[3][c] = 0.0f;
+			}
+			palette[2][3] = 1.0f;
+			palette[3][3] = 0.0f;
+		}
+
+		for (int i = 0; i < 16; i++)
+		{
+			memcpy(outRGBA[i], palette[(indices >> (i * 2)) & 3], sizeof(float) * 4);
+		}
+	}
+
+	void DecodeBC4(const uint8_t* block, float outRGBA[16][4])
+	{
+		float red0 = block[0] / 255.0f;
+		float red1 = block[1] / 255.0f;
+
+		float palette[8];
+		palette[0] = red0;
+		palette[1] = red1;
+		if (block[0] > block[1])
+		{
+			for (int i = 1; i < 7; i++)
+			{
+				palette[i + 1] = ((7 - i) * red0 + i * red1) / 7.0f;
+			}
+		}
+		else
+		{
+			for (int i = 1; i < 5; i++)
+			{
+				palette[i + 1] = ((5 - i) * red0 + i * red1) / 5.0f;
+			}
+			palette[6] = 0.0f;
+			palette[7] = 1.0f;
+		}
+
+		uint64_t indices = 0;
+		for (int i = 0; i < 6; i++)
+		{
+			indices |= (uint64_t)block[2 + i] << (i * 8);
+		}
+
+		for (int i = 0; i < 16; i++)
+		{
+			float value = palette[(indices >> (i * 3)) & 7];
+			outRGBA[i][0] = value;
+			outRGBA[i][1] = value;
+			outRGBA[i][2] = value;
+			outRGBA[i][3] = 1.0f;
+		}
+	}
+
+	// Little endian bit reader over one 128 bit block
+	class BitReader
+	{
+	public:
+		explicit BitReader(const uint8_t* block)
+		{
+			memcpy(&low, block, 8);
+			memcpy(&high, block + 8, 8);
+		}
+
+		uint32_t Read(int count)
+		{
+			uint32_t value = 0;
+			for (int i = 0; i < count; i++)
+			{
+				value |= ReadBit() << i;
+			}
+			return value;
+		}
+
+		uint32_t ReadBit()
+		{
+			uint32_t bit = position < 64 ? (uint32_t)(low >> position) & 1 : (uint32_t)(high >> (position - 64)) & 1;
+			position++;
+			return bit;
+		}
+
+	private:
+		uint64_t low = 0;
+		uint64_t high = 0;
+		int position = 0;
+	};
+
+	// Endpoint fields, w/x are the first subset, y/z the second
+	enum BC6HField { RW, GW, BW, RX, GX, BX, RY, GY, BY, RZ, GZ, BZ };
+
+	//indexed by the order modes are tested in DecodeBC6H
+	static const BC6HMode BC6HModes[BC6HModeCount] =
+	{
+		{ 10, { 5, 5, 5 }, true, 2 },
+		{ 7, { 6, 6, 6 }, true, 2 },
+		{ 11, { 5, 4, 4 }, true, 2 },
+		{ 11, { 4, 5, 4 }, true, 2 },
+		{ 11, { 4, 4, 5 }, true, 2 },
+		{ 9, { 5, 5, 5 }, true, 2 },
+		{ 8, { 6, 5, 5 }, true, 2 },
+		{ 8, { 5, 6, 5 }, true, 2 },
+		{ 8, { 5, 5, 6 }, true, 2 },
+		{ 6, { 6, 6, 6 }, false, 2 },
+		{ 10, { 10, 10, 10 }, false, 1 },
+		{ 11, { 9, 9, 9 }, true, 1 },
+		{ 12, { 8, 8, 8 }, true, 1 },
+		{ 16, { 4, 4, 4 }, true, 1 },
+	};
+
+	//subset of every texel for the 32 two subset partitions, bit i is texel i
+	static const uint16_t BC6HPartitions[32] =
+	{
+		0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+		0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+		0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+		0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+	};
+
+	//anchor texel of the second subset
+	static const uint8_t BC6HAnchors[32] =
+	{
+		15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15,
+		15, 2, 8, 2, 2, 8, 8, 15,
+		2, 8, 2, 2, 8, 8, 2, 2,
+	};
+
+	//mode bits of every mode, the first two take 2 bits and the others 5
+	static const uint32_t BC6HModeCodes[BC6HModeCount] =
+	{
+		0x00, 0x01, 0x02, 0x06, 0x0A, 0x0E, 0x12, 0x16, 0x1A, 0x1E, 0x03, 0x07, 0x0B, 0x0F,
+	};
+
+	static const int BC6HWeights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+	static const int BC6HWeights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	static int SignExtend(int value, int bits)
+	{
+		int shift = 32 - bits;
+		return (int)((uint32_t)value << shift) >> shift;
+	}
+
+	static int Unquantize(int value, int bits, bool bSigned)
+	{
+		if (!bSigned)
+		{
+			if (bits >= 15 || value == 0)
+			{
+				return value;
+			}
+			if (value == (1 << bits) - 1)
+			{
+				return 0xFFFF;
+			}
+			return ((value << 16) + 0x8000) >> bits;
+		}
+
+		if (bits >= 16)
+		{
+			return value;
+		}
+
+		bool bNegative = value < 0;
+		if (bNegative)
+		{
+			value = -value;
+		}
+
+		int result;
+		if (value == 0)
+		{
+			result = 0;
+		}
+		else if (value >= (1 << (bits - 1)) - 1)
+		{
+			result = 0x7FFF;
+		}
+		else
+		{
+			result = ((value << 15) + 0x4000) >> (bits - 1);
+		}
+		return bNegative ? -result : result;
+	}
+
+	static uint16_t FinishUnquantize(int value, bool bSigned)
+	{
+		if (!bSigned)
+		{
+			return (uint16_t)((value * 31) >> 6);
+		}
+
+		value = value < 0 ? -(((-value) * 31) >> 5) : (value * 31) >> 5;
+		if (value < 0)
+		{
+			return (uint16_t)(0x8000 | (-value));
+		}
+		return (uint16_t)value;
+	}
+
+	//calls visit(field, bit) for every endpoint bit of a mode in stream order, reading and packing share it
+	template<typename Visit>
+	static void VisitBC6HEndpointBits(int modeIndex, Visit visit)
+	{
+		//fields are listed in stream order, high:low bit ranges as in the format spec
+		auto read = [&](int field, int high, int low)
+			{
+				for (int bit = low; bit <= high; bit++)
+				{
+					visit(field, bit);
+				}
+			};
+		auto readReversed = [&](int field, int high, int low)
+			{
+				for (int bit = high; bit >= low; bit--)
+				{
+					visit(field, bit);
+				}
+			};
+
+		switch (modeIndex)
+		{
+		case 0:
+			read(GY, 4, 4); read(BY, 4, 4); read(BZ, 4, 4);
+			read(RW, 9, 0); read(GW, 9, 0); read(BW, 9, 0);
+			read(RX, 4, 0); read(GZ, 4, 4); read(GY, 3, 0);
+			read(GX, 4, 0); read(BZ, 0, 0); read(GZ, 3, 0);
+			read(BX, 4, 0); read(BZ, 1, 1); read(BY, 3, 0);
+			read(RY, 4, 0); read(BZ, 2, 2); read(RZ, 4, 0); read(BZ, 3, 3);
+			break;
+		case 1:
+			read(GY, 5, 5); read(GZ, 4, 4); read(GZ, 5, 5);
+			read(RW, 6, 0); read(BZ, 0, 0); read(BZ, 1, 1); read(BY, 4, 4);
+			read(GW, 6, 0); read(BY, 5, 5); read(BZ, 2, 2); read(GY, 4, 4);
+			read(BW, 6, 0); read(BZ, 3, 3); read(BZ, 5, 5); read(BZ, 4, 4);
+			read(RX, 5, 0); read(GY, 3, 0); read(GX, 5, 0); read(GZ, 3, 0);
+			read(BX, 5, 0); read(BY, 3, 0); read(RY, 5, 0); read(RZ, 5, 0);
+			break;
+		case 2:
+			read(RW, 9, 0); read(GW, 9, 0); read(BW, 9, 0);
+			read(RX, 4, 0); read(RW, 10, 10); read(GY, 3, 0);
+			read(GX, 3, 0); read(GW, 10, 10); read(BZ, 0, 0); read(GZ, 3, 0);
+			read(BX, 3, 0); read(BW, 10, 10); read(BZ, 1, 1); read(BY, 3, 0);
+			read(RY, 4, 0); read(BZ, 2, 2); read(RZ, 4, 0); read(BZ, 3, 3);
+			break;
+		case 3:
+			read(RW, 9, 0); read(GW, 9, 0); read(BW, 9, 0);
+			read(RX, 3, 0); read(RW, 10, 10); read(GZ, 4, 4); read(GY, 3, 0);
+			read(GX, 4, 0); read(GW, 10, 10); read(GZ, 3, 0);
+			read(BX, 3, 0); read(BW, 10, 10); read(BZ, 1, 1); read(BY, 3, 0);
+			read(RY, 3, 0); read(BZ, 0, 0); read(BZ, 2, 2); read(RZ, 3, 0); read(GY, 4, 4); read(BZ, 3, 3);
+			break;
+		case 4:
+			read(RW, 9, 0); read(GW, 9, 0); read(BW, 9, 0);
+			read(RX, 3, 0); read(RW, 10, 10); read(BY, 4, 4); read(GY, 3, 0);
+			read(GX, 3, 0); read(GW, 10, 10); read(BZ, 0, 0); read(GZ, 3, 0);
+			read(BX, 4, 0); read(BW, 10, 10); read(BY, 3, 0);
+			read(RY, 3, 0); read(BZ, 1, 1); read(BZ, 2, 2); read(RZ, 3, 0); read(BZ, 4, 4); read(BZ, 3, 3);
+			break;
+		case 5:
+			read(RW, 8, 0); read(BY, 4, 4); read(GW, 8, 0); read(GY, 4, 4);
+			read(BW, 8, 0); read(BZ, 4, 4); read(RX, 4, 0); read(GZ, 4, 4); read(GY, 3, 0);
+			read(GX, 4, 0); read(BZ, 0, 0); read(GZ, 3, 0);
+			read(BX, 4, 0); read(BZ, 1, 1); read(BY, 3, 0);
+			read(RY, 4, 0); read(BZ, 2, 2); read(RZ, 4, 0); read(BZ, 3, 3);
+			break;
+		case 6:
+			read(RW, 7, 0); read(GZ, 4, 4); read(BY, 4, 4); read(GW, 7, 0); read(BZ, 2, 2); read(GY, 4, 4);
+			read(BW, 7, 0); read(BZ, 3, 3); read(BZ, 4, 4); read(RX, 5, 0); read(GY, 3, 0);
+			read(GX, 4, 0); read(BZ, 0, 0); read(GZ, 3, 0);
+			read(BX, 4, 0); read(BZ, 1, 1); read(BY, 3, 0);
+			read(RY, 5, 0); read(RZ, 5, 0);
+			break;
+		case 7:
+			read(RW, 7, 0); read(BZ, 0, 0); read(BY, 4, 4); read(GW, 7, 0); read(GY, 5, 5); read(GY, 4, 4);
+			read(BW, 7, 0); read(GZ, 5, 5); read(BZ, 4, 4); read(RX, 4, 0); read(GZ, 4, 4); read(GY, 3, 0);
+			read(GX, 5, 0); read(GZ, 3, 0);
+			read(BX, 4, 0); read(BZ, 1, 1); read(BY, 3, 0);
+			read(RY, 4, 0); read(BZ, 2, 2); read(RZ, 4, 0); read(BZ, 3, 3);
+			break;
+		case 8:
+			read(RW, 7, 0); read(BZ, 1, 1); read(BY, 4, 4); read(GW, 7, 0); read(BY, 5, 5); read(GY, 4, 4);
+			read(BW, 7, 0); read(BZ, 5, 5); read(BZ, 4, 4); read(RX, 4, 0); read(GZ, 4, 4); read(GY, 3, 0);
+			read(GX, 4, 0); read(BZ, 0, 0); read(GZ, 3, 0);
+			read(BX, 5, 0); read(BY, 3, 0);
+			read(RY, 4, 0); read(BZ, 2, 2); read(RZ, 4, 0); read(BZ, 3, 3);
+			break;
+		case 9:
+			read(RW, 5, 0); read(GZ, 4, 4); read(BZ, 0, 0); read(BZ, 1, 1); read(BY, 4, 4);
+			read(GW, 5, 0); read(GY, 5, 5); read(BY, 5, 5); read(BZ, 2, 2); read(GY, 4, 4);
+			read(BW, 5, 0); read(GZ, 5, 5); read(BZ, 3, 3); read(BZ, 5, 5); read(BZ, 4, 4);
+			read(RX, 5, 0); read(GY, 3, 0); read(GX, 5, 0); read(GZ, 3, 0);
+			read(BX, 5, 0); read(BY, 3, 0); read(RY, 5, 0); read(RZ, 5, 0);
+			break;
+		case 10:
+			read(RW, 9, 0); read(GW, 9, 0); read(BW, 9, 0);
+			read(RX, 9, 0); read(GX, 9, 0); read(BX, 9, 0);
+			break;
+		case 11:
+			read(RW, 9, 0); read(GW, 9, 0); read(BW, 9, 0);
+			read(RX, 8, 0); read(RW, 10, 10); read(GX, 8, 0); read(GW, 10, 10); read(BX, 8, 0); read(BW, 10, 10);
+			break;
+		case 12:
+			read(RW, 9, 0); read(GW, 9, 0); read(BW, 9, 0);
+			read(RX, 7, 0); readReversed(RW, 11, 10); read(GX, 7, 0); readReversed(GW, 11, 10); read(BX, 7, 0); readReversed(BW, 11, 10);
+			break;
+		case 13:
+			read(RW, 9, 0); read(GW, 9, 0); read(BW, 9, 0);
+			read(RX, 3, 0); readReversed(RW, 15, 10); read(GX, 3, 0); readReversed(GW, 15, 10); read(BX, 3, 0); readReversed(BW, 15, 10);
+			break;
+		}
+	}
+
+	const BC6HMode& GetBC6HMode(int modeIndex)
+	{
+		return BC6HModes[modeIndex];
+	}
+
+	const int* GetBC6HWeights(int subsetCount)
+	{
+		return subsetCount == 2 ? BC6HWeights3 : BC6HWeights4;
+	}
+
+	int GetBC6HSubset(int partition, int texel)
+	{
+		return (BC6HPartitions[partition] >> texel) & 1;
+	}
+
+	int GetBC6HAnchor(int partition)
+	{
+		return BC6HAnchors[partition];
+	}
+
+	// Little endian bit writer over one 128 bit block
+	class BitWriter
+	{
+	public:
+		void Write(uint32_t value, int count)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				uint64_t bit = (value >> i) & 1;
+				if (position < 64)
+				{
+					low |= bit << position;
+				}
+				else
+				{
+					high |= bit << (position - 64);
+				}
+				position++;
+			}
+		}
+
+		void Store(uint8_t* block) const
+		{
+			memcpy(block, &low, 8);
+			memcpy(block + 8, &high, 8);
+		}
+
+	private:
+		uint64_t low = 0;
+		uint64_t high = 0;
+		int position = 0;
+	};
+
+	void PackBC6H(int modeIndex, const int fields[12], int partition, const int indices[16], uint8_t* outBlock)
+	{
+		const BC6HMode& info = BC6HModes[modeIndex];
+
+		BitWriter writer;
+		writer.Write(BC6HModeCodes[modeIndex], modeIndex < 2 ? 2 : 5);
+		VisitBC6HEndpointBits(modeIndex, [&](int field, int bit) { writer.Write((uint32_t)fields[field] >> bit, 1); });
+		if (info.subsetCount == 2)
+		{
+			writer.Write((uint32_t)partition, 5);
+		}
+
+		int indexBits = info.subsetCount == 2 ? 3 : 4;
+		for (int i = 0; i < 16; i++)
+		{
+			bool bAnchor = i == 0 || (info.subsetCount == 2 && i == BC6HAnchors[partition]);
+			writer.Write((uint32_t)indices[i], bAnchor ? indexBits - 1 : indexBits);
+		}
+		writer.Store(outBlock);
+	}
+
+	uint16_t InterpolateBC6H(int endpoint0, int endpoint1, int bits, int weight, bool bSigned)
+	{
+		int e0 = Unquantize(endpoint0, bits, bSigned);
+		int e1 = Unquantize(endpoint1, bits, bSigned);
+		return FinishUnquantize(((64 - weight) * e0 + weight * e1 + 32) >> 6, bSigned);
+	}
+
+	void DecodeBC6H(const uint8_t* block, bool bSigned, float outRGBA[16][4])
+	{
+		BitReader reader(block);
+
+		//2 bit modes first, then the 5 bit ones
+		int modeIndex = -1;
+		uint32_t mode = reader.Read(2);
+		if (mode == 0 || mode == 1)
+		{
+			modeIndex = (int)mode;
+		}
+		else
+		{
+			mode |= reader.Read(3) << 2;
+			switch (mode)
+			{
+			case 0x02: modeIndex = 2; break;
+			case 0x06: modeIndex = 3; break;
+			case 0x0A: modeIndex = 4; break;
+			case 0x0E: modeIndex = 5; break;
+			case 0x12: modeIndex = 6; break;
+			case 0x16: modeIndex = 7; break;
+			case 0x1A: modeIndex = 8; break;
+			case 0x1E: modeIndex = 9; break;
+			case 0x03: modeIndex = 10; break;
+			case 0x07: modeIndex = 11; break;
+			case 0x0B: modeIndex = 12; break;
+			case 0x0F: modeIndex = 13; break;
+			}
+		}
+
+		if (modeIndex < 0)
+		{
+			//reserved modes decode to black
+			for (int i = 0; i < 16; i++)
+			{
+				outRGBA[i][0] = outRGBA[i][1] = outRGBA[i][2] = 0.0f;
+				outRGBA[i][3] = 1.0f;
+			}
+			return;
+		}
+
+		const BC6HMode& info = BC6HModes[modeIndex];
+
+		int fields[12] = {};
+		VisitBC6HEndpointBits(modeIndex, [&](int field, int bit) { fields[field] |= (int)reader.ReadBit() << bit; });
+
+		int partition = 0;
+		if (info.subsetCount == 2)
+		{
+			partition = (int)reader.Read(5);
+		}
+
+		//endpoints[subset * 2 + end][channel]
+		int endpoints[4][3];
+		int endpointCount = info.subsetCount * 2;
+		for (int c = 0; c < 3; c++)
+		{
+			endpoints[0][c] = fields[RW + c];
+			endpoints[1][c] = fields[RX + c];
+			endpoints[2][c] = fields[RY + c];
+			endpoints[3][c] = fields[RZ + c];
+		}
+
+		for (int c = 0; c < 3; c++)
+		{
+			if (bSigned)
+			{
+				endpoints[0][c] = SignExtend(endpoints[0][c], info.endpointBits);
+			}
+			for (int e = 1; e < endpointCount; e++)
+			{
+				if (info.bTransformed)
+				{
+					endpoints[e][c] = SignExtend(endpoints[e][c], info.deltaBits[c]);
+					endpoints[e][c] = (endpoints[0][c] + endpoints[e][c]) & ((1 << info.endpointBits) - 1);
+					if (bSigned)
+					{
+						endpoints[e][c] = SignExtend(endpoints[e][c], info.endpointBits);
+					}
+				}
+				else if (bSigned)
+				{
+					endpoints[e][c] = SignExtend(endpoints[e][c], info.endpointBits);
+				}
+			}
+			for (int e = 0; e < endpointCount; e++)
+			{
+				endpoints[e][c] = Unquantize(endpoints[e][c], info.endpointBits, bSigned);
+			}
+		}
+
+		int indexBits = info.subsetCount == 2 ? 3 : 4;
+		const int* weights = info.subsetCount == 2 ? BC6HWeights3 : BC6HWeights4;
+		for (int i = 0; i < 16; i++)
+		{
+			int subset = info.subsetCount == 2 ? (BC6HPartitions[partition] >> i) & 1 : 0;
+
+			//anchor texels drop their top index bit
+			bool bAnchor = i == 0 || (info.subsetCount == 2 && i == BC6HAnchors[partition]);
+			int index = (int)reader.Read(bAnchor ? indexBits - 1 : indexBits);
+
+			const int* e0 = endpoints[subset * 2];
+			const int* e1 = endpoints[subset * 2 + 1];
+			int weight = weights[index];
+			for (int c = 0; c < 3; c++)
+			{
+				int value = ((64 - weight) * e0[c] + weight * e1[c] + 32) >> 6;
+				outRGBA[i][c] = HalfToFloat(FinishUnquantize(value, bSigned));
+			}
+			outRGBA[i][3] = 1.0f;
+		}
+	}
+}
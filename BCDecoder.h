@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+// Software decoders for the block compressed formats the viewer ships.
+// Every decoder writes one 4x4 block as 16 RGBA float texels, row major, so
+// the cpu path sees the same values the gpu sampler reads.
+namespace BCDecoder
+{
+	//bytes per 4x4 block
+	const int BC1BlockSize = 8;
+	const int BC4BlockSize = 8;
+	const int BC6HBlockSize = 16;
+
+	//half float bits to float
+	float HalfToFloat(uint16_t half);
+
+	//float to half float bits, round to nearest even
+	uint16_t FloatToHalf(float value);
+
+	//BC1 (DXT1) unorm, alpha is 1 unless the block uses punch-through
+	void DecodeBC1(const uint8_t* block, float outRGBA[16][4]);
+
+	//BC4 unorm, red channel replicated into rgb, alpha 1
+	void DecodeBC4(const uint8_t* block, float outRGBA[16][4]);
+
+	//BC6H signed or unsigned half float, alpha 1
+	void DecodeBC6H(const uint8_t* block, bool bSigned, float outRGBA[16][4]);
+
+	// Endpoint layout of a BC6H mode, modes are numbered in the order DecodeBC6H tests them
+	struct BC6HMode
+	{
+		int endpointBits;
+		int deltaBits[3];
+		bool bTransformed;
+		int subsetCount;
+	};
+
+	const int BC6HModeCount = 14;
+	const int BC6HPartitionCount = 32;
+
+	//what an encoder needs to know of the format, the decoder reads blocks with the same tables
+	const BC6HMode& GetBC6HMode(int modeIndex);
+	//interpolation weights out of 64, 8 for two subset modes and 16 for one subset modes
+	const int* GetBC6HWeights(int subsetCount);
+	int GetBC6HSubset(int partition, int texel);
+	//texel of the second subset that drops its top index bit like texel 0 does
+	int GetBC6HAnchor(int partition);
+
+	//half float bits DecodeBC6H gives a channel between two bits wide endpoints at weight out of 64
+	uint16_t InterpolateBC6H(int endpoint0, int endpoint1, int bits, int weight, bool bSigned);
+
+	//assembles a block DecodeBC6H reads back. fields hold r, g, b of endpoints w, x, y and z as stored,
+	//deltas of transformed modes included, anchor indices must fit in one bit less
+	void PackBC6H(int modeIndex, const int fields[12], int partition, const int indices[16], uint8_t* outBlock);
+}
@@ -0,0 +1,377 @@
+#include "BCEncoder.h"
+#include "BCDecoder.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace BCEncoder
+{
+	//two subset partitions that get quantized, picked by how well a line fits each subset before quantizing
+	static const int BC6HPartitionCandidates = 2;
+
+	//half float bits as the integer BC6H interpolates in, the sign applied for signed formats
+	static int FromHalfBits(uint16_t half, bool bSigned)
+	{
+		if (bSigned && (half & 0x8000))
+		{
+			return -(int)(half & 0x7FFF);
+		}
+		return half;
+	}
+
+	static int ToBC6HInteger(float value, bool bSigned)
+	{
+		const float maxHalf = 65504.0f;
+		value = std::min(std::max(value, bSigned ? -maxHalf : 0.0f), maxHalf);
+		return FromHalfBits(BCDecoder::FloatToHalf(value), bSigned);
+	}
+
+	static int ClampEndpoint(int value, int bits, bool bSigned)
+	{
+		const int maxValue = bSigned ? (1 << (bits - 1)) - 1 : (1 << bits) - 1;
+		return std::min(std::max(value, bSigned ? -maxValue : 0), maxValue);
+	}
+
+	//endpoint of bits whose decoded value is closest to target, an integer from ToBC6HInteger
+	static int QuantizeEndpoint(float target, int bits, bool bSigned)
+	{
+		//unquantizing scales by 2^(16 - bits), finishing by 31/32 (signed) or 31/64, search around the inverse
+		float scale = (float)(1 << (16 - bits)) * (bSigned ? 31.0f / 32.0f : 31.0f / 64.0f);
+		int estimate = (int)std::lround(target / scale);
+		int best = ClampEndpoint(estimate, bits, bSigned);
+		float bestError = INFINITY;
+		for (int q = estimate - 2; q <= estimate + 2; q++)
+		{
+			int clamped = ClampEndpoint(q, bits, bSigned);
+			float decoded = (float)FromHalfBits(BCDecoder::InterpolateBC6H(clamped, clamped, bits, 0, bSigned), bSigned);
+			float error = std::fabs(decoded - target);
+			if (error < bestError)
+			{
+				bestError = error;
+				best = clamped;
+			}
+		}
+		return best;
+	}
+
+	// One way to encode a block and its squared error in float
+	struct BC6HCandidate
+	{
+		int modeIndex = -1;
+		int partition = 0;
+		//endpoints w, x, y, z as decoded, transformed modes store x, y and z as deltas to w
+		int endpoints[4][3] = {};
+		int indices[16] = {};
+		float error = INFINITY;
+	};
+
+	static int GetSubset(const BCDecoder::BC6HMode& mode, int partition, int texel)
+	{
+		return mode.subsetCount == 2 ? BCDecoder::GetBC6HSubset(partition, texel) : 0;
+	}
+
+	//ends of the principal axis through the texels of one subset, the anchor texel towards the first.
+	//Returns the squared distance of the texels to the axis
+	static float FitSubset(const float points[16][3], int subsetCount, int partition, int subset, float outEndpoints[2][3])
+	{
+		auto inSubset = [&](int texel)
+			{
+				return subsetCount == 1 || BCDecoder::GetBC6HSubset(partition, texel) == subset;
+			};
+
+		float mean[3] = {};
+		int count = 0;
+		for (int i = 0; i < 16; i++)
+		{
+			if (inSubset(i))
+			{
+				for (int c = 0; c < 3; c++)
+				{
+					mean[c] += points[i][c];
+				}
+				count++;
+			}
+		}
+		for (int c = 0; c < 3; c++)
+		{
+			mean[c] /= (float)count;
+		}
+
+		float covariance[3][3] = {};
+		for (int i = 0; i < 16; i++)
+		{
+			if (!inSubset(i))
+			{
+				continue;
+			}
+			for (int a = 0; a < 3; a++)
+			{
+				for (int b = 0; b < 3; b++)
+				{
+					covariance[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+				}
+			}
+		}
+
+		//power iteration from the diagonal, enough for the dominant axis of 16 points
+		float axis[3] = { covariance[0][0], covariance[1][1], covariance[2][2] };
+		for (int iteration = 0; iteration < 8; iteration++)
+		{
+			float next[3];
+			for (int a = 0; a < 3; a++)
+			{
+				next[a] = covariance[a][0] * axis[0] + covariance[a][1] * axis[1] + covariance[a][2] * axis[2];
+			}
+			float length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+			if (length <= 0.0f)
+			{
+				break;
+			}
+			for (int a = 0; a < 3; a++)
+			{
+				axis[a] = next[a] / length;
+			}
+		}
+
+		const int anchor = subset == 0 ? 0 : BCDecoder::GetBC6HAnchor(partition);
+		float minT = 0.0f;
+		float maxT = 0.0f;
+		float anchorT = 0.0f;
+		float lineError = 0.0f;
+		for (int i = 0; i < 16; i++)
+		{
+			if (!inSubset(i))
+			{
+				continue;
+			}
+			float offset[3] = { points[i][0] - mean[0], points[i][1] - mean[1], points[i][2] - mean[2] };
+			float t = offset[0] * axis[0] + offset[1] * axis[1] + offset[2] * axis[2];
+			minT = std::min(minT, t);
+			maxT = std::max(maxT, t);
+			if (i == anchor)
+			{
+				anchorT = t;
+			}
+			lineError += std::max(offset[0] * offset[0] + offset[1] * offset[1] + offset[2] * offset[2] - t * t, 0.0f);
+		}
+
+		if (anchorT - minT > maxT - anchorT)
+		{
+			std::swap(minT, maxT);
+		}
+		for (int c = 0; c < 3; c++)
+		{
+			outEndpoints[0][c] = mean[c] + axis[c] * minT;
+			outEndpoints[1][c] = mean[c] + axis[c] * maxT;
+		}
+		return lineError;
+	}
+
+	//deltas too wide for the mode pull the endpoint towards w
+	static void QuantizeEndpoints(const float endpoints[4][3], bool bSigned, BC6HCandidate& candidate)
+	{
+		const BCDecoder::BC6HMode& mode = BCDecoder::GetBC6HMode(candidate.modeIndex);
+		const int endpointCount = mode.subsetCount * 2;
+		for (int c = 0; c < 3; c++)
+		{
+			const int base = QuantizeEndpoint(endpoints[0][c], mode.endpointBits, bSigned);
+			candidate.endpoints[0][c] = base;
+			for (int e = 1; e < endpointCount; e++)
+			{
+				int value = QuantizeEndpoint(endpoints[e][c], mode.endpointBits, bSigned);
+				if (mode.bTransformed)
+				{
+					const int maxDelta = (1 << (mode.deltaBits[c] - 1)) - 1;
+					value = ClampEndpoint(base + std::min(std::max(value - base, -maxDelta - 1), maxDelta), mode.endpointBits, bSigned);
+				}
+				candidate.endpoints[e][c] = value;
+			}
+		}
+	}
+
+	//closest palette entry of every texel, anchor texels only reach the first half of the palette
+	static void AssignIndices(const float texels[16][4], bool bSigned, BC6HCandidate& candidate)
+	{
+		const BCDecoder::BC6HMode& mode = BCDecoder::GetBC6HMode(candidate.modeIndex);
+		const int indexCount = mode.subsetCount == 2 ? 8 : 16;
+		const int* weights = BCDecoder::GetBC6HWeights(mode.subsetCount);
+
+		float palette[2][16][3];
+		for (int s = 0; s < mode.subsetCount; s++)
+		{
+			for (int w = 0; w < indexCount; w++)
+			{
+				for (int c = 0; c < 3; c++)
+				{
+					uint16_t half = BCDecoder::InterpolateBC6H(candidate.endpoints[s * 2][c], candidate.endpoints[s * 2 + 1][c],
+						mode.endpointBits, weights[w], bSigned);
+					palette[s][w][c] = BCDecoder::HalfToFloat(half);
+				}
+			}
+		}
+
+		candidate.error = 0.0f;
+		for (int i = 0; i < 16; i++)
+		{
+			const int subset = GetSubset(mode, candidate.partition, i);
+			const bool bAnchor = i == 0 || (mode.subsetCount == 2 && i == BCDecoder::GetBC6HAnchor(candidate.partition));
+			const int reachable = bAnchor ? indexCount / 2 : indexCount;
+
+			float bestError = INFINITY;
+			for (int w = 0; w < reachable; w++)
+			{
+				float error = 0.0f;
+				for (int c = 0; c < 3; c++)
+				{
+					float difference = palette[subset][w][c] - texels[i][c];
+					error += difference * difference;
+				}
+				if (error < bestError)
+				{
+					bestError = error;
+					candidate.indices[i] = w;
+				}
+			}
+			candidate.error += bestError;
+		}
+	}
+
+	//quantizes the fitted endpoints, then refits them by least squares for the chosen weights while the error drops
+	static BC6HCandidate FitMode(const float texels[16][4], const float points[16][3], const float fitted[4][3],
+		int modeIndex, int partition, bool bSigned)
+	{
+		const BCDecoder::BC6HMode& mode = BCDecoder::GetBC6HMode(modeIndex);
+		const int* weights = BCDecoder::GetBC6HWeights(mode.subsetCount);
+
+		BC6HCandidate best;
+		best.modeIndex = modeIndex;
+		best.partition = partition;
+		QuantizeEndpoints(fitted, bSigned, best);
+		AssignIndices(texels, bSigned, best);
+
+		for (int iteration = 0; iteration < 2; iteration++)
+		{
+			float endpoints[4][3];
+			bool bSolved = true;
+			for (int s = 0; s < mode.subsetCount && bSolved; s++)
+			{
+				float aa = 0.0f;
+				float ab = 0.0f;
+				float bb = 0.0f;
+				float ax[3] = {};
+				float bx[3] = {};
+				for (int i = 0; i < 16; i++)
+				{
+					if (GetSubset(mode, partition, i) != s)
+					{
+						continue;
+					}
+					float b = weights[best.indices[i]] / 64.0f;
+					float a = 1.0f - b;
+					aa += a * a;
+					ab += a * b;
+					bb += b * b;
+					for (int c = 0; c < 3; c++)
+					{
+						ax[c] += a * points[i][c];
+						bx[c] += b * points[i][c];
+					}
+				}
+
+				float determinant = aa * bb - ab * ab;
+				bSolved = std::fabs(determinant) >= 1e-6f;
+				for (int c = 0; c < 3 && bSolved; c++)
+				{
+					endpoints[s * 2][c] = (bb * ax[c] - ab * bx[c]) / determinant;
+					endpoints[s * 2 + 1][c] = (aa * bx[c] - ab * ax[c]) / determinant;
+				}
+			}
+			if (!bSolved)
+			{
+				break;
+			}
+
+			BC6HCandidate refined;
+			refined.modeIndex = modeIndex;
+			refined.partition = partition;
+			QuantizeEndpoints(endpoints, bSigned, refined);
+			AssignIndices(texels, bSigned, refined);
+			if (!(refined.error < best.error))
+			{
+				break;
+			}
+			best = refined;
+		}
+		return best;
+	}
+
+	void EncodeBC6H(const float texels[16][4], bool bSigned, uint8_t* outBlock)
+	{
+		//fitted in the integer space the hardware interpolates in, compared in float
+		float points[16][3];
+		for (int i = 0; i < 16; i++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				points[i][c] = (float)ToBC6HInteger(texels[i][c], bSigned);
+			}
+		}
+
+		BC6HCandidate best;
+		auto tryModes = [&](const float fitted[4][3], int subsetCount, int partition)
+			{
+				for (int modeIndex = 0; modeIndex < BCDecoder::BC6HModeCount; modeIndex++)
+				{
+					if (BCDecoder::GetBC6HMode(modeIndex).subsetCount != subsetCount)
+					{
+						continue;
+					}
+					BC6HCandidate candidate = FitMode(texels, points, fitted, modeIndex, partition, bSigned);
+					if (candidate.error < best.error)
+					{
+						best = candidate;
+					}
+				}
+			};
+
+		float fitted[4][3] = {};
+		FitSubset(points, 1, 0, 0, fitted);
+		tryModes(fitted, 1, 0);
+
+		//partitions ranked by the distance of their texels to one line per subset
+		std::pair<float, int> partitions[BCDecoder::BC6HPartitionCount];
+		for (int partition = 0; partition < BCDecoder::BC6HPartitionCount; partition++)
+		{
+			float subsetEndpoints[2][3];
+			float lineError = FitSubset(points, 2, partition, 0, subsetEndpoints) + FitSubset(points, 2, partition, 1, subsetEndpoints);
+			partitions[partition] = { lineError, partition };
+		}
+		std::partial_sort(partitions, partitions + BC6HPartitionCandidates, partitions + BCDecoder::BC6HPartitionCount);
+
+		for (int candidate = 0; candidate < BC6HPartitionCandidates; candidate++)
+		{
+			const int partition = partitions[candidate].second;
+			FitSubset(points, 2, partition, 0, fitted);
+			FitSubset(points, 2, partition, 1, fitted + 2);
+			tryModes(fitted, 2, partition);
+		}
+
+		const BCDecoder::BC6HMode& mode = BCDecoder::GetBC6HMode(best.modeIndex);
+		int fields[12];
+		for (int e = 0; e < 4; e++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				int value = best.endpoints[e][c];
+				int bits = mode.endpointBits;
+				if (e > 0 && mode.bTransformed)
+				{
+					value -= best.endpoints[0][c];
+					bits = mode.deltaBits[c];
+				}
+				fields[e * 3 + c] = (int)((uint32_t)value & ((1u << bits) - 1));
+			}
+		}
+		BCDecoder::PackBC6H(best.modeIndex, fields, best.partition, best.indices, outBlock);
+	}
+}
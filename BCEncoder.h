@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+// Software encoders for the block compressed formats the tools write.
+// Blocks come in as 16 RGBA float texels, row major, the layout BCDecoder hands back.
+namespace BCEncoder
+{
+	//BC6H signed or unsigned half float from the rgb of the texels. Every one subset mode and the two subset modes
+	//of the best fitting partitions are tried, endpoints fitted along the principal axis and refined by least squares
+	void EncodeBC6H(const float texels[16][4], bool bSigned, uint8_t* outBlock);
+}
@@ -0,0 +1,370 @@
+// Decoder model 1024_32 with its weights as constants, generated by DecoderCompiler from the model
+// hashing to 0x8d1c818726095321. 704 multiply-adds per pixel instead of 704, 0 neurons eliminated.
+// Regenerate with NeuralTexture --bake-decoders, don't edit.
+#include "BakedDecoders.h"
+#include <cmath>
+
+namespace
+{
+const size_t BlockSize = 16;
+
+inline float Relu(float x)
+{
+	return x > 0.0f ? x : 0.0f;
+}
+
+//x holds a block of pixels channel major, y gets the outputs of the first pixelCount pixels
+void DecodeBlock(const float (*x)[BlockSize], float* y, size_t pixelCount)
+{
+	float h0[32][BlockSize];
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[0][p] = Relu(-0.108289421f - 0.248642504f * x[0][p] - 0.151766211f * x[1][p] - 0.173601091f * x[2][p]
+			- 0.128731444f * x[3][p] - 0.287003011f * x[4][p] + 0.074037604f * x[5][p] - 0.0434892662f * x[6][p]
+			+ 0.124507219f * x[7][p] + 0.119322583f * x[8][p] - 0.0395486951f * x[9][p] - 0.287399441f * x[10][p]
+			- 0.02106167f * x[11][p] + 0.196606025f * x[12][p] - 0.0276253875f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[1][p] = Relu(-0.110665224f - 0.0905820727f * x[0][p] + 0.046624247f * x[1][p] - 0.294144899f * x[2][p]
+			- 0.314914256f * x[3][p] - 0.0788209438f * x[4][p] - 0.0428274684f * x[5][p] - 0.0813278556f * x[6][p]
+			- 0.216860205f * x[7][p] + 0.171087161f * x[8][p] - 0.302964687f * x[9][p] + 0.0374992788f * x[10][p]
+			- 0.112742223f * x[11][p] - 0.0741233155f * x[12][p] - 0.0238013379f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[2][p] = Relu(-0.304169357f + 0.494009435f * x[0][p] - 1.21362484f * x[1][p] + 1.01323354f * x[2][p]
+			- 0.333705813f * x[3][p] - 0.230846271f * x[4][p] + 0.771661222f * x[5][p] + 0.309940815f * x[6][p]
+			+ 0.366086841f * x[7][p] + 0.154038161f * x[8][p] + 0.124407031f * x[9][p] - 0.1743339f * x[10][p]
+			+ 0.266618818f * x[11][p] - 0.0522711575f * x[12][p] + 0.0492471978f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[3][p] = Relu(-0.69093138f + 0.0974380821f * x[0][p] + 1.44753861f * x[1][p] + 0.819527268f * x[2][p]
+			+ 0.223506272f * x[3][p] - 0.394830167f * x[4][p] + 0.155982926f * x[5][p] - 0.0278783981f * x[6][p]
+			+ 0.116830334f * x[7][p] + 0.614866018f * x[8][p] + 0.00266188988f * x[9][p] - 0.381007999f * x[10][p]
+			+ 0.0798909068f * x[11][p] + 0.015688248f * x[12][p] + 0.015552938f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[4][p] = Relu(0.00824304111f + 0.427692562f * x[0][p] + 0.0319952257f * x[1][p] - 0.11949183f * x[2][p]
+			- 1.08643329f * x[3][p] + 0.714116096f * x[4][p] + 0.120172031f * x[5][p] + 0.0934817269f * x[6][p]
+			+ 0.215334192f * x[7][p] + 0.350751102f * x[8][p] + 0.161223963f * x[9][p] + 0.249263242f * x[10][p]
+			- 0.266109526f * x[11][p] + 0.0352772288f * x[12][p] + 0.031616658f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[5][p] = Relu(0.238047138f - 0.0309503507f * x[0][p] + 1.01560867f * x[1][p] - 0.953978837f * x[2][p]
+			+ 1.03095937f * x[3][p] - 0.111230373f * x[4][p] - 0.0814305767f * x[5][p] - 0.124677904f * x[6][p]
+			+ 0.366693079f * x[7][p] + 0.396469444f * x[8][p] + 0.0198241156f * x[9][p] + 0.326054096f * x[10][p]
+			+ 0.291586101f * x[11][p] + 0.0426522382f * x[12][p] - 0.0320094787f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[6][p] = Relu(0.0211510677f - 0.222218573f * x[0][p] - 0.265299976f * x[1][p] + 0.0195371136f * x[2][p]
+			- 0.0431204624f * x[3][p] - 0.14575693f * x[4][p] - 0.250650078f * x[5][p] + 0.0123304026f * x[6][p]
+			- 0.235489473f * x[7][p] + 0.0211911835f * x[8][p] + 0.133746743f * x[9][p] - 0.293521076f * x[10][p]
+			+ 0.21332325f * x[11][p] + 0.131158218f * x[12][p] - 0.0278995503f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[7][p] = Relu(-0.525202811f + 0.224714428f * x[0][p] - 1.27054429f * x[1][p] + 1.14435244f * x[2][p]
+			- 0.109987594f * x[3][p] + 0.393011451f * x[4][p] - 0.00985865947f * x[5][p] + 0.00537689496f * x[6][p]
+			+ 0.408944249f * x[7][p] + 0.281059027f * x[8][p] + 0.666621804f * x[9][p] - 0.594194889f * x[10][p]
+			- 0.499724746f * x[11][p] - 0.0407491326f * x[12][p] + 0.0109581854f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[8][p] = Relu(-0.103140667f - 0.177620128f * x[0][p] - 0.0508403741f * x[1][p] - 0.0234178249f * x[2][p]
+			- 0.233977914f * x[3][p] - 0.210949838f * x[4][p] - 0.0974179357f * x[5][p] - 0.190400913f * x[6][p]
+			+ 0.199583068f * x[7][p] - 0.301284462f * x[8][p] - 0.138644248f * x[9][p] + 0.0806723759f * x[10][p]
+			- 0.133169383f * x[11][p] - 0.0895907581f * x[12][p] - 0.0972697213f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[9][p] = Relu(-0.208498672f - 0.203727633f * x[0][p] + 0.0242192112f * x[1][p] + 0.150226399f * x[2][p]
+			- 0.203002989f * x[3][p] - 0.024779398f * x[4][p] - 0.034051057f * x[5][p] - 0.212699726f * x[6][p]
+			- 0.278320104f * x[7][p] + 0.0314965807f * x[8][p] - 0.181617603f * x[9][p] + 0.0400475301f * x[10][p]
+			+ 0.162943631f * x[11][p] - 0.068103835f * x[12][p] + 0.219049677f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[10][p] = Relu(-0.178444847f + 0.156928584f * x[0][p] - 0.0464729518f * x[1][p] - 0.0150441313f * x[2][p]
+			- 0.127628297f * x[3][p] - 0.113720663f * x[4][p] - 0.0985699371f * x[5][p] - 0.060539633f * x[6][p]
+			+ 0.217980593f * x[7][p] - 0.220799461f * x[8][p] - 0.219340444f * x[9][p] + 0.189761654f * x[10][p]
+			+ 0.0166554134f * x[11][p] + 0.114972793f * x[12][p] - 0.00346863805f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[11][p] = Relu(0.501965344f - 0.246421248f * x[0][p] + 0.346182317f * x[1][p] - 1.08498406f * x[2][p]
+			+ 0.701191247f * x[3][p] - 0.107072353f * x[4][p] + 0.824305952f * x[5][p] - 0.132280424f * x[6][p]
+			- 0.188345671f * x[7][p] - 0.0676595345f * x[8][p] - 0.150447577f * x[9][p] + 0.309203565f * x[10][p]
+			- 0.0934869498f * x[11][p] + 0.0285977181f * x[12][p] - 0.00170862966f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[12][p] = Relu(0.67102176f + 0.11562036f * x[0][p] - 0.385433346f * x[1][p] + 0.156148791f * x[2][p]
+			- 0.333039522f * x[3][p] - 1.8853972f * x[4][p] - 0.203515723f * x[5][p] + 0.692036808f * x[6][p]
+			- 0.26642105f * x[7][p] - 0.262543261f * x[8][p] - 0.299061239f * x[9][p] + 0.0418334045f * x[10][p]
+			- 0.00442674197f * x[11][p] + 0.0288425386f * x[12][p] - 0.00854181685f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[13][p] = Relu(-0.265058011f - 0.181492984f * x[0][p] - 0.172181904f * x[1][p] + 0.160530478f * x[2][p]
+			- 0.106238201f * x[3][p] - 0.088877514f * x[4][p] + 0.103934556f * x[5][p] - 0.203805894f * x[6][p]
+			- 0.136020243f * x[7][p] + 0.117553949f * x[8][p] - 0.198256373f * x[9][p] - 0.0205250531f * x[10][p]
+			- 0.249034852f * x[11][p] - 0.0942754298f * x[12][p] + 0.221510828f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[14][p] = Relu(-1.01977396f + 0.938598156f * x[0][p] - 0.139427692f * x[1][p] - 0.480922878f * x[2][p]
+			+ 1.0826956f * x[3][p] - 1.4237926f * x[4][p] + 1.00057662f * x[5][p] + 0.152893811f * x[6][p]
+			+ 0.191368535f * x[7][p] + 0.196546018f * x[8][p] - 0.194619402f * x[9][p] - 0.441426814f * x[10][p]
+			+ 0.101030558f * x[11][p] + 0.00633090455f * x[12][p] - 0.0360188559f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[15][p] = Relu(-0.843518853f + 0.280004889f * x[0][p] + 1.12805557f * x[1][p] + 0.94059962f * x[2][p]
+			- 0.42909044f * x[3][p] - 0.0617272258f * x[4][p] + 0.148477763f * x[5][p] - 0.644096375f * x[6][p]
+			+ 0.370413691f * x[7][p] + 0.734611273f * x[8][p] + 0.0024855386f * x[9][p] - 0.371130258f * x[10][p]
+			+ 0.114402279f * x[11][p] - 0.0579178818f * x[12][p] + 0.0240838844f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[16][p] = Relu(0.558876932f - 0.0745339766f * x[0][p] - 0.832248807f * x[1][p] - 0.601004839f * x[2][p]
+			+ 0.694844961f * x[3][p] + 0.995669305f * x[4][p] - 0.51203084f * x[5][p] + 0.316635698f * x[6][p]
+			- 0.111197427f * x[7][p] - 0.44526127f * x[8][p] + 0.480411202f * x[9][p] + 0.190695211f * x[10][p]
+			+ 0.158953696f * x[11][p] - 0.00141377107f * x[12][p] - 0.0329392925f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[17][p] = Relu(0.279437155f + 1.36226785f * x[0][p] + 0.157329112f * x[1][p] - 0.489991963f * x[2][p]
+			- 0.00746772438f * x[3][p] - 0.181577355f * x[4][p] - 0.375821382f * x[5][p] - 0.193801165f * x[6][p]
+			+ 0.353022844f * x[7][p] - 0.0972416922f * x[8][p] - 0.536207736f * x[9][p] - 0.12239489f * x[10][p]
+			- 0.504374981f * x[11][p] - 0.00472499197f * x[12][p] + 0.00821866374f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[18][p] = Relu(-0.27673319f - 0.164913476f * x[0][p] - 0.274166346f * x[1][p] + 0.0872567073f * x[2][p]
+			- 0.0469127595f * x[3][p] - 0.0122444741f * x[4][p] - 0.232945442f * x[5][p] + 0.0750205219f * x[6][p]
+			- 0.188398734f * x[7][p] - 0.0222887173f * x[8][p] + 0.0691155046f * x[9][p] + 0.129194945f * x[10][p]
+			+ 0.0869785026f * x[11][p] - 0.134924516f * x[12][p] - 0.148504883f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[19][p] = Relu(0.00131161907f - 0.102491938f * x[0][p] + 0.948560715f * x[1][p] + 0.615691841f * x[2][p]
+			+ 0.378783047f * x[3][p] + 0.384655476f * x[4][p] - 1.10996175f * x[5][p] - 0.144760847f * x[6][p]
+			- 0.392492533f * x[7][p] + 0.635187507f * x[8][p] - 0.285749674f * x[9][p] - 0.0642203689f * x[10][p]
+			- 1.13609278f * x[11][p] - 0.0127227074f * x[12][p] - 0.0010691128f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[20][p] = Relu(-0.305403113f - 0.340276659f * x[0][p] - 0.027901575f * x[1][p] - 0.27046591f * x[2][p]
+			- 0.106717139f * x[3][p] + 0.110020153f * x[4][p] + 0.0289023034f * x[5][p] - 0.0372925922f * x[6][p]
+			+ 0.106973357f * x[7][p] - 0.27435115f * x[8][p] + 0.159248769f * x[9][p] - 0.211787447f * x[10][p]
+			- 0.272882223f * x[11][p] + 0.19408156f * x[12][p] + 0.142080858f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[21][p] = Relu(-0.241592169f - 0.254386663f * x[0][p] - 0.282028675f * x[1][p] - 0.0720493942f * x[2][p]
+			- 0.0460938811f * x[3][p] + 0.0203481279f * x[4][p] + 0.108106494f * x[5][p] + 0.0490590371f * x[6][p]
+			- 0.0394388624f * x[7][p] + 0.109245539f * x[8][p] - 0.0701966584f * x[9][p] - 0.0739288405f * x[10][p]
+			- 0.179070368f * x[11][p] - 0.147293612f * x[12][p] - 0.0929022878f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[22][p] = Relu(-0.199476019f + 0.0782226399f * x[0][p] - 0.147232711f * x[1][p] + 0.0941844359f * x[2][p]
+			- 0.317101955f * x[3][p] - 0.11628563f * x[4][p] - 0.106711522f * x[5][p] - 0.0851057917f * x[6][p]
+			+ 0.00508100959f * x[7][p] - 0.132688791f * x[8][p] - 0.238080084f * x[9][p] - 0.177340969f * x[10][p]
+			- 0.336069077f * x[11][p] - 0.13276729f * x[12][p] + 0.148663759f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[23][p] = Relu(-0.265788138f + 0.133230463f * x[0][p] + 0.040499717f * x[1][p] - 0.17797029f * x[2][p]
+			- 0.236784056f * x[3][p] + 0.0633956119f * x[4][p] - 0.219400764f * x[5][p] - 0.0611751713f * x[6][p]
+			+ 0.160961673f * x[7][p] - 0.236441299f * x[8][p] + 0.124056049f * x[9][p] - 0.232991561f * x[10][p]
+			- 0.270906538f * x[11][p] - 0.117903687f * x[12][p] - 0.0892478973f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[24][p] = Relu(-0.224018991f - 0.150889069f * x[0][p] + 0.158984452f * x[1][p] - 0.201823622f * x[2][p]
+			+ 0.229154259f * x[3][p] - 0.227075934f * x[4][p] - 0.224239692f * x[5][p] - 0.194592446f * x[6][p]
+			- 0.218957335f * x[7][p] + 0.0693455935f * x[8][p] - 0.131397426f * x[9][p] - 0.136299819f * x[10][p]
+			+ 0.10196349f * x[11][p] - 0.0160835385f * x[12][p] + 0.222497821f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[25][p] = Relu(0.293185532f - 1.2244494f * x[0][p] - 0.459447265f * x[1][p] + 0.867045522f * x[2][p]
+			+ 0.0686465353f * x[3][p] + 0.334454626f * x[4][p] - 0.026712019f * x[5][p] + 0.447284698f * x[6][p]
+			+ 0.140007913f * x[7][p] + 0.494995326f * x[8][p] + 0.414310038f * x[9][p] + 0.0718493462f * x[10][p]
+			- 0.213366091f * x[11][p] + 0.00922063366f * x[12][p] - 0.00250688405f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[26][p] = Relu(-0.278596282f + 0.0720815584f * x[0][p] + 0.0671216547f * x[1][p] - 0.24029918f * x[2][p]
+			+ 0.102658443f * x[3][p] - 0.285732448f * x[4][p] + 0.0620328002f * x[5][p] + 0.0187468324f * x[6][p]
+			+ 0.129289597f * x[7][p] - 0.348462105f * x[8][p] + 0.146248251f * x[9][p] - 0.0092603527f * x[10][p]
+			+ 0.0112228133f * x[11][p] - 0.0379681066f * x[12][p] + 0.113716267f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[27][p] = Relu(-0.0424034707f + 0.559276104f * x[0][p] + 0.00900033955f * x[1][p] - 0.980833173f * x[2][p]
+			+ 0.813884735f * x[3][p] + 0.00962885749f * x[4][p] + 0.386922926f * x[5][p] - 0.10402476f * x[6][p]
+			- 0.196733445f * x[7][p] - 0.377015412f * x[8][p] - 0.384888738f * x[9][p] - 0.0669394732f * x[10][p]
+			+ 0.130505428f * x[11][p] - 0.0309666023f * x[12][p] - 0.015917046f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[28][p] = Relu(0.0681421682f + 1.10794687f * x[0][p] - 0.398060054f * x[1][p] + 0.291945308f * x[2][p]
+			- 0.103281774f * x[3][p] + 0.146174252f * x[4][p] - 0.829988778f * x[5][p] + 0.00589117827f * x[6][p]
+			+ 0.490409464f * x[7][p] + 0.133032173f * x[8][p] + 0.152423531f * x[9][p] - 0.344727308f * x[10][p]
+			+ 0.0975190699f * x[11][p] - 0.0303513147f * x[12][p] - 0.0308625717f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[29][p] = Relu(-0.974747241f + 0.579801857f * x[0][p] - 0.27538383f * x[1][p] + 0.871816754f * x[2][p]
+			+ 0.493654281f * x[3][p] + 0.479194432f * x[4][p] + 0.903127015f * x[5][p] - 0.278240889f * x[6][p]
+			+ 0.482619286f * x[7][p] + 0.0115523906f * x[8][p] + 0.0367585793f * x[9][p] - 0.117102176f * x[10][p]
+			+ 0.358330131f * x[11][p] - 0.0877147093f * x[12][p] + 0.029473735f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[30][p] = Relu(0.543471873f + 0.424731433f * x[0][p] - 1.10302615f * x[1][p] + 0.488708645f * x[2][p]
+			+ 0.239382789f * x[3][p] - 0.804989398f * x[4][p] - 0.176451027f * x[5][p] + 0.331186026f * x[6][p]
+			+ 0.397794753f * x[7][p] + 0.1321567f * x[8][p] + 0.0500409678f * x[9][p] - 0.318685204f * x[10][p]
+			- 0.219838277f * x[11][p] - 0.0265324395f * x[12][p] + 0.0197841357f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[31][p] = Relu(-0.443304509f + 0.553355992f * x[0][p] - 0.880716085f * x[1][p] + 0.480420768f * x[2][p]
+			+ 0.31347391f * x[3][p] + 0.692287147f * x[4][p] + 0.0646413639f * x[5][p] - 0.367005169f * x[6][p]
+			+ 0.341517001f * x[7][p] - 0.109288469f * x[8][p] - 0.440214276f * x[9][p] - 0.782963693f * x[10][p]
+			+ 0.221438646f * x[11][p] - 0.0445544161f * x[12][p] + 0.0347930603f * x[13][p]);
+	}
+
+	float s[8][BlockSize];
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[0][p] = 0.244296342f + 0.0126183955f * h0[0][p] - 0.0778971538f * h0[1][p] + 0.610656798f * h0[2][p]
+			- 0.0831519514f * h0[3][p] - 0.363843769f * h0[4][p] - 0.978637218f * h0[5][p] - 0.13085103f * h0[6][p]
+			+ 0.0862227231f * h0[7][p] + 0.117415339f * h0[8][p] - 0.14210315f * h0[9][p] - 0.00948141329f * h0[10][p]
+			- 0.646049857f * h0[11][p] - 0.0602762587f * h0[12][p] + 0.174291566f * h0[13][p] + 0.114234619f * h0[14][p]
+			+ 0.0602116212f * h0[15][p] - 0.534197867f * h0[16][p] + 0.0435800962f * h0[17][p] - 0.151799276f * h0[18][p]
+			- 0.308589131f * h0[19][p] - 0.0042605293f * h0[20][p] - 0.112881072f * h0[21][p] - 0.0204390474f * h0[22][p]
+			+ 0.164866328f * h0[23][p] - 0.114690527f * h0[24][p] + 0.233439937f * h0[25][p] - 0.109057046f * h0[26][p]
+			- 0.328371704f * h0[27][p] + 0.227925688f * h0[28][p] - 0.261647969f * h0[29][p] + 0.830798984f * h0[30][p]
+			+ 0.22537449f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[1][p] = -0.257823378f - 0.038870573f * h0[0][p] + 0.0106521957f * h0[1][p] + 0.565801144f * h0[2][p]
+			- 0.148793504f * h0[3][p] - 0.238166675f * h0[4][p] - 0.558830261f * h0[5][p] + 0.0228287186f * h0[6][p]
+			+ 0.592059255f * h0[7][p] - 0.00354792411f * h0[8][p] - 0.125606313f * h0[9][p] - 0.0621136203f * h0[10][p]
+			- 0.420072705f * h0[11][p] + 0.233563483f * h0[12][p] - 0.125728518f * h0[13][p] - 0.138747573f * h0[14][p]
+			+ 0.0403003693f * h0[15][p] + 0.520662367f * h0[16][p] - 0.027338095f * h0[17][p] + 0.0676287636f * h0[18][p]
+			+ 0.202412203f * h0[19][p] - 0.130028009f * h0[20][p] + 0.0698547736f * h0[21][p] + 0.0653031766f * h0[22][p]
+			+ 0.0454093032f * h0[23][p] + 0.034768939f * h0[24][p] + 0.421623498f * h0[25][p] + 0.127745658f * h0[26][p]
+			+ 0.0170607455f * h0[27][p] + 0.316794485f * h0[28][p] + 0.781609654f * h0[29][p] + 0.222384125f * h0[30][p]
+			+ 0.467504621f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[2][p] = -0.112034045f - 0.0960986093f * h0[0][p] + 0.133569747f * h0[1][p] + 0.605345011f * h0[2][p]
+			- 0.082415767f * h0[3][p] - 0.31131053f * h0[4][p] - 0.526052892f * h0[5][p] + 0.00247285748f * h0[6][p]
+			+ 1.08825755f * h0[7][p] - 0.0756201297f * h0[8][p] - 0.0196252353f * h0[9][p] + 0.0244411863f * h0[10][p]
+			- 0.44104293f * h0[11][p] - 0.475844622f * h0[12][p] + 0.140266135f * h0[13][p] - 0.0316075757f * h0[14][p]
+			- 0.146648332f * h0[15][p] + 0.401006579f * h0[16][p] - 0.0237204153f * h0[17][p] + 0.149158046f * h0[18][p]
+			+ 0.141814277f * h0[19][p] + 0.141125485f * h0[20][p] + 0.166554704f * h0[21][p] - 0.0969800055f * h0[22][p]
+			+ 0.0857547745f * h0[23][p] + 0.0355719179f * h0[24][p] + 0.410986185f * h0[25][p] + 0.0410312675f * h0[26][p]
+			+ 0.00709105795f * h0[27][p] + 0.401005834f * h0[28][p] + 0.764768004f * h0[29][p] + 0.314834118f * h0[30][p]
+			- 0.290731728f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[3][p] = 0.808968604f + 0.117016107f * h0[0][p] + 0.0593999885f * h0[1][p] + 0.374954879f * h0[2][p]
+			+ 1.02603781f * h0[3][p] - 1.38075054f * h0[4][p] + 0.692156553f * h0[5][p] + 0.0246379431f * h0[6][p]
+			+ 1.1727432f * h0[7][p] - 0.10890229f * h0[8][p] - 0.0180300307f * h0[9][p] - 0.126363918f * h0[10][p]
+			+ 0.74448514f * h0[11][p] + 2.19181609f * h0[12][p] - 0.0851938277f * h0[13][p] + 7.01901245f * h0[14][p]
+			- 3.04904366f * h0[15][p] - 0.469879448f * h0[16][p] + 0.621552587f * h0[17][p] + 0.0209913272f * h0[18][p]
+			+ 0.86846751f * h0[19][p] + 0.0849940181f * h0[20][p] + 0.0333987288f * h0[21][p] - 0.0164285321f * h0[22][p]
+			+ 0.0246999953f * h0[23][p] - 0.0790306702f * h0[24][p] - 0.370735765f * h0[25][p] - 0.142585412f * h0[26][p]
+			+ 0.672551632f * h0[27][p] - 0.0246992745f * h0[28][p] + 0.160394162f * h0[29][p] + 0.79435873f * h0[30][p]
+			+ 0.419351459f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[4][p] = 0.537442923f + 0.136623099f * h0[0][p] - 0.0465147868f * h0[1][p] + 0.17098178f * h0[2][p]
+			- 1.02453959f * h0[3][p] - 0.365653187f * h0[4][p] - 0.0146876657f * h0[5][p] - 0.0846609399f * h0[6][p]
+			+ 0.0376500525f * h0[7][p] + 0.0370299779f * h0[8][p] + 0.141421095f * h0[9][p] - 0.101007827f * h0[10][p]
+			+ 0.624654293f * h0[11][p] + 0.0423911512f * h0[12][p] - 0.123693332f * h0[13][p] - 0.099295266f * h0[14][p]
+			- 0.208766192f * h0[15][p] + 0.478145689f * h0[16][p] - 0.523507297f * h0[17][p] + 0.075404048f * h0[18][p]
+			- 0.538453281f * h0[19][p] - 0.0760819763f * h0[20][p] - 0.00199525314f * h0[21][p] + 0.0964520276f * h0[22][p]
+			- 0.103181601f * h0[23][p] - 0.0882318094f * h0[24][p] + 1.06802142f * h0[25][p] - 0.113629825f * h0[26][p]
+			- 0.109802023f * h0[27][p] - 0.54034251f * h0[28][p] - 0.567968488f * h0[29][p] + 0.565058649f * h0[30][p]
+			+ 0.114214018f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[5][p] = -0.24127847f + 0.070839487f * h0[0][p] + 0.212324113f * h0[1][p] + 0.165243864f * h0[2][p]
+			+ 1.09135079f * h0[3][p] - 0.310482949f * h0[4][p] + 0.023124747f * h0[5][p] + 0.0285478849f * h0[6][p]
+			- 0.163973272f * h0[7][p] + 0.0981056169f * h0[8][p] + 0.00842382386f * h0[9][p] - 0.166189522f * h0[10][p]
+			- 0.160855159f * h0[11][p] + 0.130527601f * h0[12][p] + 0.124380752f * h0[13][p] - 0.0990553722f * h0[14][p]
+			- 0.152173266f * h0[15][p] - 0.694032371f * h0[16][p] - 0.778034031f * h0[17][p] - 0.0319659784f * h0[18][p]
+			+ 0.423627853f * h0[19][p] + 0.0430118218f * h0[20][p] - 0.131107643f * h0[21][p] + 0.067303136f * h0[22][p]
+			- 0.0660866275f * h0[23][p] + 0.017240122f * h0[24][p] + 0.912780523f * h0[25][p] + 0.15310894f * h0[26][p]
+			- 0.260745794f * h0[27][p] - 0.47971797f * h0[28][p] + 0.621530354f * h0[29][p] - 0.415146887f * h0[30][p]
+			+ 0.149719968f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[6][p] = 0.139026195f + 0.0684692264f * h0[0][p] + 0.0394820124f * h0[1][p] + 0.652680039f * h0[2][p]
+			+ 0.405528367f * h0[3][p] - 0.370897502f * h0[4][p] + 0.516572475f * h0[5][p] - 0.160844922f * h0[6][p]
+			- 0.825302064f * h0[7][p] - 0.129639819f * h0[8][p] + 0.111050591f * h0[9][p] + 0.128842905f * h0[10][p]
+			+ 0.585626125f * h0[11][p] + 0.357266963f * h0[12][p] + 0.0606648624f * h0[13][p] + 3.46344566f * h0[14][p]
+			- 0.303187549f * h0[15][p] - 0.256461918f * h0[16][p] + 0.517205656f * h0[17][p] - 0.415361285f * h0[18][p]
+			- 0.59887737f * h0[19][p] - 0.0690386519f * h0[20][p] + 0.0317156799f * h0[21][p] + 0.0866858065f * h0[22][p]
+			+ 0.0537448861f * h0[23][p] + 0.0589493811f * h0[24][p] - 0.831176162f * h0[25][p] + 0.0583581589f * h0[26][p]
+			+ 0.711259842f * h0[27][p] + 0.0546845011f * h0[28][p] + 0.931612432f * h0[29][p] + 0.488265753f * h0[30][p]
+			+ 0.737532377f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[7][p] = -0.0867879167f + 0.011369653f * h0[0][p] - 0.0120432135f * h0[1][p] - 0.44011125f * h0[2][p]
+			+ 0.110519856f * h0[3][p] - 0.96013391f * h0[4][p] + 0.437700301f * h0[5][p] - 0.0240598284f * h0[6][p]
+			- 0.185032234f * h0[7][p] - 0.00609783037f * h0[8][p] + 0.0282416344f * h0[9][p] - 0.0475640036f * h0[10][p]
+			- 0.324019253f * h0[11][p] + 0.109974384f * h0[12][p] - 0.0845748186f * h0[13][p] - 0.00978615507f * h0[14][p]
+			- 0.124799632f * h0[15][p] + 0.448821545f * h0[16][p] + 0.0153333005f * h0[17][p] - 0.0242638215f * h0[18][p]
+			+ 0.590329051f * h0[19][p] - 0.0192667544f * h0[20][p] + 0.0961636826f * h0[21][p] + 0.044771757f * h0[22][p]
+			- 0.134350464f * h0[23][p] + 0.116644636f * h0[24][p] + 0.444204777f * h0[25][p] - 0.154541612f * h0[26][p]
+			- 0.0735368282f * h0[27][p] + 0.350055546f * h0[28][p] - 0.457466215f * h0[29][p] + 0.453757972f * h0[30][p]
+			+ 0.263834506f * h0[31][p];
+	}
+
+	for (size_t p = 0; p < pixelCount; p++)
+	{
+		for (size_t o = 0; o < 8; o++)
+		{
+			y[p * 8 + o] = 1.0f / (1.0f + std::exp(-s[o][p]));
+		}
+	}
+}
+
+void Decode(const float* inputs, float* outputs, size_t count)
+{
+	float x[14][BlockSize];
+	for (size_t begin = 0; begin < count; begin += BlockSize)
+	{
+		const size_t pixelCount = count - begin < BlockSize ? count - begin : BlockSize;
+		for (size_t i = 0; i < 14; i++)
+		{
+			for (size_t p = 0; p < BlockSize; p++)
+			{
+				x[i][p] = p < pixelCount ? inputs[(begin + p) * 14 + i] : 0.0f;
+			}
+		}
+		DecodeBlock(x, outputs + begin * 8, pixelCount);
+	}
+}
+}
+
+extern const BakedDecoder BakedDecoder_1024_32 = { "1024_32", 0x8d1c818726095321ull, 14, 8, Decode };
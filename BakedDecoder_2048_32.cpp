@@ -0,0 +1,370 @@
+// Decoder model 2048_32 with its weights as constants, generated by DecoderCompiler from the model
+// hashing to 0x3bdc9ca4ababd4b0. 704 multiply-adds per pixel instead of 704, 0 neurons eliminated.
+// Regenerate with NeuralTexture --bake-decoders, don't edit.
+#include "BakedDecoders.h"
+#include <cmath>
+
+namespace
+{
+const size_t BlockSize = 16;
+
+inline float Relu(float x)
+{
+	return x > 0.0f ? x : 0.0f;
+}
+
+//x holds a block of pixels channel major, y gets the outputs of the first pixelCount pixels
+void DecodeBlock(const float (*x)[BlockSize], float* y, size_t pixelCount)
+{
+	float h0[32][BlockSize];
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[0][p] = Relu(-0.622300625f + 0.620573521f * x[0][p] - 0.39015919f * x[1][p] + 0.498498499f * x[2][p]
+			+ 0.984005928f * x[3][p] - 0.698058784f * x[4][p] + 0.812249184f * x[5][p] - 0.649901032f * x[6][p]
+			+ 0.0739519373f * x[7][p] - 0.433809668f * x[8][p] - 0.472952008f * x[9][p] - 0.664353788f * x[10][p]
+			- 0.216045231f * x[11][p] + 0.0169078782f * x[12][p] + 0.0162463859f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[1][p] = Relu(0.085540466f + 0.161575109f * x[0][p] - 0.13676028f * x[1][p] - 0.334649056f * x[2][p]
+			- 0.0471118502f * x[3][p] - 0.344830483f * x[4][p] - 0.303178489f * x[5][p] + 0.00866779406f * x[6][p]
+			- 0.307191253f * x[7][p] - 0.0263717677f * x[8][p] - 0.295554638f * x[9][p] + 0.0895337984f * x[10][p]
+			- 0.117817737f * x[11][p] + 0.0596485287f * x[12][p] + 0.0270101484f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[2][p] = Relu(-0.0226370133f + 0.307308584f * x[0][p] - 1.31332397f * x[1][p] + 1.20272696f * x[2][p]
+			- 0.0826347023f * x[3][p] + 0.0324662291f * x[4][p] - 0.323640585f * x[5][p] + 1.3424561f * x[6][p]
+			+ 0.504149079f * x[7][p] + 0.0109884972f * x[8][p] - 0.280080587f * x[9][p] + 0.489093482f * x[10][p]
+			- 0.317743152f * x[11][p] - 0.0305464268f * x[12][p] + 0.00584930135f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[3][p] = Relu(-0.26639244f - 0.13698867f * x[0][p] + 0.746816635f * x[1][p] + 0.143151417f * x[2][p]
+			+ 0.683810472f * x[3][p] + 0.297227591f * x[4][p] + 0.103082076f * x[5][p] + 0.244812459f * x[6][p]
+			- 0.366876364f * x[7][p] + 0.094845511f * x[8][p] - 0.186933011f * x[9][p] - 0.456792831f * x[10][p]
+			- 0.533132911f * x[11][p] + 0.0199033041f * x[12][p] - 0.00856588129f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[4][p] = Relu(0.0177771281f + 0.0309340861f * x[0][p] - 0.203243956f * x[1][p] - 0.00754882628f * x[2][p]
+			+ 0.00290261954f * x[3][p] - 0.187966391f * x[4][p] - 0.365278423f * x[5][p] - 0.131736562f * x[6][p]
+			- 0.336582541f * x[7][p] - 0.119379833f * x[8][p] - 0.127503514f * x[9][p] + 0.182841256f * x[10][p]
+			- 0.0592795461f * x[11][p] + 0.0638703257f * x[12][p] - 0.00328639545f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[5][p] = Relu(-0.924994349f + 0.929291129f * x[0][p] + 0.132793844f * x[1][p] + 0.105260611f * x[2][p]
+			- 0.729192138f * x[3][p] + 0.89681828f * x[4][p] + 1.50501382f * x[5][p] + 0.176217839f * x[6][p]
+			- 0.613123119f * x[7][p] + 0.214675918f * x[8][p] - 0.395200491f * x[9][p] - 0.480223358f * x[10][p]
+			- 0.849920213f * x[11][p] + 0.00635138946f * x[12][p] + 0.0293484852f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[6][p] = Relu(-0.102349043f - 0.255636454f * x[0][p] - 0.172005251f * x[1][p] - 0.211975425f * x[2][p]
+			+ 0.0560753942f * x[3][p] - 0.247304305f * x[4][p] + 0.153721273f * x[5][p] + 0.236637324f * x[6][p]
+			- 0.230621323f * x[7][p] - 0.0678307861f * x[8][p] - 0.0147363842f * x[9][p] - 0.205762178f * x[10][p]
+			- 0.0575155318f * x[11][p] - 0.0131631792f * x[12][p] + 0.245428234f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[7][p] = Relu(-0.000131294277f + 0.0146712475f * x[0][p] - 0.0923244804f * x[1][p] - 0.330492318f * x[2][p]
+			- 0.197572038f * x[3][p] + 0.148089573f * x[4][p] - 0.250391155f * x[5][p] + 0.0835408196f * x[6][p]
+			+ 0.0633058399f * x[7][p] - 0.0991620123f * x[8][p] - 0.0109291486f * x[9][p] - 0.241121858f * x[10][p]
+			- 0.189539552f * x[11][p] - 0.0651754811f * x[12][p] + 0.00498248916f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[8][p] = Relu(-0.498158604f + 0.774653554f * x[0][p] + 0.0533838011f * x[1][p] + 0.276017815f * x[2][p]
+			+ 0.625275493f * x[3][p] - 0.46769616f * x[4][p] + 0.72923559f * x[5][p] + 0.31090489f * x[6][p]
+			- 0.584737897f * x[7][p] + 0.00882162806f * x[8][p] - 0.208449468f * x[9][p] + 0.00844289921f * x[10][p]
+			- 0.352663547f * x[11][p] - 0.0271551888f * x[12][p] + 0.0123210009f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[9][p] = Relu(-0.187029004f + 0.414420515f * x[0][p] - 0.0194584634f * x[1][p] - 1.17136371f * x[2][p]
+			+ 0.511091888f * x[3][p] + 0.780194819f * x[4][p] + 0.729183316f * x[5][p] + 0.462716609f * x[6][p]
+			- 0.537782013f * x[7][p] + 0.282569319f * x[8][p] - 0.499247104f * x[9][p] - 0.373014688f * x[10][p]
+			+ 0.134831637f * x[11][p] + 0.00624330249f * x[12][p] + 0.00840264838f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[10][p] = Relu(0.157786772f + 0.485453725f * x[0][p] - 0.38017723f * x[1][p] + 0.414437056f * x[2][p]
+			- 1.2080251f * x[3][p] + 0.156066269f * x[4][p] + 0.414056033f * x[5][p] + 0.166117772f * x[6][p]
+			+ 0.255711764f * x[7][p] + 0.032550212f * x[8][p] + 0.339972615f * x[9][p] + 0.131623775f * x[10][p]
+			- 0.151145607f * x[11][p] - 0.01396049f * x[12][p] + 0.00355145824f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[11][p] = Relu(-0.0918770507f + 0.444138676f * x[0][p] + 0.904901087f * x[1][p] + 0.019302804f * x[2][p]
+			+ 0.424998909f * x[3][p] - 0.487781763f * x[4][p] - 0.718887568f * x[5][p] - 0.446302801f * x[6][p]
+			+ 0.314269125f * x[7][p] - 0.610563755f * x[8][p] + 0.297464043f * x[9][p] - 0.422072947f * x[10][p]
+			- 0.109135568f * x[11][p] - 0.00706795184f * x[12][p] - 0.00549428677f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[12][p] = Relu(0.77739948f - 0.0445416421f * x[0][p] - 0.481981456f * x[1][p] - 1.05533218f * x[2][p]
+			- 0.0679048374f * x[3][p] - 0.294306368f * x[4][p] - 0.128667831f * x[5][p] - 0.0953867584f * x[6][p]
+			+ 0.269941658f * x[7][p] + 0.331708074f * x[8][p] + 0.550073922f * x[9][p] + 0.291953117f * x[10][p]
+			+ 0.580701351f * x[11][p] + 0.00932971854f * x[12][p] + 0.0314625613f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[13][p] = Relu(-0.118363738f + 0.414486498f * x[0][p] - 1.14754033f * x[1][p] + 1.07132864f * x[2][p]
+			+ 0.650800765f * x[3][p] - 0.465971947f * x[4][p] + 0.344197214f * x[5][p] + 0.20362635f * x[6][p]
+			+ 0.254780442f * x[7][p] - 0.621133387f * x[8][p] - 0.245479867f * x[9][p] - 0.182956442f * x[10][p]
+			- 0.610926867f * x[11][p] - 0.0403244272f * x[12][p] - 0.0052191182f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[14][p] = Relu(-0.111397125f - 0.0903852358f * x[0][p] + 0.0227506049f * x[1][p] - 0.275702506f * x[2][p]
+			+ 0.158904374f * x[3][p] - 0.175038695f * x[4][p] + 0.117655963f * x[5][p] - 0.247635275f * x[6][p]
+			+ 0.122554615f * x[7][p] - 0.197817162f * x[8][p] - 0.0613555238f * x[9][p] - 0.202349335f * x[10][p]
+			- 0.302592307f * x[11][p] + 0.262221366f * x[12][p] - 0.0936495811f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[15][p] = Relu(0.456806213f - 0.266627073f * x[0][p] + 0.955092549f * x[1][p] - 0.693930745f * x[2][p]
+			- 0.464003921f * x[3][p] - 0.771536887f * x[4][p] + 0.410142541f * x[5][p] - 0.106411576f * x[6][p]
+			+ 0.0270310957f * x[7][p] + 0.359293729f * x[8][p] + 0.406952053f * x[9][p] + 0.0241932385f * x[10][p]
+			+ 0.489623666f * x[11][p] + 0.0534074455f * x[12][p] - 0.00674090907f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[16][p] = Relu(0.393673956f + 1.09201801f * x[0][p] - 0.750011325f * x[1][p] - 1.44044864f * x[2][p]
+			- 0.0279965326f * x[3][p] - 0.13878572f * x[4][p] - 0.135438144f * x[5][p] + 0.130351961f * x[6][p]
+			- 0.0811629444f * x[7][p] + 0.6996907f * x[8][p] + 0.0303891022f * x[9][p] - 0.353579074f * x[10][p]
+			+ 0.224416628f * x[11][p] + 0.00694338279f * x[12][p] + 0.0116005111f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[17][p] = Relu(0.258988649f - 1.32916999f * x[0][p] - 0.124936394f * x[1][p] + 0.740907013f * x[2][p]
+			+ 0.096911259f * x[3][p] + 0.242744997f * x[4][p] - 0.217197627f * x[5][p] + 0.143109754f * x[6][p]
+			+ 0.3331379f * x[7][p] - 0.183596551f * x[8][p] + 0.269542247f * x[9][p] + 0.244166374f * x[10][p]
+			+ 0.484691799f * x[11][p] - 0.0118817016f * x[12][p] - 0.000467747916f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[18][p] = Relu(0.251045108f + 0.807400644f * x[0][p] - 0.758964717f * x[1][p] - 0.067747198f * x[2][p]
+			+ 0.573006749f * x[3][p] - 0.62058121f * x[4][p] - 0.161920771f * x[5][p] - 0.073782973f * x[6][p]
+			+ 0.583426952f * x[7][p] - 0.528116405f * x[8][p] + 0.395083427f * x[9][p] + 0.148537576f * x[10][p]
+			+ 0.252638429f * x[11][p] - 0.0164681412f * x[12][p] + 0.00436993828f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[19][p] = Relu(-0.230976388f + 0.502963722f * x[0][p] + 0.665197492f * x[1][p] - 0.983106315f * x[2][p]
+			- 0.00467487751f * x[3][p] + 0.455183327f * x[4][p] + 0.121206321f * x[5][p] - 0.110603794f * x[6][p]
+			+ 0.162817389f * x[7][p] + 0.385183036f * x[8][p] - 0.134230196f * x[9][p] - 0.220275208f * x[10][p]
+			+ 0.0963958129f * x[11][p] + 0.0233283248f * x[12][p] + 0.0388379991f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[20][p] = Relu(0.368433803f - 1.00466228f * x[0][p] - 1.06771564f * x[1][p] - 0.411917239f * x[2][p]
+			+ 0.181214198f * x[3][p] + 0.36832419f * x[4][p] + 0.276905358f * x[5][p] + 0.16102013f * x[6][p]
+			+ 0.330905795f * x[7][p] + 0.578833818f * x[8][p] - 0.164901346f * x[9][p] + 0.770265341f * x[10][p]
+			+ 0.530281186f * x[11][p] + 0.0154781956f * x[12][p] + 0.00986698363f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[21][p] = Relu(0.0624378063f - 0.0139301317f * x[0][p] - 0.192264006f * x[1][p] - 0.262733668f * x[2][p]
+			+ 0.0593008734f * x[3][p] - 0.298874825f * x[4][p] - 0.049425032f * x[5][p] + 0.159861088f * x[6][p]
+			- 0.27677989f * x[7][p] - 0.0194096845f * x[8][p] + 0.161518708f * x[9][p] - 0.0332595557f * x[10][p]
+			- 0.257581174f * x[11][p] + 0.0169423614f * x[12][p] + 0.0711300671f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[22][p] = Relu(-0.680026531f + 0.445302725f * x[0][p] + 0.545138896f * x[1][p] + 1.13345206f * x[2][p]
+			+ 0.343764096f * x[3][p] - 0.0516910516f * x[4][p] + 0.0526890978f * x[5][p] + 0.0649794862f * x[6][p]
+			- 0.0952421278f * x[7][p] - 0.220982179f * x[8][p] - 0.00387170794f * x[9][p] - 0.268865943f * x[10][p]
+			- 0.221978605f * x[11][p] - 0.0169862714f * x[12][p] - 0.0206580292f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[23][p] = Relu(0.523167908f - 1.06100702f * x[0][p] - 0.478529543f * x[1][p] - 0.331346661f * x[2][p]
+			+ 0.587321281f * x[3][p] + 0.370144397f * x[4][p] + 0.692164242f * x[5][p] - 0.190339521f * x[6][p]
+			+ 0.210232586f * x[7][p] + 0.401759237f * x[8][p] - 0.0108028427f * x[9][p] + 0.233395681f * x[10][p]
+			+ 0.15822117f * x[11][p] + 0.00350242807f * x[12][p] + 0.00748819858f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[24][p] = Relu(-0.246181369f + 0.0660595f * x[0][p] - 0.0755952373f * x[1][p] + 0.219471157f * x[2][p]
+			- 0.148343638f * x[3][p] - 0.279662073f * x[4][p] - 0.177339122f * x[5][p] + 0.0588799529f * x[6][p]
+			- 0.121314496f * x[7][p] - 0.136138216f * x[8][p] - 0.020126937f * x[9][p] - 0.244544834f * x[10][p]
+			- 0.159046948f * x[11][p] + 0.05891487f * x[12][p] - 0.222847119f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[25][p] = Relu(-0.196724638f + 0.974631965f * x[0][p] - 0.104751341f * x[1][p] - 0.204699785f * x[2][p]
+			- 0.695575535f * x[3][p] + 1.00976419f * x[4][p] + 0.075789474f * x[5][p] + 0.125481158f * x[6][p]
+			- 0.402331114f * x[7][p] + 0.500015616f * x[8][p] - 0.227730229f * x[9][p] - 0.280319273f * x[10][p]
+			+ 0.17512247f * x[11][p] + 0.0362319946f * x[12][p] - 0.00724740885f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[26][p] = Relu(-0.214245304f - 0.0714911222f * x[0][p] - 0.206411242f * x[1][p] - 0.190205216f * x[2][p]
+			- 0.26381126f * x[3][p] - 0.259765178f * x[4][p] - 0.199209884f * x[5][p] - 0.256570518f * x[6][p]
+			+ 0.238200873f * x[7][p] + 0.247232586f * x[8][p] - 0.166558877f * x[9][p] + 0.0311962962f * x[10][p]
+			- 0.241532579f * x[11][p] - 0.145036817f * x[12][p] - 0.202486604f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[27][p] = Relu(0.289412469f + 0.340963632f * x[0][p] - 1.28211415f * x[1][p] + 0.744139373f * x[2][p]
+			- 0.29497242f * x[3][p] - 0.270440459f * x[4][p] + 0.352877468f * x[5][p] + 0.244195893f * x[6][p]
+			+ 0.204272822f * x[7][p] + 0.111720271f * x[8][p] - 0.317222536f * x[9][p] + 0.0534744449f * x[10][p]
+			+ 0.354800135f * x[11][p] - 0.0215731729f * x[12][p] + 0.0339528695f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[28][p] = Relu(-0.306572706f - 0.211635336f * x[0][p] + 1.23818207f * x[1][p] + 0.453325421f * x[2][p]
+			- 0.155149147f * x[3][p] - 0.353347063f * x[4][p] + 0.356570423f * x[5][p] - 0.403661966f * x[6][p]
+			- 0.401543707f * x[7][p] + 0.0204815324f * x[8][p] + 0.248924106f * x[9][p] - 0.18391721f * x[10][p]
+			+ 0.0699415803f * x[11][p] + 0.00295849307f * x[12][p] + 0.024125386f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[29][p] = Relu(0.0178662371f - 0.288603097f * x[0][p] + 0.564464867f * x[1][p] - 0.748451114f * x[2][p]
+			+ 0.847599983f * x[3][p] - 0.816085577f * x[4][p] + 0.835089803f * x[5][p] - 0.0345265493f * x[6][p]
+			+ 0.545060873f * x[7][p] + 0.0476297475f * x[8][p] - 0.0148427468f * x[9][p] - 0.219052851f * x[10][p]
+			- 0.145707995f * x[11][p] + 0.000712538895f * x[12][p] - 0.0094112372f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[30][p] = Relu(0.305025101f + 0.155389532f * x[0][p] - 0.84185493f * x[1][p] + 0.473312646f * x[2][p]
+			- 0.293774217f * x[3][p] - 0.394671291f * x[4][p] + 0.657212555f * x[5][p] + 0.661973834f * x[6][p]
+			- 0.162388295f * x[7][p] - 0.0357218608f * x[8][p] - 0.346169323f * x[9][p] + 0.227636337f * x[10][p]
+			+ 0.0831959546f * x[11][p] - 0.013336706f * x[12][p] + 0.0218253732f * x[13][p]);
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		h0[31][p] = Relu(-0.198321432f - 0.289794683f * x[0][p] - 0.10773918f * x[1][p] + 0.0633614212f * x[2][p]
+			- 0.00536937313f * x[3][p] + 0.133053854f * x[4][p] - 0.0288126394f * x[5][p] + 0.136301905f * x[6][p]
+			- 0.0124982595f * x[7][p] + 0.0223714951f * x[8][p] - 0.205879107f * x[9][p] + 0.00627641426f * x[10][p]
+			+ 0.0638998821f * x[11][p] - 0.0964022428f * x[12][p] + 0.000462949887f * x[13][p]);
+	}
+
+	float s[8][BlockSize];
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[0][p] = 0.158128053f + 0.110838115f * h0[0][p] - 0.142317817f * h0[1][p] + 0.3911286f * h0[2][p]
+			- 0.191891193f * h0[3][p] + 0.0902001709f * h0[4][p] + 0.0589827895f * h0[5][p] + 0.155969486f * h0[6][p]
+			+ 0.133344114f * h0[7][p] - 0.148467436f * h0[8][p] - 0.435221165f * h0[9][p] + 0.101190612f * h0[10][p]
+			- 0.19736737f * h0[11][p] - 0.187054843f * h0[12][p] - 0.0864266753f * h0[13][p] - 0.00991890952f * h0[14][p]
+			- 0.957421601f * h0[15][p] - 0.0324785635f * h0[16][p] + 0.339419365f * h0[17][p] + 0.176763356f * h0[18][p]
+			- 0.162888035f * h0[19][p] + 0.133240566f * h0[20][p] + 0.0165233072f * h0[21][p] + 0.152029052f * h0[22][p]
+			- 0.628367305f * h0[23][p] + 0.169366628f * h0[24][p] + 0.420598686f * h0[25][p] + 0.0737913698f * h0[26][p]
+			+ 0.676894546f * h0[27][p] - 0.405731797f * h0[28][p] - 0.653276145f * h0[29][p] + 0.135192752f * h0[30][p]
+			- 0.113093853f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[1][p] = 0.167681411f + 0.490420222f * h0[0][p] + 0.0605791397f * h0[1][p] + 1.02021205f * h0[2][p]
+			- 0.0950235352f * h0[3][p] + 0.0425995737f * h0[4][p] + 0.0483757704f * h0[5][p] - 0.038371101f * h0[6][p]
+			- 0.246742234f * h0[7][p] + 0.19213827f * h0[8][p] - 0.277791381f * h0[9][p] - 0.0536604784f * h0[10][p]
+			- 0.167368129f * h0[11][p] - 0.394870937f * h0[12][p] - 0.142264053f * h0[13][p] + 0.0938061848f * h0[14][p]
+			- 0.579466343f * h0[15][p] - 0.0322114378f * h0[16][p] - 0.0912480205f * h0[17][p] + 0.478249818f * h0[18][p]
+			- 0.221356496f * h0[19][p] + 0.0814610273f * h0[20][p] + 0.00578265265f * h0[21][p] + 0.268139184f * h0[22][p]
+			- 0.0667464808f * h0[23][p] + 0.116035216f * h0[24][p] - 0.00258016167f * h0[25][p] + 0.0179205388f * h0[26][p]
+			+ 0.940910578f * h0[27][p] - 0.0554084331f * h0[28][p] + 0.212058246f * h0[29][p] + 0.326061934f * h0[30][p]
+			+ 0.159043387f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[2][p] = 0.142127633f - 0.53713876f * h0[0][p] - 0.0531970523f * h0[1][p] + 0.654460311f * h0[2][p]
+			+ 0.00637921458f * h0[3][p] + 0.0542837009f * h0[4][p] + 0.0682249516f * h0[5][p] - 0.116861194f * h0[6][p]
+			+ 0.0334209539f * h0[7][p] + 0.399330318f * h0[8][p] - 0.0357571803f * h0[9][p] + 0.0151643818f * h0[10][p]
+			- 0.0862209126f * h0[11][p] - 0.363931417f * h0[12][p] + 2.0353086f * h0[13][p] + 0.0318676643f * h0[14][p]
+			- 0.414549172f * h0[15][p] - 0.151653767f * h0[16][p] - 0.149647668f * h0[17][p] + 0.591232479f * h0[18][p]
+			- 0.269734561f * h0[19][p] - 0.0870956108f * h0[20][p] - 0.0680374876f * h0[21][p] + 0.285380423f * h0[22][p]
+			+ 0.0982287228f * h0[23][p] - 0.0587718412f * h0[24][p] - 0.182116151f * h0[25][p] - 0.0800724551f * h0[26][p]
+			+ 0.879460335f * h0[27][p] - 0.098708652f * h0[28][p] - 0.302605987f * h0[29][p] + 0.447768718f * h0[30][p]
+			+ 0.0651906133f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[3][p] = 0.908091009f + 0.807749331f * h0[0][p] - 0.0270183198f * h0[1][p] + 0.322787493f * h0[2][p]
+			- 0.63188678f * h0[3][p] + 0.194067553f * h0[4][p] + 5.76205206f * h0[5][p] + 0.124240384f * h0[6][p]
+			+ 0.0125185847f * h0[7][p] - 0.548421144f * h0[8][p] + 0.340179026f * h0[9][p] + 2.29879189f * h0[10][p]
+			- 0.735956788f * h0[11][p] + 1.379372f * h0[12][p] + 1.16500747f * h0[13][p] - 0.0113726361f * h0[14][p]
+			+ 0.685478806f * h0[15][p] - 3.77283406f * h0[16][p] + 0.150849968f * h0[17][p] + 0.0926692188f * h0[18][p]
+			+ 0.631048262f * h0[19][p] - 3.59785271f * h0[20][p] - 0.0289159287f * h0[21][p] - 0.541534185f * h0[22][p]
+			+ 0.334119469f * h0[23][p] - 0.114507325f * h0[24][p] + 1.23224163f * h0[25][p] + 0.0568136275f * h0[26][p]
+			+ 0.554828048f * h0[27][p] - 0.1706101f * h0[28][p] + 0.519112408f * h0[29][p] + 0.310237408f * h0[30][p]
+			- 0.112355232f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[4][p] = 0.0452211462f + 0.0961983725f * h0[0][p] + 0.0188295841f * h0[1][p] + 0.00433137361f * h0[2][p]
+			+ 0.164058879f * h0[3][p] + 0.231568173f * h0[4][p] - 0.028046174f * h0[5][p] - 0.0876608714f * h0[6][p]
+			- 0.107213959f * h0[7][p] + 0.00893148128f * h0[8][p] - 0.429267943f * h0[9][p] + 0.0491403863f * h0[10][p]
+			- 0.177993417f * h0[11][p] - 1.0348804f * h0[12][p] - 0.085667178f * h0[13][p] - 0.0935654044f * h0[14][p]
+			+ 0.0133303357f * h0[15][p] - 0.369133085f * h0[16][p] + 1.329247f * h0[17][p] - 0.989601374f * h0[18][p]
+			- 0.346738607f * h0[19][p] - 0.129708812f * h0[20][p] + 0.0478276052f * h0[21][p] + 0.256750762f * h0[22][p]
+			+ 0.67961657f * h0[23][p] + 0.152049229f * h0[24][p] - 0.232013926f * h0[25][p] + 0.123097464f * h0[26][p]
+			- 0.0139064966f * h0[27][p] + 0.513954461f * h0[28][p] + 0.0431021079f * h0[29][p] + 0.0857272148f * h0[30][p]
+			+ 0.273129016f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[5][p] = -0.104705475f + 0.107065186f * h0[0][p] - 0.00587207312f * h0[1][p] + 0.0433197208f * h0[2][p]
+			- 0.248849899f * h0[3][p] + 0.109945878f * h0[4][p] - 0.0425813012f * h0[5][p] + 0.113567874f * h0[6][p]
+			- 0.030817125f * h0[7][p] - 0.280605018f * h0[8][p] + 0.237801626f * h0[9][p] + 0.0508840233f * h0[10][p]
+			- 0.441487402f * h0[11][p] + 1.0486424f * h0[12][p] + 0.0227655135f * h0[13][p] + 0.000495701039f * h0[14][p]
+			- 0.166283667f * h0[15][p] - 0.293736309f * h0[16][p] + 0.329639614f * h0[17][p] - 0.0857538581f * h0[18][p]
+			- 0.203664079f * h0[19][p] + 0.12779057f * h0[20][p] + 0.128460199f * h0[21][p] - 0.847632706f * h0[22][p]
+			+ 1.05352294f * h0[23][p] + 0.146808892f * h0[24][p] - 0.138098225f * h0[25][p] + 0.0925917178f * h0[26][p]
+			+ 0.286742806f * h0[27][p] - 0.785055935f * h0[28][p] + 0.0817761794f * h0[29][p] + 0.122488603f * h0[30][p]
+			+ 0.0128231784f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[6][p] = 0.351605892f + 0.67312479f * h0[0][p] - 0.169120908f * h0[1][p] + 0.278080165f * h0[2][p]
+			+ 0.0977521986f * h0[3][p] + 0.0816725567f * h0[4][p] + 3.50620866f * h0[5][p] - 0.101589411f * h0[6][p]
+			+ 0.0806897357f * h0[7][p] + 0.5221771f * h0[8][p] + 0.893339097f * h0[9][p] + 0.604429185f * h0[10][p]
+			- 0.484870017f * h0[11][p] - 0.300382972f * h0[12][p] - 0.959014237f * h0[13][p] - 0.0588128306f * h0[14][p]
+			- 0.0738478452f * h0[15][p] - 0.695151389f * h0[16][p] - 0.552936137f * h0[17][p] - 0.494601965f * h0[18][p]
+			+ 0.508459628f * h0[19][p] - 0.629104197f * h0[20][p] - 0.0390120521f * h0[21][p] + 0.309757292f * h0[22][p]
+			- 0.16707094f * h0[23][p] - 0.0411061756f * h0[24][p] + 1.20678258f * h0[25][p] - 0.0909550264f * h0[26][p]
+			+ 0.416817367f * h0[27][p] + 0.254540443f * h0[28][p] + 0.0661493838f * h0[29][p] + 0.358071268f * h0[30][p]
+			- 0.162674233f * h0[31][p];
+	}
+	for (size_t p = 0; p < BlockSize; p++)
+	{
+		s[7][p] = 0.193237245f + 0.0701794922f * h0[0][p] - 0.172861114f * h0[1][p] + 0.091818966f * h0[2][p]
+			- 0.216758713f * h0[3][p] - 0.0412265807f * h0[4][p] + 0.089363277f * h0[5][p] + 0.0428218991f * h0[6][p]
+			- 0.0714636371f * h0[7][p] - 0.126315504f * h0[8][p] - 0.659187138f * h0[9][p] - 0.0128901973f * h0[10][p]
+			- 0.0830829889f * h0[11][p] + 0.597948372f * h0[12][p] - 0.199791968f * h0[13][p] - 0.108398668f * h0[14][p]
+			+ 0.93496418f * h0[15][p] - 0.0616821423f * h0[16][p] - 0.0279515442f * h0[17][p] - 0.0216119699f * h0[18][p]
+			- 0.236853316f * h0[19][p] - 0.0220435299f * h0[20][p] - 0.0997176468f * h0[21][p] - 0.402315646f * h0[22][p]
+			- 0.392702252f * h0[23][p] + 0.119269662f * h0[24][p] - 0.360841334f * h0[25][p] + 0.129023656f * h0[26][p]
+			+ 0.286194146f * h0[27][p] + 0.188414693f * h0[28][p] - 0.0943920538f * h0[29][p] + 0.387018442f * h0[30][p]
+			+ 0.0746098757f * h0[31][p];
+	}
+
+	for (size_t p = 0; p < pixelCount; p++)
+	{
+		for (size_t o = 0; o < 8; o++)
+		{
+			y[p * 8 + o] = 1.0f / (1.0f + std::exp(-s[o][p]));
+		}
+	}
+}
+
+void Decode(const float* inputs, float* outputs, size_t count)
+{
+	float x[14][BlockSize];
+	for (size_t begin = 0; begin < count; begin += BlockSize)
+	{
+		const size_t pixelCount = count - begin < BlockSize ? count - begin : BlockSize;
+		for (size_t i = 0; i < 14; i++)
+		{
+			for (size_t p = 0; p < BlockSize; p++)
+			{
+				x[i][p] = p < pixelCount ? inputs[(begin + p) * 14 + i] : 0.0f;
+			}
+		}
+		DecodeBlock(x, outputs + begin * 8, pixelCount);
+	}
+}
+}
+
+extern const BakedDecoder BakedDecoder_2048_32 = { "2048_32", 0x3bdc9ca4ababd4b0ull, 14, 8, Decode };
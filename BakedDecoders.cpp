@@ -0,0 +1,28 @@
+#include "BakedDecoders.h"
+
+//BakedDecoder_<name>.cpp, written by NeuralTexture --bake-decoders for the models of the material library
+extern const BakedDecoder BakedDecoder_v23;
+extern const BakedDecoder BakedDecoder_1024_32;
+extern const BakedDecoder BakedDecoder_2048_32;
+
+const std::vector<const BakedDecoder*>& GetBakedDecoders()
+{
+	static const std::vector<const BakedDecoder*> decoders = {
+		&BakedDecoder_v23,
+		&BakedDecoder_1024_32,
+		&BakedDecoder_2048_32,
+	};
+	return decoders;
+}
+
+const BakedDecoder* FindBakedDecoder(uint64_t modelHash)
+{
+	for (const BakedDecoder* decoder : GetBakedDecoders())
+	{
+		if (decoder->modelHash == modelHash)
+		{
+			return decoder;
+		}
+	}
+	return nullptr;
+}
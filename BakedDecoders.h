@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Decoder of one model compiled ahead of time by DecoderCompiler, its weights are constants in the code.
+// Only used for a model hashing to modelHash, so a retrained model falls back to the generic kernels.
+struct BakedDecoder
+{
+	const char* name;
+	uint64_t modelHash;
+	int inputCount;
+	int outputCount;
+
+	//same layout as NeuralDecoderCPU::Decode
+	void (*decode)(const float* inputs, float* outputs, size_t count);
+};
+
+//every decoder compiled into the program
+const std::vector<const BakedDecoder*>& GetBakedDecoders();
+
+//baked decoder of the model with HashDecoderModel modelHash, nullptr when there is none
+const BakedDecoder* FindBakedDecoder(uint64_t modelHash);
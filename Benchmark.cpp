@@ -0,0 +1,482 @@
+#include "Benchmark.h"
+#include "RenderBackend.h"
+#include "SoftwareRenderer.h"
+#include "FrameStats.h"
+#include "MemoryTracker.h"
+#include "NeuralModelPool.h"
+#include "Profiler.h"
+#include "nlohmann/json.hpp"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using Json = nlohmann::ordered_json;
+
+static std::vector<std::string> SplitList(const std::string& value)
+{
+	std::vector<std::string> items;
+	std::stringstream stream(value);
+	std::string item;
+	while (std::getline(stream, item, ','))
+	{
+		if (!item.empty())
+		{
+			items.push_back(item);
+		}
+	}
+	return items;
+}
+
+bool BenchmarkSettings::Parse(const std::vector<std::string>& arguments, std::string* error)
+{
+	for (const std::string& argument : arguments)
+	{
+		if (argument == "--cpu")
+		{
+			bSoftware = true;
+			continue;
+		}
+
+		size_t separator = argument.find('=');
+		if (argument.rfind("--", 0) != 0 || separator == std::string::npos)
+		{
+			continue;
+		}
+
+		std::string key = argument.substr(2, separator - 2);
+		std::string value = argument.substr(separator + 1);
+
+		try
+		{
+			if (key == "materials")
+			{
+				materials = SplitList(value);
+			}
+			else if (key == "scales")
+			{
+				scales.clear();
+				for (const std::string& item : SplitList(value))
+				{
+					scales.push_back(std::stof(item));
+				}
+			}
+			else if (key == "resolutions")
+			{
+				resolutions.clear();
+				for (const std::string& item : SplitList(value))
+				{
+					size_t x = item.find('x');
+					if (x == std::string::npos)
+					{
+						throw std::invalid_argument(item);
+					}
+					BenchmarkResolution resolution;
+					resolution.width = (uint32_t)std::stoul(item.substr(0, x));
+					resolution.height = (uint32_t)std::stoul(item.substr(x + 1));
+					if (resolution.width == 0 || resolution.height == 0)
+					{
+						throw std::invalid_argument(item);
+					}
+					resolutions.push_back(resolution);
+				}
+			}
+			else if (key == "warmup")
+			{
+				warmupFrames = (uint32_t)std::stoul(value);
+			}
+			else if (key == "frames")
+			{
+				measuredFrames = (uint32_t)std::stoul(value);
+			}
+			else if (key == "threads")
+			{
+				threadCount = (uint32_t)std::stoul(value);
+			}
+			else if (key == "output")
+			{
+				outputPath = value;
+			}
+			else if (key == "backend")
+			{
+				backend = value;
+			}
+		}
+		catch (const std::exception&)
+		{
+			if (error)
+			{
+				*error = "Invalid value for --" + key + ": " + value;
+			}
+			return false;
+		}
+	}
+	return true;
+}
+
+void BenchmarkSettings::ApplyDefaults(const BenchmarkSettings& defaults)
+{
+	if (materials.empty())
+	{
+		materials = defaults.materials;
+	}
+	if (scales.empty())
+	{
+		scales = defaults.scales;
+	}
+	if (resolutions.empty())
+	{
+		resolutions = defaults.resolutions;
+	}
+	if (warmupFrames == 0)
+	{
+		warmupFrames = defaults.warmupFrames;
+	}
+	if (measuredFrames == 0)
+	{
+		measuredFrames = defaults.measuredFrames;
+	}
+}
+
+bool IsBenchmarkRequested(const std::vector<std::string>& arguments)
+{
+	for (const std::string& argument : arguments)
+	{
+		if (argument == "--benchmark")
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static Json ToJson(const TimingStatistics& stats)
+{
+	Json json;
+	json["mean"] = stats.mean;
+	json["p50"] = stats.p50;
+	json["p90"] = stats.p90;
+	json["p99"] = stats.p99;
+	json["max"] = stats.max;
+	return json;
+}
+
+//memory reported under the material name, per category
+static Json GetMaterialMemory(const std::string& owner)
+{
+	Json json;
+	for (const MemoryOwnerUsage& usage : MemoryTracker::Get().GetOwnerUsage())
+	{
+		if (usage.owner != owner)
+		{
+			continue;
+		}
+
+		uint64_t domainBytes[(int)MemoryDomain::Count] = {};
+		Json categories = Json::object();
+		for (int i = 0; i < (int)MemoryCategory::Count; i++)
+		{
+			if (usage.bytes[i] > 0)
+			{
+				categories[GetMemoryCategoryName((MemoryCategory)i)] = usage.bytes[i];
+				domainBytes[(int)GetMemoryDomain((MemoryCategory)i)] += usage.bytes[i];
+			}
+		}
+
+		json["totalBytes"] = usage.GetTotal();
+		json["gpuBytes"] = domainBytes[(int)MemoryDomain::GPU];
+		json["cpuBytes"] = domainBytes[(int)MemoryDomain::CPU];
+		json["categories"] = categories;
+	}
+	return json;
+}
+
+static Json RunScenario(BenchmarkTarget& target, const BenchmarkSettings& settings, const BenchmarkResolution& resolution, float scale)
+{
+	PROFILE_ZONE("Benchmark::Scenario");
+
+	RectConstantBuffer constants;
+	constants.scale = scale;
+
+	for (uint32_t i = 0; i < settings.warmupFrames; i++)
+	{
+		target.RenderFrame(constants);
+	}
+
+	std::vector<float> frameTimes;
+	std::vector<float> gpuTimes;
+	std::vector<float> decodeTimes;
+	for (uint32_t i = 0; i < settings.measuredFrames; i++)
+	{
+		BenchmarkFrame frame = target.RenderFrame(constants);
+		frameTimes.push_back((float)frame.frameMs);
+		gpuTimes.push_back((float)frame.gpuMs);
+		decodeTimes.push_back((float)frame.decodeMs);
+	}
+
+	TimingStatistics frameStats = ComputeTimingStatistics(frameTimes);
+	TimingStatistics gpuStats = ComputeTimingStatistics(gpuTimes);
+	TimingStatistics decodeStats = ComputeTimingStatistics(decodeTimes);
+
+	double pixels = (double)resolution.width * resolution.height;
+
+	Json scenario;
+	scenario["width"] = resolution.width;
+	scenario["height"] = resolution.height;
+	scenario["scale"] = scale;
+	scenario["frames"] = settings.measuredFrames;
+	scenario["frameMs"] = ToJson(frameStats);
+	scenario["gpuMs"] = ToJson(gpuStats);
+	scenario["decodeMs"] = ToJson(decodeStats);
+	//medians, robust against the odd hitch
+	scenario["frameNsPerPixel"] = frameStats.p50 * 1.0e6 / pixels;
+	scenario["decodeNsPerPixel"] = decodeStats.p50 * 1.0e6 / pixels;
+
+	std::cout << "[benchmark] " << resolution.width << "x" << resolution.height << " scale " << scale
+		<< ": frame p50 " << frameStats.p50 << "ms, decode " << decodeStats.p50 * 1.0e6 / pixels << "ns/pixel" << std::endl;
+
+	return scenario;
+}
+
+bool RunBenchmark(BenchmarkTarget& target, const BenchmarkSettings& settings)
+{
+	PROFILE_ZONE("RunBenchmark");
+
+	Json report;
+	report["target"] = target.GetName();
+	report["warmupFrames"] = settings.warmupFrames;
+	report["measuredFrames"] = settings.measuredFrames;
+	report["materials"] = Json::array();
+
+	std::vector<std::string> names = settings.materials;
+	if (names.empty())
+	{
+		for (const MaterialDesc& desc : GetMaterialLibrary())
+		{
+			names.push_back(desc.name);
+		}
+	}
+
+	for (const std::string& name : names)
+	{
+		Json material;
+		material["name"] = name;
+
+		const MaterialDesc* desc = FindMaterialDesc(name);
+		if (desc == nullptr)
+		{
+			material["loaded"] = false;
+			material["error"] = "Unknown material";
+			report["materials"].push_back(material);
+			continue;
+		}
+		material["shader"] = GetMaterialShaderName(desc->shader);
+
+		std::cout << "[benchmark] " << target.GetName() << ": " << name << std::endl;
+
+		std::string error;
+		auto loadStart = std::chrono::steady_clock::now();
+		bool bLoaded;
+		{
+			MemoryTracker::OwnerScope memoryOwner(name);
+			bLoaded = target.LoadMaterial(*desc, &error);
+		}
+		double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+
+		material["loaded"] = bLoaded;
+		if (!bLoaded)
+		{
+			std::cout << "[benchmark] skipped " << name << ": " << error << std::endl;
+			material["error"] = error;
+			report["materials"].push_back(material);
+			continue;
+		}
+		material["loadMs"] = loadMs;
+
+		Json scenarios = Json::array();
+		for (const BenchmarkResolution& resolution : settings.resolutions)
+		{
+			target.SetResolution(resolution.width, resolution.height);
+			for (float scale : settings.scales)
+			{
+				scenarios.push_back(RunScenario(target, settings, resolution, scale));
+			}
+		}
+
+		//after the scenarios, some buffers are only created on first draw
+		material["memory"] = GetMaterialMemory(name);
+		material["scenarios"] = scenarios;
+
+		target.UnloadMaterial();
+		report["materials"].push_back(material);
+	}
+
+	std::ofstream file(settings.outputPath);
+	if (!file)
+	{
+		std::cout << "[benchmark] can't write " << settings.outputPath << std::endl;
+		return false;
+	}
+	file << report.dump(2) << std::endl;
+
+	std::cout << "[benchmark] wrote " << settings.outputPath << std::endl;
+	return true;
+}
+
+SoftwareBenchmarkTarget::SoftwareBenchmarkTarget(uint32_t threadCount)
+	: renderer(std::make_unique<SoftwareRenderer>(threadCount))
+{
+}
+
+SoftwareBenchmarkTarget::~SoftwareBenchmarkTarget() = default;
+
+std::string SoftwareBenchmarkTarget::GetName() const
+{
+	return "Software (" + std::to_string(renderer->GetThreadCount()) + " threads)";
+}
+
+static BenchmarkSettings GetSoftwareDefaultSettings()
+{
+	//a few frames are plenty, a cpu frame is far more stable than a gpu one
+	BenchmarkSettings defaults;
+	defaults.scales = { 0.5f, 1.0f, 2.0f };
+	defaults.resolutions = { { 480, 270 } };
+	defaults.warmupFrames = 1;
+	defaults.measuredFrames = 5;
+	return defaults;
+}
+
+BenchmarkSettings SoftwareBenchmarkTarget::GetDefaultSettings() const
+{
+	return GetSoftwareDefaultSettings();
+}
+
+bool SoftwareBenchmarkTarget::LoadMaterial(const MaterialDesc& desc, std::string* error)
+{
+	material = SoftwareMaterial::Create(desc, error);
+	return material != nullptr;
+}
+
+void SoftwareBenchmarkTarget::UnloadMaterial()
+{
+	material.reset();
+}
+
+void SoftwareBenchmarkTarget::SetResolution(uint32_t inWidth, uint32_t inHeight)
+{
+	width = inWidth;
+	height = inHeight;
+}
+
+BenchmarkFrame SoftwareBenchmarkTarget::RenderFrame(const RectConstantBuffer& constants)
+{
+	SoftwareRenderStats stats;
+	renderer->Render(*material, constants, width, height, image, &stats);
+
+	BenchmarkFrame frame;
+	frame.frameMs = stats.totalMs;
+	frame.decodeMs = stats.sampleMs + stats.decodeMs;
+	return frame;
+}
+
+int RunSoftwareBenchmark(const std::vector<std::string>& arguments)
+{
+	BenchmarkSettings settings;
+	std::string error;
+	if (!settings.Parse(arguments, &error))
+	{
+		std::cout << error << std::endl;
+		return 1;
+	}
+
+	if (!settings.backend.empty())
+	{
+		std::unique_ptr<RenderBackend> backend = CreateHeadlessBackend(settings.backend, settings.threadCount, &error);
+		if (!backend)
+		{
+			std::cout << error << std::endl;
+			return 1;
+		}
+		return RunBackendBenchmark(*backend, settings, GetSoftwareDefaultSettings());
+	}
+
+	SoftwareBenchmarkTarget target(settings.threadCount);
+	settings.ApplyDefaults(target.GetDefaultSettings());
+
+	return RunBenchmark(target, settings) ? 0 : 1;
+}
+
+BackendBenchmarkTarget::BackendBenchmarkTarget(RenderBackend& inBackend, const BenchmarkSettings& inDefaults)
+	: backend(inBackend), defaults(inDefaults)
+{
+}
+
+BackendBenchmarkTarget::~BackendBenchmarkTarget()
+{
+	UnloadMaterial();
+}
+
+std::string BackendBenchmarkTarget::GetName() const
+{
+	return backend.GetName() + " backend";
+}
+
+BenchmarkSettings BackendBenchmarkTarget::GetDefaultSettings() const
+{
+	return defaults;
+}
+
+bool BackendBenchmarkTarget::LoadMaterial(const MaterialDesc& desc, std::string* error)
+{
+	material = BackendMaterial::Create(backend, desc, error);
+	if (!material)
+	{
+		return false;
+	}
+
+	//load time includes getting the textures onto the gpu
+	backend.BeginFrame();
+	backend.EndFrame();
+	backend.WaitForIdle();
+	return true;
+}
+
+void BackendBenchmarkTarget::UnloadMaterial()
+{
+	//frames in flight may still reference the material
+	backend.WaitForIdle();
+	material.reset();
+
+	//the next material loads its decoder again, its memory is reported under that material
+	NeuralModelPool::Get().Collect();
+}
+
+void BackendBenchmarkTarget::SetResolution(uint32_t width, uint32_t height)
+{
+	backend.SetResolution(width, height);
+}
+
+BenchmarkFrame BackendBenchmarkTarget::RenderFrame(const RectConstantBuffer& constants)
+{
+	PROFILE_ZONE("Benchmark::Frame");
+
+	auto start = std::chrono::steady_clock::now();
+
+	backend.BeginFrame();
+	material->Draw(constants);
+	backend.EndFrame();
+
+	BenchmarkFrame frame;
+	frame.frameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	frame.gpuMs = backend.GetLastGpuMs();
+	frame.decodeMs = backend.GetLastDecodeMs();
+	return frame;
+}
+
+int RunBackendBenchmark(RenderBackend& backend, BenchmarkSettings settings, const BenchmarkSettings& defaults)
+{
+	BackendBenchmarkTarget target(backend, defaults);
+	settings.ApplyDefaults(target.GetDefaultSettings());
+
+	return RunBenchmark(target, settings) ? 0 : 1;
+}
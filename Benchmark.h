@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ConstantBuffers.h"
+#include "MaterialLibrary.h"
+
+struct BenchmarkResolution
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+};
+
+// What to run, parsed from --key=value arguments.
+// Empty lists and 0 counts mean the defaults of the target.
+struct BenchmarkSettings
+{
+	//material names, all materials of the library when empty
+	std::vector<std::string> materials;
+	std::vector<float> scales;
+	std::vector<BenchmarkResolution> resolutions;
+
+	uint32_t warmupFrames = 0;
+	uint32_t measuredFrames = 0;
+
+	//worker threads of the cpu reference renderer, 0 for all hardware threads
+	uint32_t threadCount = 0;
+
+	std::string outputPath = "benchmark.json";
+
+	//run on the cpu reference renderer even when a device is available
+	bool bSoftware = false;
+
+	//run through a RenderBackend (null, software or d3d12) instead of the dedicated targets
+	std::string backend;
+
+	//returns false and fills error on malformed values, unknown keys are left for other modes
+	bool Parse(const std::vector<std::string>& arguments, std::string* error = nullptr);
+
+	//fill empty settings with the defaults of a target
+	void ApplyDefaults(const BenchmarkSettings& defaults);
+};
+
+// Result of one rendered frame, in milliseconds
+struct BenchmarkFrame
+{
+	//wall time of the whole frame on the cpu
+	double frameMs = 0.0;
+	//gpu timestamps around the frame, 0 on the cpu
+	double gpuMs = 0.0;
+	//time spent producing material inputs, texture sampling or neural decode
+	double decodeMs = 0.0;
+};
+
+// Something benchmark scenarios can run on, the d3d12 viewer or the cpu reference renderer.
+// The scenario loop in RunBenchmark only talks to this interface.
+class BenchmarkTarget
+{
+public:
+	virtual ~BenchmarkTarget() = default;
+
+	virtual std::string GetName() const = 0;
+
+	virtual BenchmarkSettings GetDefaultSettings() const = 0;
+
+	//returns false and fills error when the material can't be used on this target
+	virtual bool LoadMaterial(const MaterialDesc& desc, std::string* error) = 0;
+	virtual void UnloadMaterial() = 0;
+
+	virtual void SetResolution(uint32_t width, uint32_t height) = 0;
+
+	virtual BenchmarkFrame RenderFrame(const RectConstantBuffer& constants) = 0;
+};
+
+// Runs every material x resolution x scale scenario on the cpu reference renderer
+class SoftwareBenchmarkTarget : public BenchmarkTarget
+{
+public:
+	explicit SoftwareBenchmarkTarget(uint32_t threadCount = 0);
+	~SoftwareBenchmarkTarget();
+
+	std::string GetName() const override;
+	BenchmarkSettings GetDefaultSettings() const override;
+
+	bool LoadMaterial(const MaterialDesc& desc, std::string* error) override;
+	void UnloadMaterial() override;
+
+	void SetResolution(uint32_t width, uint32_t height) override;
+
+	BenchmarkFrame RenderFrame(const RectConstantBuffer& constants) override;
+
+private:
+	std::unique_ptr<class SoftwareRenderer> renderer;
+	std::shared_ptr<struct SoftwareMaterial> material;
+
+	uint32_t width = 0;
+	uint32_t height = 0;
+	std::vector<float> image;
+};
+
+// Runs the scenarios through a RenderBackend, the same material and draw code on every backend.
+// On the null backend the frame time is the cpu cost of the pipeline itself
+class BackendBenchmarkTarget : public BenchmarkTarget
+{
+public:
+	BackendBenchmarkTarget(class RenderBackend& inBackend, const BenchmarkSettings& inDefaults);
+	~BackendBenchmarkTarget();
+
+	std::string GetName() const override;
+	BenchmarkSettings GetDefaultSettings() const override;
+
+	bool LoadMaterial(const MaterialDesc& desc, std::string* error) override;
+	void UnloadMaterial() override;
+
+	void SetResolution(uint32_t width, uint32_t height) override;
+
+	BenchmarkFrame RenderFrame(const RectConstantBuffer& constants) override;
+
+private:
+	class RenderBackend& backend;
+	BenchmarkSettings defaults;
+	std::unique_ptr<class BackendMaterial> material;
+};
+
+//true when arguments ask for the benchmark
+bool IsBenchmarkRequested(const std::vector<std::string>& arguments);
+
+//run every scenario on target and write the json report, returns false when nothing could be written
+bool RunBenchmark(BenchmarkTarget& target, const BenchmarkSettings& settings);
+
+//--benchmark on the cpu reference renderer, or on the null or software backend with --backend=name.
+//Returns the process exit code
+int RunSoftwareBenchmark(const std::vector<std::string>& arguments);
+
+//scenarios of settings through backend, returns the process exit code
+int RunBackendBenchmark(class RenderBackend& backend, BenchmarkSettings settings, const BenchmarkSettings& defaults);
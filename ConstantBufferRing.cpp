@@ -0,0 +1,71 @@
+#include "ConstantBufferRing.h"
+#include "d3dx12.h"
+#include "Graphics.h"
+#include "MemoryTracker.h"
+
+ConstantBufferRing::~ConstantBufferRing()
+{
+	Release();
+}
+
+void ConstantBufferRing::Initialize(ID3D12Device* device, UINT frameCount, UINT sliceSize)
+{
+	this->frameCount = frameCount;
+	this->sliceSize = (sliceSize + D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1) & ~(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1);
+
+	UINT64 bufferSize = (UINT64)this->sliceSize * frameCount;
+	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
+	CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(bufferSize);
+	CHECKHR(device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&buffer)));
+
+	//never read on the cpu, mapped until release
+	D3D12_RANGE readRange = { 0, 0 };
+	CHECKHR(buffer->Map(0, &readRange, (void**)&cpuAddress));
+	gpuAddress = buffer->GetGPUVirtualAddress();
+
+	trackedBytes = bufferSize;
+	MemoryTracker::Get().Allocate(MemoryCategory::ConstantBuffer, trackedBytes);
+
+	BeginFrame(0);
+}
+
+void ConstantBufferRing::Release()
+{
+	if (buffer)
+	{
+		buffer->Unmap(0, nullptr);
+		buffer.Reset();
+		cpuAddress = nullptr;
+		gpuAddress = 0;
+	}
+	if (trackedBytes)
+	{
+		MemoryTracker::Get().Free(MemoryCategory::ConstantBuffer, trackedBytes);
+		trackedBytes = 0;
+	}
+}
+
+void ConstantBufferRing::BeginFrame(UINT frameIndex)
+{
+	sliceStart = (frameIndex % frameCount) * sliceSize;
+	offset = 0;
+}
+
+bool ConstantBufferRing::Allocate(UINT size, Allocation& outAllocation)
+{
+	UINT alignedSize = (size + D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1) & ~(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1);
+	if (!buffer || offset + alignedSize > sliceSize)
+	{
+		return false;
+	}
+
+	outAllocation.cpuAddress = cpuAddress + sliceStart + offset;
+	outAllocation.gpuAddress = gpuAddress + sliceStart + offset;
+
+	offset += alignedSize;
+	if (offset > peakBytes)
+	{
+		peakBytes = offset;
+	}
+	return true;
+}
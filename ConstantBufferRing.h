@@ -0,0 +1,52 @@
+#pragma once
+#include <wrl\client.h>
+#include <d3d12.h>
+
+// Persistently mapped upload buffer with one slice per frame in flight.
+// Draws take the next 256 byte aligned range of the current frame's slice and bind it as a root CBV,
+// so setting constants is a pointer bump and a memcpy. Slices follow the frame contexts, a slice is
+// written again once the fence of the frame that last used it completed.
+class ConstantBufferRing
+{
+public:
+	static const UINT DefaultSliceSize = 64 * 1024;
+
+	struct Allocation
+	{
+		void* cpuAddress = nullptr;
+		D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;
+	};
+
+	~ConstantBufferRing();
+
+	void Initialize(ID3D12Device* device, UINT frameCount, UINT sliceSize = DefaultSliceSize);
+
+	void Release();
+
+	//start writing to the slice of frameIndex, its previous contents must no longer be in use
+	void BeginFrame(UINT frameIndex);
+
+	//false when the slice of this frame is used up
+	bool Allocate(UINT size, Allocation& outAllocation);
+
+	UINT GetSliceSize() const { return sliceSize; }
+
+	//bytes taken from the current slice, most taken by any frame
+	UINT GetUsedBytes() const { return offset; }
+	UINT GetPeakBytes() const { return peakBytes; }
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12Resource> buffer;
+	UINT8* cpuAddress = nullptr;
+	D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;
+
+	UINT frameCount = 0;
+	UINT sliceSize = 0;
+
+	//start of the current slice and the bump offset inside it
+	UINT sliceStart = 0;
+	UINT offset = 0;
+	UINT peakBytes = 0;
+
+	UINT64 trackedBytes = 0;
+};
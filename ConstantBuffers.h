@@ -0,0 +1,14 @@
+#pragma once
+
+// Constants of the full screen rect pass, shared by the gpu pixel shader and the cpu reference renderer.
+// Layout matches the $Globals of PixelShader.hlsl.
+struct RectConstantBuffer
+{
+	float scale = 1.f;
+	float intensity = 2.5f;
+	float lightpos = 0.f;
+	float metalness = 0.0f;
+
+	//padding 256 byte alignment
+	float padding[60];
+};
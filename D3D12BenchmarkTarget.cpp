@@ -0,0 +1,145 @@
+#include "D3D12BenchmarkTarget.h"
+#include "Graphics.h"
+#include "Window.h"
+#include "Texture2D.h"
+#include "D3D12RenderBackend.h"
+#include "NeuralModelPool.h"
+#include "Profiler.h"
+#include <chrono>
+#include <iostream>
+
+D3D12BenchmarkTarget::D3D12BenchmarkTarget(D3D12GraphicsDevice& inDevice, Window& inWindow)
+	: device(inDevice), window(inWindow)
+{
+	//measure the gpu, not the display
+	previousVsync = device.GetVsync();
+	device.SetVsync(0);
+}
+
+D3D12BenchmarkTarget::~D3D12BenchmarkTarget()
+{
+	device.SetVsync(previousVsync);
+}
+
+std::string D3D12BenchmarkTarget::GetName() const
+{
+	return "D3D12";
+}
+
+BenchmarkSettings D3D12BenchmarkTarget::GetDefaultSettings() const
+{
+	BenchmarkSettings defaults;
+	defaults.scales = { 0.5f, 1.0f, 2.0f };
+	defaults.resolutions = { { 1280, 720 }, { 1920, 1080 }, { 2560, 1440 } };
+	defaults.warmupFrames = 60;
+	defaults.measuredFrames = 300;
+	return defaults;
+}
+
+void D3D12BenchmarkTarget::FlushUploads()
+{
+	window.Update(0.0f);
+
+	device.PreRender();
+	device.Render(0.0f);
+	device.Present();
+	device.PostRender();
+
+	//the copies are only done once the frame finished, not just submitted
+	device.WaitForGpu();
+}
+
+bool D3D12BenchmarkTarget::LoadMaterial(const MaterialDesc& desc, std::string* error)
+{
+	try
+	{
+		material = CreateMaterial(device, desc);
+	}
+	catch (const std::exception& exception)
+	{
+		*error = exception.what();
+		return false;
+	}
+
+	for (const TextureSlot& slot : material->GetTextureSlots())
+	{
+		if (slot.texture == nullptr)
+		{
+			*error = "Texture " + slot.name + " failed to load";
+			material.reset();
+			return false;
+		}
+	}
+
+	//load time includes getting the textures onto the gpu
+	FlushUploads();
+	return true;
+}
+
+void D3D12BenchmarkTarget::UnloadMaterial()
+{
+	//frames in flight may still reference the material
+	device.WaitForGpu();
+	material.reset();
+
+	//the next material loads its decoder again, its memory is reported under that material
+	NeuralModelPool::Get().Collect();
+}
+
+void D3D12BenchmarkTarget::SetResolution(uint32_t width, uint32_t height)
+{
+	window.Resize((int)width, (int)height);
+	device.Resize((int)width, (int)height);
+}
+
+BenchmarkFrame D3D12BenchmarkTarget::RenderFrame(const RectConstantBuffer& constants)
+{
+	PROFILE_ZONE("Benchmark::Frame");
+
+	auto start = std::chrono::steady_clock::now();
+
+	window.Update(0.0f);
+
+	device.rectConstantBuffer = constants;
+
+	device.PreRender();
+	device.DrawFullScreenRect(material);
+	device.Render(0.0f);
+	device.Present();
+	device.PostRender();
+
+	BenchmarkFrame frame;
+	frame.frameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	frame.gpuMs = device.GetLastFrameTimings().gpuMs;
+	//decode and shading share one pass on the gpu
+	frame.decodeMs = frame.gpuMs;
+	return frame;
+}
+
+int RunD3D12Benchmark(D3D12GraphicsDevice& device, Window& window, const std::vector<std::string>& arguments)
+{
+	BenchmarkSettings settings;
+	std::string error;
+	if (!settings.Parse(arguments, &error))
+	{
+		std::cout << error << std::endl;
+		return 1;
+	}
+
+	//the cpu backends don't need the window
+	if (!settings.backend.empty() && settings.backend != "d3d12")
+	{
+		return RunSoftwareBenchmark(arguments);
+	}
+
+	D3D12BenchmarkTarget target(device, window);
+	if (settings.backend == "d3d12")
+	{
+		//same scenarios through the backend interface, vsync stays off while target lives
+		D3D12RenderBackend backend(device, window);
+		return RunBackendBenchmark(backend, settings, target.GetDefaultSettings());
+	}
+	settings.ApplyDefaults(target.GetDefaultSettings());
+
+	return RunBenchmark(target, settings) ? 0 : 1;
+}
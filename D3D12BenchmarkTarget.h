@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Benchmark.h"
+#include "Material.h"
+
+// Runs benchmark scenarios on the d3d12 viewer, without imgui and with vsync off
+class D3D12BenchmarkTarget : public BenchmarkTarget
+{
+public:
+	D3D12BenchmarkTarget(class D3D12GraphicsDevice& inDevice, class Window& inWindow);
+	~D3D12BenchmarkTarget();
+
+	std::string GetName() const override;
+	BenchmarkSettings GetDefaultSettings() const override;
+
+	bool LoadMaterial(const MaterialDesc& desc, std::string* error) override;
+	void UnloadMaterial() override;
+
+	void SetResolution(uint32_t width, uint32_t height) override;
+
+	BenchmarkFrame RenderFrame(const RectConstantBuffer& constants) override;
+
+private:
+	//one frame that only runs queued render commands, flushes texture uploads
+	void FlushUploads();
+
+	class D3D12GraphicsDevice& device;
+	class Window& window;
+
+	MaterialPtr material;
+
+	uint32_t previousVsync = 1;
+};
+
+//--benchmark on the d3d12 device, --backend=d3d12 runs it through D3D12RenderBackend and
+//--backend=null|software on the cpu. Returns the process exit code
+int RunD3D12Benchmark(class D3D12GraphicsDevice& device, class Window& window, const std::vector<std::string>& arguments);
@@ -0,0 +1,242 @@
+#include "D3D12RenderBackend.h"
+#include "Graphics.h"
+#include "Window.h"
+#include "Texture2D.h"
+#include "StructuredBuffer.h"
+#include "Material.h"
+#include "Shader.h"
+#include "Profiler.h"
+
+D3D12RenderBackend::D3D12RenderBackend(D3D12GraphicsDevice& inDevice, Window& inWindow)
+	: device(inDevice), window(inWindow)
+{
+}
+
+D3D12RenderBackend::~D3D12RenderBackend()
+{
+	//nothing submitted through the backend may still be read once it's gone
+	device.WaitForGpu();
+	for (auto& table : tables)
+	{
+		heapAllocator.Free(table.second.descriptors);
+	}
+}
+
+std::string D3D12RenderBackend::GetName() const
+{
+	return "D3D12";
+}
+
+BackendTexture D3D12RenderBackend::CreateTexture(const std::string& path, const std::string& name, std::string* error)
+{
+	PROFILE_ZONE("D3D12RenderBackend::CreateTexture");
+
+	BackendTexture handle;
+	Texture2DPtr texture = LoadMaterialTexture(device, path);
+	if (!texture)
+	{
+		if (error)
+		{
+			*error = "Failed to load texture " + name + ": " + path;
+		}
+		return handle;
+	}
+
+	handle.id = nextId++;
+	textures[handle.id] = texture;
+	return handle;
+}
+
+BackendBuffer D3D12RenderBackend::CreateBuffer(const void* data, size_t elementSize, size_t elementCount, MemoryCategory category, const std::string&)
+{
+	auto buffer = std::make_shared<StructuredBuffer>();
+
+	//the caller's data is gone by the time the upload runs
+	const uint8_t* bytes = (const uint8_t*)data;
+	std::vector<uint8_t> copy(bytes, bytes + elementSize * elementCount);
+	std::string memoryOwner = MemoryTracker::GetCurrentOwner();
+	device.AddRenderCommand([buffer, copy = std::move(copy), elementSize, elementCount, category, memoryOwner](D3D12GraphicsDevice& device)
+	{
+		MemoryTracker::OwnerScope ownerScope(memoryOwner);
+		buffer->Initialize(device, const_cast<uint8_t*>(copy.data()), elementSize, elementCount, category);
+	});
+
+	BackendBuffer handle;
+	handle.id = nextId++;
+	buffers[handle.id] = buffer;
+	return handle;
+}
+
+BackendDescriptorTable D3D12RenderBackend::CreateDescriptorTable(const std::vector<BackendTexture>& tableTextures, const std::vector<BackendBuffer>& tableBuffers)
+{
+	BackendDescriptorTable handle;
+
+	Table table;
+	for (BackendTexture texture : tableTextures)
+	{
+		auto it = textures.find(texture.id);
+		if (it == textures.end())
+		{
+			return handle;
+		}
+		table.textures.push_back(it->second);
+	}
+	for (BackendBuffer buffer : tableBuffers)
+	{
+		auto it = buffers.find(buffer.id);
+		if (it == buffers.end())
+		{
+			return handle;
+		}
+		table.buffers.push_back(it->second);
+	}
+
+	handle.id = nextId++;
+	tables[handle.id] = std::move(table);
+	return handle;
+}
+
+void D3D12RenderBackend::Destroy(BackendTexture texture)
+{
+	auto it = textures.find(texture.id);
+	if (it != textures.end())
+	{
+		device.DeferRelease(it->second);
+		textures.erase(it);
+	}
+}
+
+void D3D12RenderBackend::Destroy(BackendBuffer buffer)
+{
+	auto it = buffers.find(buffer.id);
+	if (it != buffers.end())
+	{
+		device.DeferRelease(it->second);
+		buffers.erase(it);
+	}
+}
+
+void D3D12RenderBackend::Destroy(BackendDescriptorTable table)
+{
+	auto it = tables.find(table.id);
+	if (it != tables.end())
+	{
+		//the sources are only referenced by the views, those live until the fence passes with the range
+		heapAllocator.Free(it->second.descriptors);
+		tables.erase(it);
+	}
+}
+
+void D3D12RenderBackend::SetResolution(uint32_t width, uint32_t height)
+{
+	window.Resize((int)width, (int)height);
+	device.Resize((int)width, (int)height);
+}
+
+void D3D12RenderBackend::BeginFrame()
+{
+	window.Update(0.0f);
+	device.PreRender();
+
+	//uploads queued since the last frame are recorded ahead of the draws
+	device.Render(0.0f);
+}
+
+void D3D12RenderBackend::Draw(const BackendDraw& draw)
+{
+	PROFILE_ZONE("D3D12RenderBackend::Draw");
+
+	auto it = tables.find(draw.table.id);
+	if (it == tables.end() || !UpdateTable(it->second))
+	{
+		return;
+	}
+
+	const MaterialPtr& pipeline = GetPipeline(draw.shader);
+	D3D12_GPU_DESCRIPTOR_HANDLE srvTable = heapAllocator.GetGpuHandle(it->second.descriptors);
+	device.DrawFullScreenRect(pipeline->pso->PSO, [&pipeline, srvTable, constants = draw.constants](D3D12GraphicsDevice& device)
+	{
+		pipeline->pixelShader->SetShaderParameters(device, srvTable, constants);
+	});
+}
+
+uint64_t D3D12RenderBackend::EndFrame()
+{
+	//draws added after BeginFrame
+	device.Render(0.0f);
+	device.Present();
+	device.PostRender();
+	return device.GetLastSubmittedFenceValue();
+}
+
+uint64_t D3D12RenderBackend::GetCompletedFenceValue()
+{
+	return device.GetCompletedFenceValue();
+}
+
+uint64_t D3D12RenderBackend::GetLastSubmittedFenceValue() const
+{
+	return device.GetLastSubmittedFenceValue();
+}
+
+void D3D12RenderBackend::WaitForFence(uint64_t fenceValue)
+{
+	device.WaitForFence(fenceValue);
+}
+
+double D3D12RenderBackend::GetLastGpuMs() const
+{
+	return device.GetLastFrameTimings().gpuMs;
+}
+
+bool D3D12RenderBackend::ReadFrame(std::vector<uint8_t>&, uint32_t&, uint32_t&)
+{
+	return false;
+}
+
+bool D3D12RenderBackend::UpdateTable(Table& table)
+{
+	if (heapAllocator.IsValid(table.descriptors))
+	{
+		return true;
+	}
+
+	//a buffer has no resource until its upload command ran
+	for (const StructuredBufferPtr& buffer : table.buffers)
+	{
+		if (!buffer->bufferResource)
+		{
+			return false;
+		}
+	}
+
+	table.descriptors = heapAllocator.Alloc((UINT)(table.textures.size() + table.buffers.size()), "Backend srv table");
+	if (!heapAllocator.IsValid(table.descriptors))
+	{
+		return false;
+	}
+
+	UINT offset = 0;
+	for (const Texture2DPtr& texture : table.textures)
+	{
+		texture->CreateView(device, heapAllocator.GetCpuHandle(table.descriptors, offset++));
+	}
+	for (const StructuredBufferPtr& buffer : table.buffers)
+	{
+		buffer->CreateView(device, heapAllocator.GetCpuHandle(table.descriptors, offset++));
+	}
+	return true;
+}
+
+const MaterialPtr& D3D12RenderBackend::GetPipeline(MaterialShader shader)
+{
+	MaterialPtr& pipeline = pipelines[shader];
+	if (!pipeline)
+	{
+		pipeline = std::make_shared<Material>();
+		pipeline->vertexShader = ShaderMap::Get().GetShader<VertexShader>(device, "FullScreenRectVS");
+		pipeline->pixelShader = GetMaterialPixelShader(device, shader);
+		pipeline->BuildPSO(device);
+	}
+	return pipeline;
+}
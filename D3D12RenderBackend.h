@@ -0,0 +1,69 @@
+#pragma once
+
+#include <map>
+#include "RenderBackend.h"
+#include "DescriptorAllocator.h"
+
+typedef std::shared_ptr<struct Texture2D> Texture2DPtr;
+typedef std::shared_ptr<class StructuredBuffer> StructuredBufferPtr;
+typedef std::shared_ptr<class Material> MaterialPtr;
+
+// RenderBackend on the viewer's D3D12GraphicsDevice.
+// Textures and buffers go through the device upload path on the next frame, so descriptor tables are
+// written on their first draw, once every view exists. Destroyed objects are released behind the device fence.
+class D3D12RenderBackend : public RenderBackend
+{
+public:
+	D3D12RenderBackend(class D3D12GraphicsDevice& inDevice, class Window& inWindow);
+	~D3D12RenderBackend();
+
+	std::string GetName() const override;
+
+	BackendTexture CreateTexture(const std::string& path, const std::string& name, std::string* error = nullptr) override;
+	BackendBuffer CreateBuffer(const void* data, size_t elementSize, size_t elementCount, MemoryCategory category, const std::string& name) override;
+	BackendDescriptorTable CreateDescriptorTable(const std::vector<BackendTexture>& textures, const std::vector<BackendBuffer>& buffers) override;
+
+	void Destroy(BackendTexture texture) override;
+	void Destroy(BackendBuffer buffer) override;
+	void Destroy(BackendDescriptorTable table) override;
+
+	void SetResolution(uint32_t width, uint32_t height) override;
+
+	void BeginFrame() override;
+	void Draw(const BackendDraw& draw) override;
+	uint64_t EndFrame() override;
+
+	uint64_t GetCompletedFenceValue() override;
+	uint64_t GetLastSubmittedFenceValue() const override;
+	void WaitForFence(uint64_t fenceValue) override;
+
+	double GetLastGpuMs() const override;
+
+	//the back buffer is never read back
+	bool ReadFrame(std::vector<uint8_t>& outRGBA8, uint32_t& outWidth, uint32_t& outHeight) override;
+
+private:
+	struct Table
+	{
+		std::vector<Texture2DPtr> textures;
+		std::vector<StructuredBufferPtr> buffers;
+
+		//written on first draw from the views of the sources
+		DescriptorHandle descriptors;
+	};
+
+	//views are written once every source finished its upload, false until then
+	bool UpdateTable(Table& table);
+
+	//vertex and pixel shader plus pso of a material variant, built on first use
+	const MaterialPtr& GetPipeline(MaterialShader shader);
+
+	class D3D12GraphicsDevice& device;
+	class Window& window;
+
+	uint32_t nextId = 1;
+	std::map<uint32_t, Texture2DPtr> textures;
+	std::map<uint32_t, StructuredBufferPtr> buffers;
+	std::map<uint32_t, Table> tables;
+	std::map<MaterialShader, MaterialPtr> pipelines;
+};
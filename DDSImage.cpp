@@ -0,0 +1,360 @@
+#include "DDSImage.h"
+#include "BCDecoder.h"
+#include "Profiler.h"
+#include <fstream>
+#include <cstring>
+
+static uint32_t MakeFourCC(char a, char b, char c, char d)
+{
+	return (uint32_t)(uint8_t)a | ((uint32_t)(uint8_t)b << 8) | ((uint32_t)(uint8_t)c << 16) | ((uint32_t)(uint8_t)d << 24);
+}
+
+static uint32_t ReadU32(const uint8_t* data)
+{
+	uint32_t value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+static uint32_t ToDXGIFormat(DDSFormat format)
+{
+	switch (format)
+	{
+	case DDSFormat::RGBA8: return 28;
+	case DDSFormat::BC1: return 71;
+	case DDSFormat::BC4: return 80;
+	case DDSFormat::BC6H_UF16: return 95;
+	case DDSFormat::BC6H_SF16: return 96;
+	default: return 0;
+	}
+}
+
+static DDSFormat FromDXGIFormat(uint32_t dxgiFormat)
+{
+	switch (dxgiFormat)
+	{
+	case 28: //DXGI_FORMAT_R8G8B8A8_UNORM
+	case 29: //DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+		return DDSFormat::RGBA8;
+	case 71: //DXGI_FORMAT_BC1_UNORM
+	case 72: //DXGI_FORMAT_BC1_UNORM_SRGB
+		return DDSFormat::BC1;
+	case 80: //DXGI_FORMAT_BC4_UNORM
+		return DDSFormat::BC4;
+	case 95: //DXGI_FORMAT_BC6H_UF16
+		return DDSFormat::BC6H_UF16;
+	case 96: //DXGI_FORMAT_BC6H_SF16
+		return DDSFormat::BC6H_SF16;
+	default:
+		return DDSFormat::Unknown;
+	}
+}
+
+static bool Fail(std::string* error, const std::string& message)
+{
+	if (error)
+	{
+		*error = message;
+	}
+	return false;
+}
+
+bool DDSImage::Load(const std::string& path, std::string* error)
+{
+	PROFILE_ZONE("DDSImage::Load");
+
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		return Fail(error, "File not found: " + path);
+	}
+
+	size_t fileSize = (size_t)file.tellg();
+	file.seekg(0);
+
+	std::vector<uint8_t> bytes(fileSize);
+	file.read((char*)bytes.data(), fileSize);
+
+	//magic + DDS_HEADER
+	const size_t headerSize = 4 + 124;
+	if (fileSize < headerSize || ReadU32(bytes.data()) != MakeFourCC('D', 'D', 'S', ' '))
+	{
+		return Fail(error, "Not a dds file: " + path);
+	}
+
+	const uint8_t* header = bytes.data() + 4;
+	height = ReadU32(header + 8);
+	width = ReadU32(header + 12);
+	mipLevels = ReadU32(header + 24);
+	if (mipLevels == 0)
+	{
+		mipLevels = 1;
+	}
+
+	const uint8_t* pixelFormat = header + 72;
+	uint32_t pixelFlags = ReadU32(pixelFormat + 4);
+	uint32_t fourCC = ReadU32(pixelFormat + 8);
+
+	size_t dataOffset = headerSize;
+	format = DDSFormat::Unknown;
+
+	const uint32_t DDPF_FOURCC = 0x4;
+	const uint32_t DDPF_RGB = 0x40;
+	if (pixelFlags & DDPF_FOURCC)
+	{
+		if (fourCC == MakeFourCC('D', 'X', '1', '0'))
+		{
+			//DDS_HEADER_DXT10
+			if (fileSize < headerSize + 20)
+			{
+				return Fail(error, "Truncated dx10 header: " + path);
+			}
+			const uint8_t* dx10 = bytes.data() + headerSize;
+			uint32_t dimension = ReadU32(dx10 + 4);
+			uint32_t arraySize = ReadU32(dx10 + 12);
+			if (dimension != 3 || arraySize > 1)
+			{
+				return Fail(error, "Only single 2D textures are supported: " + path);
+			}
+			format = FromDXGIFormat(ReadU32(dx10));
+			dataOffset += 20;
+		}
+		else if (fourCC == MakeFourCC('D', 'X', 'T', '1'))
+		{
+			format = DDSFormat::BC1;
+		}
+		else if (fourCC == MakeFourCC('B', 'C', '4', 'U') || fourCC == MakeFourCC('A', 'T', 'I', '1'))
+		{
+			format = DDSFormat::BC4;
+		}
+	}
+	else if ((pixelFlags & DDPF_RGB) && ReadU32(pixelFormat + 12) == 32 && ReadU32(pixelFormat + 16) == 0x000000FF)
+	{
+		format = DDSFormat::RGBA8;
+	}
+
+	if (format == DDSFormat::Unknown)
+	{
+		return Fail(error, "Unsupported dds format: " + path);
+	}
+
+	//lay out the mips, the file may hold fewer than the header claims
+	mipOffsets.clear();
+	size_t offset = 0;
+	size_t available = fileSize - dataOffset;
+	for (uint32_t mip = 0; mip < mipLevels; mip++)
+	{
+		size_t mipSize = GetMipSize(mip);
+		if (offset + mipSize > available)
+		{
+			break;
+		}
+		mipOffsets.push_back(offset);
+		offset += mipSize;
+	}
+
+	if (mipOffsets.empty())
+	{
+		return Fail(error, "Truncated dds file: " + path);
+	}
+	mipLevels = (uint32_t)mipOffsets.size();
+
+	data.assign(bytes.begin() + dataOffset, bytes.begin() + dataOffset + offset);
+	return true;
+}
+
+uint32_t DDSImage::GetMipWidth(uint32_t mip) const
+{
+	uint32_t value = width >> mip;
+	return value > 0 ? value : 1;
+}
+
+uint32_t DDSImage::GetMipHeight(uint32_t mip) const
+{
+	uint32_t value = height >> mip;
+	return value > 0 ? value : 1;
+}
+
+size_t DDSImage::GetMipSize(uint32_t mip) const
+{
+	size_t mipWidth = GetMipWidth(mip);
+	size_t mipHeight = GetMipHeight(mip);
+	if (IsBlockCompressed(format))
+	{
+		return ((mipWidth + 3) / 4) * ((mipHeight + 3) / 4) * GetBlockSize(format);
+	}
+	return mipWidth * mipHeight * GetBlockSize(format);
+}
+
+bool DDSImage::DecodeMip(uint32_t mip, std::vector<float>& outRGBA) const
+{
+	PROFILE_ZONE("DDSImage::DecodeMip");
+
+	if (mip >= mipOffsets.size())
+	{
+		return false;
+	}
+
+	uint32_t mipWidth = GetMipWidth(mip);
+	uint32_t mipHeight = GetMipHeight(mip);
+	const uint8_t* source = data.data() + mipOffsets[mip];
+
+	outRGBA.resize((size_t)mipWidth * mipHeight * 4);
+
+	if (format == DDSFormat::RGBA8)
+	{
+		for (size_t i = 0; i < outRGBA.size(); i++)
+		{
+			outRGBA[i] = source[i] / 255.0f;
+		}
+		return true;
+	}
+
+	uint32_t blocksX = (mipWidth + 3) / 4;
+	uint32_t blocksY = (mipHeight + 3) / 4;
+	uint32_t blockSize = GetBlockSize(format);
+
+	float block[16][4];
+	for (uint32_t by = 0; by < blocksY; by++)
+	{
+		for (uint32_t bx = 0; bx < blocksX; bx++)
+		{
+			const uint8_t* blockData = source + ((size_t)by * blocksX + bx) * blockSize;
+			switch (format)
+			{
+			case DDSFormat::BC1: BCDecoder::DecodeBC1(blockData, block); break;
+			case DDSFormat::BC4: BCDecoder::DecodeBC4(blockData, block); break;
+			case DDSFormat::BC6H_UF16: BCDecoder::DecodeBC6H(blockData, false, block); break;
+			case DDSFormat::BC6H_SF16: BCDecoder::DecodeBC6H(blockData, true, block); break;
+			default: return false;
+			}
+
+			//blocks on the edge of small mips hang over the image
+			for (uint32_t y = 0; y < 4 && by * 4 + y < mipHeight; y++)
+			{
+				for (uint32_t x = 0; x < 4 && bx * 4 + x < mipWidth; x++)
+				{
+					float* texel = &outRGBA[(((size_t)by * 4 + y) * mipWidth + bx * 4 + x) * 4];
+					memcpy(texel, block[y * 4 + x], sizeof(float) * 4);
+				}
+			}
+		}
+	}
+	return true;
+}
+
+bool DDSImage::SaveRGBA8(const std::string& path, uint32_t width, uint32_t height, const std::vector<uint8_t>& rgba, std::string* error)
+{
+	if (rgba.size() != (size_t)width * height * 4)
+	{
+		return Fail(error, "Image size doesn't match " + std::to_string(width) + "x" + std::to_string(height) + ": " + path);
+	}
+
+	//magic + DDS_HEADER, everything not set stays 0
+	uint32_t header[32] = {};
+	header[0] = MakeFourCC('D', 'D', 'S', ' ');
+	header[1] = 124;
+	header[2] = 0x100F; //DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PITCH | DDSD_PIXELFORMAT
+	header[3] = height;
+	header[4] = width;
+	header[5] = width * 4;
+	header[7] = 1;
+
+	//DDS_PIXELFORMAT
+	header[19] = 32;
+	header[20] = 0x41; //DDPF_RGB | DDPF_ALPHAPIXELS
+	header[22] = 32;
+	header[23] = 0x000000FF;
+	header[24] = 0x0000FF00;
+	header[25] = 0x00FF0000;
+	header[26] = 0xFF000000;
+
+	header[27] = 0x1000; //DDSCAPS_TEXTURE
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return Fail(error, "Can't write " + path);
+	}
+	file.write((const char*)header, sizeof(header));
+	file.write((const char*)rgba.data(), rgba.size());
+	return true;
+}
+
+bool DDSImage::Save(const std::string& path, std::string* error) const
+{
+	if (format == DDSFormat::Unknown || mipOffsets.size() != mipLevels || mipLevels == 0)
+	{
+		return Fail(error, "Nothing to save: " + path);
+	}
+
+	//magic + DDS_HEADER + DDS_HEADER_DXT10, everything not set stays 0
+	uint32_t header[37] = {};
+	header[0] = MakeFourCC('D', 'D', 'S', ' ');
+	header[1] = 124;
+	header[2] = 0x1007 | 0x20000; //DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT
+	header[2] |= IsBlockCompressed(format) ? 0x80000 : 0x8; //DDSD_LINEARSIZE or DDSD_PITCH
+	header[3] = height;
+	header[4] = width;
+	header[5] = IsBlockCompressed(format) ? (uint32_t)GetMipSize(0) : width * 4;
+	header[7] = mipLevels;
+
+	//DDS_PIXELFORMAT, the dx10 header names the format
+	header[19] = 32;
+	header[20] = 0x4; //DDPF_FOURCC
+	header[21] = MakeFourCC('D', 'X', '1', '0');
+
+	header[27] = 0x1000; //DDSCAPS_TEXTURE
+	if (mipLevels > 1)
+	{
+		header[27] |= 0x400008; //DDSCAPS_MIPMAP | DDSCAPS_COMPLEX
+	}
+
+	header[32] = ToDXGIFormat(format);
+	header[33] = 3; //D3D10_RESOURCE_DIMENSION_TEXTURE2D
+	header[35] = 1;
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return Fail(error, "Can't write " + path);
+	}
+	file.write((const char*)header, sizeof(header));
+	file.write((const char*)data.data(), data.size());
+	if (!file)
+	{
+		return Fail(error, "Can't write " + path);
+	}
+	return true;
+}
+
+const char* DDSImage::GetFormatName(DDSFormat format)
+{
+	switch (format)
+	{
+	case DDSFormat::BC1: return "BC1";
+	case DDSFormat::BC4: return "BC4";
+	case DDSFormat::BC6H_UF16: return "BC6H_UF16";
+	case DDSFormat::BC6H_SF16: return "BC6H_SF16";
+	case DDSFormat::RGBA8: return "RGBA8";
+	default: return "Unknown";
+	}
+}
+
+uint32_t DDSImage::GetBlockSize(DDSFormat format)
+{
+	switch (format)
+	{
+	case DDSFormat::BC1: return BCDecoder::BC1BlockSize;
+	case DDSFormat::BC4: return BCDecoder::BC4BlockSize;
+	case DDSFormat::BC6H_UF16:
+	case DDSFormat::BC6H_SF16: return BCDecoder::BC6HBlockSize;
+	case DDSFormat::RGBA8: return 4;
+	default: return 0;
+	}
+}
+
+bool DDSImage::IsBlockCompressed(DDSFormat format)
+{
+	return format != DDSFormat::RGBA8 && format != DDSFormat::Unknown;
+}
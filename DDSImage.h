@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Pixel formats the cpu path understands
+enum class DDSFormat
+{
+	Unknown,
+	BC1,
+	BC4,
+	BC6H_UF16,
+	BC6H_SF16,
+	RGBA8,
+};
+
+// Portable .dds reader, keeps the raw blocks of every mip level.
+// Only 2D textures without arrays are supported, which is everything the viewer ships.
+class DDSImage
+{
+public:
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t mipLevels = 0;
+	DDSFormat format = DDSFormat::Unknown;
+
+	//raw data of all mips, back to back
+	std::vector<uint8_t> data;
+	std::vector<size_t> mipOffsets;
+
+public:
+	//returns false and fills error when the file can't be read
+	bool Load(const std::string& path, std::string* error = nullptr);
+
+	uint32_t GetMipWidth(uint32_t mip) const;
+	uint32_t GetMipHeight(uint32_t mip) const;
+	size_t GetMipSize(uint32_t mip) const;
+
+	//expand one mip to RGBA float, row major
+	bool DecodeMip(uint32_t mip, std::vector<float>& outRGBA) const;
+
+	//writes format, size and every mip in data back out, block compressed formats with a dx10 header
+	bool Save(const std::string& path, std::string* error = nullptr) const;
+
+	//uncompressed single mip R8G8B8A8 file, what the cpu tools write their images as
+	static bool SaveRGBA8(const std::string& path, uint32_t width, uint32_t height, const std::vector<uint8_t>& rgba, std::string* error = nullptr);
+
+	static const char* GetFormatName(DDSFormat format);
+
+	//bytes per 4x4 block, or per pixel for uncompressed formats
+	static uint32_t GetBlockSize(DDSFormat format);
+	static bool IsBlockCompressed(DDSFormat format);
+};
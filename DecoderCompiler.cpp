@@ -0,0 +1,423 @@
+#include "DecoderCompiler.h"
+#include "MaterialLibrary.h"
+#include "ShaderCache.h"
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+
+uint64_t HashDecoderModel(const NeuralModel& model)
+{
+	uint64_t hash = HashShaderBytes(model.layer_sizes.data(), model.layer_sizes.size() * sizeof(int32_t));
+	hash = HashShaderBytes(model.weights.data(), model.weights.size() * sizeof(float), hash);
+	hash = HashShaderBytes(model.bias.data(), model.bias.size() * sizeof(float), hash);
+	//only factorized models have linear layers, the hashes of the trained models stay what they were
+	if (!model.linear_layers.empty())
+	{
+		hash = HashShaderBytes(model.linear_layers.data(), model.linear_layers.size() * sizeof(int32_t), hash);
+	}
+	return hash;
+}
+
+CompiledDecoder CompileDecoder(const NeuralModel& model)
+{
+	const std::vector<int32_t>& sizes = model.layer_sizes;
+	if (sizes.size() < 2)
+	{
+		throw std::runtime_error("Decoder model has no layers");
+	}
+
+	size_t weightCount = 0;
+	size_t biasCount = 0;
+	for (size_t i = 0; i + 1 < sizes.size(); i++)
+	{
+		weightCount += (size_t)sizes[i] * sizes[i + 1];
+		biasCount += sizes[i + 1];
+	}
+	if (weightCount != model.weights.size() || biasCount != model.bias.size())
+	{
+		throw std::runtime_error("Decoder model weights don't match its layer sizes");
+	}
+	for (size_t i = 0; i < model.weights.size() + model.bias.size(); i++)
+	{
+		if (!std::isfinite(i < model.weights.size() ? model.weights[i] : model.bias[i - model.weights.size()]))
+		{
+			throw std::runtime_error("Decoder model has weights that aren't finite");
+		}
+	}
+
+	CompiledDecoder decoder;
+	decoder.inputCount = sizes.front();
+	decoder.outputCount = sizes.back();
+	decoder.modelHash = HashDecoderModel(model);
+	DecoderCompileStats& stats = decoder.stats;
+
+	const size_t layerCount = sizes.size() - 1;
+
+	//forward: drop zero weights and fold neurons that lost every input into the next layer.
+	//Neurons stay at their model index until the end
+	std::vector<std::vector<CompiledNeuron>> neurons(layerCount);
+	std::vector<std::vector<char>> bConstant(layerCount);
+	std::vector<std::vector<float>> constantValues(layerCount);
+
+	size_t weightOffset = 0;
+	size_t biasOffset = 0;
+	for (size_t layer = 0; layer < layerCount; layer++)
+	{
+		const int in = sizes[layer];
+		const int out = sizes[layer + 1];
+		const bool bLastLayer = layer + 1 == layerCount;
+		const bool bLinear = model.IsLinearLayer(layer);
+
+		neurons[layer].resize(out);
+		bConstant[layer].assign(out, 0);
+		constantValues[layer].assign(out, 0.0f);
+
+		for (int o = 0; o < out; o++)
+		{
+			CompiledNeuron& neuron = neurons[layer][o];
+			neuron.bias = model.bias[biasOffset + o];
+
+			const float* row = model.weights.data() + weightOffset + (size_t)o * in;
+			for (int i = 0; i < in; i++)
+			{
+				stats.denseMultiplyAdds++;
+				if (layer > 0 && bConstant[layer - 1][i])
+				{
+					neuron.bias += row[i] * constantValues[layer - 1][i];
+				}
+				else if (row[i] == 0.0f)
+				{
+					stats.zeroWeights++;
+				}
+				else
+				{
+					neuron.weights.push_back({ i, row[i] });
+				}
+			}
+
+			//ReLU of the bias alone, the outputs are never folded
+			if (!bLastLayer && neuron.weights.empty())
+			{
+				bConstant[layer][o] = 1;
+				constantValues[layer][o] = neuron.bias > 0.0f || bLinear ? neuron.bias : 0.0f;
+				stats.constantNeurons++;
+			}
+		}
+
+		weightOffset += (size_t)in * out;
+		biasOffset += out;
+	}
+
+	//backward: a hidden neuron is live when a live neuron of the next layer reads it
+	std::vector<std::vector<char>> bLive(layerCount);
+	bLive[layerCount - 1].assign(sizes.back(), 1);
+	for (size_t layer = layerCount - 1; layer > 0; layer--)
+	{
+		bLive[layer - 1].assign(sizes[layer], 0);
+		for (size_t o = 0; o < neurons[layer].size(); o++)
+		{
+			if (!bLive[layer][o])
+			{
+				continue;
+			}
+			for (const auto& weight : neurons[layer][o].weights)
+			{
+				bLive[layer - 1][weight.first] = 1;
+			}
+		}
+		for (int o = 0; o < sizes[layer]; o++)
+		{
+			if (!bLive[layer - 1][o] && !bConstant[layer - 1][o])
+			{
+				stats.deadNeurons++;
+			}
+		}
+	}
+
+	//compact the live neurons and point the weights at their new index
+	std::vector<int> previousIndices;
+	for (size_t layer = 0; layer < layerCount; layer++)
+	{
+		CompiledLayer compiledLayer;
+		compiledLayer.bLinear = model.IsLinearLayer(layer);
+		std::vector<int> indices(neurons[layer].size(), -1);
+		for (size_t o = 0; o < neurons[layer].size(); o++)
+		{
+			if (!bLive[layer][o])
+			{
+				continue;
+			}
+
+			CompiledNeuron neuron = neurons[layer][o];
+			if (layer > 0)
+			{
+				for (auto& weight : neuron.weights)
+				{
+					weight.first = previousIndices[weight.first];
+				}
+			}
+			stats.multiplyAdds += neuron.weights.size();
+
+			indices[o] = (int)compiledLayer.neurons.size();
+			compiledLayer.sources.push_back((int)o);
+			compiledLayer.neurons.push_back(std::move(neuron));
+		}
+		decoder.layers.push_back(std::move(compiledLayer));
+		previousIndices = std::move(indices);
+	}
+
+	return decoder;
+}
+
+void EvaluateCompiledDecoder(const CompiledDecoder& decoder, const float* inputs, float* outputs, size_t count)
+{
+	std::vector<float> layerInput;
+	std::vector<float> layerOutput;
+	for (size_t pixel = 0; pixel < count; pixel++)
+	{
+		layerInput.assign(inputs + pixel * decoder.inputCount, inputs + (pixel + 1) * decoder.inputCount);
+		for (size_t layer = 0; layer < decoder.layers.size(); layer++)
+		{
+			const bool bLastLayer = layer + 1 == decoder.layers.size();
+			const bool bLinear = decoder.layers[layer].bLinear;
+
+			layerOutput.clear();
+			for (const CompiledNeuron& neuron : decoder.layers[layer].neurons)
+			{
+				float sum = neuron.bias;
+				for (const auto& weight : neuron.weights)
+				{
+					sum += weight.second * layerInput[weight.first];
+				}
+				layerOutput.push_back(bLastLayer ? 1.0f / (1.0f + std::exp(-sum)) : (sum > 0.0f || bLinear ? sum : 0.0f));
+			}
+			layerInput.swap(layerOutput);
+		}
+
+		for (int o = 0; o < decoder.outputCount; o++)
+		{
+			outputs[pixel * decoder.outputCount + o] = layerInput[o];
+		}
+	}
+}
+
+//shortest text reading back as the same float, valid in C++ and HLSL
+static std::string FormatFloat(float value)
+{
+	char text[32];
+	snprintf(text, sizeof(text), "%.9g", value);
+
+	std::string result = text;
+	if (result.find_first_of(".e") == std::string::npos)
+	{
+		result += ".0";
+	}
+	return result + "f";
+}
+
+static std::string FormatHash(uint64_t hash)
+{
+	return "0x" + FormatShaderKey(hash);
+}
+
+//bias + weight * input + ..., four terms per line. input(i) names the value of input i
+template<typename InputName>
+static std::string FormatSum(const CompiledNeuron& neuron, const std::string& indent, InputName input)
+{
+	std::string sum = FormatFloat(neuron.bias);
+	for (size_t i = 0; i < neuron.weights.size(); i++)
+	{
+		sum += i % 4 == 3 ? "\n" + indent : " ";
+		float weight = neuron.weights[i].second;
+		sum += weight < 0.0f ? "- " : "+ ";
+		sum += FormatFloat(std::fabs(weight)) + " * " + input(neuron.weights[i].first);
+	}
+	return sum;
+}
+
+static std::string FormatHeader(const CompiledDecoder& decoder, const std::string& comment, const std::string& name)
+{
+	const DecoderCompileStats& stats = decoder.stats;
+	return comment + " Decoder model " + name + " with its weights as constants, generated by DecoderCompiler from the model\n" +
+		comment + " hashing to " + FormatHash(decoder.modelHash) + ". " + std::to_string(stats.multiplyAdds) + " multiply-adds per pixel instead of " +
+		std::to_string(stats.denseMultiplyAdds) + ", " + std::to_string(stats.constantNeurons + stats.deadNeurons) + " neurons eliminated.\n" +
+		comment + " Regenerate with NeuralTexture --bake-decoders, don't edit.\n";
+}
+
+std::string GenerateDecoderCPP(const CompiledDecoder& decoder, const std::string& name)
+{
+	const std::string B = "BlockSize";
+
+	std::string code = FormatHeader(decoder, "//", name);
+	code += "#include \"BakedDecoders.h\"\n";
+	code += "#include <cmath>\n\n";
+	code += "namespace\n{\n";
+	code += "const size_t " + B + " = 16;\n\n";
+	code += "inline float Relu(float x)\n{\n\treturn x > 0.0f ? x : 0.0f;\n}\n\n";
+
+	//every neuron is one loop over the pixels of a block, they vectorize with the weights as broadcast constants
+	code += "//x holds a block of pixels channel major, y gets the outputs of the first pixelCount pixels\n";
+	code += "void DecodeBlock(const float (*x)[" + B + "], float* y, size_t pixelCount)\n{\n";
+	for (size_t layer = 0; layer < decoder.layers.size(); layer++)
+	{
+		const CompiledLayer& compiledLayer = decoder.layers[layer];
+		const bool bLastLayer = layer + 1 == decoder.layers.size();
+
+		auto input = [layer](int i)
+		{
+			return layer == 0 ? "x[" + std::to_string(i) + "][p]" : "h" + std::to_string(layer - 1) + "[" + std::to_string(i) + "][p]";
+		};
+
+		//the sums of the outputs are kept apart from the sigmoid, exp would keep their loops from vectorizing
+		const std::string array = bLastLayer ? "s" : "h" + std::to_string(layer);
+		size_t arraySize = compiledLayer.neurons.empty() ? 1 : compiledLayer.neurons.size();
+		code += "\tfloat " + array + "[" + std::to_string(arraySize) + "][" + B + "];\n";
+		for (size_t o = 0; o < compiledLayer.neurons.size(); o++)
+		{
+			std::string sum = FormatSum(compiledLayer.neurons[o], "\t\t\t", input);
+			code += "\tfor (size_t p = 0; p < " + B + "; p++)\n\t{\n";
+			code += "\t\t" + array + "[" + std::to_string(o) + "][p] = " + (bLastLayer || compiledLayer.bLinear ? sum : "Relu(" + sum + ")") + ";\n";
+			code += "\t}\n";
+		}
+		code += "\n";
+	}
+
+	const std::string outputCount = std::to_string(decoder.outputCount);
+	code += "\tfor (size_t p = 0; p < pixelCount; p++)\n\t{\n";
+	code += "\t\tfor (size_t o = 0; o < " + outputCount + "; o++)\n\t\t{\n";
+	code += "\t\t\ty[p * " + outputCount + " + o] = 1.0f / (1.0f + std::exp(-s[o][p]));\n";
+	code += "\t\t}\n\t}\n";
+	code += "}\n\n";
+
+	const std::string inputCount = std::to_string(decoder.inputCount);
+	code += "void Decode(const float* inputs, float* outputs, size_t count)\n{\n";
+	code += "\tfloat x[" + inputCount + "][" + B + "];\n";
+	code += "\tfor (size_t begin = 0; begin < count; begin += " + B + ")\n\t{\n";
+	code += "\t\tconst size_t pixelCount = count - begin < " + B + " ? count - begin : " + B + ";\n";
+	code += "\t\tfor (size_t i = 0; i < " + inputCount + "; i++)\n\t\t{\n";
+	code += "\t\t\tfor (size_t p = 0; p < " + B + "; p++)\n\t\t\t{\n";
+	code += "\t\t\t\tx[i][p] = p < pixelCount ? inputs[(begin + p) * " + inputCount + " + i] : 0.0f;\n";
+	code += "\t\t\t}\n\t\t}\n";
+	code += "\t\tDecodeBlock(x, outputs + begin * " + outputCount + ", pixelCount);\n";
+	code += "\t}\n}\n";
+	code += "}\n\n";
+
+	code += "extern const BakedDecoder BakedDecoder_" + name + " = { \"" + name + "\", " + FormatHash(decoder.modelHash) + "ull, " +
+		inputCount + ", " + outputCount + ", Decode };\n";
+	return code;
+}
+
+std::string GenerateDecoderHLSL(const CompiledDecoder& decoder, const std::string& name, std::string* error)
+{
+	if (decoder.inputCount != 14 || decoder.outputCount != 8)
+	{
+		if (error)
+		{
+			*error = "PSMain decodes 14 features to 8 channels, the model maps " + std::to_string(decoder.inputCount) + " to " + std::to_string(decoder.outputCount);
+		}
+		return "";
+	}
+
+	std::string code = FormatHeader(decoder, "//", name);
+	code += "// Compiled as the pixel shader, PixelShader.hlsl follows with this forward() in place of the generic ones.\n";
+	code += "#define BAKED_NN 1\n\n";
+	code += "struct NNOutputs\n{\n    float outputs[8];\n};\n\n";
+	code += "NNOutputs forward(float input[14])\n{\n";
+	for (size_t layer = 0; layer < decoder.layers.size(); layer++)
+	{
+		const CompiledLayer& compiledLayer = decoder.layers[layer];
+		const bool bLastLayer = layer + 1 == decoder.layers.size();
+
+		auto input = [layer](int i)
+		{
+			return layer == 0 ? "input[" + std::to_string(i) + "]" : "h" + std::to_string(layer - 1) + "_" + std::to_string(i);
+		};
+
+		if (bLastLayer)
+		{
+			code += "    NNOutputs nnOutputs;\n";
+		}
+		for (size_t o = 0; o < compiledLayer.neurons.size(); o++)
+		{
+			std::string sum = FormatSum(compiledLayer.neurons[o], "        ", input);
+			if (bLastLayer)
+			{
+				code += "    nnOutputs.outputs[" + std::to_string(o) + "] = 1.0f / (1.0f + exp(-(" + sum + ")));\n";
+			}
+			else if (compiledLayer.bLinear)
+			{
+				code += "    float h" + std::to_string(layer) + "_" + std::to_string(o) + " = " + sum + ";\n";
+			}
+			else
+			{
+				code += "    float h" + std::to_string(layer) + "_" + std::to_string(o) + " = max(0.0f, " + sum + ");\n";
+			}
+		}
+		code += "\n";
+	}
+	code += "    return nnOutputs;\n}\n\n";
+	code += "#include \"../PixelShader.hlsl\"\n";
+	return code;
+}
+
+static bool WriteGeneratedFile(const std::string& path, const std::string& code)
+{
+	std::ofstream file(path, std::ios::binary);
+	file << code;
+	if (!file)
+	{
+		std::cout << "Failed to write " << path << std::endl;
+		return false;
+	}
+	std::cout << "Wrote " << path << std::endl;
+	return true;
+}
+
+int BakeLibraryDecoders()
+{
+	std::set<std::string> modelPaths;
+	int failed = 0;
+	for (const MaterialDesc& desc : GetMaterialLibrary())
+	{
+		if (!desc.IsNeural() || !modelPaths.insert(desc.modelPath).second)
+		{
+			continue;
+		}
+
+		std::string name = std::filesystem::path(desc.modelPath).parent_path().filename().string();
+		try
+		{
+			CompiledDecoder decoder = CompileDecoder(*NeuralModel::LoadModel(desc.modelPath));
+			const DecoderCompileStats& stats = decoder.stats;
+			std::cout << name << ": " << stats.multiplyAdds << "/" << stats.denseMultiplyAdds << " multiply-adds, " << stats.zeroWeights << " zero weights, "
+				<< stats.constantNeurons << " constant and " << stats.deadNeurons << " dead neurons" << std::endl;
+
+			std::string error;
+			std::string hlsl = GenerateDecoderHLSL(decoder, name, &error);
+			if (hlsl.empty())
+			{
+				std::cout << name << ": " << error << std::endl;
+				failed++;
+			}
+			else
+			{
+				std::filesystem::create_directories("Shaders/Baked");
+				failed += WriteGeneratedFile("Shaders/Baked/" + name + ".hlsl", hlsl) ? 0 : 1;
+			}
+			failed += WriteGeneratedFile("BakedDecoder_" + name + ".cpp", GenerateDecoderCPP(decoder, name)) ? 0 : 1;
+		}
+		catch (const std::exception& exception)
+		{
+			std::cout << desc.modelPath << ": " << exception.what() << std::endl;
+			failed++;
+		}
+	}
+
+	//the list is kept by hand, a new model needs its entry
+	std::cout << "Every BakedDecoder_<name>.cpp has to be listed in BakedDecoders.cpp" << std::endl;
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "NeuralModel.h"
+
+// Neuron left after compilation, its weights only reference live neurons of the previous layer
+struct CompiledNeuron
+{
+	float bias = 0.0f;
+	//index into the previous compiled layer, or the model inputs for the first layer, and weight
+	std::vector<std::pair<int, float>> weights;
+};
+
+struct CompiledLayer
+{
+	//neuron of the model each compiled neuron came from
+	std::vector<int> sources;
+	std::vector<CompiledNeuron> neurons;
+	//outputs skip the ReLU, see NeuralModel::linear_layers
+	bool bLinear = false;
+};
+
+struct DecoderCompileStats
+{
+	//multiply-adds per pixel of the model and of the compiled decoder
+	size_t denseMultiplyAdds = 0;
+	size_t multiplyAdds = 0;
+
+	size_t zeroWeights = 0;
+	//hidden neurons without inputs, their constant output was folded into the next layer
+	size_t constantNeurons = 0;
+	//hidden neurons nothing reads
+	size_t deadNeurons = 0;
+};
+
+// Decoder model with its weights fixed: zero weights dropped, constant neurons folded into the biases of
+// the next layer and neurons no output depends on removed. The output layer keeps every neuron in order.
+struct CompiledDecoder
+{
+	int inputCount = 0;
+	int outputCount = 0;
+	std::vector<CompiledLayer> layers;
+
+	//HashDecoderModel of the source model
+	uint64_t modelHash = 0;
+
+	DecoderCompileStats stats;
+};
+
+//hash of layer sizes, weights, biases and linear layers, decides whether a baked decoder belongs to a model
+uint64_t HashDecoderModel(const NeuralModel& model);
+
+CompiledDecoder CompileDecoder(const NeuralModel& model);
+
+//runs the compiled decoder like NeuralDecoderCPU runs the model, to check the compilation itself
+void EvaluateCompiledDecoder(const CompiledDecoder& decoder, const float* inputs, float* outputs, size_t count);
+
+//C++ translation unit defining the BakedDecoder "BakedDecoder_<name>", name has to be a valid identifier
+std::string GenerateDecoderCPP(const CompiledDecoder& decoder, const std::string& name);
+
+//HLSL defining forward() of PixelShader.hlsl with the weights as literals, empty and error filled when the
+//decoder doesn't map 14 features to 8 material channels like PSMain expects
+std::string GenerateDecoderHLSL(const CompiledDecoder& decoder, const std::string& name, std::string* error = nullptr);
+
+//compile the model of every neural material of the library into BakedDecoder_<name>.cpp and
+//Shaders/Baked/<name>.hlsl, named after the directory of the model. Returns the process exit code
+int BakeLibraryDecoders();
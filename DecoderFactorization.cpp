@@ -0,0 +1,376 @@
+#include "DecoderFactorization.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+// W = U S V^T of the weights of one layer, singular values largest first
+struct LayerDecomposition
+{
+	//outputs x rank and inputs x rank, row major
+	std::vector<double> left;
+	std::vector<double> right;
+	std::vector<double> singularValues;
+};
+
+static LayerDecomposition DecomposeLayer(const NeuralModel& model, size_t layer)
+{
+	const std::vector<int32_t>& sizes = model.layer_sizes;
+	if (layer + 1 >= sizes.size())
+	{
+		throw std::runtime_error("Decoder model has no layer " + std::to_string(layer));
+	}
+
+	const int in = sizes[layer];
+	const int out = sizes[layer + 1];
+	size_t weightOffset = 0;
+	for (size_t l = 0; l < layer; l++)
+	{
+		weightOffset += (size_t)sizes[l] * sizes[l + 1];
+	}
+	const float* weights = model.weights.data() + weightOffset;
+
+	//one-sided Jacobi: rotations from the right orthogonalize the columns of a matrix with no more columns than
+	//rows, their norms are the singular values. A wide layer is decomposed transposed
+	const bool bTransposed = in > out;
+	const int rows = bTransposed ? in : out;
+	const int columns = bTransposed ? out : in;
+
+	std::vector<std::vector<double>> a(columns, std::vector<double>(rows));
+	for (int o = 0; o < out; o++)
+	{
+		for (int i = 0; i < in; i++)
+		{
+			if (bTransposed)
+			{
+				a[o][i] = weights[(size_t)o * in + i];
+			}
+			else
+			{
+				a[i][o] = weights[(size_t)o * in + i];
+			}
+		}
+	}
+	std::vector<std::vector<double>> v(columns, std::vector<double>(columns, 0.0));
+	for (int c = 0; c < columns; c++)
+	{
+		v[c][c] = 1.0;
+	}
+
+	const double epsilon = 1e-15;
+	for (int sweep = 0; sweep < 100; sweep++)
+	{
+		bool bRotated = false;
+		for (int p = 0; p < columns; p++)
+		{
+			for (int q = p + 1; q < columns; q++)
+			{
+				double alpha = 0.0;
+				double beta = 0.0;
+				double gamma = 0.0;
+				for (int r = 0; r < rows; r++)
+				{
+					alpha += a[p][r] * a[p][r];
+					beta += a[q][r] * a[q][r];
+					gamma += a[p][r] * a[q][r];
+				}
+				if (std::fabs(gamma) <= epsilon * std::sqrt(alpha * beta))
+				{
+					continue;
+				}
+				bRotated = true;
+
+				const double zeta = (beta - alpha) / (2.0 * gamma);
+				const double t = (zeta >= 0.0 ? 1.0 : -1.0) / (std::fabs(zeta) + std::sqrt(1.0 + zeta * zeta));
+				const double cosine = 1.0 / std::sqrt(1.0 + t * t);
+				const double sine = cosine * t;
+				for (int r = 0; r < rows; r++)
+				{
+					const double x = a[p][r];
+					a[p][r] = cosine * x - sine * a[q][r];
+					a[q][r] = sine * x + cosine * a[q][r];
+				}
+				for (int r = 0; r < columns; r++)
+				{
+					const double x = v[p][r];
+					v[p][r] = cosine * x - sine * v[q][r];
+					v[q][r] = sine * x + cosine * v[q][r];
+				}
+			}
+		}
+		if (!bRotated)
+		{
+			break;
+		}
+	}
+
+	std::vector<double> norms(columns);
+	for (int c = 0; c < columns; c++)
+	{
+		norms[c] = std::sqrt(std::inner_product(a[c].begin(), a[c].end(), a[c].begin(), 0.0));
+	}
+	std::vector<int> order(columns);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](int x, int y) { return norms[x] > norms[y]; });
+
+	//the normalized columns are U, or V for a transposed layer
+	LayerDecomposition decomposition;
+	const size_t rank = (size_t)columns;
+	decomposition.left.resize((size_t)out * rank);
+	decomposition.right.resize((size_t)in * rank);
+	for (size_t j = 0; j < rank; j++)
+	{
+		const int c = order[j];
+		const double norm = norms[c];
+		decomposition.singularValues.push_back(norm);
+
+		std::vector<double>& normalized = bTransposed ? decomposition.right : decomposition.left;
+		std::vector<double>& rotation = bTransposed ? decomposition.left : decomposition.right;
+		for (int r = 0; r < rows; r++)
+		{
+			normalized[r * rank + j] = norm > 0.0 ? a[c][r] / norm : 0.0;
+		}
+		for (int r = 0; r < columns; r++)
+		{
+			rotation[r * rank + j] = v[c][r];
+		}
+	}
+	return decomposition;
+}
+
+static NeuralModelPtr BuildFactorizedModel(const NeuralModel& model, size_t layer, const LayerDecomposition& decomposition, int rank)
+{
+	const std::vector<int32_t>& sizes = model.layer_sizes;
+	const size_t fullRank = decomposition.singularValues.size();
+	rank = std::clamp(rank, 1, (int)fullRank);
+
+	auto factorized = std::make_shared<NeuralModel>();
+	factorized->layer_sizes.push_back(sizes[0]);
+
+	size_t weightOffset = 0;
+	size_t biasOffset = 0;
+	for (size_t l = 0; l + 1 < sizes.size(); l++)
+	{
+		const int in = sizes[l];
+		const int out = sizes[l + 1];
+		if (l == layer)
+		{
+			//the square root of every singular value goes to each half, their weights stay of similar scale
+			factorized->layer_sizes.push_back(rank);
+			for (int j = 0; j < rank; j++)
+			{
+				const double scale = std::sqrt(decomposition.singularValues[j]);
+				for (int i = 0; i < in; i++)
+				{
+					factorized->weights.push_back((float)(scale * decomposition.right[i * fullRank + j]));
+				}
+			}
+			factorized->bias.insert(factorized->bias.end(), rank, 0.0f);
+
+			for (int o = 0; o < out; o++)
+			{
+				for (int j = 0; j < rank; j++)
+				{
+					factorized->weights.push_back((float)(std::sqrt(decomposition.singularValues[j]) * decomposition.left[o * fullRank + j]));
+				}
+			}
+		}
+		else
+		{
+			factorized->weights.insert(factorized->weights.end(), model.weights.begin() + weightOffset, model.weights.begin() + weightOffset + (size_t)in * out);
+		}
+		factorized->layer_sizes.push_back(out);
+		factorized->bias.insert(factorized->bias.end(), model.bias.begin() + biasOffset, model.bias.begin() + biasOffset + out);
+
+		weightOffset += (size_t)in * out;
+		biasOffset += out;
+	}
+
+	//the second half takes the place of the layer, linear if the layer was
+	for (int32_t linear : model.linear_layers)
+	{
+		factorized->linear_layers.push_back((size_t)linear >= layer ? linear + 1 : linear);
+	}
+	factorized->linear_layers.push_back((int32_t)layer);
+	std::sort(factorized->linear_layers.begin(), factorized->linear_layers.end());
+	return factorized;
+}
+
+//multiply-adds of a layer kept at rank, the dense layer when that is cheaper
+static size_t GetFactorizedMultiplyAdds(int in, int out, size_t rank)
+{
+	return std::min((size_t)in * out, rank * (in + out));
+}
+
+bool IsFactorizableLayer(const NeuralModel& model, size_t layer)
+{
+	return layer > 0 && layer + 2 < model.layer_sizes.size() && !model.IsLinearLayer(layer) && !model.IsLinearLayer(layer - 1);
+}
+
+std::vector<LayerRankErrors> ComputeRankErrors(const NeuralModel& model)
+{
+	PROFILE_ZONE("ComputeRankErrors");
+
+	std::vector<LayerRankErrors> layers;
+	for (size_t layer = 0; layer + 1 < model.layer_sizes.size(); layer++)
+	{
+		if (!IsFactorizableLayer(model, layer))
+		{
+			continue;
+		}
+
+		LayerRankErrors errors;
+		errors.layer = layer;
+		errors.inputCount = model.layer_sizes[layer];
+		errors.outputCount = model.layer_sizes[layer + 1];
+		errors.singularValues = DecomposeLayer(model, layer).singularValues;
+
+		double total = 0.0;
+		for (double value : errors.singularValues)
+		{
+			total += value * value;
+		}
+		//tail sums from the smallest value up, so a tiny tail isn't lost to cancellation
+		errors.errors.assign(errors.singularValues.size() + 1, 0.0);
+		double tail = 0.0;
+		for (size_t r = errors.singularValues.size(); r-- > 0;)
+		{
+			tail += errors.singularValues[r] * errors.singularValues[r];
+			errors.errors[r] = total > 0.0 ? std::sqrt(tail / total) : 0.0;
+		}
+		layers.push_back(std::move(errors));
+	}
+	return layers;
+}
+
+NeuralModelPtr FactorizeLayer(const NeuralModel& model, size_t layer, int rank)
+{
+	PROFILE_ZONE("FactorizeLayer");
+	return BuildFactorizedModel(model, layer, DecomposeLayer(model, layer), rank);
+}
+
+NeuralModelPtr FactorizeModel(const NeuralModel& model, const std::string& level, std::string* error)
+{
+	PROFILE_ZONE("FactorizeModel");
+
+	auto fail = [&](const std::string& message)
+	{
+		if (error)
+		{
+			*error = message;
+		}
+		return nullptr;
+	};
+
+	const bool bRank = level.rfind("rank=", 0) == 0;
+	const bool bMacs = level.rfind("macs=", 0) == 0;
+	if (!bRank && !bMacs)
+	{
+		return fail("Unknown factorization level " + level + ", expected rank=r or macs=fraction");
+	}
+
+	double value = 0.0;
+	try
+	{
+		value = std::stod(level.substr(5));
+	}
+	catch (const std::exception&)
+	{
+		value = 0.0;
+	}
+	if (bRank ? !(value >= 1.0) : !(value > 0.0 && value <= 1.0))
+	{
+		return fail(bRank ? "Factorization level " + level + " needs a rank of at least 1" : "Factorization level " + level + " needs 0 < fraction <= 1");
+	}
+
+	const std::vector<int32_t>& sizes = model.layer_sizes;
+	std::vector<LayerDecomposition> decompositions(sizes.size() - 1);
+	//rank of every layer, its full rank keeps it dense
+	std::vector<size_t> ranks(sizes.size() - 1, 0);
+	size_t denseMultiplyAdds = 0;
+	for (size_t layer = 0; layer + 1 < sizes.size(); layer++)
+	{
+		denseMultiplyAdds += (size_t)sizes[layer] * sizes[layer + 1];
+		if (IsFactorizableLayer(model, layer))
+		{
+			decompositions[layer] = DecomposeLayer(model, layer);
+			ranks[layer] = decompositions[layer].singularValues.size();
+		}
+	}
+	if (std::all_of(ranks.begin(), ranks.end(), [](size_t rank) { return rank == 0; }))
+	{
+		return fail("Decoder model has no layer between two hidden layers to factorize");
+	}
+
+	if (bRank)
+	{
+		for (size_t layer = 0; layer < ranks.size(); layer++)
+		{
+			ranks[layer] = std::min(ranks[layer], (size_t)value);
+		}
+	}
+	else
+	{
+		auto countMultiplyAdds = [&]()
+		{
+			size_t multiplyAdds = 0;
+			for (size_t layer = 0; layer < ranks.size(); layer++)
+			{
+				multiplyAdds += ranks[layer] == 0 ? (size_t)sizes[layer] * sizes[layer + 1] : GetFactorizedMultiplyAdds(sizes[layer], sizes[layer + 1], ranks[layer]);
+			}
+			return multiplyAdds;
+		};
+
+		//the singular value whose loss costs its layer the least energy goes first
+		const double target = value * denseMultiplyAdds;
+		while ((double)countMultiplyAdds() > target)
+		{
+			size_t best = ranks.size();
+			double bestLoss = 0.0;
+			for (size_t layer = 0; layer < ranks.size(); layer++)
+			{
+				if (ranks[layer] <= 1)
+				{
+					continue;
+				}
+				const std::vector<double>& singularValues = decompositions[layer].singularValues;
+				double total = 0.0;
+				for (double singularValue : singularValues)
+				{
+					total += singularValue * singularValue;
+				}
+				const double dropped = singularValues[ranks[layer] - 1];
+				const double loss = total > 0.0 ? dropped * dropped / total : 0.0;
+				if (best == ranks.size() || loss < bestLoss)
+				{
+					best = layer;
+					bestLoss = loss;
+				}
+			}
+			if (best == ranks.size())
+			{
+				return fail("Factorization level " + level + " takes fewer multiply-adds than rank 1 of every layer");
+			}
+			ranks[best]--;
+		}
+	}
+
+	//from the last layer down, a factorized layer shifts the indices of the layers after it
+	auto factorized = std::make_shared<NeuralModel>();
+	factorized->layer_sizes = model.layer_sizes;
+	factorized->weights = model.weights;
+	factorized->bias = model.bias;
+	factorized->linear_layers = model.linear_layers;
+	for (size_t layer = ranks.size(); layer-- > 0;)
+	{
+		const int in = sizes[layer];
+		const int out = sizes[layer + 1];
+		if (ranks[layer] == 0 || GetFactorizedMultiplyAdds(in, out, ranks[layer]) == (size_t)in * out)
+		{
+			continue;
+		}
+		factorized = BuildFactorizedModel(*factorized, layer, decompositions[layer], (int)ranks[layer]);
+	}
+	return factorized;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "NeuralModel.h"
+
+// Singular values of the weights of one layer and what keeping only the largest of them costs
+struct LayerRankErrors
+{
+	size_t layer = 0;
+	int inputCount = 0;
+	int outputCount = 0;
+
+	//largest first, min(inputCount, outputCount) of them
+	std::vector<double> singularValues;
+	//relative Frobenius error of the weights at rank r, sqrt of the energy past the first r singular values over
+	//the total. errors[0] is 1, errors[singularValues.size()] is 0
+	std::vector<double> errors;
+};
+
+//whether layer can be replaced by two thinner ones: it maps hidden neurons to hidden neurons and isn't the first or
+//second half of a factorized layer already. The first and output layers are left alone, they hold little energy
+//outside their largest singular values and lose the most quality per dropped one
+bool IsFactorizableLayer(const NeuralModel& model, size_t layer);
+
+//every factorizable layer of the model
+std::vector<LayerRankErrors> ComputeRankErrors(const NeuralModel& model);
+
+//replaces layer with its rank r approximation from the SVD W = U S V^T as two layers: a linear one computing
+//sqrt(S) V^T x without bias and one computing U sqrt(S) h plus the original bias. Exact at full rank
+NeuralModelPtr FactorizeLayer(const NeuralModel& model, size_t layer, int rank);
+
+//applies a factorization level: "rank=r" factorizes every layer where rank r takes fewer multiply-adds than the
+//dense layer, "macs=f" drops the singular values carrying the least energy over all layers until the model takes
+//at most f of its dense multiply-adds. nullptr and error filled when the level can't be parsed or reached
+NeuralModelPtr FactorizeModel(const NeuralModel& model, const std::string& level, std::string* error = nullptr);
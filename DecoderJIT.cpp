@@ -0,0 +1,597 @@
+#include "DecoderJIT.h"
+#include "DecoderCompiler.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <map>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define DECODER_JIT_X64 1
+#else
+#define DECODER_JIT_X64 0
+#endif
+
+#if DECODER_JIT_X64
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <sys/mman.h>
+#endif
+#endif
+
+namespace
+{
+// What the generated code gets as its only argument, every buffer is channel major blocks of 16 pixels
+struct JITArguments
+{
+	const float* inputs;
+	float* hidden;
+	float* outputs;
+	const float* constants;
+	//xmm6 to xmm15 are callee saved on windows, the code keeps them here while it overwrites them
+	uint8_t savedRegisters[10 * 16];
+};
+
+typedef void (*JITKernel)(JITArguments* arguments);
+
+enum Register
+{
+	RCX = 1,
+	RDI = 7,
+	R8 = 8,
+	R9 = 9,
+	R10 = 10,
+	R11 = 11,
+};
+
+// Encoder of the few x86-64 instructions the kernels are made of, memory operands are always [base + disp32]
+class X64Assembler
+{
+public:
+	std::vector<uint8_t> bytes;
+
+	void Byte(uint32_t value)
+	{
+		bytes.push_back((uint8_t)value);
+	}
+
+	void Dword(int32_t value)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			Byte(((uint32_t)value >> (8 * i)) & 0xff);
+		}
+	}
+
+	//modrm of reg and [base + disp32], rsp and r12 as base need a sib byte
+	void Memory(int reg, int base, int32_t disp)
+	{
+		Byte(0x80 | ((reg & 7) << 3) | (base & 7));
+		if ((base & 7) == 4)
+		{
+			Byte(0x24);
+		}
+		Dword(disp);
+	}
+
+	//modrm of two registers
+	void Registers(int reg, int rm)
+	{
+		Byte(0xc0 | ((reg & 7) << 3) | (rm & 7));
+	}
+
+	//mov reg, qword [base + disp]
+	void LoadPointer(int reg, int base, int32_t disp)
+	{
+		Byte(0x48 | ((reg & 8) ? 4 : 0) | ((base & 8) ? 1 : 0));
+		Byte(0x8b);
+		Memory(reg, base, disp);
+	}
+
+	//3 byte VEX prefix and opcode. map 1 is 0F and 2 is 0F38, pp 0 is no prefix and 1 is 66
+	void Vex(int map, int pp, bool b256, int reg, int vvvv, int rm, uint8_t opcode)
+	{
+		Byte(0xc4);
+		Byte(((reg & 8) ? 0 : 0x80) | 0x40 | ((rm & 8) ? 0 : 0x20) | map);
+		Byte(((~vvvv & 15) << 3) | (b256 ? 4 : 0) | pp);
+		Byte(opcode);
+	}
+
+	//EVEX prefix of a 512 bit operation without a mask and opcode, bBroadcast reads a memory operand as one float for every lane
+	void Evex(int map, int pp, int reg, int vvvv, int rm, bool bRegisterRm, bool bBroadcast, uint8_t opcode)
+	{
+		Byte(0x62);
+		Byte(((reg & 8) ? 0 : 0x80) | ((bRegisterRm && (rm & 16)) ? 0 : 0x40) | ((rm & 8) ? 0 : 0x20) | ((reg & 16) ? 0 : 0x10) | map);
+		Byte(((~vvvv & 15) << 3) | 4 | pp);
+		Byte(0x40 | (bBroadcast ? 0x10 : 0) | ((vvvv & 16) ? 0 : 0x08));
+		Byte(opcode);
+	}
+
+	void Vzeroupper()
+	{
+		Byte(0xc5);
+		Byte(0xf8);
+		Byte(0x77);
+	}
+
+	void Ret()
+	{
+		Byte(0xc3);
+	}
+};
+
+// Vector operations of a kernel in the encoding of its instruction set, registers are ymm or zmm by target
+class KernelEmitter
+{
+public:
+	KernelEmitter(X64Assembler& inAssembler, bool bInAVX512)
+		: assembler(inAssembler), bAVX512(bInAVX512)
+	{
+	}
+
+	//vmovups dst, [base + disp]
+	void Load(int dst, int base, int32_t disp)
+	{
+		Encode(1, 0, dst, 0, base, false, 0x10);
+		assembler.Memory(dst, base, disp);
+	}
+
+	//vmovups [base + disp], src
+	void Store(int base, int32_t disp, int src)
+	{
+		Encode(1, 0, src, 0, base, false, 0x11);
+		assembler.Memory(src, base, disp);
+	}
+
+	//vmovups dst, src
+	void Copy(int dst, int src)
+	{
+		Encode(1, 0, dst, 0, src, true, 0x10);
+		assembler.Registers(dst, src);
+	}
+
+	//vbroadcastss dst, dword [base + disp]
+	void Broadcast(int dst, int base, int32_t disp)
+	{
+		Encode(2, 1, dst, 0, base, false, 0x18);
+		assembler.Memory(dst, base, disp);
+	}
+
+	//vfmadd231ps sum, x, w
+	void MultiplyAdd(int sum, int x, int w)
+	{
+		Encode(2, 1, sum, x, w, true, 0xb8);
+		assembler.Registers(sum, w);
+	}
+
+	//vfmadd231ps sum, x, dword [base + disp]{1to16}, the weight needs no register of its own
+	void MultiplyAddBroadcast(int sum, int x, int base, int32_t disp)
+	{
+		assembler.Evex(2, 1, sum, x, base, false, true, 0xb8);
+		assembler.Memory(sum, base, disp);
+	}
+
+	//vmaxps dst, a, b
+	void Max(int dst, int a, int b)
+	{
+		Encode(1, 0, dst, a, b, true, 0x5f);
+		assembler.Registers(dst, b);
+	}
+
+	//vxorps dst, dst, dst, vpxord on AVX-512 where vxorps needs DQ
+	void Zero(int dst)
+	{
+		if (bAVX512)
+		{
+			Encode(1, 1, dst, dst, dst, true, 0xef);
+		}
+		else
+		{
+			Encode(1, 0, dst, dst, dst, true, 0x57);
+		}
+		assembler.Registers(dst, dst);
+	}
+
+private:
+	void Encode(int map, int pp, int reg, int vvvv, int rm, bool bRegisterRm, uint8_t opcode)
+	{
+		if (bAVX512)
+		{
+			assembler.Evex(map, pp, reg, vvvv, rm, bRegisterRm, false, opcode);
+		}
+		else
+		{
+			assembler.Vex(map, pp, true, reg, vvvv, rm, opcode);
+		}
+	}
+
+	X64Assembler& assembler;
+	bool bAVX512;
+};
+
+struct CpuFeatures
+{
+	bool bAVX2 = false;
+	bool bAVX512 = false;
+};
+
+#if DECODER_JIT_X64
+void Cpuid(uint32_t leaf, uint32_t subleaf, uint32_t (&registers)[4])
+{
+#ifdef _WIN32
+	int values[4];
+	__cpuidex(values, (int)leaf, (int)subleaf);
+	for (int i = 0; i < 4; i++)
+	{
+		registers[i] = (uint32_t)values[i];
+	}
+#else
+	__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+//register state the os saves on a context switch
+uint64_t ReadXcr0()
+{
+#ifdef _WIN32
+	return _xgetbv(0);
+#else
+	uint32_t low = 0;
+	uint32_t high = 0;
+	__asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+	return ((uint64_t)high << 32) | low;
+#endif
+}
+#endif
+
+CpuFeatures DetectCpuFeatures()
+{
+	CpuFeatures features;
+#if DECODER_JIT_X64
+	uint32_t registers[4];
+	Cpuid(0, 0, registers);
+	if (registers[0] < 7)
+	{
+		return features;
+	}
+
+	Cpuid(1, 0, registers);
+	const bool bFMA = (registers[2] >> 12) & 1;
+	const bool bOSXSAVE = (registers[2] >> 27) & 1;
+	const bool bAVX = (registers[2] >> 28) & 1;
+	if (!bOSXSAVE || !bAVX)
+	{
+		return features;
+	}
+
+	//xmm and ymm state, then opmask and both halves of the zmm state
+	const uint64_t xcr0 = ReadXcr0();
+	const bool bYmmState = (xcr0 & 0x06) == 0x06;
+	const bool bZmmState = (xcr0 & 0xe6) == 0xe6;
+
+	Cpuid(7, 0, registers);
+	features.bAVX2 = bYmmState && bFMA && ((registers[1] >> 5) & 1);
+	features.bAVX512 = features.bAVX2 && bZmmState && ((registers[1] >> 16) & 1);
+#endif
+	return features;
+}
+
+const CpuFeatures& GetCpuFeatures()
+{
+	static const CpuFeatures features = DetectCpuFeatures();
+	return features;
+}
+
+//pages holding bytes, writable while they are copied and only executable after, nullptr when the os refuses
+void* MapCode(const std::vector<uint8_t>& bytes, size_t& outMappedSize)
+{
+#if DECODER_JIT_X64
+	const size_t pageSize = 4096;
+	outMappedSize = (bytes.size() + pageSize - 1) / pageSize * pageSize;
+#ifdef _WIN32
+	void* pages = VirtualAlloc(nullptr, outMappedSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	if (pages == nullptr)
+	{
+		return nullptr;
+	}
+	memcpy(pages, bytes.data(), bytes.size());
+	DWORD oldProtection = 0;
+	if (!VirtualProtect(pages, outMappedSize, PAGE_EXECUTE_READ, &oldProtection))
+	{
+		VirtualFree(pages, 0, MEM_RELEASE);
+		return nullptr;
+	}
+	FlushInstructionCache(GetCurrentProcess(), pages, outMappedSize);
+	return pages;
+#else
+	void* pages = mmap(nullptr, outMappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (pages == MAP_FAILED)
+	{
+		return nullptr;
+	}
+	memcpy(pages, bytes.data(), bytes.size());
+	if (mprotect(pages, outMappedSize, PROT_READ | PROT_EXEC) != 0)
+	{
+		munmap(pages, outMappedSize);
+		return nullptr;
+	}
+	return pages;
+#endif
+#else
+	(void)bytes;
+	outMappedSize = 0;
+	return nullptr;
+#endif
+}
+
+void UnmapCode(void* pages, size_t mappedSize)
+{
+#if DECODER_JIT_X64
+#ifdef _WIN32
+	(void)mappedSize;
+	VirtualFree(pages, 0, MEM_RELEASE);
+#else
+	munmap(pages, mappedSize);
+#endif
+#else
+	(void)pages;
+	(void)mappedSize;
+#endif
+}
+
+bool Fail(std::string* error, const std::string& message)
+{
+	if (error)
+	{
+		*error = message;
+	}
+	return false;
+}
+}
+
+const char* GetDecoderJITTargetName(DecoderJITTarget target)
+{
+	switch (target)
+	{
+	case DecoderJITTarget::Auto: return "Auto";
+	case DecoderJITTarget::AVX2: return "AVX2";
+	case DecoderJITTarget::AVX512: return "AVX-512";
+	default: return "Unknown";
+	}
+}
+
+bool IsDecoderJITTargetSupported(DecoderJITTarget target)
+{
+	const CpuFeatures& features = GetCpuFeatures();
+	switch (target)
+	{
+	case DecoderJITTarget::AVX2: return features.bAVX2;
+	case DecoderJITTarget::AVX512: return features.bAVX512;
+	default: return features.bAVX2 || features.bAVX512;
+	}
+}
+
+std::unique_ptr<DecoderJIT> DecoderJIT::Create(const NeuralModelPtr& model, DecoderJITTarget target, std::string* error)
+{
+	PROFILE_ZONE("DecoderJIT::Create");
+
+	if (target == DecoderJITTarget::Auto)
+	{
+		target = IsDecoderJITTargetSupported(DecoderJITTarget::AVX512) ? DecoderJITTarget::AVX512 : DecoderJITTarget::AVX2;
+	}
+	if (!IsDecoderJITTargetSupported(target))
+	{
+		Fail(error, std::string("This cpu can't run ") + GetDecoderJITTargetName(target) + " code");
+		return nullptr;
+	}
+	if (model == nullptr || model->layer_sizes.size() < 2)
+	{
+		Fail(error, "Decoder model has no layers");
+		return nullptr;
+	}
+
+	std::unique_ptr<DecoderJIT> jit(new DecoderJIT());
+	jit->target = target;
+	if (!jit->Generate(CompileDecoder(*model), error))
+	{
+		return nullptr;
+	}
+	return jit;
+}
+
+DecoderJIT::~DecoderJIT()
+{
+	if (code)
+	{
+		UnmapCode(code, mappedSize);
+	}
+}
+
+bool DecoderJIT::Generate(const CompiledDecoder& decoder, std::string* error)
+{
+	inputCount = decoder.inputCount;
+	outputCount = decoder.outputCount;
+	for (size_t layer = 0; layer + 1 < decoder.layers.size(); layer++)
+	{
+		hiddenSize = std::max(hiddenSize, (int)decoder.layers[layer].neurons.size());
+	}
+
+	const bool bAVX512 = target == DecoderJITTarget::AVX512;
+	const int32_t channelBytes = (int32_t)(BlockSize * sizeof(float));
+	const int32_t hiddenBytes = hiddenSize * channelBytes;
+
+	//registers a channel of a block takes, and the bytes of each
+	const int parts = bAVX512 ? 1 : 2;
+	const int32_t partBytes = channelBytes / parts;
+
+	//sums of the group first, then the input channel, the broadcast weight on AVX2 and zero for ReLU
+	const int registerCount = bAVX512 ? 32 : 16;
+	const int zeroRegister = registerCount - 1;
+	const int weightRegister = registerCount - 2;
+	const int inputRegister = bAVX512 ? registerCount - 2 : registerCount - 4;
+	const int groupLimit = inputRegister / parts;
+
+	X64Assembler assembler;
+	KernelEmitter emitter(assembler, bAVX512);
+
+	auto addConstant = [this](float value)
+	{
+		constants.push_back(value);
+		return (int32_t)((constants.size() - 1) * sizeof(float));
+	};
+
+#ifdef _WIN32
+	const int argumentRegister = RCX;
+	for (int i = 0; i < 10; i++)
+	{
+		assembler.Vex(1, 0, false, 6 + i, 0, argumentRegister, 0x11);
+		assembler.Memory(6 + i, argumentRegister, (int32_t)(offsetof(JITArguments, savedRegisters) + i * 16));
+	}
+#else
+	const int argumentRegister = RDI;
+#endif
+	assembler.LoadPointer(R8, argumentRegister, (int32_t)offsetof(JITArguments, inputs));
+	assembler.LoadPointer(R9, argumentRegister, (int32_t)offsetof(JITArguments, hidden));
+	assembler.LoadPointer(R10, argumentRegister, (int32_t)offsetof(JITArguments, outputs));
+	assembler.LoadPointer(R11, argumentRegister, (int32_t)offsetof(JITArguments, constants));
+	emitter.Zero(zeroRegister);
+
+	for (size_t layer = 0; layer < decoder.layers.size(); layer++)
+	{
+		const std::vector<CompiledNeuron>& neurons = decoder.layers[layer].neurons;
+		const bool bLastLayer = layer + 1 == decoder.layers.size();
+		const bool bRelu = !bLastLayer && !decoder.layers[layer].bLinear;
+
+		//hidden layers alternate between the two halves of the hidden buffer
+		const int sourceBase = layer == 0 ? R8 : R9;
+		const int32_t sourceOffset = layer == 0 ? 0 : (int32_t)((layer - 1) % 2) * hiddenBytes;
+		const int destinationBase = bLastLayer ? R10 : R9;
+		const int32_t destinationOffset = bLastLayer ? 0 : (int32_t)(layer % 2) * hiddenBytes;
+
+		//groups of equal size that fit the registers
+		const size_t neuronCount = neurons.size();
+		const size_t groupCount = (neuronCount + groupLimit - 1) / groupLimit;
+		for (size_t group = 0; group < groupCount; group++)
+		{
+			const size_t begin = neuronCount * group / groupCount;
+			const size_t end = neuronCount * (group + 1) / groupCount;
+
+			//neurons of the group reading each input, in input order like the generic kernel sums them
+			std::map<int, std::vector<std::pair<int, float>>> readers;
+			for (size_t n = begin; n < end; n++)
+			{
+				const int sum = (int)(n - begin) * parts;
+				emitter.Broadcast(sum, R11, addConstant(neurons[n].bias));
+				for (int part = 1; part < parts; part++)
+				{
+					emitter.Copy(sum + part, sum);
+				}
+				for (const auto& weight : neurons[n].weights)
+				{
+					readers[weight.first].emplace_back(sum, weight.second);
+				}
+			}
+
+			for (const auto& input : readers)
+			{
+				for (int part = 0; part < parts; part++)
+				{
+					emitter.Load(inputRegister + part, sourceBase, sourceOffset + input.first * channelBytes + part * partBytes);
+				}
+				for (const auto& reader : input.second)
+				{
+					const int32_t weightOffset = addConstant(reader.second);
+					if (bAVX512)
+					{
+						emitter.MultiplyAddBroadcast(reader.first, inputRegister, R11, weightOffset);
+						continue;
+					}
+					emitter.Broadcast(weightRegister, R11, weightOffset);
+					for (int part = 0; part < parts; part++)
+					{
+						emitter.MultiplyAdd(reader.first + part, inputRegister + part, weightRegister);
+					}
+				}
+			}
+
+			for (size_t n = begin; n < end; n++)
+			{
+				for (int part = 0; part < parts; part++)
+				{
+					const int sum = (int)(n - begin) * parts + part;
+					if (bRelu)
+					{
+						emitter.Max(sum, sum, zeroRegister);
+					}
+					emitter.Store(destinationBase, destinationOffset + (int32_t)n * channelBytes + part * partBytes, sum);
+				}
+			}
+		}
+	}
+
+#ifdef _WIN32
+	for (int i = 0; i < 10; i++)
+	{
+		assembler.Vex(1, 0, false, 6 + i, 0, argumentRegister, 0x10);
+		assembler.Memory(6 + i, argumentRegister, (int32_t)(offsetof(JITArguments, savedRegisters) + i * 16));
+	}
+#endif
+	assembler.Vzeroupper();
+	assembler.Ret();
+
+	code = MapCode(assembler.bytes, mappedSize);
+	if (code == nullptr)
+	{
+		return Fail(error, "Failed to map executable memory for the decoder");
+	}
+	codeSize = assembler.bytes.size();
+	return true;
+}
+
+void DecoderJIT::Decode(const float* inputs, float* outputs, size_t count) const
+{
+	const size_t B = BlockSize;
+
+	//inputs, both hidden halves and output sums of a block
+	std::vector<float> buffer(((size_t)inputCount + 2 * (size_t)hiddenSize + outputCount) * B);
+
+	JITArguments arguments;
+	float* blockInputs = buffer.data();
+	arguments.inputs = blockInputs;
+	arguments.hidden = blockInputs + (size_t)inputCount * B;
+	arguments.outputs = arguments.hidden + 2 * (size_t)hiddenSize * B;
+	arguments.constants = constants.data();
+	const float* sums = arguments.outputs;
+
+	const JITKernel kernel = (JITKernel)code;
+	for (size_t begin = 0; begin < count; begin += B)
+	{
+		const size_t pixelCount = count - begin < B ? count - begin : B;
+
+		//transpose the inputs, a partial last block is padded with zeros
+		for (int i = 0; i < inputCount; i++)
+		{
+			for (size_t p = 0; p < B; p++)
+			{
+				blockInputs[i * B + p] = p < pixelCount ? inputs[(begin + p) * inputCount + i] : 0.0f;
+			}
+		}
+
+		kernel(&arguments);
+
+		for (size_t p = 0; p < pixelCount; p++)
+		{
+			for (int o = 0; o < outputCount; o++)
+			{
+				outputs[(begin + p) * outputCount + o] = 1.0f / (1.0f + std::exp(-sums[o * B + p]));
+			}
+		}
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "NeuralModel.h"
+
+struct CompiledDecoder;
+
+// Instruction sets the JIT emits code for
+enum class DecoderJITTarget
+{
+	//widest one the cpu and the os support
+	Auto,
+	AVX2,
+	AVX512,
+};
+
+const char* GetDecoderJITTargetName(DecoderJITTarget target);
+
+//whether this process can run code of target, Auto when there is any
+bool IsDecoderJITTargetSupported(DecoderJITTarget target);
+
+// x86-64 machine code for the forward pass of one model, generated when the model is loaded.
+// Works from the CompiledDecoder of the model, so zero weights and dead neurons cost nothing, and runs
+// blocks of 16 pixels channel major like the batched kernel. A layer is computed a group of neurons at a
+// time with their sums held in vector registers while every input is read once, each weight broadcast
+// from a constant pool next to the code. ReLU is applied to the registers before they are stored, the
+// sigmoid of the output layer runs in C++ while the block is written back to the pixel major outputs.
+// NeuralDecoderCPU::CreateJIT checks the code against the generic kernel before any pixel goes through it.
+class DecoderJIT
+{
+public:
+	//pixels per call of the generated code
+	static const size_t BlockSize = 16;
+
+	//nullptr and error filled when target can't run here or the model has nothing to decode
+	static std::unique_ptr<DecoderJIT> Create(const NeuralModelPtr& model, DecoderJITTarget target = DecoderJITTarget::Auto, std::string* error = nullptr);
+
+	~DecoderJIT();
+
+	DecoderJIT(const DecoderJIT&) = delete;
+	DecoderJIT& operator=(const DecoderJIT&) = delete;
+
+	//same layout as NeuralDecoderCPU::Decode
+	void Decode(const float* inputs, float* outputs, size_t count) const;
+
+	DecoderJITTarget GetTarget() const { return target; }
+
+	//bytes of machine code and of weights it reads
+	size_t GetCodeSize() const { return codeSize; }
+	size_t GetConstantSize() const { return constants.size() * sizeof(float); }
+
+private:
+	DecoderJIT() = default;
+
+	bool Generate(const CompiledDecoder& decoder, std::string* error);
+
+	DecoderJITTarget target = DecoderJITTarget::Auto;
+	int inputCount = 0;
+	int outputCount = 0;
+
+	//channels of the widest hidden layer, two of them ping-pong between layers
+	int hiddenSize = 0;
+
+	void* code = nullptr;
+	size_t codeSize = 0;
+	size_t mappedSize = 0;
+	std::vector<float> constants;
+};
@@ -0,0 +1,281 @@
+#include "DecoderPruning.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+//copy of the weights, biases and layer sizes, without the gpu buffers of the source
+static NeuralModelPtr CopyModel(const NeuralModel& model)
+{
+	auto copy = std::make_shared<NeuralModel>();
+	copy->layer_sizes = model.layer_sizes;
+	copy->weights = model.weights;
+	copy->bias = model.bias;
+	copy->linear_layers = model.linear_layers;
+	return copy;
+}
+
+ActivationStats CollectActivationStats(const NeuralModel& model, const float* inputs, size_t count)
+{
+	PROFILE_ZONE("CollectActivationStats");
+
+	const std::vector<int32_t>& sizes = model.layer_sizes;
+	const size_t layerCount = sizes.size() - 1;
+
+	ActivationStats stats;
+	stats.sampleCount = count;
+	stats.layerInputs.resize(layerCount);
+	for (size_t layer = 0; layer < layerCount; layer++)
+	{
+		stats.layerInputs[layer].resize(sizes[layer]);
+	}
+
+	std::vector<float> layerInput;
+	std::vector<float> layerOutput;
+	for (size_t sample = 0; sample < count; sample++)
+	{
+		layerInput.assign(inputs + sample * sizes[0], inputs + (sample + 1) * sizes[0]);
+
+		const float* weights = model.weights.data();
+		const float* bias = model.bias.data();
+		for (size_t layer = 0; layer < layerCount; layer++)
+		{
+			const int in = sizes[layer];
+			const int out = sizes[layer + 1];
+
+			std::vector<ChannelStats>& channels = stats.layerInputs[layer];
+			for (int i = 0; i < in; i++)
+			{
+				ChannelStats& channel = channels[i];
+				const float x = layerInput[i];
+				channel.minimum = sample == 0 ? x : std::min(channel.minimum, x);
+				channel.maximum = sample == 0 ? x : std::max(channel.maximum, x);
+				channel.mean += x;
+				channel.meanSquare += (double)x * x;
+			}
+
+			//the output layer is never read by another, its sums aren't needed
+			if (layer + 1 == layerCount)
+			{
+				break;
+			}
+
+			layerOutput.resize(out);
+			for (int o = 0; o < out; o++)
+			{
+				float sum = bias[o];
+				for (int i = 0; i < in; i++)
+				{
+					sum += weights[(size_t)o * in + i] * layerInput[i];
+				}
+				layerOutput[o] = sum > 0.0f || model.IsLinearLayer(layer) ? sum : 0.0f;
+			}
+			layerInput.swap(layerOutput);
+			weights += (size_t)in * out;
+			bias += out;
+		}
+	}
+
+	for (std::vector<ChannelStats>& channels : stats.layerInputs)
+	{
+		for (ChannelStats& channel : channels)
+		{
+			channel.mean /= count > 0 ? (double)count : 1.0;
+			channel.meanSquare /= count > 0 ? (double)count : 1.0;
+		}
+	}
+	return stats;
+}
+
+NeuralModelPtr PruneStructured(const NeuralModel& model, int n, int m, const ActivationStats& stats)
+{
+	PROFILE_ZONE("PruneStructured");
+
+	NeuralModelPtr pruned = CopyModel(model);
+	const std::vector<int32_t>& sizes = model.layer_sizes;
+
+	size_t weightOffset = (size_t)sizes[0] * sizes[1];
+	size_t biasOffset = sizes[1];
+	for (size_t layer = 1; layer + 1 < sizes.size(); layer++)
+	{
+		const int in = sizes[layer];
+		const int out = sizes[layer + 1];
+		const std::vector<ChannelStats>& channels = stats.layerInputs[layer];
+
+		for (int o = 0; o < out; o++)
+		{
+			float* row = &pruned->weights[weightOffset + (size_t)o * in];
+			float& bias = pruned->bias[biasOffset + o];
+
+			for (int begin = 0; begin < in; begin += m)
+			{
+				const int end = std::min(begin + m, in);
+
+				std::vector<int> order;
+				for (int i = begin; i < end; i++)
+				{
+					order.push_back(i);
+				}
+				auto contribution = [&](int i)
+				{
+					return std::fabs(row[i]) * std::sqrt(channels[i].meanSquare);
+				};
+				//ties keep the lower input, so the same model always prunes the same way
+				std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return contribution(a) > contribution(b); });
+
+				for (size_t k = (size_t)n; k < order.size(); k++)
+				{
+					const int i = order[k];
+					bias += (float)(row[i] * channels[i].mean);
+					row[i] = 0.0f;
+				}
+			}
+		}
+
+		weightOffset += (size_t)in * out;
+		biasOffset += out;
+	}
+	return pruned;
+}
+
+NeuralModelPtr RemoveDeadNeurons(const NeuralModel& model, const ActivationStats& stats, float tolerance, size_t* outRemoved)
+{
+	PROFILE_ZONE("RemoveDeadNeurons");
+
+	const std::vector<int32_t>& sizes = model.layer_sizes;
+	const size_t layerCount = sizes.size() - 1;
+
+	//rows of every layer as their own vectors, so neurons can go from the middle
+	std::vector<std::vector<std::vector<float>>> rows(layerCount);
+	std::vector<std::vector<float>> biases(layerCount);
+	size_t weightOffset = 0;
+	size_t biasOffset = 0;
+	for (size_t layer = 0; layer < layerCount; layer++)
+	{
+		const int in = sizes[layer];
+		const int out = sizes[layer + 1];
+		for (int o = 0; o < out; o++)
+		{
+			const float* row = &model.weights[weightOffset + (size_t)o * in];
+			rows[layer].emplace_back(row, row + in);
+			biases[layer].push_back(model.bias[biasOffset + o]);
+		}
+		weightOffset += (size_t)in * out;
+		biasOffset += out;
+	}
+
+	size_t removed = 0;
+	for (size_t layer = 0; layer + 1 < layerCount; layer++)
+	{
+		//outputs of this layer are what the next one reads
+		const std::vector<ChannelStats>& channels = stats.layerInputs[layer + 1];
+		std::vector<std::vector<float>>& next = rows[layer + 1];
+
+		for (int neuron = (int)rows[layer].size() - 1; neuron >= 0; neuron--)
+		{
+			const ChannelStats& channel = channels[neuron];
+			if (channel.maximum - channel.minimum > tolerance || rows[layer].size() == 1)
+			{
+				continue;
+			}
+
+			for (size_t o = 0; o < next.size(); o++)
+			{
+				biases[layer + 1][o] += (float)(next[o][neuron] * channel.mean);
+				next[o].erase(next[o].begin() + neuron);
+			}
+			rows[layer].erase(rows[layer].begin() + neuron);
+			biases[layer].erase(biases[layer].begin() + neuron);
+			removed++;
+		}
+	}
+
+	auto pruned = std::make_shared<NeuralModel>();
+	pruned->linear_layers = model.linear_layers;
+	pruned->layer_sizes.push_back(sizes[0]);
+	for (size_t layer = 0; layer < layerCount; layer++)
+	{
+		pruned->layer_sizes.push_back((int32_t)rows[layer].size());
+		for (const std::vector<float>& row : rows[layer])
+		{
+			pruned->weights.insert(pruned->weights.end(), row.begin(), row.end());
+		}
+		pruned->bias.insert(pruned->bias.end(), biases[layer].begin(), biases[layer].end());
+	}
+
+	if (outRemoved)
+	{
+		*outRemoved = removed;
+	}
+	return pruned;
+}
+
+NeuralModelPtr PruneModel(const NeuralModel& model, const std::string& level, const float* inputs, size_t count, std::string* error)
+{
+	NeuralModelPtr pruned = CopyModel(model);
+
+	std::stringstream steps(level);
+	std::string step;
+	while (std::getline(steps, step, '+'))
+	{
+		ActivationStats stats = CollectActivationStats(*pruned, inputs, count);
+
+		size_t colon = step.find(':');
+		if (step == "dead" || step.rfind("dead=", 0) == 0)
+		{
+			float tolerance = 0.0f;
+			if (step.size() > 5)
+			{
+				try
+				{
+					tolerance = std::stof(step.substr(5));
+				}
+				catch (const std::exception&)
+				{
+					tolerance = -1.0f;
+				}
+			}
+			if (!(tolerance >= 0.0f))
+			{
+				if (error)
+				{
+					*error = "Invalid tolerance in pruning level " + level;
+				}
+				return nullptr;
+			}
+			pruned = RemoveDeadNeurons(*pruned, stats, tolerance);
+		}
+		else if (colon != std::string::npos)
+		{
+			int n = 0;
+			int m = 0;
+			try
+			{
+				n = std::stoi(step.substr(0, colon));
+				m = std::stoi(step.substr(colon + 1));
+			}
+			catch (const std::exception&)
+			{
+			}
+			if (n <= 0 || m <= 0 || n > m)
+			{
+				if (error)
+				{
+					*error = "Pruning level " + step + " needs 0 < n <= m";
+				}
+				return nullptr;
+			}
+			pruned = PruneStructured(*pruned, n, m, stats);
+		}
+		else
+		{
+			if (error)
+			{
+				*error = "Unknown pruning level " + step + ", expected n:m, dead or dead=tolerance";
+			}
+			return nullptr;
+		}
+	}
+	return pruned;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "NeuralModel.h"
+
+// Range of one channel over a set of decoder inputs
+struct ChannelStats
+{
+	float minimum = 0.0f;
+	float maximum = 0.0f;
+	double mean = 0.0;
+	double meanSquare = 0.0;
+};
+
+// What every layer of a model reads over a set of decoder inputs: the features for the first layer,
+// the outputs of the layer before for the others
+struct ActivationStats
+{
+	size_t sampleCount = 0;
+	std::vector<std::vector<ChannelStats>> layerInputs;
+};
+
+//inputs hold model->layer_sizes.front() floats per sample
+ActivationStats CollectActivationStats(const NeuralModel& model, const float* inputs, size_t count);
+
+//keeps the n of every m consecutive weights of a neuron that contribute most and zeroes the others, in every
+//layer but the first which reads the features directly. A weight contributes its magnitude times the rms of
+//its input, the mean contribution of a dropped weight moves into the bias
+NeuralModelPtr PruneStructured(const NeuralModel& model, int n, int m, const ActivationStats& stats);
+
+//removes hidden neurons whose output varies by at most tolerance over the samples, the mean output of each
+//moves into the biases of the next layer. Tolerance 0 only removes neurons that are constant on every sample
+NeuralModelPtr RemoveDeadNeurons(const NeuralModel& model, const ActivationStats& stats, float tolerance, size_t* outRemoved = nullptr);
+
+//applies a pruning level: "n:m", "dead" or "dead=tolerance", joined with + to apply several in order. Stats
+//are collected over inputs before each step. nullptr and error filled when the level can't be parsed
+NeuralModelPtr PruneModel(const NeuralModel& model, const std::string& level, const float* inputs, size_t count, std::string* error = nullptr);
@@ -0,0 +1,191 @@
+#include "DescriptorAllocator.h"
+#include <algorithm>
+#include <iterator>
+
+DescriptorAllocator::DescriptorAllocator(uint32_t capacity)
+{
+	Reset(capacity);
+}
+
+void DescriptorAllocator::Reset(uint32_t newCapacity)
+{
+	capacity = newCapacity;
+	slots.assign(capacity, Slot());
+	freeRanges.clear();
+	if (capacity > 0)
+	{
+		freeRanges[0] = capacity;
+	}
+	pendingFrees.clear();
+
+	allocatedDescriptors = 0;
+	peakDescriptors = 0;
+	liveAllocations = 0;
+	pendingFreeDescriptors = 0;
+	failedAllocations = 0;
+}
+
+DescriptorHandle DescriptorAllocator::Allocate(uint32_t count, const char* name)
+{
+	DescriptorHandle handle;
+	if (count == 0)
+	{
+		failedAllocations++;
+		return handle;
+	}
+
+	auto it = freeRanges.begin();
+	while (it != freeRanges.end() && it->second < count)
+	{
+		++it;
+	}
+	if (it == freeRanges.end())
+	{
+		failedAllocations++;
+		return handle;
+	}
+
+	//take the front of the range, the rest stays free
+	uint32_t index = it->first;
+	uint32_t rangeCount = it->second;
+	freeRanges.erase(it);
+	if (rangeCount > count)
+	{
+		freeRanges[index + count] = rangeCount - count;
+	}
+
+	Slot& slot = slots[index];
+	slot.count = count;
+	slot.name = name ? name : "";
+
+	allocatedDescriptors += count;
+	peakDescriptors = std::max(peakDescriptors, allocatedDescriptors);
+	liveAllocations++;
+
+	handle.index = index;
+	handle.count = count;
+	handle.generation = slot.generation;
+	return handle;
+}
+
+bool DescriptorAllocator::IsValid(const DescriptorHandle& handle) const
+{
+	if (handle.IsNull() || handle.index >= capacity)
+	{
+		return false;
+	}
+	const Slot& slot = slots[handle.index];
+	return slot.count != 0 && slot.count == handle.count && slot.generation == handle.generation;
+}
+
+bool DescriptorAllocator::Free(const DescriptorHandle& handle, uint64_t fenceValue)
+{
+	if (!IsValid(handle))
+	{
+		return false;
+	}
+
+	//stale copies of the handle fail IsValid from here on
+	Slot& slot = slots[handle.index];
+	slot.generation = slot.generation == UINT32_MAX ? 1 : slot.generation + 1;
+	slot.count = 0;
+	slot.name.clear();
+
+	allocatedDescriptors -= handle.count;
+	liveAllocations--;
+
+	PendingFree pending;
+	pending.fenceValue = fenceValue;
+	pending.index = handle.index;
+	pending.count = handle.count;
+	pendingFrees.push_back(pending);
+	pendingFreeDescriptors += handle.count;
+	return true;
+}
+
+void DescriptorAllocator::Retire(uint64_t completedFenceValue)
+{
+	size_t kept = 0;
+	for (const PendingFree& pending : pendingFrees)
+	{
+		if (pending.fenceValue <= completedFenceValue)
+		{
+			ReturnRange(pending.index, pending.count);
+			pendingFreeDescriptors -= pending.count;
+		}
+		else
+		{
+			pendingFrees[kept++] = pending;
+		}
+	}
+	pendingFrees.resize(kept);
+}
+
+void DescriptorAllocator::ReturnRange(uint32_t index, uint32_t count)
+{
+	auto next = freeRanges.lower_bound(index);
+
+	//merge with the range right after
+	if (next != freeRanges.end() && next->first == index + count)
+	{
+		count += next->second;
+		next = freeRanges.erase(next);
+	}
+
+	//and with the one right before
+	if (next != freeRanges.begin())
+	{
+		auto previous = std::prev(next);
+		if (previous->first + previous->second == index)
+		{
+			previous->second += count;
+			return;
+		}
+	}
+
+	freeRanges.emplace_hint(next, index, count);
+}
+
+DescriptorHandle DescriptorAllocator::Find(uint32_t index) const
+{
+	DescriptorHandle handle;
+	if (index < capacity && slots[index].count != 0)
+	{
+		handle.index = index;
+		handle.count = slots[index].count;
+		handle.generation = slots[index].generation;
+	}
+	return handle;
+}
+
+DescriptorAllocatorStats DescriptorAllocator::GetStats() const
+{
+	DescriptorAllocatorStats stats;
+	stats.capacity = capacity;
+	stats.allocatedDescriptors = allocatedDescriptors;
+	stats.peakDescriptors = peakDescriptors;
+	stats.liveAllocations = liveAllocations;
+	stats.pendingFreeDescriptors = pendingFreeDescriptors;
+	stats.failedAllocations = failedAllocations;
+	for (const auto& range : freeRanges)
+	{
+		stats.largestFreeRange = std::max(stats.largestFreeRange, range.second);
+	}
+	return stats;
+}
+
+std::vector<DescriptorLeak> DescriptorAllocator::GetLiveAllocations() const
+{
+	std::vector<DescriptorLeak> live;
+	for (uint32_t index = 0; index < capacity; index++)
+	{
+		if (slots[index].count != 0)
+		{
+			DescriptorLeak leak;
+			leak.handle = Find(index);
+			leak.name = slots[index].name;
+			live.push_back(leak);
+		}
+	}
+	return live;
+}
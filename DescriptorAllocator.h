@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Contiguous range of descriptors handed out by DescriptorAllocator.
+// The generation tells a live range from a stale copy of a handle whose range was freed and may
+// belong to someone else by now. A default constructed handle is null.
+struct DescriptorHandle
+{
+	uint32_t index = 0;
+	uint32_t count = 0;
+	uint32_t generation = 0;
+
+	bool IsNull() const { return generation == 0; }
+
+	bool operator==(const DescriptorHandle& other) const
+	{
+		return index == other.index && count == other.count && generation == other.generation;
+	}
+	bool operator!=(const DescriptorHandle& other) const { return !(*this == other); }
+};
+
+struct DescriptorAllocatorStats
+{
+	uint32_t capacity = 0;
+	uint32_t allocatedDescriptors = 0;
+	uint32_t peakDescriptors = 0;
+	uint32_t liveAllocations = 0;
+	//freed but still in use by a frame in flight
+	uint32_t pendingFreeDescriptors = 0;
+	//largest range Allocate can serve right now, small next to the free total means fragmentation
+	uint32_t largestFreeRange = 0;
+	uint64_t failedAllocations = 0;
+};
+
+// An allocation that was never freed, reported at shutdown
+struct DescriptorLeak
+{
+	DescriptorHandle handle;
+	std::string name;
+};
+
+// Index allocator behind a descriptor heap, without any d3d12 in it.
+// Ranges are served first fit from a free list that merges neighbours on return. Free invalidates the
+// handle right away but keeps the range out of the free list until the fence value of the frame that
+// last used it completed, so the gpu never reads a descriptor rewritten under it. Not thread safe,
+// the heap is only touched from the render thread.
+class DescriptorAllocator
+{
+public:
+	explicit DescriptorAllocator(uint32_t capacity = 0);
+
+	//forgets every allocation and starts over with capacity descriptors
+	void Reset(uint32_t capacity);
+
+	//null handle when no free range is large enough, name shows up in the leak report
+	DescriptorHandle Allocate(uint32_t count, const char* name = nullptr);
+
+	bool IsValid(const DescriptorHandle& handle) const;
+
+	//false for null and stale handles. The range comes back once Retire sees fenceValue complete
+	bool Free(const DescriptorHandle& handle, uint64_t fenceValue);
+
+	void Retire(uint64_t completedFenceValue);
+
+	//live allocation starting at index, null if there is none. For callers that only kept the index
+	DescriptorHandle Find(uint32_t index) const;
+
+	DescriptorAllocatorStats GetStats() const;
+
+	std::vector<DescriptorLeak> GetLiveAllocations() const;
+
+private:
+	struct Slot
+	{
+		//bumped on every free, never 0
+		uint32_t generation = 1;
+		//size of the live allocation starting here, 0 if none
+		uint32_t count = 0;
+		std::string name;
+	};
+
+	struct PendingFree
+	{
+		uint64_t fenceValue = 0;
+		uint32_t index = 0;
+		uint32_t count = 0;
+	};
+
+	void ReturnRange(uint32_t index, uint32_t count);
+
+	uint32_t capacity = 0;
+	std::vector<Slot> slots;
+
+	//start -> count of every free range, neighbours are always merged
+	std::map<uint32_t, uint32_t> freeRanges;
+	std::vector<PendingFree> pendingFrees;
+
+	uint32_t allocatedDescriptors = 0;
+	uint32_t peakDescriptors = 0;
+	uint32_t liveAllocations = 0;
+	uint32_t pendingFreeDescriptors = 0;
+	uint64_t failedAllocations = 0;
+};
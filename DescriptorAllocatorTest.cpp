@@ -0,0 +1,157 @@
+#include "UnitTest.h"
+#include "DescriptorAllocator.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+//seeded random allocations, frees and retires against a model of who owns every descriptor: live ranges never
+//overlap, freed ones come back only once the fence passed their frame, stale handles are refused, free neighbours
+//merge and the stats agree with the model after every step
+bool CheckDescriptorAllocator(std::string& outMessage)
+{
+	enum class Owner : uint8_t { Free, Live, Pending };
+
+	const uint32_t capacity = 256;
+	DescriptorAllocator allocator(capacity);
+	std::vector<Owner> owners(capacity, Owner::Free);
+	std::vector<DescriptorHandle> live;
+	std::vector<DescriptorHandle> stale;
+	//frame fence value of every pending range
+	std::vector<std::pair<DescriptorHandle, uint64_t>> pending;
+
+	std::mt19937 random(11);
+	uint64_t fenceValue = 1;
+	uint64_t completedFenceValue = 0;
+	uint32_t peakDescriptors = 0;
+	uint64_t failedAllocations = 0;
+	std::string failures;
+
+	auto countOwned = [&](Owner owner)
+	{
+		return (uint32_t)std::count(owners.begin(), owners.end(), owner);
+	};
+	auto largestFreeRun = [&]()
+	{
+		uint32_t largest = 0;
+		uint32_t run = 0;
+		for (Owner owner : owners)
+		{
+			run = owner == Owner::Free ? run + 1 : 0;
+			largest = std::max(largest, run);
+		}
+		return largest;
+	};
+	auto setOwner = [&](const DescriptorHandle& handle, Owner owner)
+	{
+		std::fill(owners.begin() + handle.index, owners.begin() + handle.index + handle.count, owner);
+	};
+
+	const uint32_t stepCount = 20000;
+	for (uint32_t step = 0; step < stepCount && failures.empty(); step++)
+	{
+		const uint32_t action = random() % 10;
+		if (action < 5)
+		{
+			const uint32_t count = 1 + random() % 16;
+			DescriptorHandle handle = allocator.Allocate(count, "fuzz");
+			if (handle.IsNull())
+			{
+				failedAllocations++;
+				if (largestFreeRun() >= count)
+				{
+					failures += ", " + std::to_string(count) + " descriptors refused with a free run large enough";
+				}
+			}
+			else if (handle.index + handle.count > capacity || handle.count != count ||
+				std::any_of(owners.begin() + handle.index, owners.begin() + handle.index + handle.count, [](Owner owner) { return owner != Owner::Free; }))
+			{
+				failures += ", range at " + std::to_string(handle.index) + " overlaps a live or pending one";
+			}
+			else
+			{
+				setOwner(handle, Owner::Live);
+				live.push_back(handle);
+			}
+		}
+		else if (action < 8 && !live.empty())
+		{
+			const size_t which = random() % live.size();
+			DescriptorHandle handle = live[which];
+			live.erase(live.begin() + which);
+			if (!allocator.Free(handle, fenceValue))
+			{
+				failures += ", a live handle couldn't be freed";
+			}
+			setOwner(handle, Owner::Pending);
+			pending.push_back({ handle, fenceValue });
+			stale.push_back(handle);
+		}
+		else
+		{
+			//the frame ends, the gpu finishes up to three frames behind
+			const uint64_t lag = random() % 4;
+			fenceValue++;
+			if (fenceValue > lag)
+			{
+				completedFenceValue = std::max(completedFenceValue, fenceValue - 1 - lag);
+			}
+			allocator.Retire(completedFenceValue);
+			for (size_t i = 0; i < pending.size();)
+			{
+				if (pending[i].second <= completedFenceValue)
+				{
+					setOwner(pending[i].first, Owner::Free);
+					pending.erase(pending.begin() + i);
+				}
+				else
+				{
+					i++;
+				}
+			}
+		}
+
+		if (!stale.empty())
+		{
+			const DescriptorHandle& handle = stale[random() % stale.size()];
+			if (allocator.IsValid(handle) || allocator.Free(handle, fenceValue))
+			{
+				failures += ", a stale handle at " + std::to_string(handle.index) + " was still accepted";
+			}
+		}
+
+		const uint32_t allocated = countOwned(Owner::Live);
+		peakDescriptors = std::max(peakDescriptors, allocated);
+		DescriptorAllocatorStats stats = allocator.GetStats();
+		if (stats.allocatedDescriptors != allocated || stats.liveAllocations != live.size() ||
+			stats.pendingFreeDescriptors != countOwned(Owner::Pending) || stats.peakDescriptors != peakDescriptors ||
+			stats.failedAllocations != failedAllocations || stats.largestFreeRange != largestFreeRun())
+		{
+			failures += ", stats differ from the model at step " + std::to_string(step);
+		}
+	}
+
+	//everything freed and retired merges back into one range
+	for (const DescriptorHandle& handle : live)
+	{
+		allocator.Free(handle, fenceValue);
+	}
+	allocator.Retire(fenceValue);
+	DescriptorAllocatorStats stats = allocator.GetStats();
+	if (stats.largestFreeRange != capacity || stats.allocatedDescriptors != 0 || stats.pendingFreeDescriptors != 0 ||
+		!allocator.GetLiveAllocations().empty())
+	{
+		failures += ", " + std::to_string(stats.largestFreeRange) + " descriptors in the largest range once everything retired";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(stepCount) + " steps, peak " + std::to_string(peakDescriptors) + " of " + std::to_string(capacity) + " descriptors, " +
+		std::to_string(failedAllocations) + " allocations refused";
+	return true;
+}
@@ -0,0 +1,175 @@
+#include "DeterministicDecode.h"
+#include "NeuralDecoderCPU.h"
+#include "ShaderCache.h"
+#include "SoftwareRenderer.h"
+#include <cmath>
+#include <cstring>
+
+//a multiply and an add stay two roundings in this file, whatever the instruction set the compiler targets
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace DeterministicDecode
+{
+	//e^x = 2^n e^r with r = x - n ln2 in [-ln2 / 2, ln2 / 2], ln2 split so n * LogTwoHigh is exact
+	static const float LogTwoHigh = 0.693145751953125f;
+	static const float LogTwoLow = 1.42860682e-6f;
+	static const float InverseLogTwo = 1.44269504f;
+
+	static float Exp(float x)
+	{
+		//past these e^x leaves the normal floats, the sigmoid is 0 or 1 there anyway
+		x = x < -87.0f ? -87.0f : (x > 88.0f ? 88.0f : x);
+
+		const float n = std::floor(x * InverseLogTwo + 0.5f);
+		float r = x - n * LogTwoHigh;
+		r = r - n * LogTwoLow;
+
+		//Taylor series to r^6, Horner order
+		float p = 1.0f / 720.0f;
+		p = p * r + 1.0f / 120.0f;
+		p = p * r + 1.0f / 24.0f;
+		p = p * r + 1.0f / 6.0f;
+		p = p * r + 0.5f;
+		p = p * r + 1.0f;
+		p = p * r + 1.0f;
+
+		//2^n built from its exponent bits, n is in [-126, 127]
+		const uint32_t bits = (uint32_t)((int32_t)n + 127) << 23;
+		float scale;
+		memcpy(&scale, &bits, sizeof(scale));
+		return p * scale;
+	}
+
+	float Sigmoid(float x)
+	{
+		return 1.0f / (1.0f + Exp(-x));
+	}
+
+	void Sample(const SoftwareTexture& texture, float u, float v, float outRGBA[4])
+	{
+		const uint32_t width = texture.width;
+		const uint32_t height = texture.height;
+
+		float x = u * width - 0.5f;
+		float y = v * height - 0.5f;
+		float x0 = std::floor(x);
+		float y0 = std::floor(y);
+		float fx = x - x0;
+		float fy = y - y0;
+
+		auto wrap = [](int64_t value, uint32_t size)
+			{
+				int64_t result = value % (int64_t)size;
+				return (uint32_t)(result < 0 ? result + size : result);
+			};
+
+		uint32_t ix0 = wrap((int64_t)x0, width);
+		uint32_t iy0 = wrap((int64_t)y0, height);
+		uint32_t ix1 = ix0 + 1 == width ? 0 : ix0 + 1;
+		uint32_t iy1 = iy0 + 1 == height ? 0 : iy0 + 1;
+
+		const float* t00 = &texture.texels[((size_t)iy0 * width + ix0) * 4];
+		const float* t10 = &texture.texels[((size_t)iy0 * width + ix1) * 4];
+		const float* t01 = &texture.texels[((size_t)iy1 * width + ix0) * 4];
+		const float* t11 = &texture.texels[((size_t)iy1 * width + ix1) * 4];
+
+		for (int c = 0; c < 4; c++)
+		{
+			float top = t00[c] + (t10[c] - t00[c]) * fx;
+			float bottom = t01[c] + (t11[c] - t01[c]) * fx;
+			outRGBA[c] = top + (bottom - top) * fy;
+		}
+	}
+
+	uint64_t Digest(const float* values, size_t count)
+	{
+		return HashShaderBytes(values, count * sizeof(float));
+	}
+}
+
+void NeuralDecoderCPU::DecodeDeterministic(const float* inputs, float* outputs, size_t count) const
+{
+	const std::vector<int32_t>& sizes = model->layer_sizes;
+	const size_t layerCount = sizes.size() - 1;
+	const int inputCount = GetInputCount();
+	const int outputCount = GetOutputCount();
+	const size_t B = BatchBlockSize;
+
+	//the batched kernel's blocks, a pixel's sums don't depend on the block it is in or on the pixels next to it
+	std::vector<float> scratch((size_t)maxLayerSize * B * 2);
+	float* const front = scratch.data();
+	float* const back = scratch.data() + (size_t)maxLayerSize * B;
+
+	for (size_t begin = 0; begin < count; begin += B)
+	{
+		const size_t pixelCount = count - begin < B ? count - begin : B;
+
+		for (int i = 0; i < inputCount; i++)
+		{
+			for (size_t p = 0; p < B; p++)
+			{
+				front[i * B + p] = p < pixelCount ? inputs[(begin + p) * inputCount + i] : 0.0f;
+			}
+		}
+
+		const float* layerInput = front;
+		float* layerOutput = back;
+
+		for (size_t layer = 0; layer < layerCount; layer++)
+		{
+			const int in = sizes[layer];
+			const int out = sizes[layer + 1];
+			const float* weights = model->weights.data() + weightOffsets[layer];
+			const float* bias = model->bias.data() + biasOffsets[layer];
+			const bool bLastLayer = layer + 1 == layerCount;
+			const bool bLinear = model->IsLinearLayer(layer);
+
+			for (int o = 0; o < out; o++)
+			{
+				const float* row = weights + (size_t)o * in;
+
+				//the bias, then every input in model order. Zero weights are not skipped, 0 * x isn't 0 for every x
+				float sum[B];
+				for (size_t p = 0; p < B; p++)
+				{
+					sum[p] = bias[o];
+				}
+				for (int i = 0; i < in; i++)
+				{
+					const float weight = row[i];
+					const float* x = layerInput + (size_t)i * B;
+					for (size_t p = 0; p < B; p++)
+					{
+						const float product = weight * x[p];
+						sum[p] = sum[p] + product;
+					}
+				}
+
+				if (bLastLayer)
+				{
+					for (size_t p = 0; p < pixelCount; p++)
+					{
+						outputs[(begin + p) * outputCount + o] = DeterministicDecode::Sigmoid(sum[p]);
+					}
+				}
+				else
+				{
+					float* y = layerOutput + (size_t)o * B;
+					for (size_t p = 0; p < B; p++)
+					{
+						y[p] = sum[p] > 0.0f || bLinear ? sum[p] : 0.0f;
+					}
+				}
+			}
+
+			layerInput = layerOutput;
+			layerOutput = layerOutput == front ? back : front;
+		}
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+struct SoftwareTexture;
+
+// Float math that gives the same bits on every cpu, compiler and thread count, for decoded assets that are hashed.
+// DeterministicDecode.cpp is compiled without contracting a multiply and an add into an FMA and calls nothing from
+// the C library whose results differ between platforms. The deterministic kernel of NeuralDecoderCPU lives there too.
+namespace DeterministicDecode
+{
+	//1 / (1 + e^-x) from additions, multiplications and one division, within a few ulp of the C library's
+	float Sigmoid(float x);
+
+	//SoftwareTexture::Sample with every product rounded before it is added
+	void Sample(const SoftwareTexture& texture, float u, float v, float outRGBA[4]);
+
+	//64 bit FNV-1a of the bits of count floats in order, the digest of a decoded asset
+	uint64_t Digest(const float* values, size_t count);
+}
@@ -0,0 +1,63 @@
+#include "FrameScheduler.h"
+#include <algorithm>
+#include <cassert>
+
+FrameScheduler::FrameScheduler(uint32_t frameLatency)
+{
+	SetFrameLatency(frameLatency);
+}
+
+void FrameScheduler::SetFrameLatency(uint32_t newFrameLatency)
+{
+	uint32_t maxLatency = MaxFrameLatency;
+	frameLatency = std::clamp(newFrameLatency, 1u, maxLatency);
+}
+
+uint64_t FrameScheduler::GetFrameWaitValue() const
+{
+	//right after the latency went down the next context may have last been used further back than
+	//frameLatency frames, the frame that many back must complete too
+	uint64_t contextWaitValue = contextFenceValues[frameCount % frameLatency];
+	uint64_t latencyWaitValue = lastSignaledValue >= frameLatency ? lastSignaledValue + 1 - frameLatency : 0;
+	return std::max(contextWaitValue, latencyWaitValue);
+}
+
+uint32_t FrameScheduler::BeginFrame(uint64_t completedFenceValue)
+{
+	assert(completedFenceValue >= GetFrameWaitValue());
+
+	currentContext = (uint32_t)(frameCount % frameLatency);
+	frameCount++;
+	bInFrame = true;
+
+	Retire(completedFenceValue);
+	return currentContext;
+}
+
+uint64_t FrameScheduler::EndFrame()
+{
+	uint64_t fenceValue = nextFenceValue++;
+	contextFenceValues[currentContext] = fenceValue;
+	lastSignaledValue = fenceValue;
+	bInFrame = false;
+	return fenceValue;
+}
+
+void FrameScheduler::Defer(std::function<void()> callback)
+{
+	PendingCallback entry;
+	entry.fenceValue = bInFrame ? nextFenceValue : lastSignaledValue;
+	entry.callback = std::move(callback);
+	pending.push_back(std::move(entry));
+}
+
+void FrameScheduler::Retire(uint64_t completedFenceValue)
+{
+	while (!pending.empty() && pending.front().fenceValue <= completedFenceValue)
+	{
+		//popped first, the callback may defer more work
+		std::function<void()> callback = std::move(pending.front().callback);
+		pending.pop_front();
+		callback();
+	}
+}
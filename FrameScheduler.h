@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+// Frame pacing for a queue with up to frameLatency frames in flight, without any d3d12 in it.
+// Every frame records into one of frameLatency contexts (command allocator, constant slice, timestamp
+// slots) and signals a fence value when it is submitted. A context is recorded into again only once the
+// fence value of the frame that last used it completed, so the cpu waits for the gpu only when it runs
+// frameLatency frames ahead. Resources released while recording are kept alive until every frame that
+// could still use them completed. The device drives it with its fence, tests with a simulated queue.
+class FrameScheduler
+{
+public:
+	static const uint32_t MaxFrameLatency = 3;
+
+	explicit FrameScheduler(uint32_t frameLatency = 2);
+
+	//clamped to 1..MaxFrameLatency. Safe at any time, a context always waits for its own last frame and
+	//the cpu for the frame frameLatency back
+	void SetFrameLatency(uint32_t frameLatency);
+	uint32_t GetFrameLatency() const { return frameLatency; }
+
+	//fence value that must complete before the next BeginFrame: the last frame of its context and the frame
+	//frameLatency back, 0 if neither ran
+	uint64_t GetFrameWaitValue() const;
+
+	//starts recording the next frame and returns its context index. completedFenceValue must have
+	//reached GetFrameWaitValue(), deferred work up to it runs here
+	uint32_t BeginFrame(uint64_t completedFenceValue);
+
+	//fence value to signal after the frame's work was submitted
+	uint64_t EndFrame();
+
+	//value the frame being recorded signals, resources it uses retire once it completes
+	uint64_t GetCurrentFrameFenceValue() const { return nextFenceValue; }
+
+	//highest value signaled so far, waiting for it drains the queue
+	uint64_t GetLastSignaledValue() const { return lastSignaledValue; }
+
+	uint32_t GetCurrentContext() const { return currentContext; }
+	uint64_t GetFrameCount() const { return frameCount; }
+
+	//runs callback once the frame being recorded and all before it completed. Between frames the last
+	//submitted frame is the newest that could use what callback releases
+	void Defer(std::function<void()> callback);
+
+	//runs the deferred work of every frame whose fence value is at most completedFenceValue
+	void Retire(uint64_t completedFenceValue);
+
+	size_t GetPendingCount() const { return pending.size(); }
+
+private:
+	struct PendingCallback
+	{
+		uint64_t fenceValue = 0;
+		std::function<void()> callback;
+	};
+
+	uint32_t frameLatency = 2;
+
+	//fence value signaled by the last frame recorded into each context
+	uint64_t contextFenceValues[MaxFrameLatency] = {};
+
+	uint32_t currentContext = 0;
+	uint64_t frameCount = 0;
+	bool bInFrame = false;
+
+	//fence values start at 1, a fence created with 0 has completed nothing
+	uint64_t nextFenceValue = 1;
+	uint64_t lastSignaledValue = 0;
+
+	//ordered by fence value, Defer always tags with the newest one in use
+	std::deque<PendingCallback> pending;
+};
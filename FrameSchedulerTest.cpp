@@ -0,0 +1,118 @@
+#include "UnitTest.h"
+#include "FrameScheduler.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+//a simulated queue that finishes frames only when the cpu waits for them, and now and then one more on its own:
+//the cpu never records more than the frame latency ahead as it goes 3, 2, 3, every run of latency frames uses each
+//context once, and deferred work runs only once the frame recording it, or the last submitted between frames, completed
+bool CheckFrameScheduler(std::string& outMessage)
+{
+	FrameScheduler scheduler(FrameScheduler::MaxFrameLatency);
+	std::mt19937 random(3);
+	uint64_t completedFenceValue = 0;
+	//the fence value each context signaled last, as the test saw it
+	uint64_t contextFenceValues[FrameScheduler::MaxFrameLatency] = {};
+	uint32_t deferredCount = 0;
+	uint32_t ranCount = 0;
+	uint32_t earlyCount = 0;
+
+	auto defer = [&](uint64_t fenceValue)
+	{
+		deferredCount++;
+		scheduler.Defer([&, fenceValue]()
+		{
+			ranCount++;
+			if (completedFenceValue < fenceValue)
+			{
+				earlyCount++;
+			}
+		});
+	};
+
+	std::string failures;
+	std::string aheadCounts;
+	const uint32_t latencies[] = { 3, 2, 3 };
+	for (uint32_t latency : latencies)
+	{
+		scheduler.SetFrameLatency(latency);
+
+		std::vector<uint32_t> contexts;
+		uint64_t maxAhead = 0;
+		for (int frame = 0; frame < 30; frame++)
+		{
+			//the gpu finishes what the cpu waits for and no more
+			completedFenceValue = std::max(completedFenceValue, scheduler.GetFrameWaitValue());
+			uint32_t context = scheduler.BeginFrame(completedFenceValue);
+			if (context >= latency)
+			{
+				failures += ", context " + std::to_string(context) + " at latency " + std::to_string(latency);
+				break;
+			}
+			if (contextFenceValues[context] > completedFenceValue)
+			{
+				failures += ", context " + std::to_string(context) + " recorded again before its last frame completed";
+			}
+			contexts.push_back(context);
+
+			//submitted frames not completed yet, and the one recording
+			maxAhead = std::max(maxAhead, scheduler.GetLastSignaledValue() - completedFenceValue + 1);
+
+			if (frame % 4 == 0)
+			{
+				defer(scheduler.GetCurrentFrameFenceValue());
+			}
+			contextFenceValues[context] = scheduler.EndFrame();
+			if (frame % 5 == 0)
+			{
+				defer(scheduler.GetLastSignaledValue());
+			}
+
+			if (random() % 3 == 0 && completedFenceValue < scheduler.GetLastSignaledValue())
+			{
+				completedFenceValue++;
+			}
+		}
+
+		if (maxAhead != latency)
+		{
+			failures += ", at latency " + std::to_string(latency) + " the cpu ran " + std::to_string(maxAhead) + " frames ahead";
+		}
+		for (size_t i = 0; i + latency <= contexts.size(); i++)
+		{
+			std::set<uint32_t> window(contexts.begin() + i, contexts.begin() + i + latency);
+			if (window.size() != latency)
+			{
+				failures += ", contexts don't rotate at latency " + std::to_string(latency);
+				break;
+			}
+		}
+		aheadCounts += (aheadCounts.empty() ? "" : ", ") + std::to_string(maxAhead);
+	}
+
+	//between frames with no frame after it, while the gpu is still behind, then drained
+	defer(scheduler.GetLastSignaledValue());
+	scheduler.Retire(completedFenceValue);
+	completedFenceValue = scheduler.GetLastSignaledValue();
+	scheduler.Retire(completedFenceValue);
+
+	if (earlyCount > 0)
+	{
+		failures += ", " + std::to_string(earlyCount) + " deferred callbacks ran before their frame completed";
+	}
+	if (ranCount != deferredCount || scheduler.GetPendingCount() != 0)
+	{
+		failures += ", " + std::to_string(ranCount) + " of " + std::to_string(deferredCount) + " deferred callbacks ran once the queue drained";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "latency 3, 2, 3 ran " + aheadCounts + " frames ahead, " + std::to_string(deferredCount) + " deferred callbacks";
+	return true;
+}
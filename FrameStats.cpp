@@ -0,0 +1,157 @@
+#include "FrameStats.h"
+#include <algorithm>
+#include <fstream>
+
+TimingStatistics ComputeTimingStatistics(std::vector<float>& values)
+{
+	TimingStatistics stats;
+	stats.count = values.size();
+	if (values.empty())
+	{
+		return stats;
+	}
+
+	std::sort(values.begin(), values.end());
+
+	double sum = 0.0;
+	for (float value : values)
+	{
+		sum += value;
+	}
+	stats.mean = (float)(sum / values.size());
+
+	//nearest-rank percentile, ceil(percent / 100 * count) in integers, a float product rounds across ranks
+	auto percentile = [&values](size_t percent)
+	{
+		size_t rank = (percent * values.size() + 99) / 100;
+		rank = std::clamp(rank, (size_t)1, values.size());
+		return values[rank - 1];
+	};
+
+	stats.p50 = percentile(50);
+	stats.p90 = percentile(90);
+	stats.p99 = percentile(99);
+	stats.max = values.back();
+
+	return stats;
+}
+
+std::vector<float> BuildHistogram(const std::vector<float>& values, int bucketCount, float maxValue)
+{
+	std::vector<float> buckets(bucketCount > 0 ? bucketCount : 1, 0.0f);
+	if (maxValue <= 0.0f)
+	{
+		return buckets;
+	}
+
+	for (float value : values)
+	{
+		int bucket = (int)(value / maxValue * buckets.size());
+		bucket = std::clamp(bucket, 0, (int)buckets.size() - 1);
+		buckets[bucket] += 1.0f;
+	}
+	return buckets;
+}
+
+void FrameStats::Push(FrameSample sample)
+{
+	uint64_t index = writeIndex.load(std::memory_order_relaxed);
+	Slot& slot = slots[index % Capacity];
+
+	//invalidate, write, then publish with the new tag
+	slot.tag.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot.frameMs.store(sample.frameMs, std::memory_order_relaxed);
+	slot.cpuMs.store(sample.cpuMs, std::memory_order_relaxed);
+	slot.gpuMs.store(sample.gpuMs, std::memory_order_relaxed);
+	slot.waitMs.store(sample.waitMs, std::memory_order_relaxed);
+
+	slot.tag.store(index + 1, std::memory_order_release);
+	writeIndex.store(index + 1, std::memory_order_release);
+}
+
+size_t FrameStats::Snapshot(std::vector<FrameSample>& outSamples, size_t inWindow) const
+{
+	outSamples.clear();
+
+	uint64_t end = writeIndex.load(std::memory_order_acquire);
+	uint64_t count = std::min<uint64_t>({ end, (uint64_t)inWindow, (uint64_t)Capacity });
+	outSamples.reserve((size_t)count);
+
+	for (uint64_t index = end - count; index < end; index++)
+	{
+		const Slot& slot = slots[index % Capacity];
+
+		uint64_t tag = slot.tag.load(std::memory_order_acquire);
+		FrameSample sample;
+		sample.frameIndex = index;
+		sample.frameMs = slot.frameMs.load(std::memory_order_relaxed);
+		sample.cpuMs = slot.cpuMs.load(std::memory_order_relaxed);
+		sample.gpuMs = slot.gpuMs.load(std::memory_order_relaxed);
+		sample.waitMs = slot.waitMs.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		//overwritten by the writer while copying
+		if (tag != index + 1 || slot.tag.load(std::memory_order_relaxed) != tag)
+		{
+			continue;
+		}
+
+		outSamples.push_back(sample);
+	}
+
+	return outSamples.size();
+}
+
+FrameStats::Summary FrameStats::Summarize() const
+{
+	std::vector<FrameSample> samples;
+	Snapshot(samples, window);
+
+	std::vector<float> frame, cpu, gpu, wait;
+	frame.reserve(samples.size());
+	cpu.reserve(samples.size());
+	gpu.reserve(samples.size());
+	wait.reserve(samples.size());
+
+	for (const FrameSample& sample : samples)
+	{
+		frame.push_back(sample.frameMs);
+		cpu.push_back(sample.cpuMs);
+		wait.push_back(sample.waitMs);
+
+		//frames without gpu timestamps don't count
+		if (sample.gpuMs > 0.0f)
+		{
+			gpu.push_back(sample.gpuMs);
+		}
+	}
+
+	Summary summary;
+	summary.frame = ComputeTimingStatistics(frame);
+	summary.cpu = ComputeTimingStatistics(cpu);
+	summary.gpu = ComputeTimingStatistics(gpu);
+	summary.wait = ComputeTimingStatistics(wait);
+	return summary;
+}
+
+bool FrameStats::ExportCSV(const std::string& path) const
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+
+	std::vector<FrameSample> samples;
+	Snapshot(samples, Capacity);
+
+	file << "Frame,FrameTime,CPUTime,GPUTime,WaitTime\n";
+	for (const FrameSample& sample : samples)
+	{
+		file << sample.frameIndex << "," << sample.frameMs << "," << sample.cpuMs << "," << sample.gpuMs << "," << sample.waitMs << "\n";
+	}
+
+	return true;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// Timings of one frame in milliseconds
+struct FrameSample
+{
+	uint64_t frameIndex = 0;
+
+	//wall time since the previous frame
+	float frameMs = 0.0f;
+	//cpu work, frame time minus time blocked on the gpu
+	float cpuMs = 0.0f;
+	//gpu time between the first and last timestamp of the frame, 0 when unavailable
+	float gpuMs = 0.0f;
+	//time blocked waiting on fences
+	float waitMs = 0.0f;
+};
+
+// Distribution summary of a set of timings
+struct TimingStatistics
+{
+	float mean = 0.0f;
+	float p50 = 0.0f;
+	float p90 = 0.0f;
+	float p99 = 0.0f;
+	float max = 0.0f;
+	size_t count = 0;
+};
+
+// Percentile summary of values, nearest-rank percentiles. values is reordered.
+TimingStatistics ComputeTimingStatistics(std::vector<float>& values);
+
+// Bucket values into a histogram covering [0, maxValue], the last bucket also takes everything above
+std::vector<float> BuildHistogram(const std::vector<float>& values, int bucketCount, float maxValue);
+
+// Fixed size ring of frame samples.
+// Single writer (the frame loop), any number of lock-free readers. Every slot is tagged with its
+// frame index so readers can detect and skip slots the writer overwrote while they were copying.
+class FrameStats
+{
+public:
+	static const size_t Capacity = 4096;
+
+	//append a frame, frameIndex is assigned here
+	void Push(FrameSample sample);
+
+	//copy the newest samples (at most window) in frame order
+	size_t Snapshot(std::vector<FrameSample>& outSamples, size_t window) const;
+
+	uint64_t GetFrameCount() const { return writeIndex.load(std::memory_order_acquire); }
+
+	//sliding window used by the summary getters
+	void SetWindow(size_t inWindow) { window = inWindow < Capacity ? inWindow : Capacity; }
+	size_t GetWindow() const { return window; }
+
+	struct Summary
+	{
+		TimingStatistics frame;
+		TimingStatistics cpu;
+		TimingStatistics gpu;
+		TimingStatistics wait;
+	};
+
+	//percentiles over the sliding window
+	Summary Summarize() const;
+
+	//write every sample still in the ring as csv, returns false when the file can't be opened
+	bool ExportCSV(const std::string& path) const;
+
+private:
+	struct Slot
+	{
+		//frame index + 1 of the sample stored in this slot, 0 while empty or being written
+		std::atomic<uint64_t> tag{ 0 };
+		std::atomic<float> frameMs{ 0.0f };
+		std::atomic<float> cpuMs{ 0.0f };
+		std::atomic<float> gpuMs{ 0.0f };
+		std::atomic<float> waitMs{ 0.0f };
+	};
+
+	Slot slots[Capacity];
+	std::atomic<uint64_t> writeIndex{ 0 };
+	size_t window = 600;
+};
@@ -0,0 +1,108 @@
+#include "UnitTest.h"
+#include "FrameStats.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+//nearest-rank percentiles of a known sequence, the sliding window once the ring wrapped, histogram buckets and
+//the csv export of what the ring still holds
+bool CheckFrameStats(std::string& outMessage)
+{
+	std::string failures;
+
+	//1..100 shuffled, the p-th percentile is p
+	std::vector<float> values;
+	for (int i = 1; i <= 100; i++)
+	{
+		values.push_back((float)i);
+	}
+	std::shuffle(values.begin(), values.end(), std::mt19937(5));
+	TimingStatistics statistics = ComputeTimingStatistics(values);
+	if (statistics.p50 != 50.0f || statistics.p90 != 90.0f || statistics.p99 != 99.0f || statistics.max != 100.0f ||
+		statistics.mean != 50.5f || statistics.count != 100)
+	{
+		failures += ", percentiles of 1..100 are " + std::to_string(statistics.p50) + ", " + std::to_string(statistics.p90) + ", " +
+			std::to_string(statistics.p99) + ", " + std::to_string(statistics.max);
+	}
+	std::vector<float> single = { 7.0f };
+	statistics = ComputeTimingStatistics(single);
+	if (statistics.p50 != 7.0f || statistics.p99 != 7.0f || statistics.max != 7.0f)
+	{
+		failures += ", percentiles of one value aren't that value";
+	}
+
+	//the last bucket takes what is above the range, the first what is below
+	std::vector<float> histogram = BuildHistogram({ -1.0f, 0.0f, 0.5f, 1.0f, 2.5f, 9.9f, 10.0f, 50.0f }, 10, 10.0f);
+	const std::vector<float> expectedHistogram = { 3, 1, 1, 0, 0, 0, 0, 0, 0, 3 };
+	if (histogram != expectedHistogram)
+	{
+		failures += ", histogram buckets differ";
+	}
+
+	//frame time is the frame index, every other frame without gpu timestamps
+	std::unique_ptr<FrameStats> stats = std::make_unique<FrameStats>();
+	const uint64_t frameCount = FrameStats::Capacity + 100;
+	for (uint64_t i = 0; i < frameCount; i++)
+	{
+		FrameSample sample;
+		sample.frameMs = (float)i;
+		sample.cpuMs = 1.0f;
+		sample.gpuMs = i % 2 == 0 ? 0.0f : 2.0f;
+		stats->Push(sample);
+	}
+	stats->SetWindow(600);
+	FrameStats::Summary summary = stats->Summarize();
+	const float windowStart = (float)(frameCount - 600);
+	if (summary.frame.count != 600 || summary.frame.p50 != windowStart + 299 || summary.frame.max != (float)(frameCount - 1) ||
+		summary.gpu.count != 300 || summary.cpu.p99 != 1.0f)
+	{
+		failures += ", window of the wrapped ring has " + std::to_string(summary.frame.count) + " frames, p50 " + std::to_string(summary.frame.p50);
+	}
+	std::vector<FrameSample> samples;
+	if (stats->Snapshot(samples, 2 * FrameStats::Capacity) != FrameStats::Capacity || samples.front().frameIndex != 100 ||
+		samples.back().frameIndex != frameCount - 1)
+	{
+		failures += ", snapshot of the wrapped ring doesn't hold its newest samples";
+	}
+	stats->SetWindow(FrameStats::Capacity + 5);
+	if (stats->GetWindow() != FrameStats::Capacity)
+	{
+		failures += ", window larger than the ring";
+	}
+
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "UnitTestFrameStats.csv";
+	size_t rowCount = 0;
+	std::string header;
+	if (!stats->ExportCSV(path.string()))
+	{
+		failures += ", can't write " + path.string();
+	}
+	else
+	{
+		std::ifstream file(path);
+		std::getline(file, header);
+		std::string line;
+		while (std::getline(file, line))
+		{
+			rowCount++;
+		}
+	}
+	std::filesystem::remove(path);
+	if (header != "Frame,FrameTime,CPUTime,GPUTime,WaitTime" || rowCount != FrameStats::Capacity)
+	{
+		failures += ", csv has header " + header + " and " + std::to_string(rowCount) + " rows";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "p50 " + std::to_string(summary.frame.p50) + " over the last 600 of " + std::to_string(frameCount) + " frames, " +
+		std::to_string(rowCount) + " csv rows";
+	return true;
+}
@@ -0,0 +1,1709 @@
+// Golden image regression test of the shading paths.
+// Every scenario of Golden/scenarios.json is rendered by the cpu reference of PSMain and compared
+// with its stored golden image. Failures write the actual image and a difference heatmap next to each other.
+// Rendering goes through the software backend and the backend materials, and the same scenarios are
+// submitted to the null backend once to check the commands and object lifetimes of the pipeline.
+// The shader cache keys and archive format are checked on sources written to a temporary directory.
+// Decoders compiled from the library models, baked in, interpreted or generated as machine code at runtime,
+// are checked against the generic kernel. Pruning keeps its n:m structure and removes dead neurons exactly.
+// The cpu trainer gives the same weights on any thread count and after resuming from a checkpoint,
+// and fits the grids of a new material to a frozen decoder.
+// --update rewrites the golden images, after a change in output was reviewed and is intended.
+#include "DDSImage.h"
+#include "BakedDecoders.h"
+#include "DecoderCompiler.h"
+#include "DecoderFactorization.h"
+#include "DecoderJIT.h"
+#include "DecoderPruning.h"
+#include "DeterministicDecode.h"
+#include "ImageMetrics.h"
+#include "NeuralDecoderCPU.h"
+#include "NeuralModelPool.h"
+#include "NeuralTrainer.h"
+#include "NullRenderBackend.h"
+#include "ShaderCache.h"
+#include "SoftwareRenderBackend.h"
+#include "ThreadPool.h"
+#include "nlohmann/json.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+
+using Json = nlohmann::json;
+
+// How far a render may drift from its golden image, differences are in [0, 1] per channel
+struct GoldenTolerances
+{
+	double minPSNR = 40.0;
+	//largest difference of any channel of any pixel
+	double maxDifference = 24.0 / 255.0;
+	//pixels differing by more than this count as bad
+	double badPixelDifference = 8.0 / 255.0;
+	double maxBadPixelRatio = 0.001;
+
+	//overrides the fields present in json
+	void Read(const Json& json)
+	{
+		minPSNR = json.value("minPSNR", minPSNR);
+		maxDifference = json.value("maxDifference", maxDifference);
+		badPixelDifference = json.value("badPixelDifference", badPixelDifference);
+		maxBadPixelRatio = json.value("maxBadPixelRatio", maxBadPixelRatio);
+	}
+};
+
+struct GoldenScenario
+{
+	std::string name;
+	std::string material;
+	uint32_t width = 256;
+	uint32_t height = 144;
+	RectConstantBuffer constants;
+	GoldenTolerances tolerances;
+};
+
+struct GoldenOptions
+{
+	std::string scenariosPath = "Golden/scenarios.json";
+	std::string goldenDirectory = "Golden";
+	std::string outputDirectory = "golden_out";
+	std::string filter;
+	bool bUpdate = false;
+	uint32_t threadCount = 0;
+};
+
+static bool ParseOptions(int argc, char** argv, GoldenOptions& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--update")
+		{
+			options.bUpdate = true;
+			continue;
+		}
+
+		size_t separator = argument.find('=');
+		if (argument.rfind("--", 0) != 0 || separator == std::string::npos)
+		{
+			std::cout << "Unknown argument " << argument << std::endl;
+			return false;
+		}
+
+		std::string key = argument.substr(2, separator - 2);
+		std::string value = argument.substr(separator + 1);
+		if (key == "scenarios") options.scenariosPath = value;
+		else if (key == "golden") options.goldenDirectory = value;
+		else if (key == "output") options.outputDirectory = value;
+		else if (key == "filter") options.filter = value;
+		else if (key == "threads")
+		{
+			try
+			{
+				options.threadCount = (uint32_t)std::stoul(value);
+			}
+			catch (const std::exception&)
+			{
+				std::cout << "Invalid value for --threads: " << value << std::endl;
+				return false;
+			}
+		}
+		else
+		{
+			std::cout << "Unknown argument " << argument << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool LoadScenarios(const std::string& path, std::vector<GoldenScenario>& outScenarios, std::string* error)
+{
+	std::ifstream file(path);
+	if (!file)
+	{
+		*error = "File not found: " + path;
+		return false;
+	}
+
+	try
+	{
+		Json json = Json::parse(file);
+
+		GoldenTolerances defaults;
+		if (json.contains("tolerances"))
+		{
+			defaults.Read(json["tolerances"]);
+		}
+
+		for (const Json& entry : json["scenarios"])
+		{
+			GoldenScenario scenario;
+			scenario.name = entry.at("name");
+			scenario.material = entry.at("material");
+			scenario.width = entry.value("width", scenario.width);
+			scenario.height = entry.value("height", scenario.height);
+
+			if (entry.contains("constants"))
+			{
+				const Json& constants = entry["constants"];
+				scenario.constants.scale = constants.value("scale", scenario.constants.scale);
+				scenario.constants.intensity = constants.value("intensity", scenario.constants.intensity);
+				scenario.constants.lightpos = constants.value("lightpos", scenario.constants.lightpos);
+				scenario.constants.metalness = constants.value("metalness", scenario.constants.metalness);
+			}
+
+			scenario.tolerances = defaults;
+			if (entry.contains("tolerances"))
+			{
+				scenario.tolerances.Read(entry["tolerances"]);
+			}
+
+			outScenarios.push_back(scenario);
+		}
+	}
+	catch (const std::exception& exception)
+	{
+		*error = std::string("Invalid scenarios file ") + path + ": " + exception.what();
+		return false;
+	}
+	return true;
+}
+
+static std::vector<float> ToFloat(const std::vector<uint8_t>& rgba8)
+{
+	std::vector<float> rgba(rgba8.size());
+	for (size_t i = 0; i < rgba8.size(); i++)
+	{
+		rgba[i] = rgba8[i] / 255.0f;
+	}
+	return rgba;
+}
+
+// Compares one render with its golden image, returns false and explains why when a tolerance is exceeded
+static bool CompareWithGolden(const GoldenScenario& scenario, const std::vector<uint8_t>& actual, const std::string& goldenPath,
+	const GoldenOptions& options, std::string& outMessage)
+{
+	DDSImage golden;
+	std::string error;
+	if (!golden.Load(goldenPath, &error))
+	{
+		outMessage = error + ", run with --update to create it";
+		return false;
+	}
+	if (golden.format != DDSFormat::RGBA8 || golden.width != scenario.width || golden.height != scenario.height)
+	{
+		outMessage = "golden image is " + std::to_string(golden.width) + "x" + std::to_string(golden.height) + " " +
+			DDSImage::GetFormatName(golden.format) + ", expected " + std::to_string(scenario.width) + "x" + std::to_string(scenario.height) + " RGBA8";
+		return false;
+	}
+
+	std::vector<uint8_t> goldenRGBA8(golden.data.begin(), golden.data.begin() + golden.GetMipSize(0));
+	std::vector<float> a = ToFloat(actual);
+	std::vector<float> b = ToFloat(goldenRGBA8);
+	size_t pixelCount = (size_t)scenario.width * scenario.height;
+
+	//alpha is always 1, only color is compared
+	double psnr = ImageMetrics::PSNR(ImageMetrics::MeanSquaredError(a.data(), b.data(), pixelCount, 4, 0, 3));
+
+	std::vector<float> difference;
+	ImageMetrics::AbsoluteDifference(a.data(), b.data(), pixelCount, 4, 3, difference);
+	float maxDifference = 0.0f;
+	size_t badPixels = 0;
+	for (float value : difference)
+	{
+		maxDifference = std::max(maxDifference, value);
+		if (value > scenario.tolerances.badPixelDifference)
+		{
+			badPixels++;
+		}
+	}
+	double badPixelRatio = (double)badPixels / (double)pixelCount;
+
+	const GoldenTolerances& tolerances = scenario.tolerances;
+	std::string failures;
+	if (psnr < tolerances.minPSNR)
+	{
+		failures += " PSNR " + std::to_string(psnr) + " < " + std::to_string(tolerances.minPSNR) + ";";
+	}
+	if (maxDifference > tolerances.maxDifference)
+	{
+		failures += " max difference " + std::to_string(maxDifference * 255.0) + "/255 > " + std::to_string(tolerances.maxDifference * 255.0) + "/255;";
+	}
+	if (badPixelRatio > tolerances.maxBadPixelRatio)
+	{
+		failures += " bad pixels " + std::to_string(badPixelRatio * 100.0) + "% > " + std::to_string(tolerances.maxBadPixelRatio * 100.0) + "%;";
+	}
+
+	if (failures.empty())
+	{
+		outMessage = "PSNR " + std::to_string(psnr) + ", max difference " + std::to_string(maxDifference * 255.0) + "/255";
+		return true;
+	}
+
+	//the heatmap saturates at the max difference tolerance, anything red is over it
+	std::filesystem::create_directories(options.outputDirectory);
+	std::string actualPath = options.outputDirectory + "/" + scenario.name + "_actual.dds";
+	std::string diffPath = options.outputDirectory + "/" + scenario.name + "_diff.dds";
+
+	std::vector<uint8_t> heatmap;
+	ImageMetrics::Heatmap(difference, (float)tolerances.maxDifference, heatmap);
+	DDSImage::SaveRGBA8(actualPath, scenario.width, scenario.height, actual);
+	DDSImage::SaveRGBA8(diffPath, scenario.width, scenario.height, heatmap);
+
+	outMessage = failures.substr(1) + " wrote " + actualPath + " and " + diffPath;
+	return false;
+}
+
+//every scenario drawn once on the null backend: one draw per frame, nothing used after it was destroyed,
+//and every object gone once the materials are released
+static bool CheckPipeline(const std::vector<GoldenScenario>& scenarios, const GoldenOptions& options, std::string& outMessage)
+{
+	//two frames in flight, so destroyed objects have to wait for their fence
+	NullRenderBackend backend(2);
+	std::map<std::string, std::unique_ptr<BackendMaterial>> materials;
+
+	size_t frames = 0;
+	for (const GoldenScenario& scenario : scenarios)
+	{
+		if (!options.filter.empty() && scenario.name.find(options.filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		std::unique_ptr<BackendMaterial>& material = materials[scenario.material];
+		const MaterialDesc* desc = FindMaterialDesc(scenario.material);
+		if (!material && desc)
+		{
+			material = BackendMaterial::Create(backend, *desc);
+		}
+		if (!material)
+		{
+			//reported by the scenario itself
+			continue;
+		}
+
+		backend.SetResolution(scenario.width, scenario.height);
+		backend.BeginFrame();
+		material->Draw(scenario.constants);
+		backend.EndFrame();
+		frames++;
+	}
+
+	materials.clear();
+	backend.WaitForIdle();
+
+	std::string failures;
+	if (backend.CountCommands(NullCommandType::Draw) != frames || backend.CountCommands(NullCommandType::EndFrame) != frames)
+	{
+		failures += ", " + std::to_string(backend.CountCommands(NullCommandType::Draw)) + " draws for " + std::to_string(frames) + " frames";
+	}
+	for (const std::string& validationError : backend.GetValidationErrors())
+	{
+		failures += ", " + validationError;
+	}
+	if (backend.GetLiveObjectCount() != 0)
+	{
+		failures += ", " + std::to_string(backend.GetLiveObjectCount()) + " objects left after release";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(frames) + " frames, " + std::to_string(backend.GetCommands().size()) + " commands";
+	return true;
+}
+
+static void WriteText(const std::filesystem::path& path, const std::string& text)
+{
+	std::ofstream file(path, std::ios::binary);
+	file << text;
+}
+
+//cache keys change with every input of the compiler including the included files, archives round trip
+//and damaged ones are rejected whole
+static bool CheckShaderCache(std::string& outMessage)
+{
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "GoldenTestShaderCache";
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory);
+	WriteText(directory / "Main.hlsl", "#include \"Common.hlsl\"\nfloat4 PSMain() : SV_Target { return Value(); }\n");
+	WriteText(directory / "Common.hlsl", "float4 Value() { return 1; }\n");
+
+	std::string failures;
+	std::string error;
+
+	//the real shaders hash, anything they include is found
+	uint64_t shaderHash = 0;
+	if (!HashShaderSource("Shaders", "PixelShader.hlsl", shaderHash, nullptr, &error))
+	{
+		failures += ", " + error;
+	}
+
+	uint64_t sourceHash = 0;
+	std::vector<std::string> files;
+	if (!HashShaderSource(directory.string(), "Main.hlsl", sourceHash, &files, &error))
+	{
+		failures += ", " + error;
+	}
+	if (files != std::vector<std::string>{ "Main.hlsl", "Common.hlsl" })
+	{
+		failures += ", includes not followed";
+	}
+
+	ShaderPermutation permutation;
+	permutation.file = "Main.hlsl";
+	permutation.entryPoint = "PSMain";
+	permutation.target = "ps_5_0";
+	permutation.defines = { { "USE_NEURAL_TEXTURES", "1" } };
+	uint64_t key = ComputeShaderKey(sourceHash, permutation);
+
+	std::vector<uint64_t> keys = { key };
+	ShaderPermutation variant = permutation;
+	variant.defines[0].second = "0";
+	keys.push_back(ComputeShaderKey(sourceHash, variant));
+	variant = permutation;
+	variant.defines.push_back({ "NODE_COUNT", "32" });
+	keys.push_back(ComputeShaderKey(sourceHash, variant));
+	variant = permutation;
+	variant.entryPoint = "VSMain";
+	keys.push_back(ComputeShaderKey(sourceHash, variant));
+	variant = permutation;
+	variant.target = "ps_5_1";
+	keys.push_back(ComputeShaderKey(sourceHash, variant));
+	variant = permutation;
+	variant.compileFlags = 1;
+	keys.push_back(ComputeShaderKey(sourceHash, variant));
+
+	WriteText(directory / "Common.hlsl", "float4 Value() { return 0.5; }\n");
+	uint64_t changedHash = 0;
+	HashShaderSource(directory.string(), "Main.hlsl", changedHash, nullptr, &error);
+	keys.push_back(ComputeShaderKey(changedHash, permutation));
+
+	if (ComputeShaderKey(sourceHash, permutation) != key)
+	{
+		failures += ", key not stable";
+	}
+	std::vector<uint64_t> sortedKeys = keys;
+	std::sort(sortedKeys.begin(), sortedKeys.end());
+	if (std::unique(sortedKeys.begin(), sortedKeys.end()) != sortedKeys.end())
+	{
+		failures += ", a changed input kept its key";
+	}
+
+	//every key stored with different bytes, read back from the archive
+	ShaderCache cache;
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		std::string bytecode = "bytecode " + std::to_string(i);
+		cache.Store(keys[i], bytecode.data(), bytecode.size());
+	}
+	std::string archivePath = (directory / "archive.bin").string();
+	if (!cache.SaveArchive(archivePath, &error))
+	{
+		failures += ", " + error;
+	}
+
+	ShaderCache loaded;
+	if (!loaded.LoadArchive(archivePath, &error))
+	{
+		failures += ", " + error;
+	}
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		std::vector<uint8_t> bytecode;
+		std::string expected = "bytecode " + std::to_string(i);
+		if (!loaded.Find(keys[i], bytecode) || std::string(bytecode.begin(), bytecode.end()) != expected)
+		{
+			failures += ", archive entry " + FormatShaderKey(keys[i]) + " lost";
+		}
+	}
+
+	//one flipped byte of bytecode
+	size_t archiveSize = (size_t)std::filesystem::file_size(archivePath);
+	{
+		std::fstream file(archivePath, std::ios::binary | std::ios::in | std::ios::out);
+		file.seekg(archiveSize - 1);
+		char last = 0;
+		file.read(&last, 1);
+		file.seekp(archiveSize - 1);
+		last ^= 1;
+		file.write(&last, 1);
+	}
+	ShaderCache damaged;
+	if (damaged.LoadArchive(archivePath) || damaged.GetEntryCount() != 0)
+	{
+		failures += ", damaged archive loaded";
+	}
+
+	std::filesystem::remove_all(directory);
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(keys.size()) + " keys, " + std::to_string(archiveSize) + " byte archive";
+	return true;
+}
+
+//largest difference of a decoder output to the generic kernel on random features
+static float CompareWithGenericKernel(const NeuralModelPtr& model, void (*decode)(const void* context, const float* inputs, float* outputs, size_t count), const void* context)
+{
+	//not a multiple of the block sizes, so partial blocks are covered
+	const size_t pixelCount = 1000;
+
+	NeuralDecoderCPU generic(model);
+	generic.SetKernel(DecoderKernel::Generic);
+
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+	std::vector<float> inputs(pixelCount * generic.GetInputCount());
+	for (float& input : inputs)
+	{
+		input = distribution(random);
+	}
+
+	std::vector<float> expected(pixelCount * generic.GetOutputCount());
+	std::vector<float> actual(expected.size());
+	generic.Decode(inputs.data(), expected.data(), pixelCount);
+	decode(context, inputs.data(), actual.data(), pixelCount);
+
+	float maxDifference = 0.0f;
+	for (size_t i = 0; i < expected.size(); i++)
+	{
+		maxDifference = std::max(maxDifference, std::fabs(expected[i] - actual[i]));
+	}
+	return maxDifference;
+}
+
+//every compiled decoder computes what the model does: the compiled program of each library model, the
+//baked decoder compiled into this test, and a small model with zero weights and dead neurons to eliminate
+static bool CheckDecoderCompiler(std::string& outMessage)
+{
+	const float tolerance = 1e-5f;
+
+	std::string failures;
+	auto evaluate = [](const void* context, const float* inputs, float* outputs, size_t count)
+	{
+		EvaluateCompiledDecoder(*(const CompiledDecoder*)context, inputs, outputs, count);
+	};
+	auto check = [&](const std::string& name, const char* kernel, float difference)
+	{
+		if (!(difference <= tolerance))
+		{
+			failures += ", " + name + " " + kernel + " differs by " + std::to_string(difference);
+		}
+	};
+
+	//4 inputs, 3 hidden and 2 outputs. Hidden 0 has no weights left and folds into a constant, hidden 2 is never read
+	auto model = std::make_shared<NeuralModel>();
+	model->layer_sizes = { 4, 3, 2 };
+	model->weights = {
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.5f, -0.25f, 0.0f, 1.0f,
+		0.3f, 0.3f, 0.3f, 0.3f,
+		0.75f, -1.0f, 0.0f,
+		-0.5f, 2.0f, 0.0f,
+	};
+	model->bias = { 0.5f, 0.1f, -0.2f, 0.0f, 0.25f };
+
+	CompiledDecoder small = CompileDecoder(*model);
+	const DecoderCompileStats& stats = small.stats;
+	if (stats.constantNeurons != 1 || stats.deadNeurons != 1 || stats.multiplyAdds != 5 || stats.denseMultiplyAdds != 18)
+	{
+		failures += ", eliminated " + std::to_string(stats.constantNeurons) + " constant and " + std::to_string(stats.deadNeurons) + " dead neurons, " +
+			std::to_string(stats.multiplyAdds) + " multiply-adds left";
+	}
+	check("small", "compiled", CompareWithGenericKernel(model, evaluate, &small));
+
+	size_t bakedCount = 0;
+	std::set<std::string> modelPaths;
+	for (const MaterialDesc& desc : GetMaterialLibrary())
+	{
+		if (!desc.IsNeural() || !modelPaths.insert(desc.modelPath).second)
+		{
+			continue;
+		}
+
+		NeuralModelPtr libraryModel = NeuralModel::LoadModel(desc.modelPath);
+		std::string name = std::filesystem::path(desc.modelPath).parent_path().filename().string();
+
+		CompiledDecoder compiled = CompileDecoder(*libraryModel);
+		check(name, "compiled", CompareWithGenericKernel(libraryModel, evaluate, &compiled));
+
+		const BakedDecoder* baked = FindBakedDecoder(compiled.modelHash);
+		if (baked == nullptr)
+		{
+			failures += ", no baked decoder for " + name + ", run --bake-decoders";
+			continue;
+		}
+		auto decodeBaked = [](const void* context, const float* inputs, float* outputs, size_t count)
+		{
+			((const BakedDecoder*)context)->decode(inputs, outputs, count);
+		};
+		check(name, "baked", CompareWithGenericKernel(libraryModel, decodeBaked, baked));
+		bakedCount++;
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(bakedCount) + " baked decoders";
+	return true;
+}
+
+//machine code generated for every instruction set this cpu runs, for the library models and a model whose
+//layer is wider than the registers so it's computed in several groups
+static bool CheckDecoderJIT(std::string& outMessage)
+{
+	const float tolerance = 1e-5f;
+
+	std::vector<NeuralModelPtr> models;
+	std::set<std::string> modelPaths;
+	for (const MaterialDesc& desc : GetMaterialLibrary())
+	{
+		if (desc.IsNeural() && modelPaths.insert(desc.modelPath).second)
+		{
+			models.push_back(NeuralModel::LoadModel(desc.modelPath));
+		}
+	}
+
+	std::mt19937 random(3);
+	std::uniform_real_distribution<float> distribution(-0.5f, 0.5f);
+	auto wide = std::make_shared<NeuralModel>();
+	wide->layer_sizes = { 5, 37, 3 };
+	wide->weights.resize(5 * 37 + 37 * 3);
+	wide->bias.resize(37 + 3);
+	for (float& weight : wide->weights)
+	{
+		weight = distribution(random);
+	}
+	for (float& bias : wide->bias)
+	{
+		bias = distribution(random);
+	}
+	models.push_back(wide);
+
+	std::string failures;
+	std::string targets;
+	auto decode = [](const void* context, const float* inputs, float* outputs, size_t count)
+	{
+		((const DecoderJIT*)context)->Decode(inputs, outputs, count);
+	};
+	for (DecoderJITTarget target : { DecoderJITTarget::AVX2, DecoderJITTarget::AVX512 })
+	{
+		if (!IsDecoderJITTargetSupported(target))
+		{
+			continue;
+		}
+		targets += std::string(targets.empty() ? "" : " and ") + GetDecoderJITTargetName(target);
+
+		for (size_t i = 0; i < models.size(); i++)
+		{
+			std::string error;
+			std::unique_ptr<DecoderJIT> jit = DecoderJIT::Create(models[i], target, &error);
+			if (!jit)
+			{
+				failures += ", " + error;
+				continue;
+			}
+			float difference = CompareWithGenericKernel(models[i], decode, jit.get());
+			if (!(difference <= tolerance))
+			{
+				failures += std::string(", ") + GetDecoderJITTargetName(target) + " code of model " + std::to_string(i) + " differs by " + std::to_string(difference);
+			}
+		}
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	if (targets.empty())
+	{
+		outMessage = "skipped, this cpu runs no instruction set the JIT emits";
+		return true;
+	}
+	outMessage = targets + " code of " + std::to_string(models.size()) + " models";
+	return true;
+}
+
+//2:4 pruning leaves at most 2 weights in every group of 4 past the first layer, removing dead neurons doesn't
+//change any output on the samples, and the sparse kernel decodes the pruned models like the generic one
+static bool CheckDecoderPruning(std::string& outMessage)
+{
+	const float tolerance = 1e-5f;
+	const size_t sampleCount = 500;
+
+	//hidden neuron 1 of both layers never fires on inputs in [0, 1], random ones may not either
+	std::mt19937 random(5);
+	std::uniform_real_distribution<float> distribution(-0.5f, 0.5f);
+	auto model = std::make_shared<NeuralModel>();
+	model->layer_sizes = { 6, 10, 9, 4 };
+	model->weights.resize(6 * 10 + 10 * 9 + 9 * 4);
+	model->bias.resize(10 + 9 + 4);
+	for (float& weight : model->weights)
+	{
+		weight = distribution(random);
+	}
+	for (float& bias : model->bias)
+	{
+		bias = distribution(random);
+	}
+	for (int i = 0; i < 6; i++)
+	{
+		model->weights[1 * 6 + i] = -std::fabs(model->weights[1 * 6 + i]);
+	}
+	model->bias[1] = -0.1f;
+	for (int i = 0; i < 10; i++)
+	{
+		model->weights[6 * 10 + 1 * 10 + i] = -std::fabs(model->weights[6 * 10 + 1 * 10 + i]);
+	}
+	model->bias[10 + 1] = -0.1f;
+
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::vector<float> samples(sampleCount * 6);
+	for (float& sample : samples)
+	{
+		sample = unit(random);
+	}
+
+	std::string failures;
+	ActivationStats stats = CollectActivationStats(*model, samples.data(), sampleCount);
+	NeuralModelPtr structured = PruneStructured(*model, 2, 4, stats);
+	if (!std::equal(model->weights.begin(), model->weights.begin() + 6 * 10, structured->weights.begin()))
+	{
+		failures += ", 2:4 changed the first layer";
+	}
+	size_t offset = 6 * 10;
+	for (size_t layer = 1; layer + 1 < model->layer_sizes.size(); layer++)
+	{
+		const int in = model->layer_sizes[layer];
+		const int out = model->layer_sizes[layer + 1];
+		for (int o = 0; o < out; o++)
+		{
+			for (int begin = 0; begin < in; begin += 4)
+			{
+				int nonZero = 0;
+				for (int i = begin; i < std::min(begin + 4, in); i++)
+				{
+					nonZero += structured->weights[offset + (size_t)o * in + i] != 0.0f;
+				}
+				if (nonZero > 2)
+				{
+					failures += ", 2:4 left " + std::to_string(nonZero) + " weights in a group of layer " + std::to_string(layer);
+				}
+			}
+		}
+		offset += (size_t)in * out;
+	}
+
+	size_t removed = 0;
+	NeuralModelPtr dead = RemoveDeadNeurons(*model, stats, 0.0f, &removed);
+	if (removed < 2 || (size_t)(dead->layer_sizes[1] + dead->layer_sizes[2]) != 10 + 9 - removed)
+	{
+		failures += ", removed " + std::to_string(removed) + " dead neurons, at least 2 expected";
+	}
+	else
+	{
+		NeuralDecoderCPU dense(model);
+		NeuralDecoderCPU pruned(dead);
+		dense.SetKernel(DecoderKernel::Generic);
+		pruned.SetKernel(DecoderKernel::Generic);
+		std::vector<float> expected(sampleCount * 4);
+		std::vector<float> actual(expected.size());
+		dense.Decode(samples.data(), expected.data(), sampleCount);
+		pruned.Decode(samples.data(), actual.data(), sampleCount);
+		for (size_t i = 0; i < expected.size(); i++)
+		{
+			if (!(std::fabs(expected[i] - actual[i]) <= tolerance))
+			{
+				failures += ", removing dead neurons changed an output by " + std::to_string(std::fabs(expected[i] - actual[i]));
+				break;
+			}
+		}
+	}
+
+	auto decodeSparse = [](const void* context, const float* inputs, float* outputs, size_t count)
+	{
+		((const NeuralDecoderCPU*)context)->Decode(inputs, outputs, count);
+	};
+	for (const NeuralModelPtr& pruned : { structured, dead })
+	{
+		NeuralDecoderCPU sparse(pruned);
+		sparse.SetKernel(DecoderKernel::Sparse);
+		float difference = CompareWithGenericKernel(pruned, decodeSparse, &sparse);
+		if (!(difference <= tolerance))
+		{
+			failures += ", sparse kernel differs by " + std::to_string(difference);
+		}
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "2:4 kept " + std::to_string(CompileDecoder(*structured).stats.multiplyAdds) + " of " + std::to_string(model->GetMultiplyAddCount()) + " multiply-adds";
+	return true;
+}
+
+//a layer factorized at full rank decodes like the dense one, every kernel and the compiled decoder skip the ReLU
+//of the linear layers, the linear layers survive a binary and a json round trip, and macs=0.75 takes a quarter
+//of the multiply-adds off the model, all of them from its hidden layer
+static bool CheckDecoderFactorization(std::string& outMessage)
+{
+	const float tolerance = 1e-5f;
+
+	std::mt19937 random(9);
+	std::uniform_real_distribution<float> distribution(-0.5f, 0.5f);
+	auto model = std::make_shared<NeuralModel>();
+	model->layer_sizes = { 14, 24, 20, 8 };
+	model->weights.resize(14 * 24 + 24 * 20 + 20 * 8);
+	model->bias.resize(24 + 20 + 8);
+	for (float& weight : model->weights)
+	{
+		weight = distribution(random);
+	}
+	for (float& bias : model->bias)
+	{
+		bias = distribution(random);
+	}
+
+	std::string failures;
+	auto decode = [](const void* context, const float* inputs, float* outputs, size_t count)
+	{
+		((const NeuralDecoderCPU*)context)->Decode(inputs, outputs, count);
+	};
+
+	NeuralModelPtr full = FactorizeLayer(*model, 1, 20);
+	NeuralDecoderCPU fullDecoder(full);
+	fullDecoder.SetKernel(DecoderKernel::Generic);
+	float difference = CompareWithGenericKernel(model, decode, &fullDecoder);
+	if (!(difference <= 1e-4f))
+	{
+		failures += ", full rank differs from the dense layer by " + std::to_string(difference);
+	}
+
+	std::vector<LayerRankErrors> rankErrors = ComputeRankErrors(*model);
+	for (const LayerRankErrors& layer : rankErrors)
+	{
+		for (size_t rank = 1; rank < layer.errors.size(); rank++)
+		{
+			if (layer.errors[rank] > layer.errors[rank - 1])
+			{
+				failures += ", error of layer " + std::to_string(layer.layer) + " grows with its rank";
+				break;
+			}
+		}
+		if (std::fabs(layer.errors.front() - 1.0) > 1e-9 || layer.errors.back() != 0.0)
+		{
+			failures += ", error of layer " + std::to_string(layer.layer) + " doesn't go from 1 to 0";
+		}
+	}
+
+	std::string error;
+	NeuralModelPtr factorized = FactorizeModel(*model, "macs=0.75", &error);
+	if (!factorized)
+	{
+		failures += ", " + error;
+	}
+	else if (factorized->GetMultiplyAddCount() * 4 > model->GetMultiplyAddCount() * 3 || factorized->linear_layers != std::vector<int32_t>{ 1 })
+	{
+		failures += ", macs=0.75 left " + std::to_string(factorized->GetMultiplyAddCount()) + " of " + std::to_string(model->GetMultiplyAddCount()) + " multiply-adds";
+	}
+	else
+	{
+		for (DecoderKernel kernel : { DecoderKernel::Batched, DecoderKernel::Sparse, DecoderKernel::JIT, DecoderKernel::Deterministic })
+		{
+			NeuralDecoderCPU decoder(factorized);
+			decoder.SetKernel(kernel);
+			difference = CompareWithGenericKernel(factorized, decode, &decoder);
+			if (!(difference <= tolerance))
+			{
+				failures += std::string(", ") + GetDecoderKernelName(kernel) + " kernel of the factorized model differs by " + std::to_string(difference);
+			}
+		}
+
+		CompiledDecoder compiled = CompileDecoder(*factorized);
+		auto evaluate = [](const void* context, const float* inputs, float* outputs, size_t count)
+		{
+			EvaluateCompiledDecoder(*(const CompiledDecoder*)context, inputs, outputs, count);
+		};
+		difference = CompareWithGenericKernel(factorized, evaluate, &compiled);
+		if (!(difference <= tolerance))
+		{
+			failures += ", compiled factorized model differs by " + std::to_string(difference);
+		}
+
+		std::filesystem::path directory = std::filesystem::temp_directory_path() / "GoldenTestFactorization";
+		std::filesystem::create_directories(directory);
+		for (const std::string file : { "decodermodel.bin", "decodermodel.json" })
+		{
+			std::string path = (directory / file).string();
+			bool bSaved = file == "decodermodel.bin" ? factorized->SaveBinary(path) : factorized->SaveJson(path);
+			NeuralModelPtr loaded = bSaved ? NeuralModel::LoadModel(path) : nullptr;
+			if (!loaded || loaded->layer_sizes != factorized->layer_sizes || loaded->linear_layers != factorized->linear_layers ||
+				HashDecoderModel(*loaded) != HashDecoderModel(*factorized))
+			{
+				failures += ", " + file + " doesn't read back as the factorized model";
+			}
+		}
+		std::filesystem::remove_all(directory);
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "macs=0.75 kept " + std::to_string(factorized->GetMultiplyAddCount()) + " of " + std::to_string(model->GetMultiplyAddCount()) + " multiply-adds";
+	return true;
+}
+
+//materials on the same decoder share one model: a path loaded again isn't read, a copy of the weights elsewhere
+//is read and dropped for the resident model, every model sits at its slot in the arenas, and models nothing holds
+//leave on Collect with the others moving down
+static bool CheckModelPool(std::string& outMessage)
+{
+	const std::string densePath = "Textures/NeuralCompressed/v23/decodermodel.json";
+	const std::string lightPath = "Textures/NeuralCompressed/1024_32/decodermodel.json";
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "GoldenTestModelPool";
+	std::filesystem::create_directories(directory);
+	const std::string copyPath = (directory / "decodermodel.bin").string();
+
+	std::string failures;
+	NeuralModelPool pool;
+	NeuralModelPtr dense = pool.Load(densePath);
+	NeuralModelPtr light = pool.Load(lightPath);
+	if (pool.Load(densePath) != dense)
+	{
+		failures += ", the same path loaded twice";
+	}
+	if (!dense->SaveBinary(copyPath) || pool.Load(copyPath) != dense)
+	{
+		failures += ", a copy of the weights wasn't shared";
+	}
+	std::filesystem::remove_all(directory);
+
+	NeuralModelPoolStats stats = pool.GetStats();
+	if (pool.GetModelCount() != 2 || stats.requests != 4 || stats.pathHits != 1 || stats.contentHits != 1)
+	{
+		failures += ", " + std::to_string(pool.GetModelCount()) + " models after " + std::to_string(stats.requests) + " loads, " +
+			std::to_string(stats.pathHits) + " path and " + std::to_string(stats.contentHits) + " content hits";
+	}
+
+	auto checkArenas = [&](const std::string& when)
+	{
+		std::vector<float> weights;
+		std::vector<float> biases;
+		pool.PackArenas(weights, biases);
+		for (const NeuralModelPtr& model : { dense, light })
+		{
+			NeuralModelSlot slot;
+			if (!model || !pool.FindSlot(*model, slot))
+			{
+				continue;
+			}
+			if (slot.weightOffset + slot.weightCount > weights.size() || slot.biasOffset + slot.biasCount > biases.size() ||
+				!std::equal(model->weights.begin(), model->weights.end(), weights.begin() + slot.weightOffset) ||
+				!std::equal(model->bias.begin(), model->bias.end(), biases.begin() + slot.biasOffset))
+			{
+				failures += ", a model isn't at its slot " + when;
+			}
+		}
+	};
+	checkArenas("after loading");
+	const size_t weightCount = pool.GetWeightCount();
+
+	const uint64_t generation = pool.GetGeneration();
+	dense.reset();
+	NeuralModelSlot slot;
+	if (pool.Collect() != 1 || pool.GetModelCount() != 1 || pool.GetGeneration() == generation ||
+		!pool.FindSlot(*light, slot) || slot.weightOffset != 0 || pool.GetWeightCount() != light->weights.size())
+	{
+		failures += ", Collect didn't drop the unused model and move the other down";
+	}
+	checkArenas("after Collect");
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "3 materials on 2 models, " + std::to_string(weightCount) + " weights in the arena";
+	return true;
+}
+
+//pixels of several materials on one network decode in a single call to what each material decodes alone, and a
+//material with a decoder of its own is refused
+static bool CheckUniversalDecoder(std::string& outMessage)
+{
+	std::string error;
+	const MaterialDesc* denseDesc = FindMaterialDesc("1K_Neural");
+	const MaterialDesc* lightDesc = FindMaterialDesc("1K_Neural_Light_32");
+	SoftwareMaterialPtr dense = denseDesc ? SoftwareMaterial::Create(*denseDesc, &error) : nullptr;
+	SoftwareMaterialPtr light = dense && lightDesc ? SoftwareMaterial::Create(*lightDesc, &error) : nullptr;
+	if (!dense || !light)
+	{
+		outMessage = error;
+		return false;
+	}
+
+	//a second material on the same network, its grids in another order stand in for grids of its own
+	auto swapped = std::make_shared<SoftwareMaterial>();
+	swapped->name = "1K_Neural_Swapped";
+	swapped->model = dense->model;
+	swapped->decoder = dense->decoder;
+	swapped->textures[0] = dense->textures[2];
+	swapped->textures[1] = dense->textures[3];
+	swapped->textures[2] = dense->textures[0];
+	swapped->textures[3] = dense->textures[1];
+
+	std::string failures;
+	UniversalDecoder universal(dense->model);
+	const SoftwareMaterial* materials[] = { dense.get(), swapped.get() };
+	for (const SoftwareMaterial* material : materials)
+	{
+		if (universal.AddMaterial(*material, &error) < 0)
+		{
+			failures += ", " + error;
+		}
+	}
+	if (universal.AddMaterial(*light) >= 0 || universal.GetMaterialCount() != 2)
+	{
+		failures += ", a material with its own decoder was added";
+	}
+
+	//interleaved, every block of the batch mixes both materials
+	const size_t pixelCount = 1000;
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+	std::vector<UniversalDecodeRequest> requests(pixelCount);
+	for (size_t i = 0; i < pixelCount; i++)
+	{
+		requests[i].materialIndex = (uint32_t)(i % 3 == 0);
+		requests[i].u = distribution(random);
+		requests[i].v = distribution(random);
+	}
+	std::vector<MaterialSample> batched(pixelCount);
+	universal.GetMaterialInputs(requests.data(), pixelCount, batched.data());
+
+	float maxError = 0.0f;
+	for (size_t i = 0; i < pixelCount && failures.empty(); i++)
+	{
+		const UniversalDecodeRequest& request = requests[i];
+		float uv[2] = { request.u, request.v };
+		MaterialSample alone;
+		materials[request.materialIndex]->GetMaterialInputs(uv, 1, &alone);
+
+		const float* expected = &alone.albedo[0];
+		const float* actual = &batched[i].albedo[0];
+		for (int c = 0; c < 8; c++)
+		{
+			maxError = std::max(maxError, std::abs(expected[c] - actual[c]));
+		}
+	}
+	if (maxError > 1e-5f)
+	{
+		failures += ", batched decode is off by " + std::to_string(maxError);
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(pixelCount) + " pixels of 2 materials in one call, max error " + std::to_string(maxError);
+	return true;
+}
+
+static bool CheckBC6HEncoder(std::string& outMessage)
+{
+	std::string error;
+	const MaterialDesc* desc = FindMaterialDesc("1K_Neural");
+	FeatureGrid source;
+	if (desc == nullptr || !source.Load(desc->textures[1].path, &error))
+	{
+		outMessage = desc ? error : "1K_Neural not in the library";
+		return false;
+	}
+
+	//the shipped grid went through BC6H already, encoding it again has to land close to where it was
+	ThreadPool threadPool(1);
+	DDSImage encoded;
+	source.Encode(threadPool, encoded);
+
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "GoldenTestBC6H";
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory);
+	std::string path = (directory / "grid.dds").string();
+
+	std::string failures;
+	DDSImage loaded;
+	if (!encoded.Save(path, &error) || !loaded.Load(path, &error))
+	{
+		failures += ", " + error;
+	}
+	else if (loaded.format != DDSFormat::BC6H_SF16 || loaded.mipLevels != encoded.mipLevels || loaded.data != encoded.data)
+	{
+		failures += ", the saved dds doesn't load back as written";
+	}
+	std::filesystem::remove_all(directory);
+
+	FeatureGrid decoded;
+	double rmse = 0.0;
+	if (!decoded.LoadFromImage(encoded, &error))
+	{
+		failures += ", " + error;
+	}
+	else
+	{
+		rmse = std::sqrt(ImageMetrics::MeanSquaredError(decoded.values.data(), source.values.data(), (size_t)source.width * source.height, 3, 0, 3));
+		if (rmse > 0.002)
+		{
+			failures += ", re-encoded grid is off by " + std::to_string(rmse) + " rms";
+		}
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(source.width) + "x" + std::to_string(source.height) + " grid, " + std::to_string(encoded.mipLevels) +
+		" mips, " + std::to_string(rmse) + " rms";
+	return true;
+}
+
+static bool CheckNeuralTrainer(std::string& outMessage)
+{
+	std::vector<std::string> paths;
+	if (const MaterialDesc* desc = FindMaterialDesc("1K_DDS"))
+	{
+		for (const MaterialTextureDesc& texture : desc->textures)
+		{
+			paths.push_back(texture.path);
+		}
+	}
+	std::string error;
+	TrainingTarget source;
+	if (!source.Load(paths, &error))
+	{
+		outMessage = error;
+		return false;
+	}
+	TrainingTarget target = source.Crop(32, 32);
+
+	TrainerSettings settings;
+	settings.hiddenLayers = { 16, 16 };
+	settings.epochs = 6;
+	settings.batchSize = 256;
+	settings.learningRate = 1e-2f;
+	settings.gridLearningRate = 5e-2f;
+
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "GoldenTestTrainer";
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory);
+	std::string checkpointPath = (directory / "checkpoint.bin").string();
+
+	std::string failures;
+
+	//stopped halfway and resumed on another thread count, the weights have to match a straight run
+	settings.threadCount = 1;
+	NeuralTrainer stopped(target, settings);
+	stopped.Initialize();
+	for (int e = 0; e < 3; e++)
+	{
+		stopped.TrainEpoch();
+	}
+	if (!stopped.SaveCheckpoint(checkpointPath, &error))
+	{
+		failures += ", " + error;
+	}
+	while (!stopped.IsFinished())
+	{
+		stopped.TrainEpoch();
+	}
+
+	settings.threadCount = 3;
+	NeuralTrainer straight(target, settings);
+	straight.Initialize();
+	while (!straight.IsFinished())
+	{
+		straight.TrainEpoch();
+	}
+
+	settings.threadCount = 2;
+	NeuralTrainer resumed(target, settings);
+	if (!resumed.LoadCheckpoint(checkpointPath, &error))
+	{
+		failures += ", " + error;
+	}
+	while (!resumed.IsFinished())
+	{
+		resumed.TrainEpoch();
+	}
+
+	NeuralModelPtr model = stopped.CreateModel();
+	if (model->weights != straight.CreateModel()->weights || stopped.GetGrids()[0].values != straight.GetGrids()[0].values)
+	{
+		failures += ", 1 and 3 threads trained different weights";
+	}
+	if (model->weights != resumed.CreateModel()->weights || stopped.GetGrids()[3].values != resumed.GetGrids()[3].values)
+	{
+		failures += ", the resumed run went elsewhere";
+	}
+
+	const std::vector<TrainingEpoch>& history = stopped.GetHistory();
+	if (history.size() != settings.epochs || history.back().loss >= history.front().loss * 0.5)
+	{
+		failures += ", loss didn't drop";
+	}
+
+	//exported files load as a neural material
+	std::vector<FeatureGrid> compressedGrids;
+	if (!stopped.Export(directory.string(), &compressedGrids, &error))
+	{
+		failures += ", " + error;
+	}
+	else if (NeuralModel::LoadModel((directory / "decodermodel.json").string())->weights.size() != model->weights.size())
+	{
+		failures += ", exported model doesn't load back";
+	}
+	std::filesystem::remove_all(directory);
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(history.size()) + " epochs, loss " + std::to_string(history.front().loss) + " to " +
+		std::to_string(history.back().loss) + ", same weights on 1, 2 and 3 threads and after resuming";
+	return true;
+}
+
+static bool CheckGridEncoder(std::string& outMessage)
+{
+	std::vector<std::string> paths;
+	if (const MaterialDesc* desc = FindMaterialDesc("1K_DDS"))
+	{
+		for (const MaterialTextureDesc& texture : desc->textures)
+		{
+			paths.push_back(texture.path);
+		}
+	}
+	const MaterialDesc* neuralDesc = FindMaterialDesc("1K_Neural");
+	std::string error;
+	TrainingTarget source;
+	if (neuralDesc == nullptr || !source.Load(paths, &error))
+	{
+		outMessage = neuralDesc ? error : "1K_Neural not in the library";
+		return false;
+	}
+	TrainingTarget target = source.Crop(64, 64);
+	NeuralModelPtr decoder = NeuralModel::LoadModel(neuralDesc->modelPath);
+
+	//the shipped decoder stays frozen, only new grids are fitted, once as floats and once through BC6H
+	TrainerSettings settings;
+	settings.bTrainDecoder = false;
+	settings.epochs = 8;
+	settings.batchSize = 512;
+	settings.gridLearningRate = 5e-2f;
+	settings.threadCount = 2;
+
+	std::string failures;
+	double compressedPSNR[2] = {};
+	std::vector<TrainingEpoch> history;
+	for (int quantized = 0; quantized < 2; quantized++)
+	{
+		settings.bQuantizeGrids = quantized == 1;
+		NeuralTrainer encoder(target, settings);
+		if (!encoder.Initialize(*decoder, &error))
+		{
+			outMessage = error;
+			return false;
+		}
+		while (!encoder.IsFinished())
+		{
+			encoder.TrainEpoch();
+		}
+
+		NeuralModelPtr model = encoder.CreateModel();
+		if (model->weights != decoder->weights || model->bias != decoder->bias)
+		{
+			failures += ", the frozen decoder changed";
+		}
+		history = encoder.GetHistory();
+		if (history.back().loss >= history.front().loss * 0.5)
+		{
+			failures += ", loss didn't drop";
+		}
+
+		ThreadPool threadPool(1);
+		std::vector<FeatureGrid> compressedGrids(encoder.GetGrids().size());
+		for (size_t g = 0; g < compressedGrids.size(); g++)
+		{
+			encoder.GetGrids()[g].Quantize(threadPool, compressedGrids[g]);
+		}
+		compressedPSNR[quantized] = ImageMetrics::PSNR(encoder.Evaluate(compressedGrids));
+	}
+
+	if (compressedPSNR[1] <= compressedPSNR[0])
+	{
+		failures += ", fitting through BC6H didn't help the compressed grids";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "frozen decoder, BC6H grids " + std::to_string(compressedPSNR[0]) + " dB fitted as floats, " +
+		std::to_string(compressedPSNR[1]) + " dB fitted through BC6H";
+	return true;
+}
+
+//PSNR of a decoder reading grids when it computes in format
+static double GetDeployedPSNR(const TrainingTarget& target, const NeuralModel& model, const std::vector<FeatureGrid>& grids,
+	DecoderNumberFormat format)
+{
+	TrainerSettings settings;
+	settings.weightFormat = format;
+	settings.activationFormat = format;
+	settings.threadCount = 2;
+	NeuralTrainer evaluator(target, settings);
+	return evaluator.Initialize(model, grids) ? ImageMetrics::PSNR(evaluator.Evaluate(evaluator.GetGrids())) : 0.0;
+}
+
+static bool CheckQuantizationAwareTraining(std::string& outMessage)
+{
+	std::vector<std::string> paths;
+	if (const MaterialDesc* desc = FindMaterialDesc("1K_DDS"))
+	{
+		for (const MaterialTextureDesc& texture : desc->textures)
+		{
+			paths.push_back(texture.path);
+		}
+	}
+	std::string error;
+	TrainingTarget source;
+	if (!source.Load(paths, &error))
+	{
+		outMessage = error;
+		return false;
+	}
+	TrainingTarget target = source.Downsample(16);
+
+	//a small material trained as floats and block compressed, what a fine-tune starts from
+	TrainerSettings settings;
+	settings.hiddenLayers = { 16, 16 };
+	settings.gridDivisor = 2;
+	settings.epochs = 100;
+	settings.batchSize = 1024;
+	settings.threadCount = 2;
+	NeuralTrainer trainer(target, settings);
+	trainer.Initialize();
+	while (!trainer.IsFinished())
+	{
+		trainer.TrainEpoch();
+	}
+	NeuralModelPtr startModel = trainer.CreateModel();
+	ThreadPool threadPool(1);
+	std::vector<FeatureGrid> startGrids(trainer.GetGrids().size());
+	for (size_t g = 0; g < startGrids.size(); g++)
+	{
+		trainer.GetGrids()[g].Quantize(threadPool, startGrids[g]);
+	}
+	const double startPSNR = GetDeployedPSNR(target, *startModel, startGrids, DecoderNumberFormat::Int8);
+
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "GoldenTestQuantization";
+	std::filesystem::remove_all(directory);
+
+	//fine-tuned once as floats and once through int8, what int8 costs each of them
+	std::string failures;
+	double int8PSNR[2] = {};
+	double int8Loss[2] = {};
+	settings.epochs = 10;
+	settings.bQuantizeGrids = true;
+	for (int aware = 0; aware < 2; aware++)
+	{
+		settings.weightFormat = aware ? DecoderNumberFormat::Int8 : DecoderNumberFormat::Float32;
+		settings.activationFormat = settings.weightFormat;
+		NeuralTrainer fineTuner(target, settings);
+		if (!fineTuner.Initialize(*startModel, startGrids, &error))
+		{
+			outMessage = error;
+			return false;
+		}
+		while (!fineTuner.IsFinished())
+		{
+			fineTuner.TrainEpoch();
+		}
+
+		NeuralModelPtr model = fineTuner.CreateModel();
+		std::vector<FeatureGrid> compressedGrids;
+		if (!fineTuner.Export(directory.string(), &compressedGrids, &error))
+		{
+			failures += ", " + error;
+			break;
+		}
+		int8PSNR[aware] = GetDeployedPSNR(target, *model, compressedGrids, DecoderNumberFormat::Int8);
+		int8Loss[aware] = GetDeployedPSNR(target, *model, compressedGrids, DecoderNumberFormat::Float32) - int8PSNR[aware];
+		if (!aware)
+		{
+			continue;
+		}
+
+		//the container holds the rounded weights, every row a multiple of its int8 step
+		NeuralModelPtr container = NeuralModel::LoadModel((directory / "decodermodel.bin").string());
+		if (container->weights != model->weights || container->bias != model->bias)
+		{
+			failures += ", decodermodel.bin doesn't hold the fine-tuned decoder";
+		}
+		bool bOnGrid = true;
+		size_t offset = 0;
+		for (size_t layer = 0; layer + 1 < model->layer_sizes.size(); layer++)
+		{
+			const int in = model->layer_sizes[layer];
+			for (int o = 0; o < model->layer_sizes[layer + 1]; o++, offset += in)
+			{
+				const float* row = model->weights.data() + offset;
+				float largest = 0.0f;
+				for (int i = 0; i < in; i++)
+				{
+					largest = std::max(largest, std::abs(row[i]));
+				}
+				for (int i = 0; i < in && largest > 0.0f; i++)
+				{
+					const float steps = row[i] / (largest / 127.0f);
+					bOnGrid = bOnGrid && std::abs(steps - std::round(steps)) < 1e-3f;
+				}
+			}
+		}
+		if (!bOnGrid)
+		{
+			failures += ", exported weights aren't on the int8 grid";
+		}
+	}
+	std::filesystem::remove_all(directory);
+
+	if (int8PSNR[1] <= startPSNR)
+	{
+		failures += ", fine-tuning didn't improve on the int8 starting point";
+	}
+	if (int8Loss[1] >= int8Loss[0])
+	{
+		failures += ", training through int8 didn't lower what int8 costs";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "int8 from " + std::to_string(startPSNR) + " to " + std::to_string(int8PSNR[1]) + " dB, int8 costs " +
+		std::to_string(int8Loss[0]) + " dB after a float fine-tune, " + std::to_string(int8Loss[1]) + " dB after a quantization aware one";
+	return true;
+}
+
+//the deterministic kernel gives the same bits however the pixels are split between calls, stays with the generic
+//kernel, and a bake of a material has the same digest on any thread count and on every machine
+static bool CheckDeterministicDecode(std::string& outMessage)
+{
+	//the digest of a 64x64 bake of 1K_Neural, the same on every cpu and compiler this builds with
+	const uint64_t ExpectedDigest = 0x04aeb83a74935b87ull;
+
+	std::string error;
+	const MaterialDesc* desc = FindMaterialDesc("1K_Neural");
+	SoftwareMaterialPtr material = desc ? SoftwareMaterial::Create(*desc, &error) : nullptr;
+	if (!material)
+	{
+		outMessage = desc ? error : "1K_Neural not in the library";
+		return false;
+	}
+	const NeuralDecoderCPU& decoder = *material->decoder;
+
+	std::string failures;
+	//inputs from the generator's integers, uniform_real_distribution differs between standard libraries
+	const size_t pixelCount = 1000;
+	std::mt19937 random(7);
+	std::vector<float> inputs(pixelCount * decoder.GetInputCount());
+	for (float& input : inputs)
+	{
+		input = (random() >> 8) * (1.0f / 16777216.0f) * 2.0f - 1.0f;
+	}
+
+	const size_t outputCount = decoder.GetOutputCount();
+	std::vector<float> whole(pixelCount * outputCount);
+	std::vector<float> single(whole.size());
+	std::vector<float> split(whole.size());
+	std::vector<float> generic(whole.size());
+	decoder.Decode(inputs.data(), whole.data(), pixelCount, DecoderKernel::Deterministic);
+	decoder.Decode(inputs.data(), generic.data(), pixelCount, DecoderKernel::Generic);
+	for (size_t p = 0; p < pixelCount; p++)
+	{
+		decoder.Decode(&inputs[p * decoder.GetInputCount()], &single[p * outputCount], 1, DecoderKernel::Deterministic);
+	}
+	//a cut inside a block of the kernel
+	const size_t cut = 333;
+	decoder.Decode(inputs.data(), split.data(), cut, DecoderKernel::Deterministic);
+	decoder.Decode(&inputs[cut * decoder.GetInputCount()], &split[cut * outputCount], pixelCount - cut, DecoderKernel::Deterministic);
+
+	if (memcmp(whole.data(), single.data(), whole.size() * sizeof(float)) != 0 ||
+		memcmp(whole.data(), split.data(), whole.size() * sizeof(float)) != 0)
+	{
+		failures += ", values depend on how the pixels are split between calls";
+	}
+	float maxDifference = 0.0f;
+	for (size_t i = 0; i < whole.size(); i++)
+	{
+		maxDifference = std::max(maxDifference, std::fabs(whole[i] - generic[i]));
+	}
+	if (!(maxDifference <= 1e-5f))
+	{
+		failures += ", differs from the generic kernel by " + std::to_string(maxDifference);
+	}
+
+	const uint32_t bakeSize = 64;
+	uint64_t digests[2] = {};
+	const uint32_t threadCounts[2] = { 1, 3 };
+	for (int t = 0; t < 2; t++)
+	{
+		ThreadPool threadPool(threadCounts[t]);
+		std::vector<float> texels;
+		BakeMaterial(*material, bakeSize, threadPool, true, texels);
+		digests[t] = DeterministicDecode::Digest(texels.data(), texels.size());
+	}
+	if (digests[0] != digests[1])
+	{
+		failures += ", bakes on 1 and 3 threads differ";
+	}
+	if (digests[0] != ExpectedDigest)
+	{
+		std::stringstream digest;
+		digest << std::hex << digests[0];
+		failures += ", bake digest " + digest.str() + " isn't the reference";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "generic kernel within " + std::to_string(maxDifference) + ", bake digest the reference on 1 and 3 threads";
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	GoldenOptions options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::cout << "Usage: GoldenTest [--scenarios=Golden/scenarios.json] [--golden=Golden] [--output=golden_out]" << std::endl;
+		std::cout << "                  [--filter=substring] [--threads=N] [--update]" << std::endl;
+		return 2;
+	}
+
+	std::vector<GoldenScenario> scenarios;
+	std::string error;
+	if (!LoadScenarios(options.scenariosPath, scenarios, &error))
+	{
+		std::cout << error << std::endl;
+		return 2;
+	}
+
+	SoftwareRenderBackend backend(options.threadCount);
+	std::map<std::string, std::unique_ptr<BackendMaterial>> materials;
+
+	uint32_t failed = 0;
+	uint32_t run = 0;
+	for (const GoldenScenario& scenario : scenarios)
+	{
+		if (!options.filter.empty() && scenario.name.find(options.filter) == std::string::npos)
+		{
+			continue;
+		}
+		run++;
+
+		std::unique_ptr<BackendMaterial>& material = materials[scenario.material];
+		if (!material)
+		{
+			const MaterialDesc* desc = FindMaterialDesc(scenario.material);
+			std::string materialError = "Unknown material";
+			if (desc)
+			{
+				material = BackendMaterial::Create(backend, *desc, &materialError);
+			}
+			if (!material)
+			{
+				std::cout << "FAIL " << scenario.name << ": " << scenario.material << ": " << materialError << std::endl;
+				failed++;
+				continue;
+			}
+		}
+
+		backend.SetResolution(scenario.width, scenario.height);
+		backend.BeginFrame();
+		material->Draw(scenario.constants);
+		backend.EndFrame();
+
+		std::vector<uint8_t> actual;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		backend.ReadFrame(actual, width, height);
+
+		std::string goldenPath = options.goldenDirectory + "/" + scenario.name + ".dds";
+		if (options.bUpdate)
+		{
+			if (!DDSImage::SaveRGBA8(goldenPath, scenario.width, scenario.height, actual, &error))
+			{
+				std::cout << "FAIL " << scenario.name << ": " << error << std::endl;
+				failed++;
+				continue;
+			}
+			std::cout << "updated " << goldenPath << std::endl;
+			continue;
+		}
+
+		std::string message;
+		bool bPassed = CompareWithGolden(scenario, actual, goldenPath, options, message);
+		std::cout << (bPassed ? "pass " : "FAIL ") << scenario.name << ": " << message << std::endl;
+		if (!bPassed)
+		{
+			failed++;
+		}
+	}
+
+	run++;
+	std::string pipelineMessage;
+	bool bPipelinePassed = CheckPipeline(scenarios, options, pipelineMessage);
+	std::cout << (bPipelinePassed ? "pass " : "FAIL ") << "pipeline: " << pipelineMessage << std::endl;
+	if (!bPipelinePassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string shaderCacheMessage;
+	bool bShaderCachePassed = CheckShaderCache(shaderCacheMessage);
+	std::cout << (bShaderCachePassed ? "pass " : "FAIL ") << "shader cache: " << shaderCacheMessage << std::endl;
+	if (!bShaderCachePassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string decoderMessage;
+	bool bDecodersPassed = CheckDecoderCompiler(decoderMessage);
+	std::cout << (bDecodersPassed ? "pass " : "FAIL ") << "decoder compiler: " << decoderMessage << std::endl;
+	if (!bDecodersPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string jitMessage;
+	bool bJITPassed = CheckDecoderJIT(jitMessage);
+	std::cout << (bJITPassed ? "pass " : "FAIL ") << "decoder jit: " << jitMessage << std::endl;
+	if (!bJITPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string pruningMessage;
+	bool bPruningPassed = CheckDecoderPruning(pruningMessage);
+	std::cout << (bPruningPassed ? "pass " : "FAIL ") << "decoder pruning: " << pruningMessage << std::endl;
+	if (!bPruningPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string factorizationMessage;
+	bool bFactorizationPassed = CheckDecoderFactorization(factorizationMessage);
+	std::cout << (bFactorizationPassed ? "pass " : "FAIL ") << "decoder factorization: " << factorizationMessage << std::endl;
+	if (!bFactorizationPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string poolMessage;
+	bool bPoolPassed = CheckModelPool(poolMessage);
+	std::cout << (bPoolPassed ? "pass " : "FAIL ") << "model pool: " << poolMessage << std::endl;
+	if (!bPoolPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string universalMessage;
+	bool bUniversalPassed = CheckUniversalDecoder(universalMessage);
+	std::cout << (bUniversalPassed ? "pass " : "FAIL ") << "universal decoder: " << universalMessage << std::endl;
+	if (!bUniversalPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string encoderMessage;
+	bool bEncoderPassed = CheckBC6HEncoder(encoderMessage);
+	std::cout << (bEncoderPassed ? "pass " : "FAIL ") << "bc6h encoder: " << encoderMessage << std::endl;
+	if (!bEncoderPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string trainerMessage;
+	bool bTrainerPassed = CheckNeuralTrainer(trainerMessage);
+	std::cout << (bTrainerPassed ? "pass " : "FAIL ") << "trainer: " << trainerMessage << std::endl;
+	if (!bTrainerPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string gridEncoderMessage;
+	bool bGridEncoderPassed = CheckGridEncoder(gridEncoderMessage);
+	std::cout << (bGridEncoderPassed ? "pass " : "FAIL ") << "grid encoder: " << gridEncoderMessage << std::endl;
+	if (!bGridEncoderPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string quantizationMessage;
+	bool bQuantizationPassed = CheckQuantizationAwareTraining(quantizationMessage);
+	std::cout << (bQuantizationPassed ? "pass " : "FAIL ") << "quantization aware training: " << quantizationMessage << std::endl;
+	if (!bQuantizationPassed)
+	{
+		failed++;
+	}
+
+	run++;
+	std::string deterministicMessage;
+	bool bDeterministicPassed = CheckDeterministicDecode(deterministicMessage);
+	std::cout << (bDeterministicPassed ? "pass " : "FAIL ") << "deterministic decode: " << deterministicMessage << std::endl;
+	if (!bDeterministicPassed)
+	{
+		failed++;
+	}
+
+	std::cout << run - failed << "/" << run << " scenarios passed" << std::endl;
+	return failed == 0 ? 0 : 1;
+}
@@ -8,10 +8,13 @@
 #include "Texture2D.h"
 #include "Shader.h"
 #include "Material.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
 
 //pix
 #include <pix3.h>
 #include <filesystem>
+#include <chrono>
 
 using namespace DirectX;
 
@@ -25,6 +28,15 @@ using namespace DirectX;
 //heap allocator
 DescriptorHeapAllocator heapAllocator;
 
+void DescriptorHeapAllocator::ReportLeaks() const
+{
+	std::vector<DescriptorLeak> leaks = Allocator.GetLiveAllocations();
+	for (const DescriptorLeak& leak : leaks)
+	{
+		std::cout << "Descriptor leak: " << (leak.name.empty() ? "unnamed" : leak.name) << " at " << leak.handle.index << ", " << leak.handle.count << " descriptors" << std::endl;
+	}
+}
+
 D3D12GraphicsDevice::D3D12GraphicsDevice()
 {
 	std::cout << "D3D12GraphicsDevice created" << std::endl;
@@ -78,6 +90,7 @@ D3D12GraphicsDevice::D3D12GraphicsDevice()
 			 bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
 			 bufferDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 			 CHECKHR(device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, 0, IID_PPV_ARGS(&indexBuffer)));
+			 MemoryTracker::Get().Allocate(MemoryCategory::Other, sizeof(indices));
 			 //copy index data to index buffer
 			 void* mappedBuffer;
 			 CHECKHR(indexBuffer->Map(0, 0, &mappedBuffer));
@@ -143,6 +156,7 @@ D3D12GraphicsDevice::D3D12GraphicsDevice()
 			 bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
 			 bufferDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 			 CHECKHR(device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, 0, IID_PPV_ARGS(&vertexBuffer)));
+			 MemoryTracker::Get().Allocate(MemoryCategory::Other, sizeof(vertices));
 			 //copy vertex data to vertex buffer
 			 void* mappedBuffer;
 			 CHECKHR(vertexBuffer->Map(0, 0, &mappedBuffer));
@@ -234,6 +248,13 @@ D3D12GraphicsDevice::D3D12GraphicsDevice()
 	 CHECKHR(CreateDXGIFactory2(dxgiFactoryFlags, IID_PPV_ARGS(&factory)));
 	 IDXGIAdapter1* adapter;
 	 CHECKHR(factory->EnumAdapters1(0, &adapter));
+
+	 //dedicated video memory is the gpu budget
+	 DXGI_ADAPTER_DESC1 adapterDesc = {};
+	 if (SUCCEEDED(adapter->GetDesc1(&adapterDesc)))
+	 {
+		 MemoryTracker::Get().SetBudget(MemoryDomain::GPU, (uint64_t)adapterDesc.DedicatedVideoMemory);
+	 }
 	 CHECKHR(D3D12CreateDevice(adapter, D3D_FEATURE_LEVEL_12_0, IID_PPV_ARGS(&device)));
 
 	 //create command queue
@@ -243,7 +264,7 @@ D3D12GraphicsDevice::D3D12GraphicsDevice()
 	 CHECKHR(device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&commandQueue)));
 	 //create swap chain
 	 DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
-	 swapChainDesc.BufferCount = 2;
+	 swapChainDesc.BufferCount = BackBufferCount;
 	 swapChainDesc.Width = width;
 	 swapChainDesc.Height = height;
 	 swapChainDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
@@ -258,7 +279,7 @@ D3D12GraphicsDevice::D3D12GraphicsDevice()
 
 	 //create descriptor heap
 	 D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
-	 rtvHeapDesc.NumDescriptors = 2;
+	 rtvHeapDesc.NumDescriptors = BackBufferCount;
 	 rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
 	 rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
 	 CHECKHR(device->CreateDescriptorHeap(&rtvHeapDesc, IID_PPV_ARGS(&rtvHeap)));
@@ -266,27 +287,31 @@ D3D12GraphicsDevice::D3D12GraphicsDevice()
 
 	 //create shader resource view heap
 	 D3D12_DESCRIPTOR_HEAP_DESC srvHeapDesc = {};
-	 srvHeapDesc.NumDescriptors = 128;
+	 srvHeapDesc.NumDescriptors = 1024;
 	 srvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
 	 srvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
 	 CHECKHR(device->CreateDescriptorHeap(&srvHeapDesc, IID_PPV_ARGS(&srvHeap)));
 
 	 //create shader resource view heap allocator
 	 heapAllocator.Create(device, srvHeap);
+	 heapAllocator.SetFrameFenceValue(1);
 
 	 //Create frame resources
 	 CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(rtvHeap->GetCPUDescriptorHandleForHeapStart());
-	 for (UINT i = 0; i < 2; i++)
+	 for (UINT i = 0; i < BackBufferCount; i++)
 	 {
 		 CHECKHR(swapChain->GetBuffer(i, IID_PPV_ARGS(&renderTargets[i])));
 		 device->CreateRenderTargetView(renderTargets[i], 0, rtvHandle);
 		 rtvHandle.Offset(1, rtvDescriptorSize);
 	 }
 
-	 //create command allocator
-	 CHECKHR(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&commandAllocator)));
+	 //create a command allocator per frame context, every latency can be switched to later
+	 for (UINT i = 0; i < FrameScheduler::MaxFrameLatency; i++)
+	 {
+		 CHECKHR(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&commandAllocators[i])));
+	 }
 	 //create command list
-	 CHECKHR(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, commandAllocator, 0, IID_PPV_ARGS(&commandList)));
+	 CHECKHR(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, commandAllocators[0], 0, IID_PPV_ARGS(&commandList)));
 	 commandList->Close();
 
 	 //create fence
@@ -294,7 +319,30 @@ D3D12GraphicsDevice::D3D12GraphicsDevice()
 
 	 //create event handle
 	 fenceEvent = CreateEvent(0, 0, 0, 0);
-	 fenceValue = 1;
+	 heapAllocator.SetFrameFenceValue(frameScheduler.GetCurrentFrameFenceValue());
+
+	 //create the upload ring, mapped for the lifetime of the device
+	 CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
+	 CD3DX12_RESOURCE_DESC uploadRingDesc = CD3DX12_RESOURCE_DESC::Buffer(uploadRing.GetCapacity());
+	 CHECKHR(device->CreateCommittedResource(&uploadHeapProps, D3D12_HEAP_FLAG_NONE, &uploadRingDesc, D3D12_RESOURCE_STATE_GENERIC_READ, 0, IID_PPV_ARGS(&uploadRingBuffer)));
+	 D3D12_RANGE uploadReadRange = { 0, 0 };
+	 CHECKHR(uploadRingBuffer->Map(0, &uploadReadRange, (void**)&uploadRingCpuAddress));
+	 MemoryTracker::Get().Allocate(MemoryCategory::UploadHeap, uploadRing.GetCapacity());
+
+	 //create the per frame constant buffer slices
+	 constantRing.Initialize(device, FrameScheduler::MaxFrameLatency);
+
+	 //create timestamp queries for gpu frame time
+	 D3D12_QUERY_HEAP_DESC queryHeapDesc = {};
+	 queryHeapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+	 queryHeapDesc.Count = 2 * FrameScheduler::MaxFrameLatency;
+	 CHECKHR(device->CreateQueryHeap(&queryHeapDesc, IID_PPV_ARGS(&timestampHeap)));
+
+	 CD3DX12_HEAP_PROPERTIES readbackHeapProps(D3D12_HEAP_TYPE_READBACK);
+	 CD3DX12_RESOURCE_DESC readbackDesc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(UINT64) * 2 * FrameScheduler::MaxFrameLatency);
+	 CHECKHR(device->CreateCommittedResource(&readbackHeapProps, D3D12_HEAP_FLAG_NONE, &readbackDesc, D3D12_RESOURCE_STATE_COPY_DEST, 0, IID_PPV_ARGS(&timestampReadback)));
+	 MemoryTracker::Get().Allocate(MemoryCategory::Other, sizeof(UINT64) * 2 * FrameScheduler::MaxFrameLatency);
+	 CHECKHR(commandQueue->GetTimestampFrequency(&timestampFrequency));
 
 
 	 //create full screen rect vertex buffer	
@@ -335,14 +383,27 @@ D3D12GraphicsDevice::D3D12GraphicsDevice()
 //pre render
 void D3D12GraphicsDevice::PreRender()
 {
+	PROFILE_ZONE("PreRender");
+
 	//Scoped PIX event
 	//PIXScopedEvent(commandList, PIX_COLOR(1, 0, 0), "PreRender");
 
-	//wait for previous frame
-	WaitForPreviousFrame();
+	//new frame, restart wait accounting
+	currentWaitMs = 0.0f;
+
+	//only wait when the cpu is frame latency frames ahead, for the frame that last used the next context
+	WaitForFence(frameScheduler.GetFrameWaitValue());
+	UINT64 completedFenceValue = fence->GetCompletedValue();
+	frameContext = frameScheduler.BeginFrame(completedFenceValue);
+	RetireFrameResources(completedFenceValue);
+
+	//the allocator, constant slice and timestamps of the context are free again
+	ReadTimestamps(frameContext);
+	constantRing.BeginFrame(frameContext);
+	heapAllocator.SetFrameFenceValue(frameScheduler.GetCurrentFrameFenceValue());
 
 	UINT backBufferIdx = swapChain->GetCurrentBackBufferIndex();
-	commandAllocator->Reset();
+	commandAllocators[frameContext]->Reset();
 
 	//resource transition barrier
 	D3D12_RESOURCE_BARRIER barrier = {};
@@ -353,7 +414,8 @@ void D3D12GraphicsDevice::PreRender()
 	barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
 	barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
 	
-	commandList->Reset(commandAllocator, 0);
+	commandList->Reset(commandAllocators[frameContext], 0);
+	commandList->EndQuery(timestampHeap, D3D12_QUERY_TYPE_TIMESTAMP, frameContext * 2);
 	commandList->ResourceBarrier(1, &barrier);
 
 
@@ -370,29 +432,29 @@ void D3D12GraphicsDevice::PreRender()
 
 void D3D12GraphicsDevice::Render(float deltaTime)
 {
+	PROFILE_ZONE("Render");
+
 	//Scoped PIX event
 	PIXScopedEvent(commandList, PIX_COLOR(0, 1, 0), "Render");
 
-	//pending commands to render queue
-	for (auto& command : pendingCommands)
+	//execute all render queue, commands that spilled out of the arena run last
+	renderQueue.Execute(*this);
+	if (renderQueue.GetLastOverflowCount() > 0)
 	{
-		renderQueue.push(command);
+		std::cout << "Render command queue full (" << renderQueue.GetArenaSize() << " bytes), " << renderQueue.GetLastOverflowCount()
+			<< " commands spilled" << std::endl;
 	}
-	pendingCommands.clear();
 
-	//execute all render queue
-	while (!renderQueue.empty())
-	{
-		RenderCommand& command = renderQueue.front();
-		command(*this);
-		renderQueue.pop();
-	}
+	//texture copies queued by the commands above and the rows earlier frames had no room for
+	RecordTextureUploads();
 
 
 }
 
 void D3D12GraphicsDevice::Present()
 {
+	PROFILE_ZONE("Present");
+
 	//PIX
 	//PIXScopedEvent(commandList, 0, "Present");
 
@@ -409,6 +471,11 @@ void D3D12GraphicsDevice::Present()
 
 		commandList->ResourceBarrier(1, &barrier);
 	}
+
+	//end of frame timestamp, read back when the context comes around again
+	commandList->EndQuery(timestampHeap, D3D12_QUERY_TYPE_TIMESTAMP, frameContext * 2 + 1);
+	commandList->ResolveQueryData(timestampHeap, D3D12_QUERY_TYPE_TIMESTAMP, frameContext * 2, 2, timestampReadback, sizeof(UINT64) * 2 * frameContext);
+	bTimestampsPending[frameContext] = true;
 	
 	commandList->Close();
 
@@ -416,6 +483,11 @@ void D3D12GraphicsDevice::Present()
 	ID3D12CommandList* commandLists[] = { commandList };
 	commandQueue->ExecuteCommandLists(1, commandLists);
 
+	//staging memory of the frame retires with its fence value
+	UINT64 frameFenceValue = frameScheduler.EndFrame();
+	uploadRing.FinishFrame(frameFenceValue);
+	CHECKHR(commandQueue->Signal(fence, frameFenceValue));
+
 	// Present
 	HRESULT hr = swapChain->Present(vsync, 0);   // Present with vsync
 	if (hr == DXGI_ERROR_DEVICE_REMOVED)
@@ -432,10 +504,36 @@ void D3D12GraphicsDevice::Present()
 //post render
 void D3D12GraphicsDevice::PostRender()
 {
+	PROFILE_ZONE("PostRender");
+
 	//Scoped PIX event
 	//PIXScopedEvent(commandList, PIX_COLOR(0, 0, 1), "PostRender");
-	//wait for previous frame
-	WaitForPreviousFrame();
+
+	//no wait here, the gpu works through the frame while the cpu records the next one
+	lastFrameTimings.waitMs = currentWaitMs;
+}
+
+void D3D12GraphicsDevice::ReadTimestamps(UINT context)
+{
+	if (!bTimestampsPending[context])
+	{
+		return;
+	}
+
+	UINT64* timestamps = nullptr;
+	SIZE_T offset = sizeof(UINT64) * 2 * context;
+	D3D12_RANGE readRange = { offset, offset + sizeof(UINT64) * 2 };
+	if (SUCCEEDED(timestampReadback->Map(0, &readRange, (void**)&timestamps)))
+	{
+		const UINT64* frameTimestamps = timestamps + 2 * context;
+		if (frameTimestamps[1] >= frameTimestamps[0] && timestampFrequency > 0)
+		{
+			lastFrameTimings.gpuMs = (float)((double)(frameTimestamps[1] - frameTimestamps[0]) * 1000.0 / (double)timestampFrequency);
+		}
+		D3D12_RANGE writeRange = { 0, 0 };
+		timestampReadback->Unmap(0, &writeRange);
+	}
+	bTimestampsPending[context] = false;
 }
 
 void D3D12GraphicsDevice::SetVsync(UINT vsync)
@@ -443,23 +541,28 @@ void D3D12GraphicsDevice::SetVsync(UINT vsync)
 	this->vsync = vsync;
 }
 
+void D3D12GraphicsDevice::SetFrameLatency(UINT frameLatency)
+{
+	frameScheduler.SetFrameLatency(frameLatency);
+}
+
 void D3D12GraphicsDevice::Resize(int width, int height)
 {
-	//wait for previous frame
-	WaitForPreviousFrame();
+	//back buffers can only be released once no frame in flight renders to them
+	WaitForGpu();
 
 	//release render targets
-	for (int i = 0; i < 2; i++)
+	for (UINT i = 0; i < BackBufferCount; i++)
 	{
 		renderTargets[i]->Release();
 	}
 	//resize swap chain
 	DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
 	swapChain->GetDesc1(&swapChainDesc);
-	CHECKHR(swapChain->ResizeBuffers(2, width, height, swapChainDesc.Format, swapChainDesc.Flags));
+	CHECKHR(swapChain->ResizeBuffers(BackBufferCount, width, height, swapChainDesc.Format, swapChainDesc.Flags));
 	//create new render targets
 	CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(rtvHeap->GetCPUDescriptorHandleForHeapStart());
-	for (UINT i = 0; i < 2; i++)
+	for (UINT i = 0; i < BackBufferCount; i++)
 	{
 		CHECKHR(swapChain->GetBuffer(i, IID_PPV_ARGS(&renderTargets[i])));
 		device->CreateRenderTargetView(renderTargets[i], 0, rtvHandle);
@@ -473,39 +576,83 @@ void D3D12GraphicsDevice::Resize(int width, int height)
 
 void D3D12GraphicsDevice::Cleanup()
 {
+	//frames may still be in flight
+	if (fence)
+	{
+		WaitForGpu();
+	}
+
 	if (device) device->Release();
 	if (commandQueue) commandQueue->Release();
-	if (commandAllocator) commandAllocator->Release();
+	for (ID3D12CommandAllocator* commandAllocator : commandAllocators)
+	{
+		if (commandAllocator) commandAllocator->Release();
+	}
 	if (commandList) commandList->Release();
 	if (swapChain) swapChain->Release();
 	if (rtvHeap) rtvHeap->Release();
 	if (srvHeap) srvHeap->Release();
-	for (int i = 0; i < 2; ++i)
+	for (UINT i = 0; i < BackBufferCount; ++i)
 	{
 		if (renderTargets[i]) renderTargets[i]->Release();
 	}
 	if (fence) fence->Release();
+	if (timestampHeap) timestampHeap->Release();
+	if (timestampReadback) timestampReadback->Release();
+
+	//copies that never got their rows hold on to their textures
+	textureUploads.clear();
+
+	//default textures and shaders outlive every material, release them so only real leaks are left
+	Texture2D::WhiteTexture.reset();
+	Texture2D::BlackTexture.reset();
+	ShaderMap::Get().Clear();
+
+	//gpu is idle after the wait above, every staging buffer and freed descriptor can go
+	RetireFrameResources(UINT64_MAX);
+	heapAllocator.ReportLeaks();
+	heapAllocator.Destroy();
+	constantRing.Release();
+	if (uploadRingBuffer)
+	{
+		uploadRingBuffer->Unmap(0, 0);
+		uploadRingBuffer.Reset();
+		uploadRingCpuAddress = nullptr;
+		MemoryTracker::Get().Free(MemoryCategory::UploadHeap, uploadRing.GetCapacity());
+	}
 }
 
-void D3D12GraphicsDevice::WaitForPreviousFrame()
+void D3D12GraphicsDevice::WaitForFence(UINT64 fenceValue)
 {
+	PROFILE_ZONE("WaitForFence");
+
 	//Scoped PIX event
-	//PIXScopedEvent(commandList, PIX_COLOR(1, 0, 0), "WaitForPreviousFrame");
-	// Signal and increment the fence value.
-	//store current fence value
-	UINT64 currentFenceValue = fenceValue;
-	CHECKHR(commandQueue->Signal(fence, currentFenceValue));
-	// Wait until the previous frame is finished.
-	fenceValue++;
-	if (fence->GetCompletedValue() < currentFenceValue)
+	//PIXScopedEvent(commandList, PIX_COLOR(1, 0, 0), "WaitForFence");
+	if (fence->GetCompletedValue() < fenceValue)
 	{
-		CHECKHR(fence->SetEventOnCompletion(currentFenceValue, fenceEvent));
+		auto waitStart = std::chrono::steady_clock::now();
+
+		CHECKHR(fence->SetEventOnCompletion(fenceValue, fenceEvent));
 		WaitForSingleObject(fenceEvent, INFINITE);
+
+		currentWaitMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - waitStart).count();
 	}
 }
 
+void D3D12GraphicsDevice::WaitForGpu()
+{
+	PROFILE_ZONE("WaitForGpu");
+
+	//every submitted frame signaled its fence value, the last one covers all of them
+	WaitForFence(frameScheduler.GetLastSignaledValue());
+
+	RetireFrameResources(fence->GetCompletedValue());
+}
+
 void D3D12GraphicsDevice::DrawFullScreenRect(const std::shared_ptr<Material>& material)
 {
+	PROFILE_ZONE("DrawFullScreenRect");
+
 	//Scoped PIX event
 	PIXScopedEvent(commandList, PIX_COLOR(0, 0, 1), "DrawFullScreenRect");
 
@@ -515,16 +662,24 @@ void D3D12GraphicsDevice::DrawFullScreenRect(const std::shared_ptr<Material>& ma
 		material->BuildPSO(*this);
 	}
 
+	DrawFullScreenRect(material->pso->PSO, [&material](D3D12GraphicsDevice& device)
+		{
+			material->SetShaderParameters(device);
+		});
+}
+
+void D3D12GraphicsDevice::DrawFullScreenRect(ID3D12PipelineState* pso, const RenderCommand& setShaderParameters)
+{
 	//Set Buffers
 	commandList->IASetVertexBuffers(0, 1, &FullScreenRectVertexBuffer::Get().vbv);
 	commandList->IASetIndexBuffer(&ScreenRectIndexBuffer::Get().ibv);
 	commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 	//Set Pipeline State Object
-	commandList->SetPipelineState(material->pso->PSO);
+	commandList->SetPipelineState(pso);
 
 	//Set Shader Resources
-	material->SetShaderParameters(*this);
+	setShaderParameters(*this);
 
 	//Set Viewport and Scissor Rect
 	D3D12_VIEWPORT viewport = { 0.0f, 0.0f, (float)gAppState.backBufferWidth, (float)gAppState.backBufferHeight, 0.0f, 1.0f };
@@ -536,9 +691,144 @@ void D3D12GraphicsDevice::DrawFullScreenRect(const std::shared_ptr<Material>& ma
 	commandList->DrawIndexedInstanced(6, 1, 0, 0, 0);
 }
 
-void D3D12GraphicsDevice::AddRenderCommand(const RenderCommand& command)
+UploadAllocation D3D12GraphicsDevice::AllocateUpload(UINT64 size, UINT64 alignment)
+{
+	UploadAllocation allocation;
+
+	UploadRingAllocator::Allocation range;
+	if (uploadRing.Allocate(size, alignment, range))
+	{
+		allocation.resource = uploadRingBuffer.Get();
+		allocation.offset = range.offset;
+		allocation.cpuAddress = uploadRingCpuAddress + range.offset;
+		return allocation;
+	}
+
+	//larger than what the ring has free this frame, stage it in its own buffer
+	std::cout << "Upload ring full, " << size << " bytes staged in a dedicated buffer" << std::endl;
+
+	Microsoft::WRL::ComPtr<ID3D12Resource> dedicated;
+	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
+	CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(size);
+	CHECKHR(device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, 0, IID_PPV_ARGS(&dedicated)));
+	MemoryTracker::Get().Allocate(MemoryCategory::UploadHeap, size);
+
+	D3D12_RANGE readRange = { 0, 0 };
+	CHECKHR(dedicated->Map(0, &readRange, (void**)&allocation.cpuAddress));
+	allocation.resource = dedicated.Get();
+	allocation.offset = 0;
+
+	//the buffer lives until the frame recording the copy finished
+	frameScheduler.Defer([dedicated, size]()
+	{
+		dedicated->Unmap(0, 0);
+		MemoryTracker::Get().Free(MemoryCategory::UploadHeap, size);
+	});
+	return allocation;
+}
+
+void D3D12GraphicsDevice::UploadTexture(ID3D12Resource* texture, const std::vector<D3D12_SUBRESOURCE_DATA>& subresources, RenderCommand onUploaded)
+{
+	PendingTextureUpload upload;
+	upload.texture = texture;
+	upload.subresources = subresources;
+	upload.onUploaded = std::move(onUploaded);
+	textureUploads.push_back(std::move(upload));
+}
+
+void D3D12GraphicsDevice::RecordTextureUploads()
+{
+	if (textureUploads.empty())
+	{
+		return;
+	}
+
+	PROFILE_ZONE("RecordTextureUploads");
+
+	UINT64 budget = TextureUploadBudget;
+	while (!textureUploads.empty())
+	{
+		PendingTextureUpload& upload = textureUploads.front();
+		if (upload.subresource < upload.subresources.size())
+		{
+			D3D12_RESOURCE_DESC desc = upload.texture->GetDesc();
+			D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+			UINT rowCount = 0;
+			UINT64 rowSize = 0;
+			device->GetCopyableFootprints(&desc, upload.subresource, 1, 0, &footprint, &rowCount, &rowSize, 0);
+			assert(footprint.Footprint.RowPitch <= TextureUploadBudget);
+
+			//a row of blocks covers 4 texel rows in block compressed formats
+			UINT blockHeight = footprint.Footprint.Height / rowCount;
+
+			UploadRingAllocator::Allocation range;
+			UINT bandRows = uploadRing.AllocateRows(footprint.Footprint.RowPitch, rowCount - upload.row, budget, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, range);
+			if (bandRows == 0)
+			{
+				//the budget is spent or the ring is waiting on the fence, the rest goes next frame
+				break;
+			}
+			budget -= range.size;
+
+			const D3D12_SUBRESOURCE_DATA& source = upload.subresources[upload.subresource];
+			uint8_t* destination = uploadRingCpuAddress + range.offset;
+			for (UINT row = 0; row < bandRows; row++)
+			{
+				memcpy(destination + row * footprint.Footprint.RowPitch, (const uint8_t*)source.pData + (upload.row + row) * source.RowPitch, rowSize);
+			}
+
+			D3D12_PLACED_SUBRESOURCE_FOOTPRINT band = footprint;
+			band.Offset = range.offset;
+			band.Footprint.Height = bandRows * blockHeight;
+			CD3DX12_TEXTURE_COPY_LOCATION dst(upload.texture.Get(), upload.subresource);
+			CD3DX12_TEXTURE_COPY_LOCATION src(uploadRingBuffer.Get(), band);
+			commandList->CopyTextureRegion(&dst, 0, upload.row * blockHeight, 0, &src, 0);
+
+			upload.row += bandRows;
+			if (upload.row == rowCount)
+			{
+				upload.row = 0;
+				upload.subresource++;
+			}
+		}
+
+		if (upload.subresource == upload.subresources.size())
+		{
+			RenderCommand onUploaded = std::move(upload.onUploaded);
+			textureUploads.pop_front();
+			if (onUploaded)
+			{
+				onUploaded(*this);
+			}
+		}
+	}
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS D3D12GraphicsDevice::UploadConstants(const void* data, UINT size)
+{
+	ConstantBufferRing::Allocation allocation;
+	if (constantRing.Allocate(size, allocation))
+	{
+		memcpy(allocation.cpuAddress, data, size);
+		return allocation.gpuAddress;
+	}
+
+	//more draws than the slice holds, the upload ring is fenced just the same
+	if (!bConstantRingFullReported)
+	{
+		std::cout << "Constant buffer slice full (" << constantRing.GetSliceSize() << " bytes), using the upload ring" << std::endl;
+		bConstantRingFullReported = true;
+	}
+	UploadAllocation upload = AllocateUpload(size, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+	memcpy(upload.cpuAddress, data, size);
+	return upload.resource->GetGPUVirtualAddress() + upload.offset;
+}
+
+void D3D12GraphicsDevice::RetireFrameResources(UINT64 completedFenceValue)
 {
-	renderQueue.push(command);
+	uploadRing.Retire(completedFenceValue);
+	heapAllocator.Retire(completedFenceValue);
+	frameScheduler.Retire(completedFenceValue);
 }
 
 
@@ -8,56 +8,111 @@
 #include <memory>
 #include <wrl\client.h>
 #include <string>
+#include <iostream>
 #include <functional>
-#include <queue>
+#include <deque>
+#include "ConstantBuffers.h"
+#include "DescriptorAllocator.h"
+#include "RenderCommandQueue.h"
+#include "ConstantBufferRing.h"
+#include "UploadRingAllocator.h"
+#include "FrameScheduler.h"
 
 //Macro to check for HRESULT for dx12 functions assert if failed and log location and reason
 //create error handler
 #define CHECKHR(x) { HRESULT hr = x; if(FAILED(hr)) { std::cout << "Error: " << __FILE__ << ":" << __LINE__ << " HRESULT: " << hr << std::endl; assert(false); } }
 
-// Simple free list based allocator
+// Shader visible descriptor heap sub allocated by a DescriptorAllocator.
+// Handles are generational, resolving a stale one asserts instead of aliasing whatever reused its slot.
+// Frees are deferred until the frame being recorded finished on the gpu, the device keeps the fence value current.
 struct DescriptorHeapAllocator
 {
     ID3D12DescriptorHeap* Heap = nullptr;
     D3D12_DESCRIPTOR_HEAP_TYPE  HeapType = D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES;
-    D3D12_CPU_DESCRIPTOR_HANDLE HeapStartCpu;
-    D3D12_GPU_DESCRIPTOR_HANDLE HeapStartGpu;
-    UINT                        HeapHandleIncrement;
-    std::vector<int>               FreeIndices;
+    D3D12_CPU_DESCRIPTOR_HANDLE HeapStartCpu = {};
+    D3D12_GPU_DESCRIPTOR_HANDLE HeapStartGpu = {};
+    UINT                        HeapHandleIncrement = 0;
+    DescriptorAllocator         Allocator;
+    //fence value signaled after the frame being recorded
+    UINT64                      FrameFenceValue = 0;
 
     void Create(ID3D12Device* device, ID3D12DescriptorHeap* heap)
     {
-        //assert(Heap == nullptr && FreeIndices.empty());
         Heap = heap;
         D3D12_DESCRIPTOR_HEAP_DESC desc = heap->GetDesc();
         HeapType = desc.Type;
         HeapStartCpu = Heap->GetCPUDescriptorHandleForHeapStart();
         HeapStartGpu = Heap->GetGPUDescriptorHandleForHeapStart();
         HeapHandleIncrement = device->GetDescriptorHandleIncrementSize(HeapType);
-        FreeIndices.reserve((int)desc.NumDescriptors);
-        for (int n = desc.NumDescriptors; n > 0; n--)
-            FreeIndices.push_back(n);
+        Allocator.Reset(desc.NumDescriptors);
     }
     void Destroy()
     {
         Heap = nullptr;
-        FreeIndices.clear();
+        Allocator.Reset(0);
     }
+
+    //contiguous range of count descriptors, a descriptor table. Null handle when the heap is full
+    DescriptorHandle Alloc(UINT count = 1, const char* name = nullptr)
+    {
+        DescriptorHandle handle = Allocator.Allocate(count, name);
+        assert(!handle.IsNull());
+        return handle;
+    }
+    //the descriptors stay readable by frames in flight, handle is reset
+    void Free(DescriptorHandle& handle)
+    {
+        //heap already gone at shutdown, static textures die after it
+        if (Heap && !handle.IsNull())
+        {
+            Allocator.Free(handle, FrameFenceValue);
+        }
+        handle = DescriptorHandle();
+    }
+    bool IsValid(const DescriptorHandle& handle) const { return Allocator.IsValid(handle); }
+
+    D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandle(const DescriptorHandle& handle, UINT offset = 0) const
+    {
+        assert(IsValid(handle) && offset < handle.count);
+        D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = {};
+        if (IsValid(handle))
+        {
+            cpuHandle.ptr = HeapStartCpu.ptr + (SIZE_T)(handle.index + offset) * HeapHandleIncrement;
+        }
+        return cpuHandle;
+    }
+    D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandle(const DescriptorHandle& handle, UINT offset = 0) const
+    {
+        assert(IsValid(handle) && offset < handle.count);
+        D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle = {};
+        if (IsValid(handle))
+        {
+            gpuHandle.ptr = HeapStartGpu.ptr + (UINT64)(handle.index + offset) * HeapHandleIncrement;
+        }
+        return gpuHandle;
+    }
+
+    //single descriptor by raw handles, for the ImGui backend callbacks
     void Alloc(D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu_desc_handle, D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu_desc_handle)
     {
-        assert(FreeIndices.size() > 0);
-        int idx = FreeIndices.back();
-        FreeIndices.pop_back();
-        out_cpu_desc_handle->ptr = HeapStartCpu.ptr + (idx * HeapHandleIncrement);
-        out_gpu_desc_handle->ptr = HeapStartGpu.ptr + (idx * HeapHandleIncrement);
+        DescriptorHandle handle = Alloc(1, "ImGui");
+        *out_cpu_desc_handle = GetCpuHandle(handle);
+        *out_gpu_desc_handle = GetGpuHandle(handle);
     }
     void Free(D3D12_CPU_DESCRIPTOR_HANDLE out_cpu_desc_handle, D3D12_GPU_DESCRIPTOR_HANDLE out_gpu_desc_handle)
     {
-        int cpu_idx = (int)((out_cpu_desc_handle.ptr - HeapStartCpu.ptr) / HeapHandleIncrement);
-        int gpu_idx = (int)((out_gpu_desc_handle.ptr - HeapStartGpu.ptr) / HeapHandleIncrement);
+        UINT cpu_idx = (UINT)((out_cpu_desc_handle.ptr - HeapStartCpu.ptr) / HeapHandleIncrement);
+        UINT gpu_idx = (UINT)((out_gpu_desc_handle.ptr - HeapStartGpu.ptr) / HeapHandleIncrement);
         assert(cpu_idx == gpu_idx);
-        FreeIndices.push_back(cpu_idx);
+        DescriptorHandle handle = Allocator.Find(cpu_idx);
+        Free(handle);
     }
+
+    void SetFrameFenceValue(UINT64 fenceValue) { FrameFenceValue = fenceValue; }
+    void Retire(UINT64 completedFenceValue) { Allocator.Retire(completedFenceValue); }
+
+    //prints every allocation still alive, call once everything should have been released
+    void ReportLeaks() const;
 };
 
 struct TextureSet
@@ -69,15 +124,21 @@ struct TextureSet
 	std::shared_ptr<struct Texture2D> displacementTexture;
 };
 
-struct RectConstantBuffer
+//gpu side timings of a completed frame
+struct FrameTimings
 {
-	float scale = 1.f;
-	float intensity = 2.5f;
-	float lightpos = 0.f;
-	float metalness = 0.0f;
+	//time between the first and last timestamp of the frame command list
+	float gpuMs = 0.0f;
+	//time the cpu was blocked on the fence during the frame, waiting for a frame context to come free
+	float waitMs = 0.0f;
+};
 
-	//padding 256 byte alignment
-	float padding[60];
+//staging memory for a copy recorded this frame, stays untouched until the fence of the frame completed
+struct UploadAllocation
+{
+	ID3D12Resource* resource = nullptr;
+	UINT64 offset = 0;
+	uint8_t* cpuAddress = nullptr;
 };
 
 // type def for render command created by lamda
@@ -113,16 +174,65 @@ public:
 
     bool IsSwapChainOccluded() const { return bOccluded; }
 
-	void WaitForPreviousFrame();
+	//blocks until every submitted frame finished on the gpu, for resizes, teardown and unloading
+	void WaitForGpu();
+
+	//blocks until the fence reached fenceValue, the time counts as frame wait
+	void WaitForFence(UINT64 fenceValue);
+
+	UINT64 GetCompletedFenceValue() const { return fence->GetCompletedValue(); }
+	UINT64 GetLastSubmittedFenceValue() const { return frameScheduler.GetLastSignaledValue(); }
+
+	//keeps object alive until every frame that could use it finished on the gpu
+	void DeferRelease(std::shared_ptr<void> object)
+	{
+		frameScheduler.Defer([object]() {});
+	}
+
+	//frames the cpu may record ahead of the gpu, 1..FrameScheduler::MaxFrameLatency, from the next frame on
+	void SetFrameLatency(UINT frameLatency);
+	UINT GetFrameLatency() const { return frameScheduler.GetFrameLatency(); }
 
     // Add DrawFullScreenRect method
     void DrawFullScreenRect(const std::shared_ptr<class Material>& material);
 
-	// Add RenderCommand method
-	void AddRenderCommand(const RenderCommand& command);
+	//full screen rect with any pipeline, setShaderParameters binds the root parameters of its shader
+	void DrawFullScreenRect(ID3D12PipelineState* pso, const RenderCommand& setShaderParameters);
+
+	//thread safe, commands run in order at the start of the next Render
+	template<typename Command>
+	void AddRenderCommand(Command&& command)
+	{
+		renderQueue.PushOrOverflow(std::forward<Command>(command));
+	}
+
+	//render thread only, while recording. Served from the upload ring, a dedicated buffer when the ring is full
+	//alignment defaults to the placement alignment of texture copies
+	UploadAllocation AllocateUpload(UINT64 size, UINT64 alignment = D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+	//render thread only. Copies every subresource to texture in bands of rows through the upload ring, a texture
+	//larger than the ring or the frame budget is spread over the next frames instead of a dedicated buffer.
+	//onUploaded runs once the last band is recorded, the subresource data must live until then
+	void UploadTexture(ID3D12Resource* texture, const std::vector<D3D12_SUBRESOURCE_DATA>& subresources, RenderCommand onUploaded);
+
+	const UploadRingAllocator& GetUploadRing() const { return uploadRing; }
+
+	//render thread only, while recording. Copies data to a 256 byte aligned slice of this frame, for a root CBV
+	D3D12_GPU_VIRTUAL_ADDRESS UploadConstants(const void* data, UINT size);
+
+	template<typename T>
+	D3D12_GPU_VIRTUAL_ADDRESS UploadConstants(const T& constants)
+	{
+		return UploadConstants(&constants, (UINT)sizeof(T));
+	}
+
+	const ConstantBufferRing& GetConstantRing() const { return constantRing; }
 
 	RectConstantBuffer rectConstantBuffer;
 
+	//timings of the last frame that finished on the gpu
+	const FrameTimings& GetLastFrameTimings() const { return lastFrameTimings; }
+
 public:
     //getter for device
     ID3D12Device* GetDevice() const { return device; }
@@ -135,13 +245,17 @@ private:
     //D3D12 State
     ID3D12Device* device;
     ID3D12CommandQueue* commandQueue;
-    ID3D12CommandAllocator* commandAllocator;
+    //one allocator per frame context, reset once the frame that last used it finished
+    ID3D12CommandAllocator* commandAllocators[FrameScheduler::MaxFrameLatency] = {};
     ID3D12GraphicsCommandList* commandList;
     IDXGISwapChain3* swapChain;
 
     ID3D12DescriptorHeap* rtvHeap;
     ID3D12DescriptorHeap* srvHeap;
-    ID3D12Resource* renderTargets[2];
+	//a back buffer per frame context, so at the largest latency a frame still has one to render into and
+	//Present doesn't block on a buffer the gpu holds. DXGI queues up to 3 presents, MaxFrameLatency
+	static const UINT BackBufferCount = FrameScheduler::MaxFrameLatency;
+    ID3D12Resource* renderTargets[BackBufferCount] = {};
     UINT rtvDescriptorSize;
     ID3D12Fence* fence;
 
@@ -149,20 +263,62 @@ private:
 	Microsoft::WRL::ComPtr<ID3D12Debug> debugController0;
 	Microsoft::WRL::ComPtr<ID3D12Debug1> debugController1;
 
-    //fence value
-    UINT64 fenceValue = 0;
 	HANDLE fenceEvent;
 
+	//fence values and frame contexts of the frames in flight
+	FrameScheduler frameScheduler;
+	UINT frameContext = 0;
+
+	//timestamps at the start and end of every frame context, resolved to a readback buffer
+	ID3D12QueryHeap* timestampHeap = nullptr;
+	ID3D12Resource* timestampReadback = nullptr;
+	UINT64 timestampFrequency = 0;
+	bool bTimestampsPending[FrameScheduler::MaxFrameLatency] = {};
+
+	//reads the timestamps of the context's last frame, it must have finished
+	void ReadTimestamps(UINT context);
+
+	//fence wait accumulated during the current frame
+	float currentWaitMs = 0.0f;
+	FrameTimings lastFrameTimings;
+
     UINT vsync = true;
     
     //swap chain occluded
     bool bOccluded = false;
 
-	//thread safe queue for render command
-	std::queue<RenderCommand> renderQueue;
+	//thread safe queue for render command, commands live in a per frame arena
+	RenderCommandQueue<D3D12GraphicsDevice> renderQueue;
 
-	//pending render commands
-	std::vector<RenderCommand> pendingCommands;
+	//staging memory of every upload, one persistently mapped buffer sub allocated by the ring
+	UploadRingAllocator uploadRing;
+	Microsoft::WRL::ComPtr<ID3D12Resource> uploadRingBuffer;
+	uint8_t* uploadRingCpuAddress = nullptr;
+
+	//texture copies waiting for room in the ring, recorded in order after the render commands of each frame
+	struct PendingTextureUpload
+	{
+		Microsoft::WRL::ComPtr<ID3D12Resource> texture;
+		std::vector<D3D12_SUBRESOURCE_DATA> subresources;
+		//next subresource and row of blocks to copy
+		UINT subresource = 0;
+		UINT row = 0;
+		RenderCommand onUploaded;
+	};
+	std::deque<PendingTextureUpload> textureUploads;
+
+	//ring bytes texture bands may take per frame, the rest stays free for constants and buffers
+	static const UINT64 TextureUploadBudget = UploadRingAllocator::DefaultCapacity / 4;
+
+	//records bands of the pending texture copies until the frame budget or the ring ran out
+	void RecordTextureUploads();
+
+	//constants of every draw, one slice per frame context
+	ConstantBufferRing constantRing;
+	bool bConstantRingFullReported = false;
+
+	//gives back the staging memory and descriptors of every frame the gpu finished
+	void RetireFrameResources(UINT64 completedFenceValue);
 };
 
 //getter  global heap allocator
@@ -0,0 +1,58 @@
+// Entry point on platforms without d3d12, only the device independent modes are available.
+// Source.cpp holds the windows entry point.
+#ifndef _WIN32
+#include "Benchmark.h"
+#include "DecoderCompiler.h"
+#include "Profiler.h"
+#include <iostream>
+
+static void PrintUsage()
+{
+	std::cout << "Usage: NeuralTexture --benchmark [--materials=a,b] [--scales=0.5,1,2] [--resolutions=480x270,...]" << std::endl;
+	std::cout << "                     [--warmup=N] [--frames=N] [--threads=N] [--output=benchmark.json] [-trace]" << std::endl;
+	std::cout << "                     [--backend=null|software] to run through a render backend" << std::endl;
+	std::cout << "       NeuralTexture --bake-decoders to generate the baked decoders of the material library" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	PROFILE_THREAD_NAME("Main");
+
+	std::vector<std::string> arguments(argv, argv + argc);
+
+	bool bWriteTrace = false;
+	bool bBakeDecoders = false;
+	for (const std::string& argument : arguments)
+	{
+		if (argument == "-trace")
+		{
+			bWriteTrace = true;
+		}
+		else if (argument == "--bake-decoders")
+		{
+			bBakeDecoders = true;
+		}
+	}
+
+	int result = 1;
+	if (bBakeDecoders)
+	{
+		result = BakeLibraryDecoders();
+	}
+	else if (IsBenchmarkRequested(arguments))
+	{
+		result = RunSoftwareBenchmark(arguments);
+	}
+	else
+	{
+		PrintUsage();
+	}
+
+	if (bWriteTrace)
+	{
+		std::cout << "Writing trace.json, " << Profiler::GetZoneCount() << " zones" << std::endl;
+		Profiler::WriteChromeTrace("trace.json");
+	}
+	return result;
+}
+#endif
@@ -0,0 +1,163 @@
+#include "ImageMetrics.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ImageMetrics
+{
+	double MeanSquaredError(const float* a, const float* b, size_t pixelCount, uint32_t stride, uint32_t firstChannel, uint32_t channelCount)
+	{
+		if (pixelCount == 0 || channelCount == 0)
+		{
+			return 0.0;
+		}
+
+		double sum = 0.0;
+		for (size_t i = 0; i < pixelCount; i++)
+		{
+			const float* pixelA = a + i * stride + firstChannel;
+			const float* pixelB = b + i * stride + firstChannel;
+			for (uint32_t c = 0; c < channelCount; c++)
+			{
+				double difference = (double)pixelA[c] - pixelB[c];
+				sum += difference * difference;
+			}
+		}
+		return sum / ((double)pixelCount * channelCount);
+	}
+
+	double PSNR(double meanSquaredError)
+	{
+		if (meanSquaredError <= 0.0)
+		{
+			return MaxPSNR;
+		}
+		return std::min(MaxPSNR, 10.0 * std::log10(1.0 / meanSquaredError));
+	}
+
+	double SSIM(const float* a, const float* b, uint32_t width, uint32_t height, uint32_t stride, uint32_t channel)
+	{
+		const uint32_t windowSize = 8;
+		const uint32_t windowStep = 4;
+		const double C1 = 0.01 * 0.01;
+		const double C2 = 0.03 * 0.03;
+
+		if (width < windowSize || height < windowSize)
+		{
+			return 0.0;
+		}
+
+		double sum = 0.0;
+		size_t windowCount = 0;
+		for (uint32_t y0 = 0; y0 + windowSize <= height; y0 += windowStep)
+		{
+			for (uint32_t x0 = 0; x0 + windowSize <= width; x0 += windowStep)
+			{
+				double sumA = 0.0, sumB = 0.0, sumAA = 0.0, sumBB = 0.0, sumAB = 0.0;
+				for (uint32_t y = y0; y < y0 + windowSize; y++)
+				{
+					for (uint32_t x = x0; x < x0 + windowSize; x++)
+					{
+						size_t index = ((size_t)y * width + x) * stride + channel;
+						double valueA = std::clamp(a[index], 0.0f, 1.0f);
+						double valueB = std::clamp(b[index], 0.0f, 1.0f);
+						sumA += valueA;
+						sumB += valueB;
+						sumAA += valueA * valueA;
+						sumBB += valueB * valueB;
+						sumAB += valueA * valueB;
+					}
+				}
+
+				const double n = windowSize * windowSize;
+				double meanA = sumA / n;
+				double meanB = sumB / n;
+				double varianceA = sumAA / n - meanA * meanA;
+				double varianceB = sumBB / n - meanB * meanB;
+				double covariance = sumAB / n - meanA * meanB;
+
+				sum += ((2.0 * meanA * meanB + C1) * (2.0 * covariance + C2)) /
+					((meanA * meanA + meanB * meanB + C1) * (varianceA + varianceB + C2));
+				windowCount++;
+			}
+		}
+		return sum / (double)windowCount;
+	}
+
+	AngularError NormalAngularError(const float* a, const float* b, size_t pixelCount, uint32_t stride, uint32_t firstChannel)
+	{
+		AngularError result;
+		if (pixelCount == 0)
+		{
+			return result;
+		}
+
+		const double degreesPerRadian = 180.0 / 3.14159265358979323846;
+
+		std::vector<float> angles(pixelCount);
+		double sum = 0.0;
+		for (size_t i = 0; i < pixelCount; i++)
+		{
+			const float* pixelA = a + i * stride + firstChannel;
+			const float* pixelB = b + i * stride + firstChannel;
+
+			double normalA[3], normalB[3];
+			double lengthA = 0.0, lengthB = 0.0;
+			for (int c = 0; c < 3; c++)
+			{
+				normalA[c] = pixelA[c] * 2.0 - 1.0;
+				normalB[c] = pixelB[c] * 2.0 - 1.0;
+				lengthA += normalA[c] * normalA[c];
+				lengthB += normalB[c] * normalB[c];
+			}
+
+			double cosine = 0.0;
+			if (lengthA > 0.0 && lengthB > 0.0)
+			{
+				cosine = (normalA[0] * normalB[0] + normalA[1] * normalB[1] + normalA[2] * normalB[2]) / std::sqrt(lengthA * lengthB);
+			}
+			angles[i] = (float)(std::acos(std::clamp(cosine, -1.0, 1.0)) * degreesPerRadian);
+			sum += angles[i];
+		}
+
+		result.meanDegrees = sum / (double)pixelCount;
+
+		size_t p95 = (size_t)((pixelCount - 1) * 0.95);
+		std::nth_element(angles.begin(), angles.begin() + p95, angles.end());
+		result.p95Degrees = angles[p95];
+		result.maxDegrees = *std::max_element(angles.begin() + p95, angles.end());
+		return result;
+	}
+
+	void AbsoluteDifference(const float* a, const float* b, size_t pixelCount, uint32_t stride, uint32_t channelCount, std::vector<float>& outDifference)
+	{
+		outDifference.resize(pixelCount);
+		for (size_t i = 0; i < pixelCount; i++)
+		{
+			float largest = 0.0f;
+			for (uint32_t c = 0; c < channelCount; c++)
+			{
+				largest = std::max(largest, std::fabs(a[i * stride + c] - b[i * stride + c]));
+			}
+			outDifference[i] = largest;
+		}
+	}
+
+	void Heatmap(const std::vector<float>& difference, float maxDifference, std::vector<uint8_t>& outRGBA8)
+	{
+		outRGBA8.resize(difference.size() * 4);
+		for (size_t i = 0; i < difference.size(); i++)
+		{
+			float t = maxDifference > 0.0f ? std::clamp(difference[i] / maxDifference, 0.0f, 1.0f) : (difference[i] > 0.0f ? 1.0f : 0.0f);
+
+			float r = std::clamp(t * 3.0f - 2.0f, 0.0f, 1.0f);
+			float g = std::clamp(t < 2.0f / 3.0f ? t * 3.0f - 1.0f : 3.0f - t * 3.0f, 0.0f, 1.0f);
+			float b = std::clamp(t < 1.0f / 3.0f ? t * 3.0f : 2.0f - t * 3.0f, 0.0f, 1.0f);
+
+			uint8_t* pixel = &outRGBA8[i * 4];
+			pixel[0] = (uint8_t)(r * 255.0f + 0.5f);
+			pixel[1] = (uint8_t)(g * 255.0f + 0.5f);
+			pixel[2] = (uint8_t)(b * 255.0f + 0.5f);
+			pixel[3] = 255;
+		}
+	}
+}
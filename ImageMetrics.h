@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Image comparison metrics on interleaved float images with values in [0, 1].
+// stride is the number of floats per pixel, channels are picked by index.
+namespace ImageMetrics
+{
+	//PSNR reported for identical images
+	const double MaxPSNR = 100.0;
+
+	double MeanSquaredError(const float* a, const float* b, size_t pixelCount, uint32_t stride, uint32_t firstChannel, uint32_t channelCount);
+
+	//peak signal of 1
+	double PSNR(double meanSquaredError);
+
+	//mean SSIM of one channel over 8x8 windows, 4 pixels apart
+	double SSIM(const float* a, const float* b, uint32_t width, uint32_t height, uint32_t stride, uint32_t channel);
+
+	struct AngularError
+	{
+		double meanDegrees = 0.0;
+		double p95Degrees = 0.0;
+		double maxDegrees = 0.0;
+	};
+
+	//angle between normals stored as n * 0.5 + 0.5 in three channels starting at firstChannel
+	AngularError NormalAngularError(const float* a, const float* b, size_t pixelCount, uint32_t stride, uint32_t firstChannel);
+
+	//largest absolute difference over the first channelCount channels of every pixel
+	void AbsoluteDifference(const float* a, const float* b, size_t pixelCount, uint32_t stride, uint32_t channelCount, std::vector<float>& outDifference);
+
+	//black, blue, green to red as the difference goes from 0 to maxDifference, RGBA8
+	void Heatmap(const std::vector<float>& difference, float maxDifference, std::vector<uint8_t>& outRGBA8);
+}
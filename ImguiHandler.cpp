@@ -25,7 +25,8 @@ void ImGuiHandler::Initialize(HWND hwnd, D3D12GraphicsDevice& device)
     ImGui_ImplDX12_InitInfo initInfo = {};
     initInfo.Device = device.GetDevice();
     initInfo.CommandQueue = device.GetCommandQueue();
-    initInfo.NumFramesInFlight = 2;
+    //the backend rotates its vertex buffers by this, it has to cover any frame latency
+    initInfo.NumFramesInFlight = FrameScheduler::MaxFrameLatency;
     initInfo.RTVFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
     initInfo.DSVFormat = DXGI_FORMAT_D32_FLOAT;
     initInfo.SrvDescriptorHeap = device.GetSrvHeap();
@@ -6,6 +6,19 @@
 #include "Shader.h"
 #include "Texture2D.h"
 #include "d3dx12.h"
+#include "NeuralModel.h"
+#include "NeuralModelPool.h"
+#include "MaterialLibrary.h"
+#include "MemoryTracker.h"
+#include "StructuredBuffer.h"
+#include "BakedDecoders.h"
+#include "DecoderCompiler.h"
+#include <filesystem>
+
+Material::~Material()
+{
+	heapAllocator.Free(srvTable);
+}
 
 void Material::SetTexture(int slotIndex, Texture2DPtr texture, const std::string& name)
 {
@@ -61,14 +74,50 @@ void Material::SetShaderParameters(D3D12GraphicsDevice& device)
 	std::vector<Texture2DPtr> textures;
 	CollectTextures(textures);
 
-	pixelShader->SetShaderParameters(device, textures, device.rectConstantBuffer);
+	UpdateSRVTable(device, textures, {});
+	pixelShader->SetShaderParameters(device, heapAllocator.GetGpuHandle(srvTable), device.rectConstantBuffer);
+}
+
+void Material::UpdateSRVTable(D3D12GraphicsDevice& device, const std::vector<Texture2DPtr>& textures, const std::vector<StructuredBufferPtr>& buffers)
+{
+	std::vector<DescriptorHandle> sources;
+	for (const Texture2DPtr& texture : textures)
+	{
+		sources.push_back(texture->descriptor);
+	}
+	for (const StructuredBufferPtr& buffer : buffers)
+	{
+		sources.push_back(buffer->descriptor);
+	}
+
+	//a toggled slot or reloaded texture has a different descriptor, generations catch reused slots
+	if (heapAllocator.IsValid(srvTable) && sources == srvTableSources)
+	{
+		return;
+	}
+
+	//the old table may still be read by a frame in flight, it's freed behind the fence
+	heapAllocator.Free(srvTable);
+	srvTable = heapAllocator.Alloc((UINT)sources.size(), "Material srv table");
+	srvTableSources = sources;
+
+	UINT offset = 0;
+	for (const Texture2DPtr& texture : textures)
+	{
+		texture->CreateView(device, heapAllocator.GetCpuHandle(srvTable, offset++));
+	}
+	for (const StructuredBufferPtr& buffer : buffers)
+	{
+		buffer->CreateView(device, heapAllocator.GetCpuHandle(srvTable, offset++));
+	}
 }
 
 void Material::CollectTextures(std::vector<Texture2DPtr>& textures)
 {
+	//a texture still streaming through the upload ring shows white until its last row is copied
 	for (auto& textureSlot : textureSlots)
 	{
-		if (textureSlot.bEnable && textureSlot.texture)
+		if (textureSlot.bEnable && textureSlot.texture && !textureSlot.texture->bUploadPending)
 		{
 			textures.push_back(textureSlot.texture);
 		}
@@ -81,11 +130,102 @@ void Material::CollectTextures(std::vector<Texture2DPtr>& textures)
 
 void NeuralTextureMaterial::SetShaderParameters(D3D12GraphicsDevice& device)
 {
-	auto neuralpixelShader = std::dynamic_pointer_cast<NeuralPixelShader>(pixelShader);
-
 	//set shader parameters
 	std::vector<Texture2DPtr> textures;
 	CollectTextures(textures);
 
-	neuralpixelShader->SetShaderParameters(device, textures, device.rectConstantBuffer, model);
+	//a model set by hand joins the pool, or shares the resident one with the same weights
+	NeuralModelPool& pool = NeuralModelPool::Get();
+	model = pool.Add(model);
+	pool.UpdateBuffers(device);
+
+	StructuredBufferPtr weights;
+	StructuredBufferPtr biases;
+	pool.GetViews(*model, weights, biases);
+
+	//feature grids, then the weights and biases of the decoder at its slot in the arenas
+	UpdateSRVTable(device, textures, { weights, biases });
+	pixelShader->SetShaderParameters(device, heapAllocator.GetGpuHandle(srvTable), device.rectConstantBuffer);
+}
+
+MaterialPtr CreateMaterial(D3D12GraphicsDevice& device, const MaterialDesc& desc)
+{
+	MemoryTracker::OwnerScope memoryOwner(desc.name);
+
+	MaterialPtr material;
+	if (desc.IsNeural())
+	{
+		auto neuralMaterial = std::make_shared<NeuralTextureMaterial>();
+		neuralMaterial->model = NeuralModelPool::Get().Load(desc.modelPath);
+		material = neuralMaterial;
+	}
+	else
+	{
+		material = std::make_shared<Material>();
+	}
+
+	for (int i = 0; i < (int)desc.textures.size(); i++)
+	{
+		const MaterialTextureDesc& textureDesc = desc.textures[i];
+		material->SetTexture(i, LoadMaterialTexture(device, textureDesc.path), textureDesc.slotName);
+	}
+
+	material->vertexShader = ShaderMap::Get().GetShader<VertexShader>(device, "FullScreenRectVS");
+	std::string bakedShaderPath;
+	if (desc.IsNeural())
+	{
+		material->pixelShader = GetBakedPixelShader(device, *std::static_pointer_cast<NeuralTextureMaterial>(material)->model, bakedShaderPath);
+	}
+	if (material->pixelShader != nullptr)
+	{
+		std::cout << desc.name << ": decoder baked into " << bakedShaderPath << std::endl;
+	}
+	else
+	{
+		material->pixelShader = GetMaterialPixelShader(device, desc.shader);
+		std::cout << desc.name << ": " << GetMaterialShaderName(desc.shader) << " pixel shader" << std::endl;
+	}
+
+	return material;
+}
+
+Texture2DPtr LoadMaterialTexture(D3D12GraphicsDevice& device, const std::string& path)
+{
+	std::wstring widePath(path.begin(), path.end());
+
+	bool bDDS = widePath.size() >= 4 && _wcsicmp(widePath.c_str() + widePath.size() - 4, L".dds") == 0;
+	return bDDS ? Texture2D::CreateFromDDS(device, widePath.c_str()) : Texture2D::CreateFromFile(device, widePath.c_str());
+}
+
+std::shared_ptr<PixelShader> GetBakedPixelShader(D3D12GraphicsDevice& device, const NeuralModel& model, std::string& outShaderPath)
+{
+	//Shaders/Baked is written by --bake-decoders alone, without its file the material keeps the generic shader
+	const BakedDecoder* decoder = FindBakedDecoder(HashDecoderModel(model));
+	const std::string path = decoder != nullptr ? std::string("Shaders/Baked/") + decoder->name + ".hlsl" : std::string();
+	if (decoder == nullptr || !std::filesystem::exists(path))
+	{
+		//the generic forward() has a ReLU after every hidden layer, a factorized model needs its own
+		if (!model.linear_layers.empty())
+		{
+			std::cout << "Factorized decoder without a baked shader, run NeuralTexture --bake-decoders" << std::endl;
+		}
+		return nullptr;
+	}
+
+	outShaderPath = path;
+	return ShaderMap::Get().GetShader<BakedNeuralPixelShader>(device, std::string("Baked") + decoder->name + "NeuralFullScreenRectPS", decoder->name);
+}
+
+std::shared_ptr<PixelShader> GetMaterialPixelShader(D3D12GraphicsDevice& device, MaterialShader shader)
+{
+	switch (shader)
+	{
+	case MaterialShader::NeuralLight32:
+		return ShaderMap::Get().GetShader<NeuralPixelShaderLight<32>>(device, "Light32NeuralFullScreenRectPS");
+	case MaterialShader::Neural:
+		return ShaderMap::Get().GetShader<NeuralPixelShader>(device, "NeuralFullScreenRectPS");
+	case MaterialShader::PBR:
+	default:
+		return ShaderMap::Get().GetShader<PixelShader>(device, "FullScreenRectPS");
+	}
 }
@@ -3,9 +3,12 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include "DescriptorAllocator.h"
+#include "MaterialLibrary.h"
 
 typedef std::shared_ptr<class Material> MaterialPtr;
 typedef std::shared_ptr<struct Texture2D> Texture2DPtr;
+typedef std::shared_ptr<class StructuredBuffer> StructuredBufferPtr;
 
 struct TextureSlot
 {
@@ -16,9 +19,15 @@ struct TextureSlot
 	bool bEnable = true;
 };
 
+// Material of the viewer, drawn by D3D12GraphicsDevice. It stays on d3d12 rather than on RenderBackend: it owns
+// pipeline state, baked pixel shaders per model and views of ranges of the model pool arenas, and its textures
+// stream in through WIC and the upload ring, none of which the backend interface has. The headless tools draw
+// the same MaterialDesc through BackendMaterial.
 class Material
 {
 public:
+	virtual ~Material();
+
 	std::shared_ptr<class VertexShader> vertexShader;
 	std::shared_ptr<class PixelShader> pixelShader;
 
@@ -35,7 +44,14 @@ public:
 protected:
 	void CollectTextures(std::vector<Texture2DPtr>& textures);
 
+	//views in register order, textures first, then buffers. Rewritten only when one of them changed
+	void UpdateSRVTable(class D3D12GraphicsDevice& device, const std::vector<Texture2DPtr>& textures, const std::vector<StructuredBufferPtr>& buffers);
+
 	std::vector<TextureSlot> textureSlots;
+
+	//descriptor table bound by the pixel shader and the descriptors of the views copied into it
+	DescriptorHandle srvTable;
+	std::vector<DescriptorHandle> srvTableSources;
 };
 
 typedef std::shared_ptr<Material> MaterialPtr;
@@ -47,4 +63,17 @@ public:
 	virtual void SetShaderParameters(class D3D12GraphicsDevice& device) override;
 
 	std::shared_ptr<class NeuralModel> model;
-};
\ No newline at end of file
+};
+
+//build a gpu material from its description, textures are uploaded on the next frame
+MaterialPtr CreateMaterial(class D3D12GraphicsDevice& device, const struct MaterialDesc& desc);
+
+//dds or any wic image, nullptr when it can't be loaded. Uploaded on the next frame
+Texture2DPtr LoadMaterialTexture(class D3D12GraphicsDevice& device, const std::string& path);
+
+//pixel shader with the decoder of model baked in, outShaderPath names its hlsl. nullptr when no baked decoder
+//matches the model or --bake-decoders didn't write its Shaders/Baked file
+std::shared_ptr<class PixelShader> GetBakedPixelShader(class D3D12GraphicsDevice& device, const class NeuralModel& model, std::string& outShaderPath);
+
+//pixel shader of a material variant, shared through the ShaderMap
+std::shared_ptr<class PixelShader> GetMaterialPixelShader(class D3D12GraphicsDevice& device, MaterialShader shader);
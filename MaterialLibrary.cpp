@@ -0,0 +1,65 @@
+#include "MaterialLibrary.h"
+
+const char* GetMaterialShaderName(MaterialShader shader)
+{
+	switch (shader)
+	{
+	case MaterialShader::PBR: return "PBR";
+	case MaterialShader::Neural: return "Neural";
+	case MaterialShader::NeuralLight32: return "NeuralLight32";
+	default: return "Unknown";
+	}
+}
+
+static MaterialDesc MakeTextureMaterial(const std::string& name, const std::string& prefix, const std::string& extension)
+{
+	MaterialDesc desc;
+	desc.name = name;
+	desc.shader = MaterialShader::PBR;
+	desc.textures = {
+		{ "Albeo", prefix + "-Color" + extension },
+		{ "Normals", prefix + "-NormalDX" + extension },
+		{ "AO", prefix + "-AO" + extension },
+		{ "Roughness", prefix + "-Roughness" + extension },
+	};
+	return desc;
+}
+
+static MaterialDesc MakeNeuralMaterial(const std::string& name, MaterialShader shader, const std::string& directory)
+{
+	MaterialDesc desc;
+	desc.name = name;
+	desc.shader = shader;
+	for (int i = 0; i < 4; i++)
+	{
+		desc.textures.push_back({ "FeatureGrid" + std::to_string(i), directory + "/compressed" + std::to_string(i) + ".dds" });
+	}
+	desc.modelPath = directory + "/decodermodel.json";
+	return desc;
+}
+
+const std::vector<MaterialDesc>& GetMaterialLibrary()
+{
+	static const std::vector<MaterialDesc> library = {
+		MakeTextureMaterial("4K_PNG", "Textures/PavingStones131_4K", ".png"),
+		MakeTextureMaterial("4K_DDS", "Textures/4K_DDS/PavingStones131_4K", ".dds"),
+		MakeTextureMaterial("1K_DDS", "Textures/1K_DDS/PavingStones131_1K", ".dds"),
+		MakeNeuralMaterial("1K_Neural", MaterialShader::Neural, "Textures/NeuralCompressed/v23"),
+		// light weight neural texture materials, 32 nodes
+		MakeNeuralMaterial("1K_Neural_Light_32", MaterialShader::NeuralLight32, "Textures/NeuralCompressed/1024_32"),
+		MakeNeuralMaterial("2K_Neural_Light_32", MaterialShader::NeuralLight32, "Textures/NeuralCompressed/2048_32"),
+	};
+	return library;
+}
+
+const MaterialDesc* FindMaterialDesc(const std::string& name)
+{
+	for (const MaterialDesc& desc : GetMaterialLibrary())
+	{
+		if (desc.name == name)
+		{
+			return &desc;
+		}
+	}
+	return nullptr;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Pixel shader variant a material is drawn with
+enum class MaterialShader
+{
+	PBR,
+	Neural,
+	NeuralLight32,
+};
+
+struct MaterialTextureDesc
+{
+	std::string slotName;
+	std::string path;
+};
+
+// Everything needed to build a material, independent of the device that draws it.
+// The viewer, the benchmark and the cpu reference renderer all build their materials from these.
+struct MaterialDesc
+{
+	std::string name;
+	MaterialShader shader = MaterialShader::PBR;
+
+	//conventional textures or feature grids, in shader register order
+	std::vector<MaterialTextureDesc> textures;
+
+	//decoder model, neural materials only
+	std::string modelPath;
+
+	bool IsNeural() const { return shader != MaterialShader::PBR; }
+};
+
+const char* GetMaterialShaderName(MaterialShader shader);
+
+//every material the viewer ships
+const std::vector<MaterialDesc>& GetMaterialLibrary();
+
+//nullptr when there is no material with that name
+const MaterialDesc* FindMaterialDesc(const std::string& name);
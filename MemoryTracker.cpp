@@ -0,0 +1,229 @@
+#include "MemoryTracker.h"
+#include <algorithm>
+
+const char* GetMemoryCategoryName(MemoryCategory category)
+{
+	switch (category)
+	{
+	case MemoryCategory::Texture: return "Texture";
+	case MemoryCategory::UploadHeap: return "Upload Heap";
+	case MemoryCategory::ConstantBuffer: return "Constant Buffer";
+	case MemoryCategory::StructuredBuffer: return "Structured Buffer";
+	case MemoryCategory::ModelWeightsGPU: return "Model Weights (GPU)";
+	case MemoryCategory::ModelWeightsCPU: return "Model Weights (CPU)";
+	case MemoryCategory::DecodedCache: return "Decoded Cache";
+	case MemoryCategory::Other: return "Other";
+	default: return "Unknown";
+	}
+}
+
+MemoryDomain GetMemoryDomain(MemoryCategory category)
+{
+	switch (category)
+	{
+	case MemoryCategory::ModelWeightsCPU:
+	case MemoryCategory::DecodedCache:
+		return MemoryDomain::CPU;
+	default:
+		return MemoryDomain::GPU;
+	}
+}
+
+uint64_t MemoryOwnerUsage::GetTotal() const
+{
+	uint64_t total = 0;
+	for (uint64_t value : bytes)
+	{
+		total += value;
+	}
+	return total;
+}
+
+//raise peak to at least value
+static void UpdatePeak(std::atomic<uint64_t>& peak, uint64_t value)
+{
+	uint64_t previous = peak.load(std::memory_order_relaxed);
+	while (previous < value && !peak.compare_exchange_weak(previous, value, std::memory_order_relaxed))
+	{
+	}
+}
+
+//subtract without wrapping around on unbalanced frees
+static void SaturatingSub(std::atomic<uint64_t>& counter, uint64_t value)
+{
+	uint64_t previous = counter.load(std::memory_order_relaxed);
+	while (!counter.compare_exchange_weak(previous, previous > value ? previous - value : 0, std::memory_order_relaxed))
+	{
+	}
+}
+
+void MemoryTracker::Allocate(MemoryCategory category, uint64_t bytes, const std::string& owner)
+{
+	CategoryCounters& counters = categories[(int)category];
+	UpdatePeak(counters.peak, counters.current.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+	counters.allocations.fetch_add(1, std::memory_order_relaxed);
+
+	DomainCounters& domain = domains[(int)GetMemoryDomain(category)];
+	UpdatePeak(domain.peak, domain.current.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+
+	if (!owner.empty())
+	{
+		std::lock_guard<std::mutex> lock(ownerMutex);
+		MemoryOwnerUsage& usage = owners[owner];
+		usage.owner = owner;
+		usage.bytes[(int)category] += bytes;
+	}
+}
+
+void MemoryTracker::Free(MemoryCategory category, uint64_t bytes, const std::string& owner)
+{
+	SaturatingSub(categories[(int)category].current, bytes);
+	SaturatingSub(domains[(int)GetMemoryDomain(category)].current, bytes);
+
+	if (!owner.empty())
+	{
+		std::lock_guard<std::mutex> lock(ownerMutex);
+		auto it = owners.find(owner);
+		if (it != owners.end())
+		{
+			uint64_t& value = it->second.bytes[(int)category];
+			value = value > bytes ? value - bytes : 0;
+		}
+	}
+}
+
+uint64_t MemoryTracker::GetCurrent(MemoryCategory category) const
+{
+	return categories[(int)category].current.load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryTracker::GetPeak(MemoryCategory category) const
+{
+	return categories[(int)category].peak.load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryTracker::GetCurrent(MemoryDomain domain) const
+{
+	return domains[(int)domain].current.load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryTracker::GetPeak(MemoryDomain domain) const
+{
+	return domains[(int)domain].peak.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::SetBudget(MemoryCategory category, uint64_t bytes)
+{
+	categories[(int)category].budget.store(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::SetBudget(MemoryDomain domain, uint64_t bytes)
+{
+	domains[(int)domain].budget.store(bytes, std::memory_order_relaxed);
+}
+
+uint64_t MemoryTracker::GetBudget(MemoryCategory category) const
+{
+	return categories[(int)category].budget.load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryTracker::GetBudget(MemoryDomain domain) const
+{
+	return domains[(int)domain].budget.load(std::memory_order_relaxed);
+}
+
+bool MemoryTracker::IsOverBudget(MemoryCategory category) const
+{
+	uint64_t budget = GetBudget(category);
+	return budget > 0 && GetCurrent(category) > budget;
+}
+
+bool MemoryTracker::IsOverBudget(MemoryDomain domain) const
+{
+	uint64_t budget = GetBudget(domain);
+	return budget > 0 && GetCurrent(domain) > budget;
+}
+
+uint64_t MemoryTracker::GetRemainingBudget(MemoryDomain domain) const
+{
+	uint64_t budget = GetBudget(domain);
+	uint64_t current = GetCurrent(domain);
+	return budget > current ? budget - current : 0;
+}
+
+std::vector<MemoryCategoryUsage> MemoryTracker::GetCategoryUsage() const
+{
+	std::vector<MemoryCategoryUsage> usage;
+	for (int i = 0; i < (int)MemoryCategory::Count; i++)
+	{
+		MemoryCategoryUsage entry;
+		entry.category = (MemoryCategory)i;
+		entry.current = categories[i].current.load(std::memory_order_relaxed);
+		entry.peak = categories[i].peak.load(std::memory_order_relaxed);
+		entry.budget = categories[i].budget.load(std::memory_order_relaxed);
+		entry.allocations = categories[i].allocations.load(std::memory_order_relaxed);
+		usage.push_back(entry);
+	}
+	return usage;
+}
+
+std::vector<MemoryOwnerUsage> MemoryTracker::GetOwnerUsage() const
+{
+	std::vector<MemoryOwnerUsage> usage;
+	{
+		std::lock_guard<std::mutex> lock(ownerMutex);
+		for (auto& owner : owners)
+		{
+			usage.push_back(owner.second);
+		}
+	}
+
+	//largest first
+	std::sort(usage.begin(), usage.end(), [](const MemoryOwnerUsage& a, const MemoryOwnerUsage& b)
+		{
+			return a.GetTotal() > b.GetTotal();
+		});
+	return usage;
+}
+
+void MemoryTracker::Reset()
+{
+	for (CategoryCounters& counters : categories)
+	{
+		counters.current = 0;
+		counters.peak = 0;
+		counters.budget = 0;
+		counters.allocations = 0;
+	}
+	for (DomainCounters& counters : domains)
+	{
+		counters.current = 0;
+		counters.peak = 0;
+		counters.budget = 0;
+	}
+
+	std::lock_guard<std::mutex> lock(ownerMutex);
+	owners.clear();
+}
+
+static std::string& GetThreadOwner()
+{
+	static thread_local std::string owner;
+	return owner;
+}
+
+MemoryTracker::OwnerScope::OwnerScope(const std::string& owner)
+{
+	previousOwner = GetThreadOwner();
+	GetThreadOwner() = owner;
+}
+
+MemoryTracker::OwnerScope::~OwnerScope()
+{
+	GetThreadOwner() = previousOwner;
+}
+
+const std::string& MemoryTracker::GetCurrentOwner()
+{
+	return GetThreadOwner();
+}
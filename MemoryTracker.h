@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// What an allocation is used for
+enum class MemoryCategory
+{
+	Texture,
+	UploadHeap,
+	ConstantBuffer,
+	StructuredBuffer,
+	ModelWeightsGPU,
+	ModelWeightsCPU,
+	DecodedCache,
+	Other,
+	Count
+};
+
+// Where the memory lives, budgets are set per domain or per category
+enum class MemoryDomain
+{
+	GPU,
+	CPU,
+	Count
+};
+
+const char* GetMemoryCategoryName(MemoryCategory category);
+MemoryDomain GetMemoryDomain(MemoryCategory category);
+
+// Usage of one category at the time of a snapshot
+struct MemoryCategoryUsage
+{
+	MemoryCategory category = MemoryCategory::Other;
+	uint64_t current = 0;
+	uint64_t peak = 0;
+	uint64_t budget = 0;
+	uint64_t allocations = 0;
+};
+
+// Usage of one owner (material) per category
+struct MemoryOwnerUsage
+{
+	std::string owner;
+	uint64_t bytes[(int)MemoryCategory::Count] = {};
+
+	uint64_t GetTotal() const;
+};
+
+// Central registry every allocation site reports into.
+// Category counters are lock-free, the per owner table takes a lock.
+// Owners are plain strings, by convention the material name; allocations made
+// without an owner only count towards the category.
+class MemoryTracker
+{
+public:
+	static MemoryTracker& Get()
+	{
+		static MemoryTracker instance;
+		return instance;
+	}
+
+	//a tracker of its own for tests, everything else reports into Get()
+	MemoryTracker() = default;
+
+	void Allocate(MemoryCategory category, uint64_t bytes, const std::string& owner = "");
+	void Free(MemoryCategory category, uint64_t bytes, const std::string& owner = "");
+
+	uint64_t GetCurrent(MemoryCategory category) const;
+	uint64_t GetPeak(MemoryCategory category) const;
+
+	uint64_t GetCurrent(MemoryDomain domain) const;
+	uint64_t GetPeak(MemoryDomain domain) const;
+
+	//budget of 0 means unlimited
+	void SetBudget(MemoryCategory category, uint64_t bytes);
+	void SetBudget(MemoryDomain domain, uint64_t bytes);
+	uint64_t GetBudget(MemoryCategory category) const;
+	uint64_t GetBudget(MemoryDomain domain) const;
+
+	bool IsOverBudget(MemoryCategory category) const;
+	bool IsOverBudget(MemoryDomain domain) const;
+
+	//bytes left before the domain budget, 0 when over or unlimited
+	uint64_t GetRemainingBudget(MemoryDomain domain) const;
+
+	std::vector<MemoryCategoryUsage> GetCategoryUsage() const;
+	std::vector<MemoryOwnerUsage> GetOwnerUsage() const;
+
+	//forget everything, counters, peaks, owners and budgets
+	void Reset();
+
+	// Owner for allocations made on this thread while the scope is alive
+	class OwnerScope
+	{
+	public:
+		explicit OwnerScope(const std::string& owner);
+		~OwnerScope();
+
+		OwnerScope(const OwnerScope&) = delete;
+		OwnerScope& operator=(const OwnerScope&) = delete;
+
+	private:
+		std::string previousOwner;
+	};
+
+	//owner set by the innermost OwnerScope of this thread
+	static const std::string& GetCurrentOwner();
+
+private:
+	struct CategoryCounters
+	{
+		std::atomic<uint64_t> current{ 0 };
+		std::atomic<uint64_t> peak{ 0 };
+		std::atomic<uint64_t> budget{ 0 };
+		std::atomic<uint64_t> allocations{ 0 };
+	};
+
+	struct DomainCounters
+	{
+		std::atomic<uint64_t> current{ 0 };
+		std::atomic<uint64_t> peak{ 0 };
+		std::atomic<uint64_t> budget{ 0 };
+	};
+
+	CategoryCounters categories[(int)MemoryCategory::Count];
+	DomainCounters domains[(int)MemoryDomain::Count];
+
+	mutable std::mutex ownerMutex;
+	std::unordered_map<std::string, MemoryOwnerUsage> owners;
+};
@@ -0,0 +1,82 @@
+#include "UnitTest.h"
+#include "MemoryTracker.h"
+#include <string>
+#include <vector>
+
+//a tracker of its own: category, domain and owner counters past 4 GB, peaks kept after frees, owners from the
+//innermost OwnerScope, budgets per domain and category
+bool CheckMemoryTracker(std::string& outMessage)
+{
+	const uint64_t GB = 1024ull * 1024 * 1024;
+	MemoryTracker tracker;
+	std::string failures;
+
+	{
+		MemoryTracker::OwnerScope materialScope("Material");
+		tracker.Allocate(MemoryCategory::Texture, 3 * GB, MemoryTracker::GetCurrentOwner());
+		{
+			MemoryTracker::OwnerScope modelScope("Model");
+			tracker.Allocate(MemoryCategory::ModelWeightsCPU, 1 * GB, MemoryTracker::GetCurrentOwner());
+		}
+		tracker.Allocate(MemoryCategory::Texture, 3 * GB, MemoryTracker::GetCurrentOwner());
+	}
+	if (!MemoryTracker::GetCurrentOwner().empty())
+	{
+		failures += ", owner " + MemoryTracker::GetCurrentOwner() + " left after its scope";
+	}
+	//without an owner only the category counts it
+	tracker.Allocate(MemoryCategory::Texture, 2 * GB, MemoryTracker::GetCurrentOwner());
+
+	if (tracker.GetCurrent(MemoryCategory::Texture) != 8 * GB || tracker.GetCurrent(MemoryDomain::GPU) != 8 * GB ||
+		tracker.GetCurrent(MemoryDomain::CPU) != 1 * GB)
+	{
+		failures += ", counters past 4 GB hold " + std::to_string(tracker.GetCurrent(MemoryCategory::Texture)) + " bytes";
+	}
+	std::vector<MemoryOwnerUsage> owners = tracker.GetOwnerUsage();
+	if (owners.size() != 2 || owners[0].owner != "Material" || owners[0].bytes[(int)MemoryCategory::Texture] != 6 * GB ||
+		owners[0].GetTotal() != 6 * GB || owners[1].owner != "Model" || owners[1].bytes[(int)MemoryCategory::ModelWeightsCPU] != 1 * GB)
+	{
+		failures += ", allocations weren't attributed to the owner of their scope";
+	}
+
+	tracker.SetBudget(MemoryDomain::GPU, 7 * GB);
+	tracker.SetBudget(MemoryCategory::Texture, 9 * GB);
+	if (!tracker.IsOverBudget(MemoryDomain::GPU) || tracker.GetRemainingBudget(MemoryDomain::GPU) != 0 ||
+		tracker.IsOverBudget(MemoryCategory::Texture) || tracker.IsOverBudget(MemoryDomain::CPU))
+	{
+		failures += ", over budget not reported at 8 of 7 GB";
+	}
+
+	tracker.Free(MemoryCategory::Texture, 3 * GB, "Material");
+	if (tracker.GetCurrent(MemoryCategory::Texture) != 5 * GB || tracker.GetPeak(MemoryCategory::Texture) != 8 * GB ||
+		tracker.GetPeak(MemoryDomain::GPU) != 8 * GB || tracker.GetOwnerUsage()[0].GetTotal() != 3 * GB)
+	{
+		failures += ", peak didn't survive a free";
+	}
+	if (tracker.IsOverBudget(MemoryDomain::GPU) || tracker.GetRemainingBudget(MemoryDomain::GPU) != 2 * GB)
+	{
+		failures += ", still over budget after the free";
+	}
+
+	//unbalanced frees stop at 0
+	tracker.Free(MemoryCategory::ModelWeightsCPU, 2 * GB, "Model");
+	MemoryCategoryUsage weights = tracker.GetCategoryUsage()[(int)MemoryCategory::ModelWeightsCPU];
+	if (weights.current != 0 || weights.peak != 1 * GB || weights.allocations != 1 || tracker.GetCurrent(MemoryDomain::CPU) != 0)
+	{
+		failures += ", a free larger than the allocation wrapped around";
+	}
+
+	tracker.Reset();
+	if (tracker.GetPeak(MemoryDomain::GPU) != 0 || tracker.GetBudget(MemoryDomain::GPU) != 0 || !tracker.GetOwnerUsage().empty())
+	{
+		failures += ", reset kept counters";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "8 GB in one category, 2 owners, budgets per domain and category";
+	return true;
+}
@@ -0,0 +1,200 @@
+#include "MicroBenchmark.h"
+#include "nlohmann/json.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+
+using Json = nlohmann::ordered_json;
+
+static volatile double sinkValue = 0.0;
+
+void MicroBenchmarkSink(double value)
+{
+	sinkValue = sinkValue + value;
+}
+
+double MicroBenchmarkResult::GetNoise() const
+{
+	return median > 0.0 ? 1.4826 * mad / median : 0.0;
+}
+
+static double Median(std::vector<double> values)
+{
+	if (values.empty())
+	{
+		return 0.0;
+	}
+	std::sort(values.begin(), values.end());
+	size_t middle = values.size() / 2;
+	return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) * 0.5;
+}
+
+MicroBenchmarkRunner::MicroBenchmarkRunner(const Settings& inSettings)
+	: settings(inSettings)
+{
+}
+
+bool MicroBenchmarkRunner::IsSelected(const std::string& name) const
+{
+	return settings.filter.empty() || name.find(settings.filter) != std::string::npos;
+}
+
+void MicroBenchmarkRunner::Run(const std::string& name, const std::string& unit, const Body& body)
+{
+	if (!IsSelected(name))
+	{
+		return;
+	}
+
+	using Clock = std::chrono::steady_clock;
+	auto measure = [&](uint64_t iterations, uint64_t& items)
+		{
+			auto start = Clock::now();
+			items = body(iterations);
+			return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		};
+
+	//grow the iteration count until one sample is long enough to time reliably, this also warms caches up
+	uint64_t iterations = 1;
+	uint64_t items = 0;
+	double elapsedMs = measure(iterations, items);
+	while (elapsedMs < settings.minSampleMs && iterations < (1ull << 30))
+	{
+		double factor = elapsedMs > 0.0 ? settings.minSampleMs / elapsedMs * 1.2 : 10.0;
+		iterations = (uint64_t)((double)iterations * (factor > 2.0 ? (factor < 100.0 ? factor : 100.0) : 2.0));
+		elapsedMs = measure(iterations, items);
+	}
+
+	std::vector<double> samples;
+	double totalMs = 0.0;
+	while (samples.size() < settings.minSamples || (samples.size() < settings.maxSamples && totalMs < settings.maxCaseMs))
+	{
+		elapsedMs = measure(iterations, items);
+		totalMs += elapsedMs;
+		samples.push_back(items > 0 ? elapsedMs * 1.0e6 / (double)items : 0.0);
+	}
+
+	MicroBenchmarkResult result;
+	result.name = name;
+	result.unit = unit;
+	result.samples = (uint32_t)samples.size();
+	result.itemsPerSample = items;
+	result.median = Median(samples);
+	result.min = *std::min_element(samples.begin(), samples.end());
+
+	double sum = 0.0;
+	std::vector<double> deviations;
+	for (double sample : samples)
+	{
+		sum += sample;
+		deviations.push_back(std::fabs(sample - result.median));
+	}
+	result.mean = sum / (double)samples.size();
+	result.mad = Median(deviations);
+
+	std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(2)
+		<< std::setw(12) << result.median << " " << unit << "  +-" << std::setprecision(1) << result.GetNoise() * 100.0 << "%" << std::endl;
+
+	results.push_back(result);
+}
+
+bool MicroBenchmarkRunner::WriteJson(const std::string& path) const
+{
+	Json json;
+	json["version"] = 1;
+	json["results"] = Json::array();
+	for (const MicroBenchmarkResult& result : results)
+	{
+		Json entry;
+		entry["name"] = result.name;
+		entry["unit"] = result.unit;
+		entry["median"] = result.median;
+		entry["mad"] = result.mad;
+		entry["min"] = result.min;
+		entry["mean"] = result.mean;
+		entry["samples"] = result.samples;
+		entry["itemsPerSample"] = result.itemsPerSample;
+		json["results"].push_back(entry);
+	}
+
+	std::ofstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+	file << json.dump(2) << std::endl;
+	return true;
+}
+
+bool MicroBenchmarkRunner::ReadJson(const std::string& path, std::vector<MicroBenchmarkResult>& outResults, std::string* error)
+{
+	std::ifstream file(path);
+	if (!file)
+	{
+		if (error)
+		{
+			*error = "File not found: " + path;
+		}
+		return false;
+	}
+
+	try
+	{
+		Json json = Json::parse(file);
+		outResults.clear();
+		for (const Json& entry : json["results"])
+		{
+			MicroBenchmarkResult result;
+			result.name = entry["name"];
+			result.unit = entry["unit"];
+			result.median = entry["median"];
+			result.mad = entry["mad"];
+			result.min = entry["min"];
+			result.mean = entry["mean"];
+			result.samples = entry["samples"];
+			result.itemsPerSample = entry["itemsPerSample"];
+			outResults.push_back(result);
+		}
+	}
+	catch (const std::exception& exception)
+	{
+		if (error)
+		{
+			*error = std::string("Invalid results file ") + path + ": " + exception.what();
+		}
+		return false;
+	}
+	return true;
+}
+
+std::vector<MicroBenchmarkComparison> MicroBenchmarkRunner::Compare(const std::vector<MicroBenchmarkResult>& baseline,
+	const std::vector<MicroBenchmarkResult>& current, double threshold, double noiseFactor)
+{
+	std::vector<MicroBenchmarkComparison> comparisons;
+	for (const MicroBenchmarkResult& result : current)
+	{
+		auto base = std::find_if(baseline.begin(), baseline.end(), [&](const MicroBenchmarkResult& entry) { return entry.name == result.name; });
+		if (base == baseline.end() || base->median <= 0.0)
+		{
+			continue;
+		}
+
+		MicroBenchmarkComparison comparison;
+		comparison.name = result.name;
+		comparison.baseline = base->median;
+		comparison.current = result.median;
+		comparison.change = (result.median - base->median) / base->median;
+
+		//both runs are noisy, a change has to stand out from both
+		double noise = noiseFactor * std::sqrt(base->GetNoise() * base->GetNoise() + result.GetNoise() * result.GetNoise());
+		comparison.allowed = noise > threshold ? noise : threshold;
+		comparison.bRegression = comparison.change > comparison.allowed;
+		comparison.bImprovement = comparison.change < -comparison.allowed;
+
+		comparisons.push_back(comparison);
+	}
+	return comparisons;
+}
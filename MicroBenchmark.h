@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Timing of one microbenchmark case, per item (pixel, block, sample, file, ...)
+struct MicroBenchmarkResult
+{
+	std::string name;
+	std::string unit;
+
+	double median = 0.0;
+	//median absolute deviation of the samples
+	double mad = 0.0;
+	double min = 0.0;
+	double mean = 0.0;
+
+	uint32_t samples = 0;
+	uint64_t itemsPerSample = 0;
+
+	//robust relative standard deviation, 1.4826 * mad / median
+	double GetNoise() const;
+};
+
+// Result of one case against a baseline run
+struct MicroBenchmarkComparison
+{
+	std::string name;
+	double baseline = 0.0;
+	double current = 0.0;
+
+	//relative change of the median, positive is slower
+	double change = 0.0;
+	//largest change still considered noise
+	double allowed = 0.0;
+
+	bool bRegression = false;
+	bool bImprovement = false;
+};
+
+// Runs timed cases and collects robust statistics.
+// Every sample runs the body often enough to take at least minSampleMs, times are reported per item.
+class MicroBenchmarkRunner
+{
+public:
+	struct Settings
+	{
+		double minSampleMs = 10.0;
+		uint32_t minSamples = 7;
+		uint32_t maxSamples = 30;
+		//stop sampling a case after this much time once minSamples are in
+		double maxCaseMs = 1000.0;
+
+		//only cases whose name contains this run
+		std::string filter;
+	};
+
+	//runs the measured work iterations times, returns the number of items processed
+	typedef std::function<uint64_t(uint64_t iterations)> Body;
+
+	explicit MicroBenchmarkRunner(const Settings& inSettings);
+
+	bool IsSelected(const std::string& name) const;
+
+	void Run(const std::string& name, const std::string& unit, const Body& body);
+
+	const std::vector<MicroBenchmarkResult>& GetResults() const { return results; }
+
+	bool WriteJson(const std::string& path) const;
+	static bool ReadJson(const std::string& path, std::vector<MicroBenchmarkResult>& outResults, std::string* error = nullptr);
+
+	//a case regresses when its median moved by more than threshold and by more than noiseFactor times the combined noise
+	static std::vector<MicroBenchmarkComparison> Compare(const std::vector<MicroBenchmarkResult>& baseline,
+		const std::vector<MicroBenchmarkResult>& current, double threshold, double noiseFactor);
+
+private:
+	Settings settings;
+	std::vector<MicroBenchmarkResult> results;
+};
+
+//keeps results of measured work alive so the optimizer can't drop it
+void MicroBenchmarkSink(double value);
@@ -0,0 +1,719 @@
+// Microbenchmarks of the cpu hot paths: decoder inference, feature grid sampling, BC6H decode,
+// dds and model loading, PBR shading, baking a material in its fast and deterministic modes, the render command queue, the upload ring and the descriptor allocator. Results are written as json, with --baseline=file every
+// case is compared against an earlier run and regressions make the exit code nonzero.
+#include "MicroBenchmark.h"
+#include "BCDecoder.h"
+#include "DDSImage.h"
+#include "DescriptorAllocator.h"
+#include "FrameScheduler.h"
+#include "NeuralDecoderCPU.h"
+#include "RenderCommandQueue.h"
+#include "SoftwareRenderer.h"
+#include "ThreadPool.h"
+#include "UploadRingAllocator.h"
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <streambuf>
+
+static const char* ModelNames[] = { "v23", "1024_32", "2048_32" };
+
+static std::string GetModelDirectory(const std::string& name)
+{
+	return "Textures/NeuralCompressed/" + name + "/";
+}
+
+struct MicroBenchmarkOptions
+{
+	std::string outputPath = "microbenchmark.json";
+	std::string baselinePath;
+	double threshold = 0.05;
+	double noiseFactor = 3.0;
+
+	std::vector<uint32_t> threadCounts;
+	std::vector<uint32_t> batchSizes = { 1, 16, 64, 256, 1024 };
+
+	MicroBenchmarkRunner::Settings runner;
+};
+
+static std::vector<uint32_t> ParseCounts(const std::string& value)
+{
+	std::vector<uint32_t> counts;
+	std::stringstream stream(value);
+	std::string item;
+	while (std::getline(stream, item, ','))
+	{
+		uint32_t count = (uint32_t)std::stoul(item);
+		if (count == 0)
+		{
+			throw std::invalid_argument(item);
+		}
+		counts.push_back(count);
+	}
+	return counts;
+}
+
+static bool ParseOptions(int argc, char** argv, MicroBenchmarkOptions& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--quick")
+		{
+			options.runner.minSamples = 3;
+			options.runner.maxSamples = 5;
+			options.runner.maxCaseMs = 100.0;
+			continue;
+		}
+
+		size_t separator = argument.find('=');
+		if (argument.rfind("--", 0) != 0 || separator == std::string::npos)
+		{
+			std::cout << "Unknown argument " << argument << std::endl;
+			return false;
+		}
+
+		std::string key = argument.substr(2, separator - 2);
+		std::string value = argument.substr(separator + 1);
+		try
+		{
+			if (key == "filter") options.runner.filter = value;
+			else if (key == "output") options.outputPath = value;
+			else if (key == "baseline") options.baselinePath = value;
+			else if (key == "threshold") options.threshold = std::stod(value);
+			else if (key == "noise") options.noiseFactor = std::stod(value);
+			else if (key == "threads") options.threadCounts = ParseCounts(value);
+			else if (key == "batches") options.batchSizes = ParseCounts(value);
+			else
+			{
+				std::cout << "Unknown argument " << argument << std::endl;
+				return false;
+			}
+		}
+		catch (const std::exception&)
+		{
+			std::cout << "Invalid value for --" << key << ": " << value << std::endl;
+			return false;
+		}
+	}
+
+	if (options.threadCounts.empty())
+	{
+		//1, half and all hardware threads
+		uint32_t hardware = ThreadPool::GetHardwareThreadCount();
+		options.threadCounts.push_back(1);
+		if (hardware / 2 > 1)
+		{
+			options.threadCounts.push_back(hardware / 2);
+		}
+		if (hardware > 1)
+		{
+			options.threadCounts.push_back(hardware);
+		}
+	}
+	return true;
+}
+
+// Swallows the log lines of LoadModel while it runs in a loop
+class NullStreamBuffer : public std::streambuf
+{
+protected:
+	int overflow(int c) override { return c; }
+};
+
+static std::vector<float> RandomValues(size_t count, float minValue, float maxValue, uint32_t seed)
+{
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<float> distribution(minValue, maxValue);
+	std::vector<float> values(count);
+	for (float& value : values)
+	{
+		value = distribution(random);
+	}
+	return values;
+}
+
+static void RunDecoderCases(MicroBenchmarkRunner& runner, const MicroBenchmarkOptions& options)
+{
+	//enough pixels to leave the caches for the largest batch, but a sample still stays short
+	const size_t pixelCount = 16384;
+
+	for (const char* modelName : ModelNames)
+	{
+		std::string modelPath = GetModelDirectory(modelName) + "decodermodel.json";
+		if (!std::filesystem::exists(modelPath))
+		{
+			std::cout << "skipped mlp/" << modelName << ": " << modelPath << " not found" << std::endl;
+			continue;
+		}
+
+		//loading is slow, skip it when the filter leaves nothing of this model
+		bool bSelected = false;
+		for (int k = 0; k < (int)DecoderKernel::Count; k++)
+		{
+			std::string prefix = std::string("mlp/") + modelName + "/" + GetDecoderKernelName((DecoderKernel)k);
+			for (uint32_t batchSize : options.batchSizes)
+			{
+				bSelected |= runner.IsSelected(prefix + "/threads=1/batch=" + std::to_string(batchSize));
+			}
+			for (uint32_t threadCount : options.threadCounts)
+			{
+				bSelected |= runner.IsSelected(prefix + "/threads=" + std::to_string(threadCount) + "/batch=256");
+			}
+		}
+		if (!bSelected)
+		{
+			continue;
+		}
+
+		NeuralModelPtr model = NeuralModel::LoadModel(modelPath);
+		NeuralDecoderCPU decoder(model);
+
+		size_t inputCount = decoder.GetInputCount();
+		size_t outputCount = decoder.GetOutputCount();
+		std::vector<float> inputs = RandomValues(pixelCount * inputCount, -1.0f, 1.0f, 1);
+		std::vector<float> outputs(pixelCount * outputCount);
+
+		for (int k = 0; k < (int)DecoderKernel::Count; k++)
+		{
+			decoder.SetKernel((DecoderKernel)k);
+			std::string prefix = std::string("mlp/") + modelName + "/" + GetDecoderKernelName((DecoderKernel)k);
+
+			//batch size sweep on one thread, the calls the renderer makes per row are this size
+			for (uint32_t batchSize : options.batchSizes)
+			{
+				runner.Run(prefix + "/threads=1/batch=" + std::to_string(batchSize), "ns/pixel", [&](uint64_t iterations)
+					{
+						for (uint64_t i = 0; i < iterations; i++)
+						{
+							for (size_t first = 0; first < pixelCount; first += batchSize)
+							{
+								size_t count = std::min<size_t>(batchSize, pixelCount - first);
+								decoder.Decode(&inputs[first * inputCount], &outputs[first * outputCount], count);
+							}
+						}
+						MicroBenchmarkSink(outputs[0]);
+						return iterations * pixelCount;
+					});
+			}
+
+			//thread sweep at a fixed batch size, batches are handed out like renderer tiles
+			const size_t threadBatchSize = 256;
+			size_t batchCount = (pixelCount + threadBatchSize - 1) / threadBatchSize;
+			for (uint32_t threadCount : options.threadCounts)
+			{
+				std::string name = prefix + "/threads=" + std::to_string(threadCount) + "/batch=" + std::to_string(threadBatchSize);
+				if (threadCount == 1 || !runner.IsSelected(name))
+				{
+					continue;
+				}
+
+				ThreadPool threadPool(threadCount);
+				runner.Run(name, "ns/pixel", [&](uint64_t iterations)
+					{
+						for (uint64_t i = 0; i < iterations; i++)
+						{
+							threadPool.ParallelFor(batchCount, [&](size_t batch, uint32_t)
+								{
+									size_t first = batch * threadBatchSize;
+									size_t count = std::min<size_t>(threadBatchSize, pixelCount - first);
+									decoder.Decode(&inputs[first * inputCount], &outputs[first * outputCount], count);
+								});
+						}
+						MicroBenchmarkSink(outputs[0]);
+						return iterations * pixelCount;
+					});
+			}
+		}
+	}
+}
+
+static void RunSamplerCases(MicroBenchmarkRunner& runner)
+{
+	std::string path = GetModelDirectory("v23") + "compressed0.dds";
+
+	SoftwareTexture texture;
+	std::string error;
+	if (!texture.LoadDDS(path, &error))
+	{
+		std::cout << "skipped sampler: " << error << std::endl;
+		return;
+	}
+
+	const size_t sampleCount = 65536;
+
+	//neighbouring pixels of a row, like the renderer walks the screen
+	std::vector<float> coherent(sampleCount * 2);
+	for (size_t i = 0; i < sampleCount; i++)
+	{
+		coherent[i * 2 + 0] = (float)(i % 256) / 256.0f;
+		coherent[i * 2 + 1] = (float)(i / 256) / 256.0f;
+	}
+	std::vector<float> scattered = RandomValues(sampleCount * 2, 0.0f, 1.0f, 2);
+
+	auto sample = [&](const std::vector<float>& uvs, uint64_t iterations)
+		{
+			float sum = 0.0f;
+			float texel[4];
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (size_t s = 0; s < sampleCount; s++)
+				{
+					texture.Sample(uvs[s * 2 + 0], uvs[s * 2 + 1], texel);
+					sum += texel[0];
+				}
+			}
+			MicroBenchmarkSink(sum);
+			return iterations * sampleCount;
+		};
+
+	runner.Run("sampler/bilinear/coherent", "ns/sample", [&](uint64_t iterations) { return sample(coherent, iterations); });
+	runner.Run("sampler/bilinear/scattered", "ns/sample", [&](uint64_t iterations) { return sample(scattered, iterations); });
+}
+
+static void RunCodecCases(MicroBenchmarkRunner& runner)
+{
+	std::string path = GetModelDirectory("v23") + "compressed0.dds";
+
+	DDSImage image;
+	std::string error;
+	if (!image.Load(path, &error))
+	{
+		std::cout << "skipped bc6h: " << error << std::endl;
+		return;
+	}
+
+	bool bSigned = image.format == DDSFormat::BC6H_SF16;
+	size_t blockCount = image.GetMipSize(0) / BCDecoder::BC6HBlockSize;
+
+	runner.Run("bc6h/decode", "ns/block", [&](uint64_t iterations)
+		{
+			float block[16][4];
+			float sum = 0.0f;
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (size_t b = 0; b < blockCount; b++)
+				{
+					BCDecoder::DecodeBC6H(&image.data[b * BCDecoder::BC6HBlockSize], bSigned, block);
+					sum += block[0][0];
+				}
+			}
+			MicroBenchmarkSink(sum);
+			return iterations * blockCount;
+		});
+
+	runner.Run("dds/load/compressed0", "ns/file", [&](uint64_t iterations)
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				DDSImage loaded;
+				loaded.Load(path);
+				MicroBenchmarkSink((double)loaded.data.size());
+			}
+			return iterations;
+		});
+}
+
+static void RunModelLoadCases(MicroBenchmarkRunner& runner)
+{
+	std::filesystem::path tempDirectory = std::filesystem::temp_directory_path();
+
+	for (const char* modelName : ModelNames)
+	{
+		std::string jsonPath = GetModelDirectory(modelName) + "decodermodel.json";
+		if (!std::filesystem::exists(jsonPath))
+		{
+			continue;
+		}
+
+		std::string jsonName = std::string("model/load/json/") + modelName;
+		std::string binaryName = std::string("model/load/binary/") + modelName;
+		if (!runner.IsSelected(jsonName) && !runner.IsSelected(binaryName))
+		{
+			continue;
+		}
+
+		std::string binaryPath = (tempDirectory / (std::string("decodermodel_") + modelName + ".bin")).string();
+		if (!NeuralModel::LoadModel(jsonPath)->SaveBinary(binaryPath))
+		{
+			std::cout << "skipped " << binaryName << ": can't write " << binaryPath << std::endl;
+			binaryPath.clear();
+		}
+
+		NullStreamBuffer nullBuffer;
+		auto load = [&](const std::string& path, uint64_t iterations)
+			{
+				std::streambuf* previous = std::cout.rdbuf(&nullBuffer);
+				for (uint64_t i = 0; i < iterations; i++)
+				{
+					MicroBenchmarkSink((double)NeuralModel::LoadModel(path)->weights.size());
+				}
+				std::cout.rdbuf(previous);
+				return iterations;
+			};
+
+		runner.Run(jsonName, "ns/file", [&](uint64_t iterations) { return load(jsonPath, iterations); });
+		if (!binaryPath.empty())
+		{
+			runner.Run(binaryName, "ns/file", [&](uint64_t iterations) { return load(binaryPath, iterations); });
+			std::filesystem::remove(binaryPath);
+		}
+	}
+}
+
+static void RunShadingCases(MicroBenchmarkRunner& runner)
+{
+	const size_t pixelCount = 4096;
+
+	std::vector<float> values = RandomValues(pixelCount * 8, 0.0f, 1.0f, 3);
+	std::vector<MaterialSample> samples(pixelCount);
+	for (size_t i = 0; i < pixelCount; i++)
+	{
+		const float* value = &values[i * 8];
+		MaterialSample& sample = samples[i];
+		for (int c = 0; c < 3; c++)
+		{
+			sample.albedo[c] = value[c];
+			sample.normal[c] = value[3 + c] * 2.0f - 1.0f;
+		}
+		sample.ao = value[6];
+		sample.roughness = value[7];
+	}
+
+	RectConstantBuffer constants;
+	runner.Run("pbr/shade", "ns/pixel", [&](uint64_t iterations)
+		{
+			float color[4];
+			float sum = 0.0f;
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (const MaterialSample& sample : samples)
+				{
+					SoftwareRenderer::ShadePixel(sample, constants, color);
+					sum += color[0];
+				}
+			}
+			MicroBenchmarkSink(sum);
+			return iterations * pixelCount;
+		});
+}
+
+static void RunUniversalDecoderCases(MicroBenchmarkRunner& runner)
+{
+	const std::string perMaterialName = "universal/materials=16/per_material";
+	const std::string batchedName = "universal/materials=16/batched";
+	if (!runner.IsSelected(perMaterialName) && !runner.IsSelected(batchedName))
+	{
+		return;
+	}
+
+	std::string error;
+	const MaterialDesc* desc = FindMaterialDesc("1K_Neural");
+	SoftwareMaterialPtr material = desc ? SoftwareMaterial::Create(*desc, &error) : nullptr;
+	if (!material)
+	{
+		std::cout << "skipped universal: " << error << std::endl;
+		return;
+	}
+
+	//every material reads the same grids, the cases differ only in how the decoder is called
+	const uint32_t materialCount = 16;
+	UniversalDecoder universal(material->model);
+	for (uint32_t m = 0; m < materialCount; m++)
+	{
+		universal.AddMaterial(*material);
+	}
+
+	//a few pixels of each material, like small objects scattered over the screen
+	const size_t pixelsPerMaterial = 64;
+	const size_t pixelCount = materialCount * pixelsPerMaterial;
+	std::vector<float> uvs = RandomValues(pixelCount * 2, 0.0f, 1.0f, 4);
+	std::vector<UniversalDecodeRequest> requests(pixelCount);
+	for (size_t i = 0; i < pixelCount; i++)
+	{
+		requests[i].materialIndex = (uint32_t)(i / pixelsPerMaterial);
+		requests[i].u = uvs[i * 2 + 0];
+		requests[i].v = uvs[i * 2 + 1];
+	}
+	std::vector<MaterialSample> samples(pixelCount);
+
+	runner.Run(perMaterialName, "ns/pixel", [&](uint64_t iterations)
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (size_t first = 0; first < pixelCount; first += pixelsPerMaterial)
+				{
+					material->GetMaterialInputs(&uvs[first * 2], pixelsPerMaterial, &samples[first]);
+				}
+			}
+			MicroBenchmarkSink(samples[0].ao);
+			return iterations * pixelCount;
+		});
+
+	runner.Run(batchedName, "ns/pixel", [&](uint64_t iterations)
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				universal.GetMaterialInputs(requests.data(), pixelCount, samples.data());
+			}
+			MicroBenchmarkSink(samples[0].ao);
+			return iterations * pixelCount;
+		});
+}
+
+static void RunBakeCases(MicroBenchmarkRunner& runner)
+{
+	const std::string fastName = "bake/1K_Neural/fast";
+	const std::string deterministicName = "bake/1K_Neural/deterministic";
+	if (!runner.IsSelected(fastName) && !runner.IsSelected(deterministicName))
+	{
+		return;
+	}
+
+	std::string error;
+	const MaterialDesc* desc = FindMaterialDesc("1K_Neural");
+	SoftwareMaterialPtr material = desc ? SoftwareMaterial::Create(*desc, &error) : nullptr;
+	if (!material)
+	{
+		std::cout << "skipped bake: " << error << std::endl;
+		return;
+	}
+
+	//what determinism costs: no FMA, the portable sigmoid and sampler against the decoder's own kernel
+	const uint32_t size = 128;
+	ThreadPool threadPool(1);
+	std::vector<float> texels;
+	for (bool bDeterministic : { false, true })
+	{
+		runner.Run(bDeterministic ? deterministicName : fastName, "ns/texel", [&](uint64_t iterations)
+			{
+				for (uint64_t i = 0; i < iterations; i++)
+				{
+					BakeMaterial(*material, size, threadPool, bDeterministic, texels);
+				}
+				MicroBenchmarkSink(texels[0]);
+				return iterations * size * size;
+			});
+	}
+}
+
+// Stands in for the device, commands only touch a counter
+struct MockRenderContext
+{
+	uint64_t executed = 0;
+};
+
+static void RunCommandQueueCases(MicroBenchmarkRunner& runner)
+{
+	//a frame worth of uploads, each capturing the destination and the staging resource
+	const size_t commandCount = 1024;
+	std::shared_ptr<int> resource = std::make_shared<int>(1);
+	std::shared_ptr<int> staging = std::make_shared<int>(1);
+	MockRenderContext context;
+
+	RenderCommandQueue<MockRenderContext> queue;
+	runner.Run("commands/arena_queue", "ns/command", [&](uint64_t iterations)
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (size_t c = 0; c < commandCount; c++)
+				{
+					queue.Push([resource, staging](MockRenderContext& context) { context.executed += *resource + *staging; });
+				}
+				queue.Execute(context);
+			}
+			MicroBenchmarkSink((double)context.executed);
+			return iterations * commandCount;
+		});
+
+	//what the device did before plus the lock it needed to be thread safe, captures this size go to the heap
+	std::queue<std::function<void(MockRenderContext&)>> functionQueue;
+	std::mutex functionMutex;
+	runner.Run("commands/std_function_queue", "ns/command", [&](uint64_t iterations)
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (size_t c = 0; c < commandCount; c++)
+				{
+					std::lock_guard<std::mutex> lock(functionMutex);
+					functionQueue.push([resource, staging](MockRenderContext& context) { context.executed += *resource + *staging; });
+				}
+				while (!functionQueue.empty())
+				{
+					functionQueue.front()(context);
+					functionQueue.pop();
+				}
+			}
+			MicroBenchmarkSink((double)context.executed);
+			return iterations * commandCount;
+		});
+}
+
+static void RunUploadRingCases(MicroBenchmarkRunner& runner)
+{
+	//mips and buffers of a material load spread over frames, the simulated gpu is two frames behind
+	const uint64_t sizes[] = { 4 << 20, 1 << 20, 256 << 10, 64 << 10, 16 << 10, 4 << 10, 1 << 10, 512 };
+	const size_t allocationsPerFrame = 16;
+	const uint64_t framesInFlight = 2;
+
+	UploadRingAllocator ring;
+	uint64_t fenceValue = 1;
+	runner.Run("upload/ring_allocate", "ns/allocation", [&](uint64_t iterations)
+		{
+			uint64_t offsets = 0;
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (size_t a = 0; a < allocationsPerFrame; a++)
+				{
+					UploadRingAllocator::Allocation allocation;
+					if (ring.Allocate(sizes[a % 8], 512, allocation))
+					{
+						offsets += allocation.offset;
+					}
+				}
+				ring.FinishFrame(fenceValue);
+				if (fenceValue > framesInFlight)
+				{
+					ring.Retire(fenceValue - framesInFlight);
+				}
+				fenceValue++;
+			}
+			MicroBenchmarkSink((double)offsets);
+			return iterations * allocationsPerFrame;
+		});
+}
+
+static void RunFrameSchedulerCases(MicroBenchmarkRunner& runner)
+{
+	//simulated queue that finishes a frame one frame after it was submitted, one deferred release per frame
+	FrameScheduler scheduler(3);
+	std::deque<uint64_t> submitted;
+	uint64_t completedFenceValue = 0;
+	uint64_t released = 0;
+	runner.Run("frames/schedule", "ns/frame", [&](uint64_t iterations)
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				while (completedFenceValue < scheduler.GetFrameWaitValue() || submitted.size() > 1)
+				{
+					completedFenceValue = submitted.front();
+					submitted.pop_front();
+				}
+				scheduler.BeginFrame(completedFenceValue);
+				scheduler.Defer([&released]() { released++; });
+				submitted.push_back(scheduler.EndFrame());
+			}
+			MicroBenchmarkSink((double)released);
+			return iterations;
+		});
+}
+
+static void RunDescriptorCases(MicroBenchmarkRunner& runner)
+{
+	//material churn: single views and srv tables come and go, frees wait two frames for the fence
+	const uint32_t counts[] = { 1, 1, 1, 4, 1, 6 };
+	const uint32_t allocationsPerFrame = 24;
+	const uint64_t framesInFlight = 2;
+
+	DescriptorAllocator allocator(1024);
+	std::vector<DescriptorHandle> live;
+	uint64_t fenceValue = 1;
+	runner.Run("descriptors/allocate_free", "ns/allocation", [&](uint64_t iterations)
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (uint32_t a = 0; a < allocationsPerFrame; a++)
+				{
+					DescriptorHandle handle = allocator.Allocate(counts[a % 6]);
+					if (!handle.IsNull())
+					{
+						live.push_back(handle);
+					}
+				}
+				//free the oldest half, the rest stays resident
+				size_t freeCount = live.size() / 2;
+				for (size_t f = 0; f < freeCount; f++)
+				{
+					allocator.Free(live[f], fenceValue);
+				}
+				live.erase(live.begin(), live.begin() + freeCount);
+
+				if (fenceValue > framesInFlight)
+				{
+					allocator.Retire(fenceValue - framesInFlight);
+				}
+				fenceValue++;
+			}
+			MicroBenchmarkSink((double)allocator.GetStats().allocatedDescriptors);
+			return iterations * allocationsPerFrame;
+		});
+}
+
+static bool CompareWithBaseline(const MicroBenchmarkRunner& runner, const MicroBenchmarkOptions& options)
+{
+	std::vector<MicroBenchmarkResult> baseline;
+	std::string error;
+	if (!MicroBenchmarkRunner::ReadJson(options.baselinePath, baseline, &error))
+	{
+		std::cout << error << std::endl;
+		return false;
+	}
+
+	uint32_t regressions = 0;
+	for (const MicroBenchmarkComparison& comparison : MicroBenchmarkRunner::Compare(baseline, runner.GetResults(), options.threshold, options.noiseFactor))
+	{
+		const char* verdict = comparison.bRegression ? "REGRESSION" : (comparison.bImprovement ? "improved" : "ok");
+		std::cout << verdict << " " << comparison.name << ": " << comparison.baseline << " -> " << comparison.current
+			<< " (" << comparison.change * 100.0 << "%, allowed " << comparison.allowed * 100.0 << "%)" << std::endl;
+		if (comparison.bRegression)
+		{
+			regressions++;
+		}
+	}
+
+	std::cout << regressions << " regressions against " << options.baselinePath << std::endl;
+	return regressions == 0;
+}
+
+int main(int argc, char** argv)
+{
+	MicroBenchmarkOptions options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::cout << "Usage: MicroBenchmark [--filter=substring] [--output=microbenchmark.json] [--baseline=file]" << std::endl;
+		std::cout << "                      [--threshold=0.05] [--noise=3] [--threads=1,4,8] [--batches=1,16,256] [--quick]" << std::endl;
+		return 2;
+	}
+
+	MicroBenchmarkRunner runner(options.runner);
+	RunDecoderCases(runner, options);
+	RunSamplerCases(runner);
+	RunCodecCases(runner);
+	RunModelLoadCases(runner);
+	RunShadingCases(runner);
+	RunUniversalDecoderCases(runner);
+	RunBakeCases(runner);
+	RunCommandQueueCases(runner);
+	RunUploadRingCases(runner);
+	RunDescriptorCases(runner);
+	RunFrameSchedulerCases(runner);
+
+	if (!runner.WriteJson(options.outputPath))
+	{
+		std::cout << "can't write " << options.outputPath << std::endl;
+		return 2;
+	}
+	std::cout << "wrote " << options.outputPath << std::endl;
+
+	if (!options.baselinePath.empty() && !CompareWithBaseline(runner, options))
+	{
+		return 1;
+	}
+	return 0;
+}
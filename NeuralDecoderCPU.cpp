@@ -0,0 +1,386 @@
+#include "NeuralDecoderCPU.h"
+#include "BakedDecoders.h"
+#include "DecoderCompiler.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+const char* GetDecoderKernelName(DecoderKernel kernel)
+{
+	switch (kernel)
+	{
+	case DecoderKernel::Generic: return "Generic";
+	case DecoderKernel::Batched: return "Batched";
+	case DecoderKernel::Sparse: return "Sparse";
+	case DecoderKernel::Baked: return "Baked";
+	case DecoderKernel::JIT: return "JIT";
+	case DecoderKernel::Deterministic: return "Deterministic";
+	default: return "Unknown";
+	}
+}
+
+NeuralDecoderCPU::NeuralDecoderCPU(NeuralModelPtr inModel)
+	: model(inModel)
+{
+	if (model == nullptr || model->layer_sizes.size() < 2)
+	{
+		throw std::runtime_error("Decoder model has no layers");
+	}
+
+	size_t weightOffset = 0;
+	size_t biasOffset = 0;
+	for (size_t i = 0; i + 1 < model->layer_sizes.size(); i++)
+	{
+		weightOffsets.push_back(weightOffset);
+		biasOffsets.push_back(biasOffset);
+		weightOffset += (size_t)model->layer_sizes[i] * model->layer_sizes[i + 1];
+		biasOffset += model->layer_sizes[i + 1];
+	}
+
+	for (int32_t size : model->layer_sizes)
+	{
+		if (size > maxLayerSize)
+		{
+			maxLayerSize = size;
+		}
+	}
+
+	if (weightOffset != model->weights.size() || biasOffset != model->bias.size())
+	{
+		throw std::runtime_error("Decoder model weights don't match its layer sizes");
+	}
+
+	compiled = std::make_shared<CompiledDecoder>(CompileDecoder(*model));
+	maxCompiledLayerSize = compiled->inputCount;
+	for (const CompiledLayer& layer : compiled->layers)
+	{
+		maxCompiledLayerSize = std::max(maxCompiledLayerSize, (int)layer.neurons.size());
+	}
+
+	//weights are part of the hash, a retrained model never runs a stale decoder
+	bakedDecoder = FindBakedDecoder(compiled->modelHash);
+
+	//a model loaded at runtime has nothing compiled in
+	if (bakedDecoder == nullptr)
+	{
+		std::string error;
+		if (!CreateJIT(DecoderJITTarget::Auto, &error))
+		{
+			std::cout << "Decoder JIT unavailable, using the batched kernel: " << error << std::endl;
+		}
+	}
+}
+
+void NeuralDecoderCPU::SetKernel(DecoderKernel inKernel)
+{
+	kernel = inKernel;
+	if (kernel == DecoderKernel::JIT && !jit && !bJITFailed)
+	{
+		CreateJIT();
+	}
+}
+
+bool NeuralDecoderCPU::CreateJIT(DecoderJITTarget target, std::string* error)
+{
+	PROFILE_ZONE("NeuralDecoderCPU::CreateJIT");
+
+	std::unique_ptr<DecoderJIT> created = DecoderJIT::Create(model, target, error);
+	if (!created)
+	{
+		bJITFailed = target == DecoderJITTarget::Auto;
+		return false;
+	}
+
+	//random features, not a multiple of the block size so a partial block is covered too
+	const size_t pixelCount = 61;
+	const float tolerance = 1e-5f;
+
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+	std::vector<float> inputs(pixelCount * GetInputCount());
+	for (float& input : inputs)
+	{
+		input = distribution(random);
+	}
+
+	std::vector<float> expected(pixelCount * GetOutputCount());
+	std::vector<float> actual(expected.size());
+	DecodeGeneric(inputs.data(), expected.data(), pixelCount);
+	created->Decode(inputs.data(), actual.data(), pixelCount);
+
+	float maxDifference = 0.0f;
+	for (size_t i = 0; i < expected.size(); i++)
+	{
+		maxDifference = std::max(maxDifference, std::fabs(expected[i] - actual[i]));
+	}
+	if (!(maxDifference <= tolerance))
+	{
+		if (error)
+		{
+			*error = std::string(GetDecoderJITTargetName(created->GetTarget())) + " code differs from the generic kernel by " + std::to_string(maxDifference);
+		}
+		bJITFailed = target == DecoderJITTarget::Auto;
+		return false;
+	}
+
+	jit = std::move(created);
+	return true;
+}
+
+int NeuralDecoderCPU::GetInputCount() const
+{
+	return model->layer_sizes.front();
+}
+
+int NeuralDecoderCPU::GetOutputCount() const
+{
+	return model->layer_sizes.back();
+}
+
+void NeuralDecoderCPU::Decode(const float* inputs, float* outputs, size_t count) const
+{
+	Decode(inputs, outputs, count, kernel);
+}
+
+void NeuralDecoderCPU::Decode(const float* inputs, float* outputs, size_t count, DecoderKernel withKernel) const
+{
+	switch (withKernel)
+	{
+	case DecoderKernel::Baked:
+		if (bakedDecoder)
+		{
+			bakedDecoder->decode(inputs, outputs, count);
+			break;
+		}
+		[[fallthrough]];
+	case DecoderKernel::JIT:
+		if (jit)
+		{
+			jit->Decode(inputs, outputs, count);
+			break;
+		}
+		DecodeBatched(inputs, outputs, count);
+		break;
+	case DecoderKernel::Batched:
+		DecodeBatched(inputs, outputs, count);
+		break;
+	case DecoderKernel::Sparse:
+		DecodeSparse(inputs, outputs, count);
+		break;
+	case DecoderKernel::Deterministic:
+		DecodeDeterministic(inputs, outputs, count);
+		break;
+	default:
+		DecodeGeneric(inputs, outputs, count);
+		break;
+	}
+}
+
+void NeuralDecoderCPU::DecodeGeneric(const float* inputs, float* outputs, size_t count) const
+{
+	const std::vector<int32_t>& sizes = model->layer_sizes;
+	const size_t layerCount = sizes.size() - 1;
+	const int inputCount = GetInputCount();
+	const int outputCount = GetOutputCount();
+
+	std::vector<float> scratch((size_t)maxLayerSize * 2);
+
+	for (size_t pixel = 0; pixel < count; pixel++)
+	{
+		const float* layerInput = inputs + pixel * inputCount;
+		float* layerOutput = scratch.data();
+
+		for (size_t layer = 0; layer < layerCount; layer++)
+		{
+			const int in = sizes[layer];
+			const int out = sizes[layer + 1];
+			const float* weights = model->weights.data() + weightOffsets[layer];
+			const float* bias = model->bias.data() + biasOffsets[layer];
+			const bool bLastLayer = layer + 1 == layerCount;
+			const bool bLinear = model->IsLinearLayer(layer);
+
+			if (bLastLayer)
+			{
+				layerOutput = outputs + pixel * outputCount;
+			}
+
+			for (int o = 0; o < out; o++)
+			{
+				const float* row = weights + (size_t)o * in;
+				float sum = bias[o];
+				for (int i = 0; i < in; i++)
+				{
+					sum += row[i] * layerInput[i];
+				}
+
+				if (bLastLayer)
+				{
+					layerOutput[o] = 1.0f / (1.0f + std::exp(-sum));
+				}
+				else
+				{
+					layerOutput[o] = sum > 0.0f || bLinear ? sum : 0.0f;
+				}
+			}
+
+			//ping-pong between the two halves of the scratch
+			layerInput = layerOutput;
+			layerOutput = layerOutput == scratch.data() ? scratch.data() + maxLayerSize : scratch.data();
+		}
+	}
+}
+
+void NeuralDecoderCPU::DecodeBatched(const float* inputs, float* outputs, size_t count) const
+{
+	const std::vector<int32_t>& sizes = model->layer_sizes;
+	const size_t layerCount = sizes.size() - 1;
+	const int inputCount = GetInputCount();
+	const int outputCount = GetOutputCount();
+	const size_t B = BatchBlockSize;
+
+	//activations of a block, channel major: value of channel c for pixel p at c * B + p
+	std::vector<float> scratch((size_t)maxLayerSize * B * 2);
+	float* const front = scratch.data();
+	float* const back = scratch.data() + (size_t)maxLayerSize * B;
+
+	for (size_t begin = 0; begin < count; begin += B)
+	{
+		const size_t pixelCount = count - begin < B ? count - begin : B;
+
+		//transpose the inputs, a partial last block is padded with zeros
+		for (int i = 0; i < inputCount; i++)
+		{
+			for (size_t p = 0; p < B; p++)
+			{
+				front[i * B + p] = p < pixelCount ? inputs[(begin + p) * inputCount + i] : 0.0f;
+			}
+		}
+
+		const float* layerInput = front;
+		float* layerOutput = back;
+
+		for (size_t layer = 0; layer < layerCount; layer++)
+		{
+			const int in = sizes[layer];
+			const int out = sizes[layer + 1];
+			const float* weights = model->weights.data() + weightOffsets[layer];
+			const float* bias = model->bias.data() + biasOffsets[layer];
+			const bool bLastLayer = layer + 1 == layerCount;
+			const bool bLinear = model->IsLinearLayer(layer);
+
+			for (int o = 0; o < out; o++)
+			{
+				const float* row = weights + (size_t)o * in;
+
+				float sum[B];
+				for (size_t p = 0; p < B; p++)
+				{
+					sum[p] = bias[o];
+				}
+				for (int i = 0; i < in; i++)
+				{
+					const float weight = row[i];
+					const float* x = layerInput + (size_t)i * B;
+					for (size_t p = 0; p < B; p++)
+					{
+						sum[p] += weight * x[p];
+					}
+				}
+
+				if (bLastLayer)
+				{
+					for (size_t p = 0; p < pixelCount; p++)
+					{
+						outputs[(begin + p) * outputCount + o] = 1.0f / (1.0f + std::exp(-sum[p]));
+					}
+				}
+				else
+				{
+					float* y = layerOutput + (size_t)o * B;
+					for (size_t p = 0; p < B; p++)
+					{
+						y[p] = sum[p] > 0.0f || bLinear ? sum[p] : 0.0f;
+					}
+				}
+			}
+
+			layerInput = layerOutput;
+			layerOutput = layerOutput == front ? back : front;
+		}
+	}
+}
+
+void NeuralDecoderCPU::DecodeSparse(const float* inputs, float* outputs, size_t count) const
+{
+	const int inputCount = GetInputCount();
+	const int outputCount = GetOutputCount();
+	const size_t B = BatchBlockSize;
+
+	//same layout as the batched kernel, sized by the compiled layers
+	std::vector<float> scratch((size_t)maxCompiledLayerSize * B * 2);
+	float* const front = scratch.data();
+	float* const back = scratch.data() + (size_t)maxCompiledLayerSize * B;
+
+	for (size_t begin = 0; begin < count; begin += B)
+	{
+		const size_t pixelCount = count - begin < B ? count - begin : B;
+
+		for (int i = 0; i < inputCount; i++)
+		{
+			for (size_t p = 0; p < B; p++)
+			{
+				front[i * B + p] = p < pixelCount ? inputs[(begin + p) * inputCount + i] : 0.0f;
+			}
+		}
+
+		const float* layerInput = front;
+		float* layerOutput = back;
+
+		for (size_t layer = 0; layer < compiled->layers.size(); layer++)
+		{
+			const std::vector<CompiledNeuron>& neurons = compiled->layers[layer].neurons;
+			const bool bLastLayer = layer + 1 == compiled->layers.size();
+			const bool bLinear = compiled->layers[layer].bLinear;
+
+			for (size_t o = 0; o < neurons.size(); o++)
+			{
+				float sum[B];
+				for (size_t p = 0; p < B; p++)
+				{
+					sum[p] = neurons[o].bias;
+				}
+				//only the weights left after pruning, indices into the previous compiled layer
+				for (const auto& weight : neurons[o].weights)
+				{
+					const float* x = layerInput + (size_t)weight.first * B;
+					for (size_t p = 0; p < B; p++)
+					{
+						sum[p] += weight.second * x[p];
+					}
+				}
+
+				if (bLastLayer)
+				{
+					for (size_t p = 0; p < pixelCount; p++)
+					{
+						outputs[(begin + p) * outputCount + o] = 1.0f / (1.0f + std::exp(-sum[p]));
+					}
+				}
+				else
+				{
+					float* y = layerOutput + o * B;
+					for (size_t p = 0; p < B; p++)
+					{
+						y[p] = sum[p] > 0.0f || bLinear ? sum[p] : 0.0f;
+					}
+				}
+			}
+
+			layerInput = layerOutput;
+			layerOutput = layerOutput == front ? back : front;
+		}
+	}
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "DecoderJIT.h"
+#include "NeuralModel.h"
+
+struct BakedDecoder;
+struct CompiledDecoder;
+
+// Loop orders of the forward pass, all produce the same values to within float rounding
+enum class DecoderKernel
+{
+	//one pixel at a time through every layer
+	Generic,
+	//blocks of pixels layer by layer, the inner loop runs over pixels and vectorizes
+	Batched,
+	//blocks of pixels over the compiled decoder, zero weights and dead neurons of a pruned model cost nothing
+	Sparse,
+	//code generated for this model with its weights as constants, JIT when none was compiled in
+	Baked,
+	//machine code generated for this model when it was loaded, Batched when this cpu can't run any
+	JIT,
+	//blocks like Batched without FMA or the C library's exp, the same bits on every cpu, compiler and thread count.
+	//For decoded assets that are hashed, see DeterministicDecode
+	Deterministic,
+	Count
+};
+
+const char* GetDecoderKernelName(DecoderKernel kernel);
+
+// Cpu forward pass of a decoder model, any depth and width.
+// Same math as forward() in PixelShader.hlsl: ReLU on hidden layers, sigmoid on the output layer.
+// The linear layers of a factorized model skip the ReLU.
+class NeuralDecoderCPU
+{
+public:
+	explicit NeuralDecoderCPU(NeuralModelPtr inModel);
+
+	int GetInputCount() const;
+	int GetOutputCount() const;
+
+	//widest layer, scratch needed per pixel is twice this
+	int GetMaxLayerSize() const { return maxLayerSize; }
+
+	//inputs hold GetInputCount() floats per pixel, outputs get GetOutputCount() floats per pixel
+	void Decode(const float* inputs, float* outputs, size_t count) const;
+
+	//with withKernel instead of the kernel set, for a caller sharing the decoder
+	void Decode(const float* inputs, float* outputs, size_t count, DecoderKernel withKernel) const;
+
+	//JIT generates the code of the model if it wasn't yet
+	void SetKernel(DecoderKernel inKernel);
+	DecoderKernel GetKernel() const { return kernel; }
+
+	//pixels per block of the batched kernel
+	static const size_t BatchBlockSize = 16;
+
+	const NeuralModelPtr& GetModel() const { return model; }
+
+	//decoder compiled in for this model, nullptr when there is none
+	const BakedDecoder* GetBakedDecoder() const { return bakedDecoder; }
+
+	//generates machine code for the model and keeps it when it decodes random inputs like the generic
+	//kernel does. Done on construction for a model without a baked decoder
+	bool CreateJIT(DecoderJITTarget target = DecoderJITTarget::Auto, std::string* error = nullptr);
+
+	//nullptr until CreateJIT succeeded
+	const DecoderJIT* GetJIT() const { return jit.get(); }
+
+private:
+	void DecodeGeneric(const float* inputs, float* outputs, size_t count) const;
+	void DecodeBatched(const float* inputs, float* outputs, size_t count) const;
+	void DecodeSparse(const float* inputs, float* outputs, size_t count) const;
+	//in DeterministicDecode.cpp, compiled without FMA contraction
+	void DecodeDeterministic(const float* inputs, float* outputs, size_t count) const;
+
+	NeuralModelPtr model;
+	DecoderKernel kernel = DecoderKernel::Baked;
+	const BakedDecoder* bakedDecoder = nullptr;
+
+	std::shared_ptr<const CompiledDecoder> compiled;
+	//widest compiled layer, the sparse kernel's scratch
+	int maxCompiledLayerSize = 0;
+
+	std::shared_ptr<const DecoderJIT> jit;
+	//CreateJIT failed for the best target, SetKernel doesn't try again
+	bool bJITFailed = false;
+
+	//start of every layer in the flat weight and bias arrays
+	std::vector<size_t> weightOffsets;
+	std::vector<size_t> biasOffsets;
+
+	int maxLayerSize = 0;
+};
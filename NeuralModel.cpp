@@ -1,12 +1,16 @@
 #include "NeuralModel.h"
 #include <fstream>
+#include <filesystem>
 #include "nlohmann/json.hpp"
 #include <iostream>
-#include "Graphics.h"
-#include "d3dx12.h"
+#include <cstring>
+#include "Profiler.h"
+#include "MemoryTracker.h"
 
 NeuralModelPtr NeuralModel::LoadModel(const std::string& modelPath)
 {
+	PROFILE_ZONE("NeuralModel::LoadModel");
+
 	std::cout << "Loading NeuralNetwork Model: " << modelPath << std::endl;
 
 	auto model = std::make_shared<NeuralModel>();
@@ -20,9 +24,23 @@ NeuralModelPtr NeuralModel::LoadModel(const std::string& modelPath)
 		throw std::runtime_error("Model file not found");
 	}
 
+	//binary models skip json parsing entirely
+	if (std::filesystem::path(modelPath).extension() == ".bin")
+	{
+		model->ReadBinary(modelPath);
+		model->TrackCPUMemory();
+
+		std::cout << "Model loaded\n";
+		return model;
+	}
+
 	std::ifstream file(modelPath);
 	
-	Json model_json = Json::parse(file);
+	Json model_json;
+	{
+		PROFILE_ZONE("ParseJson");
+		model_json = Json::parse(file);
+	}
 
 	//print hierarchy
 	//std::cout << "Model hierarchy:\n";
@@ -32,6 +50,12 @@ NeuralModelPtr NeuralModel::LoadModel(const std::string& modelPath)
 
 	cout << "Number of layers: " << num_layers << "\n";
 
+	//width of the last Conv2d, activation layers follow it in the file
+	int32_t output_channels = 0;
+	//a Conv2d right after another one had no activation
+	int32_t conv_count = 0;
+	bool bActivationPending = false;
+
 	for (int32_t i = 0; i < num_layers; i++)
 	{
 		string layer_name = "layer" + to_string(i);
@@ -40,6 +64,13 @@ NeuralModelPtr NeuralModel::LoadModel(const std::string& modelPath)
 
 		if (layer_type == "Conv2d")
 		{
+			if (bActivationPending)
+			{
+				model->linear_layers.push_back(conv_count - 1);
+			}
+			conv_count++;
+			bActivationPending = true;
+
 			int32_t in_channels = model_json[layer_name]["in_channels"];
 			int32_t out_channels = model_json[layer_name]["out_channels"];
 
@@ -47,11 +78,7 @@ NeuralModelPtr NeuralModel::LoadModel(const std::string& modelPath)
 			//cout << "--Out channels: " << out_channels << "\n";
 
 			model->layer_sizes.push_back(in_channels);
-
-			if (i == num_layers - 1)
-			{
-				model->layer_sizes.push_back(out_channels);
-			}
+			output_channels = out_channels;
 
 
 			vector<float> weights = (model_json[layer_name]["weight"]);
@@ -60,18 +87,160 @@ NeuralModelPtr NeuralModel::LoadModel(const std::string& modelPath)
 			model->weights.insert(model->weights.end(), weights.begin(), weights.end());
 			model->bias.insert(model->bias.end(), bias.begin(), bias.end());
 		}
+		else
+		{
+			bActivationPending = false;
+		}
+	}
+
+	if (output_channels > 0)
+	{
+		model->layer_sizes.push_back(output_channels);
 	}
 
+	model->TrackCPUMemory();
+
 	std::cout << "Model loaded\n";
 
     return model;
 }
 
-void NeuralModel::CreateBuffers(D3D12GraphicsDevice& device)
+static const char BinaryModelMagic[4] = { 'N', 'T', 'M', 'B' };
+//version 2 added the linear layers
+static const uint32_t BinaryModelVersion = 2;
+
+template<typename T>
+static void WriteArray(std::ofstream& file, const std::vector<T>& values)
+{
+	uint32_t count = (uint32_t)values.size();
+	file.write((const char*)&count, sizeof(count));
+	file.write((const char*)values.data(), sizeof(T) * values.size());
+}
+
+template<typename T>
+static void ReadArray(std::ifstream& file, std::vector<T>& values)
+{
+	uint32_t count = 0;
+	file.read((char*)&count, sizeof(count));
+	values.resize(count);
+	file.read((char*)values.data(), sizeof(T) * values.size());
+}
+
+bool NeuralModel::SaveBinary(const std::string& path) const
+{
+	std::ofstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+
+	file.write(BinaryModelMagic, sizeof(BinaryModelMagic));
+	file.write((const char*)&BinaryModelVersion, sizeof(BinaryModelVersion));
+	WriteArray(file, layer_sizes);
+	WriteArray(file, weights);
+	WriteArray(file, bias);
+	WriteArray(file, linear_layers);
+	return (bool)file;
+}
+
+bool NeuralModel::SaveJson(const std::string& path) const
+{
+	using Json = nlohmann::json;
+
+	Json modelJson;
+	int32_t layerCount = 0;
+	size_t weightOffset = 0;
+	size_t biasOffset = 0;
+	for (size_t i = 0; i + 1 < layer_sizes.size(); i++)
+	{
+		const size_t weightCount = (size_t)layer_sizes[i] * layer_sizes[i + 1];
+
+		Json conv;
+		conv["name"] = "Conv2d";
+		conv["in_channels"] = layer_sizes[i];
+		conv["out_channels"] = layer_sizes[i + 1];
+		conv["weight"] = std::vector<float>(weights.begin() + weightOffset, weights.begin() + weightOffset + weightCount);
+		conv["bias"] = std::vector<float>(bias.begin() + biasOffset, bias.begin() + biasOffset + layer_sizes[i + 1]);
+		modelJson["layer" + std::to_string(layerCount++)] = conv;
+
+		if (i + 2 == layer_sizes.size())
+		{
+			modelJson["layer" + std::to_string(layerCount++)] = Json{ { "name", "Sigmoid" } };
+		}
+		else if (!IsLinearLayer(i))
+		{
+			modelJson["layer" + std::to_string(layerCount++)] = Json{ { "name", "ReLU" } };
+		}
+
+		weightOffset += weightCount;
+		biasOffset += layer_sizes[i + 1];
+	}
+	modelJson["num_layers"] = layerCount;
+
+	std::ofstream file(path);
+	file << modelJson.dump();
+	return (bool)file;
+}
+
+bool NeuralModel::IsLinearLayer(size_t layer) const
 {
-	weightBuffer = std::make_shared<StructuredBuffer>();
-	weightBuffer->Initialize(device, weights.data(), sizeof(float), weights.size());
+	for (int32_t linear : linear_layers)
+	{
+		if ((size_t)linear == layer)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void NeuralModel::ReadBinary(const std::string& path)
+{
+	PROFILE_ZONE("ReadBinary");
+
+	std::ifstream file(path, std::ios::binary);
 
-	biasBuffer = std::make_shared<StructuredBuffer>();
-	biasBuffer->Initialize(device, bias.data(), sizeof(float), bias.size());
+	char magic[4] = {};
+	uint32_t version = 0;
+	file.read(magic, sizeof(magic));
+	file.read((char*)&version, sizeof(version));
+	if (memcmp(magic, BinaryModelMagic, sizeof(magic)) != 0 || version == 0 || version > BinaryModelVersion)
+	{
+		throw std::runtime_error("Not a binary model file");
+	}
+
+	ReadArray(file, layer_sizes);
+	ReadArray(file, weights);
+	ReadArray(file, bias);
+	if (version >= 2)
+	{
+		ReadArray(file, linear_layers);
+	}
+	if (!file)
+	{
+		throw std::runtime_error("Truncated binary model file");
+	}
+}
+
+void NeuralModel::TrackCPUMemory()
+{
+	//cpu copy of the weights stays alive for the lifetime of the model
+	memoryOwner = MemoryTracker::GetCurrentOwner();
+	trackedCPUBytes = (weights.size() + bias.size()) * sizeof(float);
+	MemoryTracker::Get().Allocate(MemoryCategory::ModelWeightsCPU, trackedCPUBytes, memoryOwner);
+}
+
+NeuralModel::~NeuralModel()
+{
+	MemoryTracker::Get().Free(MemoryCategory::ModelWeightsCPU, trackedCPUBytes, memoryOwner);
+}
+
+size_t NeuralModel::GetMultiplyAddCount() const
+{
+	size_t count = 0;
+	for (size_t i = 0; i + 1 < layer_sizes.size(); i++)
+	{
+		count += (size_t)layer_sizes[i] * layer_sizes[i + 1];
+	}
+	return count;
 }
@@ -2,11 +2,11 @@
 
 #include <string>
 #include <vector>
-#include <d3d12.h>
-#include <wrl\client.h>
-#include "StructuredBuffer.h"
+#include <memory>
+#include <cstdint>
 
 typedef std::shared_ptr<class NeuralModel> NeuralModelPtr;
+typedef std::shared_ptr<class StructuredBuffer> StructuredBufferPtr;
 
 struct float4
 {
@@ -28,12 +28,34 @@ public:
 
 	std::vector<int32_t> layer_sizes;
 
-	StructuredBufferPtr weightBuffer;
-	StructuredBufferPtr biasBuffer;
+	//weight layers whose outputs skip the ReLU, the first half of a factorized layer. Empty for trained models
+	std::vector<int32_t> linear_layers;
+
+	//owner the cpu weights are reported under, the gpu copy lives in the arenas of the NeuralModelPool
+	std::string memoryOwner;
+	size_t trackedCPUBytes = 0;
+
+	~NeuralModel();
 
 public:
+	//decodermodel.json as exported by the trainer, or a .bin written by SaveBinary
 	static NeuralModelPtr LoadModel(const std::string& modelPath);
 
-	void CreateBuffers(class D3D12GraphicsDevice& device);
+	//binary copy of the model, little endian:
+	//"NTMB", uint32 version, then layer sizes, weights, biases and linear layers each as uint32 count + values
+	bool SaveBinary(const std::string& path) const;
+
+	//same layout the trainer exports, a linear layer is a Conv2d without an activation after it
+	bool SaveJson(const std::string& path) const;
+
+	//layer reads layer_sizes[layer] values and writes layer_sizes[layer + 1]
+	bool IsLinearLayer(size_t layer) const;
+
+	//multiply-adds per decoded pixel
+	size_t GetMultiplyAddCount() const;
+
+private:
+	void ReadBinary(const std::string& path);
+	void TrackCPUMemory();
 };
 
@@ -0,0 +1,257 @@
+#include "NeuralModelPool.h"
+#include "DecoderCompiler.h"
+#include "Profiler.h"
+#include <algorithm>
+
+//the hash only picks the candidates, two decoders are shared when every value matches
+static bool IsSameDecoder(const NeuralModel& a, const NeuralModel& b)
+{
+	return a.layer_sizes == b.layer_sizes && a.linear_layers == b.linear_layers && a.weights == b.weights && a.bias == b.bias;
+}
+
+NeuralModelPtr NeuralModelPool::Load(const std::string& path)
+{
+	PROFILE_ZONE("NeuralModelPool::Load");
+
+	std::lock_guard<std::mutex> lock(mutex);
+	stats.requests++;
+
+	auto pathModel = pathModels.find(path);
+	if (pathModel != pathModels.end())
+	{
+		NeuralModelPtr resident = pathModel->second.lock();
+		if (resident && FindEntry(*resident))
+		{
+			stats.pathHits++;
+			return resident;
+		}
+	}
+
+	NeuralModelPtr model = NeuralModel::LoadModel(path);
+	NeuralModelPtr resident = AddLocked(model);
+	pathModels[path] = resident;
+	if (resident != model)
+	{
+		stats.contentHits++;
+	}
+	return resident;
+}
+
+NeuralModelPtr NeuralModelPool::Add(const NeuralModelPtr& model)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return AddLocked(model);
+}
+
+NeuralModelPtr NeuralModelPool::AddLocked(const NeuralModelPtr& model)
+{
+	if (const Entry* entry = FindEntry(*model))
+	{
+		return entry->model;
+	}
+
+	//a 64 bit hash can collide, a model only shares the entry when its values match too
+	const uint64_t hash = HashDecoderModel(*model);
+	for (const Entry& entry : entries)
+	{
+		if (entry.slot.hash == hash && IsSameDecoder(*entry.model, *model))
+		{
+			return entry.model;
+		}
+	}
+
+	Entry entry;
+	entry.model = model;
+	entry.slot.hash = hash;
+	entry.slot.weightOffset = weightCount;
+	entry.slot.weightCount = model->weights.size();
+	entry.slot.biasOffset = biasCount;
+	entry.slot.biasCount = model->bias.size();
+	weightCount += entry.slot.weightCount;
+	biasCount += entry.slot.biasCount;
+	entries.push_back(entry);
+	generation++;
+	return model;
+}
+
+const NeuralModelPool::Entry* NeuralModelPool::FindEntry(const NeuralModel& model) const
+{
+	for (const Entry& entry : entries)
+	{
+		if (entry.model.get() == &model)
+		{
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+bool NeuralModelPool::FindSlot(const NeuralModel& model, NeuralModelSlot& outSlot) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	const Entry* entry = FindEntry(model);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+	outSlot = entry->slot;
+	return true;
+}
+
+size_t NeuralModelPool::GetModelCount() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return entries.size();
+}
+
+NeuralModelPoolStats NeuralModelPool::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return stats;
+}
+
+size_t NeuralModelPool::GetWeightCount() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return weightCount;
+}
+
+size_t NeuralModelPool::GetBiasCount() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return biasCount;
+}
+
+uint64_t NeuralModelPool::GetGeneration() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return generation;
+}
+
+void NeuralModelPool::PackArenas(std::vector<float>& outWeights, std::vector<float>& outBiases) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	PackLocked(outWeights, outBiases);
+}
+
+void NeuralModelPool::PackLocked(std::vector<float>& outWeights, std::vector<float>& outBiases) const
+{
+	outWeights.resize(weightCount);
+	outBiases.resize(biasCount);
+	for (const Entry& entry : entries)
+	{
+		std::copy(entry.model->weights.begin(), entry.model->weights.end(), outWeights.begin() + entry.slot.weightOffset);
+		std::copy(entry.model->bias.begin(), entry.model->bias.end(), outBiases.begin() + entry.slot.biasOffset);
+	}
+}
+
+size_t NeuralModelPool::Collect()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	size_t dropped = 0;
+	weightCount = 0;
+	biasCount = 0;
+	for (size_t i = 0; i < entries.size();)
+	{
+		Entry& entry = entries[i];
+		if (entry.model.use_count() == 1)
+		{
+			entries.erase(entries.begin() + i);
+			dropped++;
+			continue;
+		}
+
+		//compact, the arenas are rebuilt on the next UpdateBuffers
+		entry.slot.weightOffset = weightCount;
+		entry.slot.biasOffset = biasCount;
+		weightCount += entry.slot.weightCount;
+		biasCount += entry.slot.biasCount;
+		i++;
+	}
+
+	if (dropped > 0)
+	{
+		generation++;
+	}
+	return dropped;
+}
+
+void NeuralModelPool::Clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+	pathModels.clear();
+	weightCount = 0;
+	biasCount = 0;
+	generation++;
+	weightArena.reset();
+	biasArena.reset();
+}
+
+//HEADLESS builds (tools like MicroBenchmark) link without the d3d12 device
+#if defined(_WIN32) && !defined(HEADLESS)
+#include "Graphics.h"
+#include "StructuredBuffer.h"
+
+void NeuralModelPool::UpdateBuffers(D3D12GraphicsDevice& device)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (bufferGeneration == generation && (weightArena || entries.empty()))
+	{
+		return;
+	}
+
+	PROFILE_ZONE("NeuralModelPool::UpdateBuffers");
+
+	//frames in flight may still read the old arenas through the views bound before
+	device.DeferRelease(weightArena);
+	device.DeferRelease(biasArena);
+	weightArena.reset();
+	biasArena.reset();
+	for (Entry& entry : entries)
+	{
+		device.DeferRelease(entry.weightView);
+		device.DeferRelease(entry.biasView);
+		entry.weightView.reset();
+		entry.biasView.reset();
+	}
+	bufferGeneration = generation;
+	if (entries.empty())
+	{
+		return;
+	}
+
+	std::vector<float> weights;
+	std::vector<float> biases;
+	PackLocked(weights, biases);
+
+	//shared by every material, not reported under any of them
+	MemoryTracker::OwnerScope ownerScope("NeuralModelPool");
+
+	weightArena = std::make_shared<StructuredBuffer>();
+	weightArena->Initialize(device, weights.data(), sizeof(float), weights.size(), MemoryCategory::ModelWeightsGPU);
+
+	biasArena = std::make_shared<StructuredBuffer>();
+	biasArena->Initialize(device, biases.data(), sizeof(float), biases.size(), MemoryCategory::ModelWeightsGPU);
+
+	for (Entry& entry : entries)
+	{
+		entry.weightView = weightArena->CreateRange(device, entry.slot.weightOffset, entry.slot.weightCount);
+		entry.biasView = biasArena->CreateRange(device, entry.slot.biasOffset, entry.slot.biasCount);
+	}
+}
+
+bool NeuralModelPool::GetViews(const NeuralModel& model, StructuredBufferPtr& outWeights, StructuredBufferPtr& outBiases) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	const Entry* entry = FindEntry(model);
+	if (entry == nullptr || entry->weightView == nullptr)
+	{
+		return false;
+	}
+	outWeights = entry->weightView;
+	outBiases = entry->biasView;
+	return true;
+}
+#endif
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "NeuralModel.h"
+
+// Where the weights and biases of a resident model sit in the arenas of a NeuralModelPool, in floats
+struct NeuralModelSlot
+{
+	//HashDecoderModel of the model
+	uint64_t hash = 0;
+	size_t weightOffset = 0;
+	size_t weightCount = 0;
+	size_t biasOffset = 0;
+	size_t biasCount = 0;
+};
+
+struct NeuralModelPoolStats
+{
+	size_t requests = 0;
+	//answered without reading the file, the path was loaded before
+	size_t pathHits = 0;
+	//read, then replaced by a resident model with the same weights
+	size_t contentHits = 0;
+};
+
+// Decoder models shared by every material using them. Models are deduplicated by content, materials
+// whose decoders have the same weights hold one NeuralModel, and the weights and biases of every resident
+// model are packed into one arena buffer each. A material keeps the pooled model and binds views of the
+// arenas at its slot, so weight memory and buffer count grow with decoders instead of materials.
+class NeuralModelPool
+{
+public:
+	static NeuralModelPool& Get()
+	{
+		static NeuralModelPool instance;
+		return instance;
+	}
+
+	NeuralModelPool() = default;
+
+	//model at path, read unless the path or a model with the same weights is resident. Throws like LoadModel
+	NeuralModelPtr Load(const std::string& path);
+
+	//the resident model with the weights of model, model itself when it's the first
+	NeuralModelPtr Add(const NeuralModelPtr& model);
+
+	//false when model isn't resident. Slots move when Collect drops a model before them
+	bool FindSlot(const NeuralModel& model, NeuralModelSlot& outSlot) const;
+
+	size_t GetModelCount() const;
+	NeuralModelPoolStats GetStats() const;
+
+	//floats in the weight and bias arenas
+	size_t GetWeightCount() const;
+	size_t GetBiasCount() const;
+
+	//every resident model at its slot
+	void PackArenas(std::vector<float>& outWeights, std::vector<float>& outBiases) const;
+
+	//drops the models only the pool holds, the ones after them move down. Returns how many were dropped
+	size_t Collect();
+
+	//changes whenever a slot does, buffers and views made for an older layout are stale
+	uint64_t GetGeneration() const;
+
+	//at shutdown, before the device goes
+	void Clear();
+
+	//uploads the arenas and creates the views of every slot when the layout changed since the last call
+	void UpdateBuffers(class D3D12GraphicsDevice& device);
+
+	//views of the weights and biases of model in the arenas, false until UpdateBuffers ran for it
+	bool GetViews(const NeuralModel& model, StructuredBufferPtr& outWeights, StructuredBufferPtr& outBiases) const;
+
+private:
+	struct Entry
+	{
+		NeuralModelPtr model;
+		NeuralModelSlot slot;
+		StructuredBufferPtr weightView;
+		StructuredBufferPtr biasView;
+	};
+
+	NeuralModelPtr AddLocked(const NeuralModelPtr& model);
+	void PackLocked(std::vector<float>& outWeights, std::vector<float>& outBiases) const;
+	const Entry* FindEntry(const NeuralModel& model) const;
+
+	mutable std::mutex mutex;
+	std::vector<Entry> entries;
+	//model read from each path, trusted only while it's still an entry
+	std::map<std::string, std::weak_ptr<NeuralModel>> pathModels;
+	size_t weightCount = 0;
+	size_t biasCount = 0;
+	uint64_t generation = 0;
+	NeuralModelPoolStats stats;
+
+	StructuredBufferPtr weightArena;
+	StructuredBufferPtr biasArena;
+	//layout the arena buffers were built for
+	uint64_t bufferGeneration = 0;
+};
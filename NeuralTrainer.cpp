@@ -0,0 +1,1307 @@
+#include "NeuralTrainer.h"
+#include "BCDecoder.h"
+#include "BCEncoder.h"
+#include "DDSImage.h"
+#include "ImageMetrics.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+//pixels per block of the forward and backward passes, the inner loops run over them
+static const size_t BlockSize = 16;
+//texels per shard of a batch, a batch has the same shards whatever the thread count
+static const size_t ShardSize = 256;
+//grid values start as small noise around the middle of [0, 1], the decoder first sees little more than uv
+static const float InitialGridRange = 0.05f;
+//grid values are kept in [0, 1] like the shipped grids, BC6H holds them with the finest steps of its half floats there
+static const float GridMin = 0.0f;
+static const float GridMax = 1.0f;
+//texels the int8 activation scales are calibrated on
+static const size_t CalibrationTexelCount = 4096;
+//largest magnitude of a symmetric int8
+static const float Int8Max = 127.0f;
+
+static const float AdamBeta1 = 0.9f;
+static const float AdamBeta2 = 0.999f;
+static const float AdamEpsilon = 1e-8f;
+
+static bool Fail(std::string* error, const std::string& message)
+{
+	if (error)
+	{
+		*error = message;
+	}
+	return false;
+}
+
+// Texels and weights of a bilinear sample with wrap addressing, the footprint of SoftwareTexture::Sample
+struct BilinearTaps
+{
+	uint32_t texels[4];
+	float weights[4];
+};
+
+static void GetBilinearTaps(uint32_t width, uint32_t height, float u, float v, BilinearTaps& outTaps)
+{
+	float x = u * width - 0.5f;
+	float y = v * height - 0.5f;
+	float x0 = std::floor(x);
+	float y0 = std::floor(y);
+	float fx = x - x0;
+	float fy = y - y0;
+
+	auto wrap = [](int64_t value, uint32_t size)
+		{
+			int64_t result = value % (int64_t)size;
+			return (uint32_t)(result < 0 ? result + size : result);
+		};
+
+	uint32_t ix0 = wrap((int64_t)x0, width);
+	uint32_t iy0 = wrap((int64_t)y0, height);
+	uint32_t ix1 = ix0 + 1 == width ? 0 : ix0 + 1;
+	uint32_t iy1 = iy0 + 1 == height ? 0 : iy0 + 1;
+
+	outTaps.texels[0] = iy0 * width + ix0;
+	outTaps.texels[1] = iy0 * width + ix1;
+	outTaps.texels[2] = iy1 * width + ix0;
+	outTaps.texels[3] = iy1 * width + ix1;
+	outTaps.weights[0] = (1.0f - fx) * (1.0f - fy);
+	outTaps.weights[1] = fx * (1.0f - fy);
+	outTaps.weights[2] = (1.0f - fx) * fy;
+	outTaps.weights[3] = fx * fy;
+}
+
+bool FeatureGrid::Load(const std::string& path, std::string* error)
+{
+	DDSImage image;
+	if (!image.Load(path, error))
+	{
+		return false;
+	}
+	return LoadFromImage(image, error);
+}
+
+bool FeatureGrid::LoadFromImage(const DDSImage& image, std::string* error)
+{
+	std::vector<float> rgba;
+	if (!image.DecodeMip(0, rgba))
+	{
+		return Fail(error, std::string("Can't decode ") + DDSImage::GetFormatName(image.format));
+	}
+
+	width = image.width;
+	height = image.height;
+	values.resize((size_t)width * height * NeuralTrainer::GridChannels);
+	for (size_t texel = 0; texel < (size_t)width * height; texel++)
+	{
+		for (int c = 0; c < NeuralTrainer::GridChannels; c++)
+		{
+			values[texel * NeuralTrainer::GridChannels + c] = rgba[texel * 4 + c];
+		}
+	}
+	return true;
+}
+
+//BC6H_SF16 blocks of one mip, rgb texels row major, rows of blocks run on the pool
+static void EncodeBlocks(ThreadPool& threadPool, const float* mip, uint32_t mipWidth, uint32_t mipHeight, uint8_t* outBlocks)
+{
+	const int C = NeuralTrainer::GridChannels;
+	const uint32_t blocksX = (mipWidth + 3) / 4;
+	const uint32_t blocksY = (mipHeight + 3) / 4;
+
+	threadPool.ParallelFor(blocksY, [&](uint32_t by, uint32_t)
+		{
+			float texels[16][4];
+			for (uint32_t bx = 0; bx < blocksX; bx++)
+			{
+				//blocks hanging over a small mip repeat its last row and column
+				for (uint32_t i = 0; i < 16; i++)
+				{
+					uint32_t x = std::min(bx * 4 + i % 4, mipWidth - 1);
+					uint32_t y = std::min(by * 4 + i / 4, mipHeight - 1);
+					const float* texel = &mip[((size_t)y * mipWidth + x) * C];
+					texels[i][0] = texel[0];
+					texels[i][1] = texel[1];
+					texels[i][2] = texel[2];
+					texels[i][3] = 1.0f;
+				}
+				BCEncoder::EncodeBC6H(texels, true, outBlocks + ((size_t)by * blocksX + bx) * BCDecoder::BC6HBlockSize);
+			}
+		});
+}
+
+void FeatureGrid::Quantize(ThreadPool& threadPool, FeatureGrid& outGrid) const
+{
+	const int C = NeuralTrainer::GridChannels;
+	const uint32_t blocksX = (width + 3) / 4;
+	const uint32_t blocksY = (height + 3) / 4;
+	std::vector<uint8_t> blocks((size_t)blocksX * blocksY * BCDecoder::BC6HBlockSize);
+	EncodeBlocks(threadPool, values.data(), width, height, blocks.data());
+
+	outGrid.width = width;
+	outGrid.height = height;
+	outGrid.values.resize(values.size());
+	threadPool.ParallelFor(blocksY, [&](uint32_t by, uint32_t)
+		{
+			float texels[16][4];
+			for (uint32_t bx = 0; bx < blocksX; bx++)
+			{
+				BCDecoder::DecodeBC6H(blocks.data() + ((size_t)by * blocksX + bx) * BCDecoder::BC6HBlockSize, true, texels);
+				for (uint32_t i = 0; i < 16; i++)
+				{
+					uint32_t x = bx * 4 + i % 4;
+					uint32_t y = by * 4 + i / 4;
+					if (x < width && y < height)
+					{
+						std::copy(texels[i], texels[i] + C, &outGrid.values[((size_t)y * width + x) * C]);
+					}
+				}
+			}
+		});
+}
+
+void FeatureGrid::Encode(ThreadPool& threadPool, DDSImage& outImage) const
+{
+	PROFILE_ZONE("FeatureGrid::Encode");
+
+	const int C = NeuralTrainer::GridChannels;
+
+	outImage = DDSImage();
+	outImage.width = width;
+	outImage.height = height;
+	outImage.format = DDSFormat::BC6H_SF16;
+
+	//box filtered mips like the trainer exports, the viewer samples mip 0 only
+	std::vector<float> mip = values;
+	uint32_t mipWidth = width;
+	uint32_t mipHeight = height;
+	while (true)
+	{
+		const uint32_t blocksX = (mipWidth + 3) / 4;
+		const uint32_t blocksY = (mipHeight + 3) / 4;
+		const size_t offset = outImage.data.size();
+		outImage.mipOffsets.push_back(offset);
+		outImage.data.resize(offset + (size_t)blocksX * blocksY * BCDecoder::BC6HBlockSize);
+		EncodeBlocks(threadPool, mip.data(), mipWidth, mipHeight, outImage.data.data() + offset);
+
+		if (mipWidth == 1 && mipHeight == 1)
+		{
+			break;
+		}
+
+		const uint32_t nextWidth = std::max(mipWidth / 2, 1u);
+		const uint32_t nextHeight = std::max(mipHeight / 2, 1u);
+		std::vector<float> next((size_t)nextWidth * nextHeight * C);
+		for (uint32_t y = 0; y < nextHeight; y++)
+		{
+			for (uint32_t x = 0; x < nextWidth; x++)
+			{
+				uint32_t x0 = std::min(x * 2, mipWidth - 1);
+				uint32_t x1 = std::min(x * 2 + 1, mipWidth - 1);
+				uint32_t y0 = std::min(y * 2, mipHeight - 1);
+				uint32_t y1 = std::min(y * 2 + 1, mipHeight - 1);
+				for (int c = 0; c < C; c++)
+				{
+					next[((size_t)y * nextWidth + x) * C + c] = 0.25f * (
+						mip[((size_t)y0 * mipWidth + x0) * C + c] + mip[((size_t)y0 * mipWidth + x1) * C + c] +
+						mip[((size_t)y1 * mipWidth + x0) * C + c] + mip[((size_t)y1 * mipWidth + x1) * C + c]);
+				}
+			}
+		}
+		mip = std::move(next);
+		mipWidth = nextWidth;
+		mipHeight = nextHeight;
+	}
+	outImage.mipLevels = (uint32_t)outImage.mipOffsets.size();
+}
+
+bool TrainingTarget::Load(const std::vector<std::string>& paths, std::string* error)
+{
+	if (paths.size() != 4)
+	{
+		return Fail(error, "A target needs albedo, normal, ao and roughness textures");
+	}
+
+	std::vector<float> textures[4];
+	for (size_t t = 0; t < 4; t++)
+	{
+		DDSImage image;
+		if (!image.Load(paths[t], error))
+		{
+			return false;
+		}
+		if (!image.DecodeMip(0, textures[t]))
+		{
+			return Fail(error, std::string("Can't decode ") + DDSImage::GetFormatName(image.format) + ": " + paths[t]);
+		}
+		if (t == 0)
+		{
+			width = image.width;
+			height = image.height;
+		}
+		else if (image.width != width || image.height != height)
+		{
+			return Fail(error, "Texture size differs from the albedo: " + paths[t]);
+		}
+	}
+
+	//the decoder writes albedo and normal as bgr
+	const size_t texelCount = (size_t)width * height;
+	values.resize(texelCount * NeuralTrainer::TargetChannels);
+	for (size_t texel = 0; texel < texelCount; texel++)
+	{
+		float* value = &values[texel * NeuralTrainer::TargetChannels];
+		for (int c = 0; c < 3; c++)
+		{
+			value[c] = textures[0][texel * 4 + 2 - c];
+			value[3 + c] = textures[1][texel * 4 + 2 - c];
+		}
+		value[6] = textures[2][texel * 4];
+		value[7] = textures[3][texel * 4];
+	}
+	return true;
+}
+
+TrainingTarget TrainingTarget::Crop(uint32_t cropWidth, uint32_t cropHeight) const
+{
+	const size_t C = NeuralTrainer::TargetChannels;
+
+	TrainingTarget crop;
+	crop.width = std::min(cropWidth, width);
+	crop.height = std::min(cropHeight, height);
+	crop.values.resize((size_t)crop.width * crop.height * C);
+	for (uint32_t y = 0; y < crop.height; y++)
+	{
+		const float* row = &values[(size_t)y * width * C];
+		std::copy(row, row + crop.width * C, crop.values.begin() + (size_t)y * crop.width * C);
+	}
+	return crop;
+}
+
+TrainingTarget TrainingTarget::Downsample(uint32_t factor) const
+{
+	const size_t C = NeuralTrainer::TargetChannels;
+	factor = std::max(factor, 1u);
+
+	TrainingTarget small;
+	small.width = std::max(width / factor, 1u);
+	small.height = std::max(height / factor, 1u);
+	small.values.assign((size_t)small.width * small.height * C, 0.0f);
+	const float weight = 1.0f / ((float)factor * factor);
+	for (uint32_t y = 0; y < small.height; y++)
+	{
+		for (uint32_t x = 0; x < small.width; x++)
+		{
+			float* value = &small.values[((size_t)y * small.width + x) * C];
+			for (uint32_t dy = 0; dy < factor; dy++)
+			{
+				for (uint32_t dx = 0; dx < factor; dx++)
+				{
+					const uint32_t sx = std::min(x * factor + dx, width - 1);
+					const uint32_t sy = std::min(y * factor + dy, height - 1);
+					const float* source = &values[((size_t)sy * width + sx) * C];
+					for (size_t c = 0; c < C; c++)
+					{
+						value[c] += weight * source[c];
+					}
+				}
+			}
+		}
+	}
+	return small;
+}
+
+const char* GetDecoderNumberFormatName(DecoderNumberFormat format)
+{
+	switch (format)
+	{
+	case DecoderNumberFormat::Float32: return "fp32";
+	case DecoderNumberFormat::Float16: return "fp16";
+	case DecoderNumberFormat::Int8: return "int8";
+	default: return "unknown";
+	}
+}
+
+static float RoundToHalf(float value)
+{
+	return BCDecoder::HalfToFloat(BCDecoder::FloatToHalf(value));
+}
+
+static float RoundToInt8(float value, float scale)
+{
+	if (scale <= 0.0f)
+	{
+		return 0.0f;
+	}
+	return std::clamp(std::nearbyint(value / scale), -Int8Max, Int8Max) * scale;
+}
+
+void NeuralTrainer::Parameters::Resize(size_t count)
+{
+	values.assign(count, 0.0f);
+	m.assign(count, 0.0f);
+	v.assign(count, 0.0f);
+}
+
+NeuralTrainer::NeuralTrainer(const TrainingTarget& inTarget, const TrainerSettings& inSettings)
+	: target(inTarget)
+	, settings(inSettings)
+{
+	threadPool = std::make_unique<ThreadPool>(settings.threadCount);
+}
+
+NeuralTrainer::~NeuralTrainer() = default;
+
+void NeuralTrainer::SetLayout(const std::vector<int32_t>& inLayerSizes)
+{
+	layerSizes = inLayerSizes;
+	weightOffsets.clear();
+	biasOffsets.clear();
+	maxLayerSize = 0;
+
+	size_t weightCount = 0;
+	size_t biasCount = 0;
+	for (size_t i = 0; i + 1 < layerSizes.size(); i++)
+	{
+		weightOffsets.push_back(weightCount);
+		biasOffsets.push_back(biasCount);
+		weightCount += (size_t)layerSizes[i] * layerSizes[i + 1];
+		biasCount += layerSizes[i + 1];
+	}
+	for (int32_t size : layerSizes)
+	{
+		maxLayerSize = std::max(maxLayerSize, (int)size);
+	}
+
+	weights.Resize(weightCount);
+	biases.Resize(biasCount);
+}
+
+bool NeuralTrainer::IsLinearLayer(size_t layer) const
+{
+	return std::find(linearLayers.begin(), linearLayers.end(), (int32_t)layer) != linearLayers.end();
+}
+
+void NeuralTrainer::CreateGrids()
+{
+	gridTexelOffsets.clear();
+	uint32_t texelCount = 0;
+	for (const FeatureGrid& grid : grids)
+	{
+		gridTexelOffsets.push_back(texelCount);
+		texelCount += grid.width * grid.height;
+	}
+
+	gridM.assign((size_t)texelCount * GridChannels, 0.0f);
+	gridV.assign((size_t)texelCount * GridChannels, 0.0f);
+	gridGradients.assign((size_t)texelCount * GridChannels, 0.0f);
+	gridTouchedSteps.assign(texelCount, 0);
+}
+
+void NeuralTrainer::Initialize()
+{
+	std::vector<int32_t> sizes = { InputCount };
+	sizes.insert(sizes.end(), settings.hiddenLayers.begin(), settings.hiddenLayers.end());
+	sizes.push_back(TargetChannels);
+	linearLayers.clear();
+	SetLayout(sizes);
+
+	std::mt19937 random(settings.seed);
+
+	//He uniform for the ReLU layers, Glorot uniform for the sigmoid output, biases start at 0
+	for (size_t layer = 0; layer + 1 < layerSizes.size(); layer++)
+	{
+		const int in = layerSizes[layer];
+		const int out = layerSizes[layer + 1];
+		const bool bLastLayer = layer + 2 == layerSizes.size();
+		const float bound = std::sqrt(6.0f / (bLastLayer ? (float)(in + out) : (float)in));
+		std::uniform_real_distribution<float> distribution(-bound, bound);
+		float* layerWeights = weights.values.data() + weightOffsets[layer];
+		for (size_t i = 0; i < (size_t)in * out; i++)
+		{
+			layerWeights[i] = distribution(random);
+		}
+	}
+
+	InitializeGrids(random);
+	RoundWeights();
+	CalibrateActivations();
+}
+
+bool NeuralTrainer::Initialize(const NeuralModel& decoder, std::string* error)
+{
+	if (decoder.layer_sizes.size() < 2 || decoder.layer_sizes.front() != InputCount || decoder.layer_sizes.back() != TargetChannels)
+	{
+		return Fail(error, "Decoder doesn't map 14 inputs to 8 outputs");
+	}
+
+	SetLayout(decoder.layer_sizes);
+	if (decoder.weights.size() != weights.values.size() || decoder.bias.size() != biases.values.size())
+	{
+		return Fail(error, "Decoder weights don't match its layer sizes");
+	}
+	weights.values = decoder.weights;
+	biases.values = decoder.bias;
+	linearLayers = decoder.linear_layers;
+
+	std::mt19937 random(settings.seed);
+	InitializeGrids(random);
+	RoundWeights();
+	CalibrateActivations();
+	return true;
+}
+
+bool NeuralTrainer::Initialize(const NeuralModel& decoder, const std::vector<FeatureGrid>& startGrids, std::string* error)
+{
+	if (startGrids.size() != GridCount)
+	{
+		return Fail(error, "A neural material has four feature grids");
+	}
+	for (const FeatureGrid& grid : startGrids)
+	{
+		if (grid.width == 0 || grid.height == 0 || grid.values.size() != (size_t)grid.width * grid.height * GridChannels)
+		{
+			return Fail(error, "Feature grid values don't match its size");
+		}
+	}
+	if (!Initialize(decoder, error))
+	{
+		return false;
+	}
+
+	grids = startGrids;
+	CreateGrids();
+	CalibrateActivations();
+	return true;
+}
+
+void NeuralTrainer::InitializeGrids(std::mt19937& random)
+{
+	std::uniform_real_distribution<float> gridDistribution(0.5f - InitialGridRange, 0.5f + InitialGridRange);
+	grids.assign(GridCount, FeatureGrid());
+	for (int g = 0; g < GridCount; g++)
+	{
+		FeatureGrid& grid = grids[g];
+		grid.width = std::max((target.width / std::max(settings.gridDivisor, 1u)) >> g, 1u);
+		grid.height = std::max((target.height / std::max(settings.gridDivisor, 1u)) >> g, 1u);
+		grid.values.resize((size_t)grid.width * grid.height * GridChannels);
+		for (float& value : grid.values)
+		{
+			value = gridDistribution(random);
+		}
+	}
+	CreateGrids();
+
+	epoch = 0;
+	step = 0;
+	history.clear();
+}
+
+NeuralModelPtr NeuralTrainer::CreateModel() const
+{
+	auto model = std::make_shared<NeuralModel>();
+	model->layer_sizes = layerSizes;
+	model->weights = roundedWeights;
+	model->bias = roundedBiases;
+	model->linear_layers = linearLayers;
+	return model;
+}
+
+void NeuralTrainer::RoundWeights()
+{
+	roundedWeights = weights.values;
+	roundedBiases = biases.values;
+	if (settings.weightFormat == DecoderNumberFormat::Float16)
+	{
+		for (float& value : roundedWeights)
+		{
+			value = RoundToHalf(value);
+		}
+		for (float& value : roundedBiases)
+		{
+			value = RoundToHalf(value);
+		}
+	}
+	else if (settings.weightFormat == DecoderNumberFormat::Int8)
+	{
+		//biases stay as they are, an int8 kernel adds them to its 32 bit sums
+		for (size_t layer = 0; layer + 1 < layerSizes.size(); layer++)
+		{
+			const int in = layerSizes[layer];
+			const int out = layerSizes[layer + 1];
+			for (int o = 0; o < out; o++)
+			{
+				float* row = roundedWeights.data() + weightOffsets[layer] + (size_t)o * in;
+				float largest = 0.0f;
+				for (int i = 0; i < in; i++)
+				{
+					largest = std::max(largest, std::abs(row[i]));
+				}
+				for (int i = 0; i < in; i++)
+				{
+					row[i] = RoundToInt8(row[i], largest / Int8Max);
+				}
+			}
+		}
+	}
+}
+
+void NeuralTrainer::CalibrateActivations()
+{
+	activationScales.clear();
+	if (settings.activationFormat != DecoderNumberFormat::Int8)
+	{
+		return;
+	}
+
+	PROFILE_ZONE("NeuralTrainer::CalibrateActivations");
+
+	//the same texels every time, the scales only follow the weights and grids
+	const size_t texelCount = (size_t)target.width * target.height;
+	std::vector<uint32_t> texels(std::min(CalibrationTexelCount, texelCount));
+	std::mt19937_64 random(settings.seed);
+	std::uniform_int_distribution<uint32_t> distribution(0, (uint32_t)texelCount - 1);
+	for (uint32_t& texel : texels)
+	{
+		texel = distribution(random);
+	}
+
+	//a maximum per shard, the largest of them doesn't depend on the order the shards ran in
+	const size_t layerCount = layerSizes.size() - 1;
+	const uint32_t shardCount = (uint32_t)((texels.size() + ShardSize - 1) / ShardSize);
+	std::vector<float> maxima((size_t)shardCount * layerCount, 0.0f);
+	threadPool->ParallelFor(shardCount, [&](uint32_t index, uint32_t)
+		{
+			const size_t first = (size_t)index * ShardSize;
+			const size_t count = std::min(ShardSize, texels.size() - first);
+			RunTexels(grids, texels.data() + first, count, 0.0f, nullptr, nullptr, maxima.data() + (size_t)index * layerCount);
+		});
+
+	activationScales.assign(layerCount, 0.0f);
+	for (uint32_t index = 0; index < shardCount; index++)
+	{
+		for (size_t layer = 0; layer < layerCount; layer++)
+		{
+			activationScales[layer] = std::max(activationScales[layer], maxima[(size_t)index * layerCount + layer] / Int8Max);
+		}
+	}
+}
+
+void NeuralTrainer::RoundActivations(float* values, size_t layer, float* activationMaxima) const
+{
+	const size_t count = (size_t)layerSizes[layer] * BlockSize;
+	if (activationMaxima)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			activationMaxima[layer] = std::max(activationMaxima[layer], std::abs(values[i]));
+		}
+	}
+
+	if (settings.activationFormat == DecoderNumberFormat::Float16)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			values[i] = RoundToHalf(values[i]);
+		}
+	}
+	else if (settings.activationFormat == DecoderNumberFormat::Int8 && !activationScales.empty())
+	{
+		const float scale = activationScales[layer];
+		for (size_t i = 0; i < count; i++)
+		{
+			values[i] = RoundToInt8(values[i], scale);
+		}
+	}
+}
+
+void NeuralTrainer::RunTexels(const std::vector<FeatureGrid>& sourceGrids, const uint32_t* texels, size_t count, float gradientScale,
+	Shard* shard, float* outputs, float* activationMaxima) const
+{
+	const size_t B = BlockSize;
+	const size_t layerCount = layerSizes.size() - 1;
+	const int gridInputCount = GridCount * GridChannels;
+
+	//activations of every layer for one block, channel major: channel c of pixel p at c * B + p
+	std::vector<size_t> activationOffsets(layerSizes.size());
+	size_t activationCount = 0;
+	for (size_t layer = 0; layer < layerSizes.size(); layer++)
+	{
+		activationOffsets[layer] = activationCount;
+		activationCount += (size_t)layerSizes[layer] * B;
+	}
+	std::vector<float> activations(activationCount);
+	std::vector<float> delta((size_t)maxLayerSize * B);
+	std::vector<float> inputDelta((size_t)maxLayerSize * B);
+	//layer inputs pixel major, the weight gradient loop runs over contiguous inputs
+	std::vector<float> transposed((size_t)maxLayerSize * B);
+	BilinearTaps taps[GridCount][BlockSize];
+
+	for (size_t begin = 0; begin < count; begin += B)
+	{
+		const size_t pixelCount = std::min(B, count - begin);
+
+		//sample the grids, a partial last block is padded with zeros
+		float* input = activations.data();
+		for (size_t p = 0; p < B; p++)
+		{
+			if (p >= pixelCount)
+			{
+				for (int i = 0; i < InputCount; i++)
+				{
+					input[i * B + p] = 0.0f;
+				}
+				continue;
+			}
+
+			const uint32_t texel = texels[begin + p];
+			const float u = ((texel % target.width) + 0.5f) / target.width;
+			const float v = ((texel / target.width) + 0.5f) / target.height;
+			for (int g = 0; g < GridCount; g++)
+			{
+				const FeatureGrid& grid = sourceGrids[g];
+				BilinearTaps& tap = taps[g][p];
+				GetBilinearTaps(grid.width, grid.height, u, v, tap);
+				for (int c = 0; c < GridChannels; c++)
+				{
+					float sum = 0.0f;
+					for (int k = 0; k < 4; k++)
+					{
+						sum += tap.weights[k] * grid.values[(size_t)tap.texels[k] * GridChannels + c];
+					}
+					input[(g * GridChannels + c) * B + p] = sum;
+				}
+			}
+			input[gridInputCount * B + p] = u;
+			input[(gridInputCount + 1) * B + p] = v;
+		}
+		//the rounded values go on through the backward pass too, their gradient is taken as that of the float ones
+		RoundActivations(input, 0, activationMaxima);
+
+		for (size_t layer = 0; layer < layerCount; layer++)
+		{
+			const int in = layerSizes[layer];
+			const int out = layerSizes[layer + 1];
+			const float* layerWeights = roundedWeights.data() + weightOffsets[layer];
+			const float* layerBiases = roundedBiases.data() + biasOffsets[layer];
+			const float* x = activations.data() + activationOffsets[layer];
+			float* y = activations.data() + activationOffsets[layer + 1];
+			const bool bLastLayer = layer + 1 == layerCount;
+			const bool bLinear = IsLinearLayer(layer);
+
+			for (int o = 0; o < out; o++)
+			{
+				const float* row = layerWeights + (size_t)o * in;
+				float sum[BlockSize];
+				for (size_t p = 0; p < B; p++)
+				{
+					sum[p] = layerBiases[o];
+				}
+				for (int i = 0; i < in; i++)
+				{
+					const float weight = row[i];
+					const float* xi = x + (size_t)i * B;
+					for (size_t p = 0; p < B; p++)
+					{
+						sum[p] += weight * xi[p];
+					}
+				}
+
+				float* yo = y + (size_t)o * B;
+				for (size_t p = 0; p < B; p++)
+				{
+					if (bLastLayer)
+					{
+						yo[p] = 1.0f / (1.0f + std::exp(-sum[p]));
+					}
+					else
+					{
+						yo[p] = sum[p] > 0.0f || bLinear ? sum[p] : 0.0f;
+					}
+				}
+			}
+			if (!bLastLayer)
+			{
+				RoundActivations(y, layer + 1, activationMaxima);
+			}
+		}
+
+		const float* decoded = activations.data() + activationOffsets[layerCount];
+		if (outputs)
+		{
+			for (size_t p = 0; p < pixelCount; p++)
+			{
+				for (int o = 0; o < TargetChannels; o++)
+				{
+					outputs[(begin + p) * TargetChannels + o] = decoded[o * B + p];
+				}
+			}
+		}
+		if (!shard)
+		{
+			continue;
+		}
+
+		//mean squared error through the sigmoid
+		for (int o = 0; o < TargetChannels; o++)
+		{
+			for (size_t p = 0; p < B; p++)
+			{
+				float d = 0.0f;
+				if (p < pixelCount)
+				{
+					const float y = decoded[o * B + p];
+					const float difference = y - target.values[(size_t)texels[begin + p] * TargetChannels + o];
+					shard->squaredError += difference * difference;
+					d = gradientScale * difference * y * (1.0f - y);
+				}
+				delta[o * B + p] = d;
+			}
+		}
+
+		for (size_t layer = layerCount; layer-- > 0;)
+		{
+			const int in = layerSizes[layer];
+			const int out = layerSizes[layer + 1];
+			const float* layerWeights = roundedWeights.data() + weightOffsets[layer];
+			const float* x = activations.data() + activationOffsets[layer];
+
+			//a frozen decoder only passes the delta on to the grids
+			if (settings.bTrainDecoder)
+			{
+				float* weightGradients = shard->weightGradients.data() + weightOffsets[layer];
+				float* biasGradients = shard->biasGradients.data() + biasOffsets[layer];
+
+				for (int i = 0; i < in; i++)
+				{
+					for (size_t p = 0; p < B; p++)
+					{
+						transposed[p * in + i] = x[i * B + p];
+					}
+				}
+
+				for (int o = 0; o < out; o++)
+				{
+					float* row = weightGradients + (size_t)o * in;
+					for (size_t p = 0; p < pixelCount; p++)
+					{
+						const float d = delta[o * B + p];
+						//most of a ReLU layer's deltas are 0
+						if (d == 0.0f)
+						{
+							continue;
+						}
+						biasGradients[o] += d;
+						const float* xp = transposed.data() + p * in;
+						for (int i = 0; i < in; i++)
+						{
+							row[i] += d * xp[i];
+						}
+					}
+				}
+			}
+
+			//the first layer only passes its delta on to the grid features, uv are fixed
+			const int needed = layer == 0 ? gridInputCount : in;
+			std::fill(inputDelta.begin(), inputDelta.begin() + (size_t)needed * B, 0.0f);
+			for (int o = 0; o < out; o++)
+			{
+				const float* row = layerWeights + (size_t)o * in;
+				const float* d = delta.data() + (size_t)o * B;
+				for (int i = 0; i < needed; i++)
+				{
+					const float weight = row[i];
+					float* di = inputDelta.data() + (size_t)i * B;
+					for (size_t p = 0; p < B; p++)
+					{
+						di[p] += weight * d[p];
+					}
+				}
+			}
+
+			//through the ReLU of the layer before, its output was 0 where it was cut
+			if (layer > 0 && !IsLinearLayer(layer - 1))
+			{
+				for (size_t i = 0; i < (size_t)needed * B; i++)
+				{
+					inputDelta[i] = x[i] > 0.0f ? inputDelta[i] : 0.0f;
+				}
+			}
+			std::swap(delta, inputDelta);
+		}
+
+		//delta now holds the gradient of the sampled features, spread over the texels the samples read
+		for (size_t p = 0; p < pixelCount; p++)
+		{
+			for (int g = 0; g < GridCount; g++)
+			{
+				const BilinearTaps& tap = taps[g][p];
+				for (int k = 0; k < 4; k++)
+				{
+					GridGradient gradient;
+					gradient.texel = gridTexelOffsets[g] + tap.texels[k];
+					for (int c = 0; c < GridChannels; c++)
+					{
+						gradient.gradient[c] = tap.weights[k] * delta[(g * GridChannels + c) * B + p];
+					}
+					shard->gridGradients.push_back(gradient);
+				}
+			}
+		}
+	}
+}
+
+static void AdamUpdate(float* values, float* m, float* v, const float* gradients, size_t count, float stepSize)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		const float g = gradients[i];
+		m[i] = AdamBeta1 * m[i] + (1.0f - AdamBeta1) * g;
+		v[i] = AdamBeta2 * v[i] + (1.0f - AdamBeta2) * g * g;
+		values[i] -= stepSize * m[i] / (std::sqrt(v[i]) + AdamEpsilon);
+	}
+}
+
+void NeuralTrainer::Step(const std::vector<uint32_t>& texels, float learningRateScale, double& outSquaredError)
+{
+	const uint32_t shardCount = (uint32_t)((texels.size() + ShardSize - 1) / ShardSize);
+	if (shards.size() < shardCount)
+	{
+		shards.resize(shardCount);
+	}
+
+	//mean over the batch and the channels, d/dy of (y - t)^2 is 2 (y - t)
+	const float gradientScale = 2.0f / (float)(texels.size() * TargetChannels);
+	{
+		PROFILE_ZONE("NeuralTrainer::Backward");
+		threadPool->ParallelFor(shardCount, [&](uint32_t index, uint32_t)
+			{
+				Shard& shard = shards[index];
+				if (settings.bTrainDecoder)
+				{
+					shard.weightGradients.assign(weights.values.size(), 0.0f);
+					shard.biasGradients.assign(biases.values.size(), 0.0f);
+				}
+				shard.gridGradients.clear();
+				shard.squaredError = 0.0;
+
+				const size_t first = (size_t)index * ShardSize;
+				const size_t count = std::min(ShardSize, texels.size() - first);
+				RunTexels(grids, texels.data() + first, count, gradientScale, &shard, nullptr);
+			});
+	}
+
+	PROFILE_ZONE("NeuralTrainer::Update");
+	step++;
+
+	//bias corrected step sizes
+	const float correction = std::sqrt(1.0f - std::pow(AdamBeta2, (float)step)) / (1.0f - std::pow(AdamBeta1, (float)step));
+
+	if (settings.bTrainDecoder)
+	{
+		Shard& total = shards[0];
+		for (uint32_t index = 1; index < shardCount; index++)
+		{
+			const Shard& shard = shards[index];
+			for (size_t i = 0; i < total.weightGradients.size(); i++)
+			{
+				total.weightGradients[i] += shard.weightGradients[i];
+			}
+			for (size_t i = 0; i < total.biasGradients.size(); i++)
+			{
+				total.biasGradients[i] += shard.biasGradients[i];
+			}
+		}
+
+		const float stepSize = settings.learningRate * learningRateScale * correction;
+		AdamUpdate(weights.values.data(), weights.m.data(), weights.v.data(), total.weightGradients.data(), weights.values.size(), stepSize);
+		AdamUpdate(biases.values.data(), biases.m.data(), biases.v.data(), total.biasGradients.data(), biases.values.size(), stepSize);
+		RoundWeights();
+	}
+
+	//texels no sample read keep their values and moments
+	touchedTexels.clear();
+	outSquaredError = 0.0;
+	for (uint32_t index = 0; index < shardCount; index++)
+	{
+		const Shard& shard = shards[index];
+		outSquaredError += shard.squaredError;
+		for (const GridGradient& gradient : shard.gridGradients)
+		{
+			float* sum = &gridGradients[(size_t)gradient.texel * GridChannels];
+			if (gridTouchedSteps[gradient.texel] != step)
+			{
+				gridTouchedSteps[gradient.texel] = step;
+				touchedTexels.push_back(gradient.texel);
+				std::fill(sum, sum + GridChannels, 0.0f);
+			}
+			for (int c = 0; c < GridChannels; c++)
+			{
+				sum[c] += gradient.gradient[c];
+			}
+		}
+	}
+
+	const float gridStepSize = settings.gridLearningRate * learningRateScale * correction;
+	const size_t chunkSize = 4096;
+	const uint32_t chunkCount = (uint32_t)((touchedTexels.size() + chunkSize - 1) / chunkSize);
+	threadPool->ParallelFor(chunkCount, [&](uint32_t chunk, uint32_t)
+		{
+			const size_t end = std::min(touchedTexels.size(), (chunk + 1) * chunkSize);
+			for (size_t t = chunk * chunkSize; t < end; t++)
+			{
+				const uint32_t texel = touchedTexels[t];
+				int g = GridCount - 1;
+				while (texel < gridTexelOffsets[g])
+				{
+					g--;
+				}
+				const size_t local = (size_t)(texel - gridTexelOffsets[g]) * GridChannels;
+				const size_t global = (size_t)texel * GridChannels;
+				float* values = grids[g].values.data() + local;
+				AdamUpdate(values, gridM.data() + global, gridV.data() + global, gridGradients.data() + global, GridChannels, gridStepSize);
+				for (int c = 0; c < GridChannels; c++)
+				{
+					values[c] = std::clamp(values[c], GridMin, GridMax);
+				}
+			}
+		});
+}
+
+TrainingEpoch NeuralTrainer::TrainEpoch()
+{
+	PROFILE_ZONE("NeuralTrainer::TrainEpoch");
+
+	const size_t texelCount = (size_t)target.width * target.height;
+	const size_t batchSize = std::min<size_t>(std::max(settings.batchSize, 1u), texelCount);
+	const size_t stepCount = (texelCount + batchSize - 1) / batchSize;
+	const float pi = 3.14159265359f;
+
+	TrainingEpoch result;
+	result.epoch = epoch;
+	//the grids go through BC6H before every epoch, what the epoch learns starts from values the dds can hold
+	//and the steps between two encodes are short enough for the next one to keep most of them
+	if (settings.bQuantizeGrids)
+	{
+		PROFILE_ZONE("NeuralTrainer::QuantizeGrids");
+		for (FeatureGrid& grid : grids)
+		{
+			FeatureGrid quantized;
+			grid.Quantize(*threadPool, quantized);
+			grid.values = std::move(quantized.values);
+		}
+	}
+	CalibrateActivations();
+
+	std::vector<uint32_t> texels(batchSize);
+	double squaredError = 0.0;
+	for (size_t s = 0; s < stepCount; s++)
+	{
+		//cosine from 1 down to the final scale over the whole run
+		const float progress = std::min(((float)epoch + (float)s / stepCount) / std::max(settings.epochs, 1u), 1.0f);
+		const float scale = settings.finalLearningRateScale + (1.0f - settings.finalLearningRateScale) * 0.5f * (1.0f + std::cos(pi * progress));
+		if (s == 0)
+		{
+			result.learningRate = settings.learningRate * scale;
+		}
+
+		//drawn from the step so a resumed run sees the same batches
+		std::mt19937_64 random(settings.seed * 0x9E3779B97F4A7C15ull + step);
+		std::uniform_int_distribution<uint32_t> distribution(0, (uint32_t)texelCount - 1);
+		for (uint32_t& texel : texels)
+		{
+			texel = distribution(random);
+		}
+
+		double stepError = 0.0;
+		Step(texels, scale, stepError);
+		squaredError += stepError;
+	}
+
+	result.loss = squaredError / ((double)stepCount * batchSize * TargetChannels);
+	result.psnr = ImageMetrics::PSNR(result.loss);
+	history.push_back(result);
+	epoch++;
+	//scales for the weights the epoch ended with, what Evaluate and the next epoch see
+	CalibrateActivations();
+	return result;
+}
+
+double NeuralTrainer::Evaluate(const std::vector<FeatureGrid>& evaluatedGrids, std::vector<float>* outImage)
+{
+	PROFILE_ZONE("NeuralTrainer::Evaluate");
+
+	const size_t texelCount = (size_t)target.width * target.height;
+	std::vector<float> image;
+	std::vector<float>& decoded = outImage ? *outImage : image;
+	decoded.resize(texelCount * TargetChannels);
+
+	const size_t chunkSize = 4096;
+	const uint32_t chunkCount = (uint32_t)((texelCount + chunkSize - 1) / chunkSize);
+	threadPool->ParallelFor(chunkCount, [&](uint32_t chunk, uint32_t)
+		{
+			const size_t first = (size_t)chunk * chunkSize;
+			const size_t count = std::min(chunkSize, texelCount - first);
+			std::vector<uint32_t> texels(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				texels[i] = (uint32_t)(first + i);
+			}
+			RunTexels(evaluatedGrids, texels.data(), count, 0.0f, nullptr, decoded.data() + first * TargetChannels);
+		});
+
+	return ImageMetrics::MeanSquaredError(decoded.data(), target.values.data(), texelCount, TargetChannels, 0, TargetChannels);
+}
+
+static const char CheckpointMagic[4] = { 'N', 'T', 'C', 'K' };
+static const uint32_t CheckpointVersion = 1;
+
+template<typename T>
+static void WriteValue(std::ofstream& file, const T& value)
+{
+	file.write((const char*)&value, sizeof(T));
+}
+
+template<typename T>
+static void ReadValue(std::ifstream& file, T& value)
+{
+	file.read((char*)&value, sizeof(T));
+}
+
+template<typename T>
+static void WriteArray(std::ofstream& file, const std::vector<T>& values)
+{
+	uint64_t count = values.size();
+	WriteValue(file, count);
+	file.write((const char*)values.data(), sizeof(T) * values.size());
+}
+
+template<typename T>
+static bool ReadArray(std::ifstream& file, std::vector<T>& values, size_t expectedCount)
+{
+	uint64_t count = 0;
+	ReadValue(file, count);
+	if (!file || count != expectedCount)
+	{
+		return false;
+	}
+	values.resize(count);
+	file.read((char*)values.data(), sizeof(T) * values.size());
+	return (bool)file;
+}
+
+bool NeuralTrainer::SaveCheckpoint(const std::string& path, std::string* error) const
+{
+	PROFILE_ZONE("NeuralTrainer::SaveCheckpoint");
+
+	//written next to the old one and renamed, a crash while writing keeps the last good checkpoint
+	const std::string temporaryPath = path + ".tmp";
+	{
+		std::ofstream file(temporaryPath, std::ios::binary);
+		if (!file)
+		{
+			return Fail(error, "Can't write " + temporaryPath);
+		}
+
+		file.write(CheckpointMagic, sizeof(CheckpointMagic));
+		WriteValue(file, CheckpointVersion);
+		WriteValue(file, epoch);
+		WriteValue(file, step);
+		WriteArray(file, layerSizes);
+		WriteArray(file, linearLayers);
+		for (const Parameters* parameters : { &weights, &biases })
+		{
+			WriteArray(file, parameters->values);
+			WriteArray(file, parameters->m);
+			WriteArray(file, parameters->v);
+		}
+
+		WriteValue(file, (uint32_t)grids.size());
+		for (const FeatureGrid& grid : grids)
+		{
+			WriteValue(file, grid.width);
+			WriteValue(file, grid.height);
+			WriteArray(file, grid.values);
+		}
+		WriteArray(file, gridM);
+		WriteArray(file, gridV);
+
+		WriteValue(file, (uint32_t)history.size());
+		for (const TrainingEpoch& row : history)
+		{
+			WriteValue(file, row.epoch);
+			WriteValue(file, row.loss);
+			WriteValue(file, row.psnr);
+			WriteValue(file, row.learningRate);
+		}
+		if (!file)
+		{
+			return Fail(error, "Can't write " + temporaryPath);
+		}
+	}
+
+	std::error_code renameError;
+	std::filesystem::rename(temporaryPath, path, renameError);
+	if (renameError)
+	{
+		return Fail(error, "Can't replace " + path + ": " + renameError.message());
+	}
+	return true;
+}
+
+bool NeuralTrainer::LoadCheckpoint(const std::string& path, std::string* error)
+{
+	PROFILE_ZONE("NeuralTrainer::LoadCheckpoint");
+
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return Fail(error, "Checkpoint not found: " + path);
+	}
+
+	char magic[4] = {};
+	uint32_t version = 0;
+	file.read(magic, sizeof(magic));
+	ReadValue(file, version);
+	if (memcmp(magic, CheckpointMagic, sizeof(magic)) != 0 || version != CheckpointVersion)
+	{
+		return Fail(error, "Not a trainer checkpoint: " + path);
+	}
+
+	uint32_t loadedEpoch = 0;
+	uint64_t loadedStep = 0;
+	uint64_t count = 0;
+	ReadValue(file, loadedEpoch);
+	ReadValue(file, loadedStep);
+
+	std::vector<int32_t> loadedLayerSizes;
+	ReadValue(file, count);
+	loadedLayerSizes.resize(file && count < 64 ? count : 0);
+	file.read((char*)loadedLayerSizes.data(), sizeof(int32_t) * loadedLayerSizes.size());
+	if (!file || loadedLayerSizes.size() < 2 || loadedLayerSizes.front() != InputCount || loadedLayerSizes.back() != TargetChannels)
+	{
+		return Fail(error, "Checkpoint decoder doesn't map 14 inputs to 8 outputs: " + path);
+	}
+
+	ReadValue(file, count);
+	linearLayers.resize(file && count < 64 ? count : 0);
+	file.read((char*)linearLayers.data(), sizeof(int32_t) * linearLayers.size());
+
+	SetLayout(loadedLayerSizes);
+	bool bRead = (bool)file;
+	for (Parameters* parameters : { &weights, &biases })
+	{
+		const size_t parameterCount = parameters->values.size();
+		bRead = bRead && ReadArray(file, parameters->values, parameterCount) && ReadArray(file, parameters->m, parameterCount) &&
+			ReadArray(file, parameters->v, parameterCount);
+	}
+
+	uint32_t gridCount = 0;
+	ReadValue(file, gridCount);
+	bRead = bRead && file && gridCount == GridCount;
+	grids.assign(GridCount, FeatureGrid());
+	size_t gridValueCount = 0;
+	for (int g = 0; g < GridCount && bRead; g++)
+	{
+		FeatureGrid& grid = grids[g];
+		ReadValue(file, grid.width);
+		ReadValue(file, grid.height);
+		bRead = file && grid.width > 0 && grid.height > 0 && ReadArray(file, grid.values, (size_t)grid.width * grid.height * GridChannels);
+		gridValueCount += grid.values.size();
+	}
+	if (!bRead)
+	{
+		return Fail(error, "Truncated or mismatched checkpoint: " + path);
+	}
+
+	CreateGrids();
+	if (!ReadArray(file, gridM, gridValueCount) || !ReadArray(file, gridV, gridValueCount))
+	{
+		return Fail(error, "Truncated checkpoint: " + path);
+	}
+
+	uint32_t historyCount = 0;
+	ReadValue(file, historyCount);
+	history.resize(file ? historyCount : 0);
+	for (TrainingEpoch& row : history)
+	{
+		ReadValue(file, row.epoch);
+		ReadValue(file, row.loss);
+		ReadValue(file, row.psnr);
+		ReadValue(file, row.learningRate);
+	}
+	if (!file)
+	{
+		return Fail(error, "Truncated checkpoint: " + path);
+	}
+
+	epoch = loadedEpoch;
+	step = loadedStep;
+	RoundWeights();
+	CalibrateActivations();
+	return true;
+}
+
+bool NeuralTrainer::WriteTrainingCurve(const std::string& path, const std::vector<TrainingEpoch>& rows, std::string* error)
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		return Fail(error, "Can't write " + path);
+	}
+
+	//columns of the trainer's training_curve.csv, SSIM isn't tracked during training
+	file.precision(17);
+	file << "Epoch,Loss,PSNR,SSIM,LearningRate\n";
+	for (const TrainingEpoch& row : rows)
+	{
+		file << row.epoch << "," << row.loss << "," << row.psnr << ",0.0," << row.learningRate << "\n";
+	}
+	return (bool)file;
+}
+
+bool NeuralTrainer::Export(const std::string& directory, std::vector<FeatureGrid>* outCompressedGrids, std::string* error)
+{
+	PROFILE_ZONE("NeuralTrainer::Export");
+
+	std::error_code directoryError;
+	std::filesystem::create_directories(directory, directoryError);
+
+	const std::string modelPath = directory + "/decodermodel.json";
+	NeuralModelPtr model = CreateModel();
+	if (!model->SaveJson(modelPath))
+	{
+		return Fail(error, "Can't write " + modelPath);
+	}
+	//the container LoadModel reads without parsing json
+	const std::string binaryPath = directory + "/decodermodel.bin";
+	if (!model->SaveBinary(binaryPath))
+	{
+		return Fail(error, "Can't write " + binaryPath);
+	}
+
+	if (outCompressedGrids)
+	{
+		outCompressedGrids->assign(GridCount, FeatureGrid());
+	}
+	for (int g = 0; g < GridCount; g++)
+	{
+		DDSImage image;
+		grids[g].Encode(*threadPool, image);
+		if (!image.Save(directory + "/compressed" + std::to_string(g) + ".dds", error))
+		{
+			return false;
+		}
+		if (outCompressedGrids && !(*outCompressedGrids)[g].LoadFromImage(image, error))
+		{
+			return false;
+		}
+	}
+
+	return WriteTrainingCurve(directory + "/training_curve.csv", history, error);
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "NeuralModel.h"
+
+class DDSImage;
+class ThreadPool;
+
+// Texel grid of features, what one compressed*.dds holds before block compression
+struct FeatureGrid
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	//rgb per texel, row major
+	std::vector<float> values;
+
+	//top mip of a feature grid dds
+	bool Load(const std::string& path, std::string* error = nullptr);
+
+	//BC6H_SF16 with every mip down to 1x1, blocks are encoded on the pool
+	void Encode(ThreadPool& threadPool, DDSImage& outImage) const;
+
+	//the top mip after a BC6H_SF16 round trip, what Encode and LoadFromImage give without the dds
+	void Quantize(ThreadPool& threadPool, FeatureGrid& outGrid) const;
+
+	//the values the viewer samples once the grid went through BC6H
+	bool LoadFromImage(const DDSImage& image, std::string* error = nullptr);
+};
+
+// Material inputs the trainer fits, at the texels of the source textures
+struct TrainingTarget
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	//8 values per texel in the order the decoder writes them: albedo bgr, normal bgr, ao, roughness
+	std::vector<float> values;
+
+	//albedo, normal, ao and roughness dds files of the same size, the textures of a conventional material
+	bool Load(const std::vector<std::string>& paths, std::string* error = nullptr);
+
+	//top left width x height texels, a small target for quick runs
+	TrainingTarget Crop(uint32_t cropWidth, uint32_t cropHeight) const;
+
+	//every factor x factor texels box filtered into one, a small target that still covers the whole of uv
+	TrainingTarget Downsample(uint32_t factor) const;
+};
+
+// Number formats a deployed decoder can compute in
+enum class DecoderNumberFormat
+{
+	Float32,
+	//half floats, round to nearest even
+	Float16,
+	//symmetric 8 bit integers, a scale per output row of the weights and per layer of the activations
+	Int8,
+	Count
+};
+
+const char* GetDecoderNumberFormatName(DecoderNumberFormat format);
+
+struct TrainerSettings
+{
+	//hidden layer widths of a new decoder
+	std::vector<int32_t> hiddenLayers = { 64, 64 };
+	//grid 0 is the target size divided by this, every further grid half the one before
+	uint32_t gridDivisor = 1;
+
+	uint32_t epochs = 50;
+	//texels per optimizer step
+	uint32_t batchSize = 16384;
+	//Adam step sizes of the decoder and the grids, decayed along a cosine to finalLearningRateScale of them
+	float learningRate = 1e-3f;
+	float gridLearningRate = 1e-2f;
+	float finalLearningRateScale = 0.1f;
+
+	//false keeps the decoder as it is and fits only the grids, encoding a new material for a trained decoder
+	bool bTrainDecoder = true;
+	//fits the grids to what BC6H holds rather than to their float values, every epoch starts from the grids
+	//after a BC6H round trip. Costs an encode of the grids per epoch
+	bool bQuantizeGrids = false;
+
+	//formats the deployed decoder computes in. The forward pass rounds the weights and every layer input to them
+	//and the gradients pass straight through to the float weights, so training learns weights that keep their
+	//quality once rounded. The exported decoder holds the rounded weights
+	DecoderNumberFormat weightFormat = DecoderNumberFormat::Float32;
+	DecoderNumberFormat activationFormat = DecoderNumberFormat::Float32;
+
+	uint32_t seed = 1;
+	//0 uses every hardware thread
+	uint32_t threadCount = 0;
+};
+
+// One row of training_curve.csv
+struct TrainingEpoch
+{
+	uint32_t epoch = 0;
+	//mean squared error over the texels the epoch trained on
+	double loss = 0.0;
+	double psnr = 0.0;
+	float learningRate = 0.0f;
+};
+
+// Fits the four feature grids and the decoder of a neural material to its source textures on the cpu, with Adam
+// on mini-batches of random texels. A batch is split into fixed shards the thread pool runs, forward and backward
+// passes go over blocks of pixels channel major so the inner loops vectorize like the batched decoder kernel.
+// Shards are reduced in order and batches are drawn from the step number, so a run gives the same weights for
+// any thread count and a run resumed from a checkpoint continues exactly.
+// With bTrainDecoder off an existing decoder stays frozen and only the grids of a new material are fitted.
+class NeuralTrainer
+{
+public:
+	static const int GridCount = 4;
+	static const int GridChannels = 3;
+	static const int TargetChannels = 8;
+	//feature grids plus uv
+	static const int InputCount = GridCount * GridChannels + 2;
+
+	//target must outlive the trainer
+	NeuralTrainer(const TrainingTarget& inTarget, const TrainerSettings& inSettings);
+	~NeuralTrainer();
+
+	//random decoder and grids sized for the target, the start of a new run
+	void Initialize();
+
+	//random grids for an existing decoder, the start of encoding a new material with it.
+	//Fails when the decoder doesn't take the 14 inputs or give the 8 outputs of a neural material
+	bool Initialize(const NeuralModel& decoder, std::string* error = nullptr);
+
+	//the decoder and grids of an existing material, the start of fine-tuning it.
+	//Fails like the decoder only overload or when there aren't four grids
+	bool Initialize(const NeuralModel& decoder, const std::vector<FeatureGrid>& startGrids, std::string* error = nullptr);
+
+	//as many random texels as the target has, in steps of the batch size
+	TrainingEpoch TrainEpoch();
+
+	bool IsFinished() const { return epoch >= settings.epochs; }
+	uint32_t GetEpoch() const { return epoch; }
+	const std::vector<TrainingEpoch>& GetHistory() const { return history; }
+
+	//decoder with the current weights, rounded to the weight format
+	NeuralModelPtr CreateModel() const;
+	const std::vector<FeatureGrid>& GetGrids() const { return grids; }
+
+	//mean squared error over every texel of the target with the current decoder reading grids, in the formats
+	//of the settings. outImage gets the 8 decoded values per texel when given
+	double Evaluate(const std::vector<FeatureGrid>& evaluatedGrids, std::vector<float>* outImage = nullptr);
+
+	//weights, grids, optimizer state and history
+	bool SaveCheckpoint(const std::string& path, std::string* error = nullptr) const;
+	bool LoadCheckpoint(const std::string& path, std::string* error = nullptr);
+
+	//decodermodel.json, decodermodel.bin, compressed0..3.dds and training_curve.csv into directory.
+	//outCompressedGrids gets the grids as they decode from the dds files when given
+	bool Export(const std::string& directory, std::vector<FeatureGrid>* outCompressedGrids = nullptr, std::string* error = nullptr);
+
+	static bool WriteTrainingCurve(const std::string& path, const std::vector<TrainingEpoch>& history, std::string* error = nullptr);
+
+private:
+	struct Parameters
+	{
+		std::vector<float> values;
+		//Adam moments
+		std::vector<float> m;
+		std::vector<float> v;
+
+		void Resize(size_t count);
+	};
+
+	// Gradient of one grid texel from one sample, texel counts over all grids
+	struct GridGradient
+	{
+		uint32_t texel;
+		float gradient[GridChannels];
+	};
+
+	// What one shard of a batch adds up, reduced in shard order
+	struct Shard
+	{
+		std::vector<float> weightGradients;
+		std::vector<float> biasGradients;
+		std::vector<GridGradient> gridGradients;
+		double squaredError = 0.0;
+	};
+
+	void SetLayout(const std::vector<int32_t>& inLayerSizes);
+	bool IsLinearLayer(size_t layer) const;
+	void CreateGrids();
+	void InitializeGrids(std::mt19937& random);
+
+	//forward pass of count texels, backward too when the shard is given. outputs gets 8 values per texel when given,
+	//activationMaxima the largest magnitude of every layer input
+	void RunTexels(const std::vector<FeatureGrid>& sourceGrids, const uint32_t* texels, size_t count, float gradientScale,
+		Shard* shard, float* outputs, float* activationMaxima = nullptr) const;
+
+	//the weights as the weight format holds them, what the passes read
+	void RoundWeights();
+	//int8 scales of the layer inputs from the largest values a fixed sample of texels gives
+	void CalibrateActivations();
+	//a block of layer inputs rounded to the activation format
+	void RoundActivations(float* values, size_t layer, float* activationMaxima) const;
+
+	void Step(const std::vector<uint32_t>& texels, float learningRateScale, double& outSquaredError);
+
+	const TrainingTarget& target;
+	TrainerSettings settings;
+	std::unique_ptr<ThreadPool> threadPool;
+
+	std::vector<int32_t> layerSizes;
+	//layers without a ReLU, as in NeuralModel
+	std::vector<int32_t> linearLayers;
+	std::vector<size_t> weightOffsets;
+	std::vector<size_t> biasOffsets;
+	int maxLayerSize = 0;
+
+	Parameters weights;
+	Parameters biases;
+	//weights and biases rounded to the weight format
+	std::vector<float> roundedWeights;
+	std::vector<float> roundedBiases;
+	//int8 step of every layer input, empty while calibrating
+	std::vector<float> activationScales;
+	std::vector<FeatureGrid> grids;
+	//first texel of every grid when the grids are counted back to back
+	std::vector<uint32_t> gridTexelOffsets;
+	//Adam moments of every grid value, grids back to back
+	std::vector<float> gridM;
+	std::vector<float> gridV;
+
+	uint32_t epoch = 0;
+	uint64_t step = 0;
+	std::vector<TrainingEpoch> history;
+
+	std::vector<Shard> shards;
+	//dense gradient of the grids and the step each texel was last touched in, only touched texels are updated
+	std::vector<float> gridGradients;
+	std::vector<uint64_t> gridTouchedSteps;
+	std::vector<uint32_t> touchedTexels;
+};
@@ -0,0 +1,318 @@
+// Trains a neural material on the cpu, without python or a gpu.
+// The four textures of a conventional material are the target, the feature grids and the decoder are fitted to them
+// and written as decodermodel.json, compressed0..3.dds and training_curve.csv, the files a neural material loads,
+// and decodermodel.bin, the same decoder in the binary container.
+// A checkpoint is written every few epochs, --resume picks a stopped run up where it was.
+// --decoder encodes a new material for a trained decoder: the decoder stays as it is and only the grids are fitted,
+// --bc6h-aware fits them to the values they have after block compression.
+// --fine-tune refines the decoder and grids of a trained material for a few epochs in the formats it is deployed in:
+// the forward pass rounds weights and activations to --weights and --activations and reads the grids as BC6H holds them.
+#include "ImageMetrics.h"
+#include "MaterialLibrary.h"
+#include "NeuralTrainer.h"
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+
+//epochs of a fine-tune unless --epochs is given
+static const uint32_t FineTuneEpochs = 5;
+
+struct TrainerOptions
+{
+	//conventional material of the library whose textures are the target
+	std::string material = "1K_DDS";
+	//albedo, normal, ao, roughness, instead of the material's
+	std::vector<std::string> textures;
+	//top left texels of the target only, 0 trains on all of it
+	uint32_t crop = 0;
+
+	//decodermodel.json of a trained decoder, only the grids are fitted when given
+	std::string decoderPath;
+	//directory with the decodermodel.json and compressed0..3.dds of a trained material, both are refined when given
+	std::string fineTuneDirectory;
+	bool bEpochsGiven = false;
+
+	std::string outputDirectory = "trained";
+	//output/checkpoint.bin when empty
+	std::string checkpointPath;
+	uint32_t checkpointEvery = 5;
+	bool bResume = false;
+
+	TrainerSettings settings;
+};
+
+static std::vector<std::string> SplitList(const std::string& value)
+{
+	std::vector<std::string> items;
+	std::stringstream stream(value);
+	std::string item;
+	while (std::getline(stream, item, ','))
+	{
+		if (!item.empty())
+		{
+			items.push_back(item);
+		}
+	}
+	return items;
+}
+
+static bool ParseNumberFormat(const std::string& name, DecoderNumberFormat* outFormat)
+{
+	for (int f = 0; f < (int)DecoderNumberFormat::Count; f++)
+	{
+		if (name == GetDecoderNumberFormatName((DecoderNumberFormat)f))
+		{
+			if (outFormat)
+			{
+				*outFormat = (DecoderNumberFormat)f;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool ParseOptions(int argc, char** argv, TrainerOptions& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--resume")
+		{
+			options.bResume = true;
+			continue;
+		}
+		if (argument == "--bc6h-aware")
+		{
+			options.settings.bQuantizeGrids = true;
+			continue;
+		}
+
+		size_t separator = argument.find('=');
+		if (argument.rfind("--", 0) != 0 || separator == std::string::npos)
+		{
+			std::cout << "Unknown argument " << argument << std::endl;
+			return false;
+		}
+
+		std::string key = argument.substr(2, separator - 2);
+		std::string value = argument.substr(separator + 1);
+		try
+		{
+			if (key == "material") options.material = value;
+			else if (key == "textures") options.textures = SplitList(value);
+			else if (key == "decoder") options.decoderPath = value;
+			else if (key == "fine-tune") options.fineTuneDirectory = value;
+			else if (key == "weights" || key == "activations")
+			{
+				DecoderNumberFormat& format = key == "weights" ? options.settings.weightFormat : options.settings.activationFormat;
+				if (!ParseNumberFormat(value, &format))
+				{
+					std::cout << "Unknown number format " << value << std::endl;
+					return false;
+				}
+			}
+			else if (key == "crop") options.crop = (uint32_t)std::stoul(value);
+			else if (key == "output") options.outputDirectory = value;
+			else if (key == "checkpoint") options.checkpointPath = value;
+			else if (key == "checkpoint-every") options.checkpointEvery = (uint32_t)std::stoul(value);
+			else if (key == "layers")
+			{
+				options.settings.hiddenLayers.clear();
+				for (const std::string& layer : SplitList(value))
+				{
+					options.settings.hiddenLayers.push_back((int32_t)std::stoul(layer));
+				}
+			}
+			else if (key == "grid-divisor") options.settings.gridDivisor = (uint32_t)std::stoul(value);
+			else if (key == "epochs")
+			{
+				options.settings.epochs = (uint32_t)std::stoul(value);
+				options.bEpochsGiven = true;
+			}
+			else if (key == "batch") options.settings.batchSize = (uint32_t)std::stoul(value);
+			else if (key == "lr") options.settings.learningRate = std::stof(value);
+			else if (key == "grid-lr") options.settings.gridLearningRate = std::stof(value);
+			else if (key == "seed") options.settings.seed = (uint32_t)std::stoul(value);
+			else if (key == "threads") options.settings.threadCount = (uint32_t)std::stoul(value);
+			else
+			{
+				std::cout << "Unknown argument " << argument << std::endl;
+				return false;
+			}
+		}
+		catch (const std::exception&)
+		{
+			std::cout << "Invalid value for --" << key << ": " << value << std::endl;
+			return false;
+		}
+	}
+
+	if (!options.textures.empty() && options.textures.size() != 4)
+	{
+		std::cout << "--textures needs albedo, normal, ao and roughness" << std::endl;
+		return false;
+	}
+	if (options.settings.batchSize == 0 || options.settings.gridDivisor == 0)
+	{
+		std::cout << "--batch and --grid-divisor must be at least 1" << std::endl;
+		return false;
+	}
+	if (!options.fineTuneDirectory.empty() && !options.decoderPath.empty())
+	{
+		std::cout << "--fine-tune brings its own decoder, --decoder can't be given with it" << std::endl;
+		return false;
+	}
+
+	if (options.textures.empty())
+	{
+		const MaterialDesc* desc = FindMaterialDesc(options.material);
+		if (desc == nullptr || desc->IsNeural() || desc->textures.size() != 4)
+		{
+			std::cout << options.material << " is not a conventional material of the library" << std::endl;
+			return false;
+		}
+		for (const MaterialTextureDesc& texture : desc->textures)
+		{
+			options.textures.push_back(texture.path);
+		}
+	}
+	options.settings.bTrainDecoder = options.decoderPath.empty();
+	if (!options.fineTuneDirectory.empty())
+	{
+		//the grids come from dds files and go back into them, every epoch starts from their BC6H values
+		options.settings.bQuantizeGrids = true;
+		if (!options.bEpochsGiven)
+		{
+			options.settings.epochs = FineTuneEpochs;
+		}
+	}
+	if (options.checkpointPath.empty())
+	{
+		options.checkpointPath = (std::filesystem::path(options.outputDirectory) / "checkpoint.bin").string();
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	TrainerOptions options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::cout << "Usage: NeuralTrainer [--material=1K_DDS] [--textures=albedo,normal,ao,roughness] [--crop=0] [--output=trained]" << std::endl;
+		std::cout << "                     [--layers=64,64] [--grid-divisor=1] [--epochs=50] [--batch=16384] [--lr=0.001] [--grid-lr=0.01]" << std::endl;
+		std::cout << "                     [--seed=1] [--threads=0] [--checkpoint=path] [--checkpoint-every=5] [--resume]" << std::endl;
+		std::cout << "                     [--decoder=decodermodel.json] [--bc6h-aware]" << std::endl;
+		std::cout << "                     [--fine-tune=material directory] [--weights=fp32|fp16|int8] [--activations=fp32|fp16|int8]" << std::endl;
+		return 2;
+	}
+
+	std::string error;
+	TrainingTarget target;
+	if (!target.Load(options.textures, &error))
+	{
+		//png sources need WIC, the cpu path only reads dds
+		std::cout << "Can't load target: " << error << std::endl;
+		return 1;
+	}
+	if (options.crop > 0)
+	{
+		target = target.Crop(options.crop, options.crop);
+	}
+
+	NeuralTrainer trainer(target, options.settings);
+	if (options.bResume)
+	{
+		if (!trainer.LoadCheckpoint(options.checkpointPath, &error))
+		{
+			std::cout << "Can't resume: " << error << std::endl;
+			return 1;
+		}
+		std::cout << "resumed at epoch " << trainer.GetEpoch() << std::endl;
+	}
+	else if (!options.fineTuneDirectory.empty())
+	{
+		const std::filesystem::path directory(options.fineTuneDirectory);
+		NeuralModelPtr decoder;
+		try
+		{
+			decoder = NeuralModel::LoadModel((directory / "decodermodel.json").string());
+		}
+		catch (const std::exception& exception)
+		{
+			error = exception.what();
+		}
+		std::vector<FeatureGrid> startGrids(NeuralTrainer::GridCount);
+		for (int g = 0; g < NeuralTrainer::GridCount && decoder; g++)
+		{
+			if (!startGrids[g].Load((directory / ("compressed" + std::to_string(g) + ".dds")).string(), &error))
+			{
+				decoder = nullptr;
+			}
+		}
+		if (!decoder || !trainer.Initialize(*decoder, startGrids, &error))
+		{
+			std::cout << "Can't fine-tune " << options.fineTuneDirectory << ": " << error << std::endl;
+			return 1;
+		}
+		//what rounding the material as it is costs, the quality the fine-tune starts from
+		std::cout << "starting from " << ImageMetrics::PSNR(trainer.Evaluate(trainer.GetGrids())) << " dB with "
+			<< GetDecoderNumberFormatName(options.settings.weightFormat) << " weights and "
+			<< GetDecoderNumberFormatName(options.settings.activationFormat) << " activations" << std::endl;
+	}
+	else if (!options.decoderPath.empty())
+	{
+		NeuralModelPtr decoder;
+		try
+		{
+			decoder = NeuralModel::LoadModel(options.decoderPath);
+		}
+		catch (const std::exception& exception)
+		{
+			error = exception.what();
+		}
+		if (!decoder || !trainer.Initialize(*decoder, &error))
+		{
+			std::cout << "Can't use decoder " << options.decoderPath << ": " << error << std::endl;
+			return 1;
+		}
+	}
+	else
+	{
+		trainer.Initialize();
+	}
+
+	std::error_code directoryError;
+	std::filesystem::create_directories(options.outputDirectory, directoryError);
+
+	std::cout << "training " << target.width << "x" << target.height << " texels" << std::endl;
+	while (!trainer.IsFinished())
+	{
+		auto start = std::chrono::steady_clock::now();
+		TrainingEpoch row = trainer.TrainEpoch();
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "epoch " << row.epoch << ": loss " << row.loss << ", " << row.psnr << " dB, lr " << row.learningRate
+			<< ", " << seconds << " s" << std::endl;
+
+		if (options.checkpointEvery > 0 && (trainer.GetEpoch() % options.checkpointEvery == 0 || trainer.IsFinished()) &&
+			!trainer.SaveCheckpoint(options.checkpointPath, &error))
+		{
+			std::cout << "Can't save checkpoint: " << error << std::endl;
+		}
+	}
+
+	std::vector<FeatureGrid> compressedGrids;
+	if (!trainer.Export(options.outputDirectory, &compressedGrids, &error))
+	{
+		std::cout << "Can't export: " << error << std::endl;
+		return 1;
+	}
+
+	//what BC6H costs the fitted grids
+	double floatError = trainer.Evaluate(trainer.GetGrids());
+	double compressedError = trainer.Evaluate(compressedGrids);
+	std::cout << "float grids " << ImageMetrics::PSNR(floatError) << " dB, BC6H grids " << ImageMetrics::PSNR(compressedError) << " dB" << std::endl;
+	std::cout << "wrote " << options.outputDirectory << std::endl;
+	return 0;
+}
@@ -0,0 +1,239 @@
+#include "NullRenderBackend.h"
+#include <algorithm>
+
+const char* GetNullCommandName(NullCommandType type)
+{
+	switch (type)
+	{
+	case NullCommandType::CreateTexture: return "CreateTexture";
+	case NullCommandType::CreateBuffer: return "CreateBuffer";
+	case NullCommandType::CreateDescriptorTable: return "CreateDescriptorTable";
+	case NullCommandType::Destroy: return "Destroy";
+	case NullCommandType::SetResolution: return "SetResolution";
+	case NullCommandType::BeginFrame: return "BeginFrame";
+	case NullCommandType::Draw: return "Draw";
+	case NullCommandType::EndFrame: return "EndFrame";
+	}
+	return "Unknown";
+}
+
+NullRenderBackend::NullRenderBackend(uint32_t inGpuLatency)
+	: gpuLatency(inGpuLatency), scheduler(FrameScheduler::MaxFrameLatency)
+{
+}
+
+std::string NullRenderBackend::GetName() const
+{
+	return "Null";
+}
+
+BackendTexture NullRenderBackend::CreateTexture(const std::string& path, const std::string& name, std::string* error)
+{
+	BackendTexture texture;
+	if (path.empty())
+	{
+		if (error)
+		{
+			*error = "Empty texture path: " + name;
+		}
+		return texture;
+	}
+	texture.id = CreateObject(NullCommandType::CreateTexture, name, 0);
+	return texture;
+}
+
+BackendBuffer NullRenderBackend::CreateBuffer(const void* data, size_t elementSize, size_t elementCount, MemoryCategory, const std::string& name)
+{
+	BackendBuffer buffer;
+	if (!data || elementSize == 0 || elementCount == 0)
+	{
+		validationErrors.push_back("Empty buffer " + name);
+		return buffer;
+	}
+	buffer.id = CreateObject(NullCommandType::CreateBuffer, name, 0);
+	return buffer;
+}
+
+BackendDescriptorTable NullRenderBackend::CreateDescriptorTable(const std::vector<BackendTexture>& textures, const std::vector<BackendBuffer>& buffers)
+{
+	BackendDescriptorTable table;
+	for (BackendTexture texture : textures)
+	{
+		if (!IsLive(texture.id, NullCommandType::CreateTexture))
+		{
+			validationErrors.push_back("Descriptor table with a texture that isn't live: " + std::to_string(texture.id));
+			return table;
+		}
+	}
+	for (BackendBuffer buffer : buffers)
+	{
+		if (!IsLive(buffer.id, NullCommandType::CreateBuffer))
+		{
+			validationErrors.push_back("Descriptor table with a buffer that isn't live: " + std::to_string(buffer.id));
+			return table;
+		}
+	}
+	table.id = CreateObject(NullCommandType::CreateDescriptorTable, "", (uint32_t)(textures.size() + buffers.size()));
+	return table;
+}
+
+void NullRenderBackend::Destroy(BackendTexture texture)
+{
+	DestroyObject(texture.id);
+}
+
+void NullRenderBackend::Destroy(BackendBuffer buffer)
+{
+	DestroyObject(buffer.id);
+}
+
+void NullRenderBackend::Destroy(BackendDescriptorTable table)
+{
+	DestroyObject(table.id);
+}
+
+void NullRenderBackend::SetResolution(uint32_t width, uint32_t height)
+{
+	NullCommand command;
+	command.type = NullCommandType::SetResolution;
+	command.name = std::to_string(width) + "x" + std::to_string(height);
+	Record(command);
+}
+
+void NullRenderBackend::BeginFrame()
+{
+	if (bRecording)
+	{
+		validationErrors.push_back("BeginFrame while a frame is recorded");
+	}
+
+	//the simulated gpu catches up when the next frame context is still in flight
+	Complete(scheduler.GetFrameWaitValue());
+	scheduler.BeginFrame(completedFenceValue);
+	bRecording = true;
+
+	NullCommand command;
+	command.type = NullCommandType::BeginFrame;
+	Record(command);
+}
+
+void NullRenderBackend::Draw(const BackendDraw& draw)
+{
+	if (!bRecording)
+	{
+		validationErrors.push_back("Draw outside of a frame");
+	}
+	if (!IsLive(draw.table.id, NullCommandType::CreateDescriptorTable))
+	{
+		validationErrors.push_back("Draw with a descriptor table that isn't live: " + std::to_string(draw.table.id));
+	}
+	if (draw.shader != MaterialShader::PBR && !draw.model)
+	{
+		validationErrors.push_back("Neural draw without a model");
+	}
+
+	NullCommand command;
+	command.type = NullCommandType::Draw;
+	command.id = draw.table.id;
+	command.shader = draw.shader;
+	command.constants = draw.constants;
+	Record(command);
+}
+
+uint64_t NullRenderBackend::EndFrame()
+{
+	if (!bRecording)
+	{
+		validationErrors.push_back("EndFrame without BeginFrame");
+	}
+
+	NullCommand command;
+	command.type = NullCommandType::EndFrame;
+	Record(command);
+
+	bRecording = false;
+	uint64_t fenceValue = scheduler.EndFrame();
+
+	//gpuLatency frames behind the cpu
+	if (fenceValue > gpuLatency)
+	{
+		Complete(fenceValue - gpuLatency);
+	}
+	return fenceValue;
+}
+
+void NullRenderBackend::WaitForFence(uint64_t fenceValue)
+{
+	Complete(std::min(fenceValue, scheduler.GetLastSignaledValue()));
+}
+
+bool NullRenderBackend::ReadFrame(std::vector<uint8_t>&, uint32_t&, uint32_t&)
+{
+	return false;
+}
+
+size_t NullRenderBackend::CountCommands(NullCommandType type) const
+{
+	return (size_t)std::count_if(commands.begin(), commands.end(), [type](const NullCommand& command) { return command.type == type; });
+}
+
+uint32_t NullRenderBackend::CreateObject(NullCommandType type, const std::string& name, uint32_t viewCount)
+{
+	uint32_t id = nextId++;
+
+	NullObject& object = objects[id];
+	object.type = type;
+	object.name = name;
+
+	NullCommand command;
+	command.type = type;
+	command.id = id;
+	command.name = name;
+	command.viewCount = viewCount;
+	Record(command);
+	return id;
+}
+
+void NullRenderBackend::DestroyObject(uint32_t id)
+{
+	if (id == 0)
+	{
+		return;
+	}
+
+	auto it = objects.find(id);
+	if (it == objects.end() || it->second.bDestroyed)
+	{
+		validationErrors.push_back("Destroy of an object that isn't live: " + std::to_string(id));
+		return;
+	}
+	it->second.bDestroyed = true;
+
+	NullCommand command;
+	command.type = NullCommandType::Destroy;
+	command.id = id;
+	command.name = it->second.name;
+	Record(command);
+
+	//frames in flight may still use it, goes right away when they all finished
+	scheduler.Defer([this, id]() { objects.erase(id); });
+	scheduler.Retire(completedFenceValue);
+}
+
+bool NullRenderBackend::IsLive(uint32_t id, NullCommandType type) const
+{
+	auto it = objects.find(id);
+	return it != objects.end() && !it->second.bDestroyed && it->second.type == type;
+}
+
+void NullRenderBackend::Record(NullCommand command)
+{
+	command.fenceValue = scheduler.GetCurrentFrameFenceValue();
+	commands.push_back(std::move(command));
+}
+
+void NullRenderBackend::Complete(uint64_t fenceValue)
+{
+	completedFenceValue = std::max(completedFenceValue, fenceValue);
+	scheduler.Retire(completedFenceValue);
+}
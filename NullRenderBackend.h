@@ -0,0 +1,105 @@
+#pragma once
+
+#include <map>
+#include "FrameScheduler.h"
+#include "RenderBackend.h"
+
+enum class NullCommandType
+{
+	CreateTexture,
+	CreateBuffer,
+	CreateDescriptorTable,
+	Destroy,
+	SetResolution,
+	BeginFrame,
+	Draw,
+	EndFrame,
+};
+
+const char* GetNullCommandName(NullCommandType type);
+
+// One call made on the null backend, fields that don't apply to the type stay at their defaults
+struct NullCommand
+{
+	NullCommandType type = NullCommandType::Draw;
+
+	//object created or destroyed, the descriptor table of a draw
+	uint32_t id = 0;
+	std::string name;
+
+	//views in a descriptor table
+	uint32_t viewCount = 0;
+
+	//draws only
+	MaterialShader shader = MaterialShader::PBR;
+	RectConstantBuffer constants;
+
+	//fence value of the frame the command was recorded in
+	uint64_t fenceValue = 0;
+};
+
+// Backend that draws nothing and records every call, so tests can assert on what the pipeline submitted.
+// Files are not read, any path makes a texture. The simulated gpu finishes a frame gpuLatency frames after
+// it was submitted, objects are destroyed only once the frames that could use them finished, and a draw of
+// a table that isn't live counts as a validation error instead of crashing.
+class NullRenderBackend : public RenderBackend
+{
+public:
+	explicit NullRenderBackend(uint32_t inGpuLatency = 0);
+
+	std::string GetName() const override;
+
+	BackendTexture CreateTexture(const std::string& path, const std::string& name, std::string* error = nullptr) override;
+	BackendBuffer CreateBuffer(const void* data, size_t elementSize, size_t elementCount, MemoryCategory category, const std::string& name) override;
+	BackendDescriptorTable CreateDescriptorTable(const std::vector<BackendTexture>& textures, const std::vector<BackendBuffer>& buffers) override;
+
+	void Destroy(BackendTexture texture) override;
+	void Destroy(BackendBuffer buffer) override;
+	void Destroy(BackendDescriptorTable table) override;
+
+	void SetResolution(uint32_t width, uint32_t height) override;
+
+	void BeginFrame() override;
+	void Draw(const BackendDraw& draw) override;
+	uint64_t EndFrame() override;
+
+	uint64_t GetCompletedFenceValue() override { return completedFenceValue; }
+	uint64_t GetLastSubmittedFenceValue() const override { return scheduler.GetLastSignaledValue(); }
+	void WaitForFence(uint64_t fenceValue) override;
+
+	bool ReadFrame(std::vector<uint8_t>& outRGBA8, uint32_t& outWidth, uint32_t& outHeight) override;
+
+	const std::vector<NullCommand>& GetCommands() const { return commands; }
+	void ClearCommands() { commands.clear(); }
+	size_t CountCommands(NullCommandType type) const;
+
+	//objects created and not destroyed yet, destroyed ones waiting for their frame included
+	size_t GetLiveObjectCount() const { return objects.size(); }
+
+	const std::vector<std::string>& GetValidationErrors() const { return validationErrors; }
+
+private:
+	struct NullObject
+	{
+		NullCommandType type = NullCommandType::CreateTexture;
+		std::string name;
+		bool bDestroyed = false;
+	};
+
+	uint32_t CreateObject(NullCommandType type, const std::string& name, uint32_t viewCount);
+	void DestroyObject(uint32_t id);
+	bool IsLive(uint32_t id, NullCommandType type) const;
+	void Record(NullCommand command);
+	void Complete(uint64_t fenceValue);
+
+	uint32_t gpuLatency = 0;
+	FrameScheduler scheduler;
+	uint64_t completedFenceValue = 0;
+	bool bRecording = false;
+
+	uint32_t nextId = 1;
+	std::map<uint32_t, NullObject> objects;
+
+	std::vector<NullCommand> commands;
+	std::vector<std::string> validationErrors;
+};
@@ -0,0 +1,678 @@
+// Quality vs cost of the neural texture variants.
+// Every neural material of the library is decoded on the cpu over a texel grid and compared with a
+// conventional reference material, the results go to a csv and a markdown table with the pareto front marked.
+// --prune and --factorize add a row for every pruning or factorization level of each neural material, with its
+// quality and speed next to the dense model it came from. --save-models writes the transformed models and their
+// generated decoders, --rank-errors the weight error of every layer at every rank.
+// Every variant gets a digest of its decoded texels, --deterministic decodes them so the digest is the same on
+// every machine and thread count.
+#include "DDSImage.h"
+#include "DecoderCompiler.h"
+#include "DecoderFactorization.h"
+#include "DecoderPruning.h"
+#include "DeterministicDecode.h"
+#include "ImageMetrics.h"
+#include "SoftwareRenderer.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+//albedo rgb, normal rgb, ao, roughness
+static const uint32_t ChannelCount = BakeChannelCount;
+
+struct ReportOptions
+{
+	std::string reference = "1K_DDS";
+	std::vector<std::string> materials;
+
+	//the grid covers the texture once, one sample per texel of a 1K texture by default
+	uint32_t size = 1024;
+	uint32_t threadCount = 1;
+	uint32_t repeats = 3;
+
+	//n:m, dead, or steps joined with +, see PruneModel
+	std::vector<std::string> pruneLevels;
+	//rank=r or macs=fraction, see FactorizeModel
+	std::vector<std::string> factorizeLevels;
+	std::string rankErrorsPath;
+	//kernel of every neural decoder, the decoder's own default when empty
+	std::string kernel;
+	std::string saveModelsDirectory;
+	//BakeMaterial's deterministic mode instead of the decoder's kernel
+	bool bDeterministic = false;
+
+	std::string csvPath = "pareto.csv";
+	std::string markdownPath = "pareto.md";
+};
+
+struct VariantReport
+{
+	std::string name;
+	std::string layers;
+	//dense variant a pruned or factorized one came from
+	std::string source;
+	bool bReference = false;
+	bool bLoaded = false;
+	std::string error;
+
+	double albedoPSNR = 0.0;
+	double albedoSSIM = 0.0;
+	double normalPSNR = 0.0;
+	ImageMetrics::AngularError normalAngle;
+	double aoPSNR = 0.0;
+	double aoSSIM = 0.0;
+	double roughnessPSNR = 0.0;
+	double roughnessSSIM = 0.0;
+	double overallPSNR = 0.0;
+
+	double nsPerPixel = 0.0;
+	//DeterministicDecode::Digest of the decoded texels
+	uint64_t digest = 0;
+	//after zero weights and dead neurons are skipped
+	size_t multiplyAdds = 0;
+	uint64_t diskBytes = 0;
+	//what the viewer keeps on the gpu: every mip of the textures plus weights and biases
+	uint64_t residentBytes = 0;
+
+	bool bPareto = false;
+};
+
+static std::vector<std::string> SplitList(const std::string& value)
+{
+	std::vector<std::string> items;
+	std::stringstream stream(value);
+	std::string item;
+	while (std::getline(stream, item, ','))
+	{
+		if (!item.empty())
+		{
+			items.push_back(item);
+		}
+	}
+	return items;
+}
+
+static bool ParseKernel(const std::string& name, DecoderKernel* outKernel)
+{
+	for (int k = 0; k < (int)DecoderKernel::Count; k++)
+	{
+		if (name == GetDecoderKernelName((DecoderKernel)k))
+		{
+			if (outKernel)
+			{
+				*outKernel = (DecoderKernel)k;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool ParseOptions(int argc, char** argv, ReportOptions& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--deterministic")
+		{
+			options.bDeterministic = true;
+			continue;
+		}
+
+		size_t separator = argument.find('=');
+		if (argument.rfind("--", 0) != 0 || separator == std::string::npos)
+		{
+			std::cout << "Unknown argument " << argument << std::endl;
+			return false;
+		}
+
+		std::string key = argument.substr(2, separator - 2);
+		std::string value = argument.substr(separator + 1);
+		try
+		{
+			if (key == "reference") options.reference = value;
+			else if (key == "materials") options.materials = SplitList(value);
+			else if (key == "size") options.size = (uint32_t)std::stoul(value);
+			else if (key == "threads") options.threadCount = (uint32_t)std::stoul(value);
+			else if (key == "repeats") options.repeats = (uint32_t)std::stoul(value);
+			else if (key == "csv") options.csvPath = value;
+			else if (key == "markdown") options.markdownPath = value;
+			else if (key == "prune") options.pruneLevels = SplitList(value);
+			else if (key == "factorize") options.factorizeLevels = SplitList(value);
+			else if (key == "rank-errors") options.rankErrorsPath = value;
+			else if (key == "kernel") options.kernel = value;
+			else if (key == "save-models") options.saveModelsDirectory = value;
+			else
+			{
+				std::cout << "Unknown argument " << argument << std::endl;
+				return false;
+			}
+		}
+		catch (const std::exception&)
+		{
+			std::cout << "Invalid value for --" << key << ": " << value << std::endl;
+			return false;
+		}
+	}
+
+	if (options.size < 8 || options.repeats == 0)
+	{
+		std::cout << "--size must be at least 8 and --repeats at least 1" << std::endl;
+		return false;
+	}
+
+	if (!options.kernel.empty() && !ParseKernel(options.kernel, nullptr))
+	{
+		std::cout << "Unknown kernel " << options.kernel << std::endl;
+		return false;
+	}
+
+	if (options.materials.empty())
+	{
+		for (const MaterialDesc& desc : GetMaterialLibrary())
+		{
+			if (desc.IsNeural())
+			{
+				options.materials.push_back(desc.name);
+			}
+		}
+	}
+	return true;
+}
+
+// Material inputs at the texel centers of a size x size grid, baked on the pool.
+// Returns the median wall time over the repeats in ns per pixel, times the thread count so it reads as cpu cost.
+static double EvaluateMaterial(const SoftwareMaterial& material, uint32_t size, uint32_t repeats, bool bDeterministic, ThreadPool& threadPool,
+	std::vector<float>& outImage)
+{
+	std::vector<double> times;
+	for (uint32_t repeat = 0; repeat < repeats; repeat++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		BakeMaterial(material, size, threadPool, bDeterministic, outImage);
+		times.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	std::sort(times.begin(), times.end());
+	return times[times.size() / 2] * threadPool.GetThreadCount() / ((double)size * size);
+}
+
+static void MeasureFootprint(const MaterialDesc& desc, const SoftwareMaterial& material, VariantReport& report)
+{
+	std::vector<std::string> files;
+	for (const MaterialTextureDesc& texture : desc.textures)
+	{
+		files.push_back(texture.path);
+
+		DDSImage image;
+		if (image.Load(texture.path))
+		{
+			report.residentBytes += image.data.size();
+		}
+	}
+
+	if (material.model)
+	{
+		files.push_back(desc.modelPath);
+		report.residentBytes += (material.model->weights.size() + material.model->bias.size()) * sizeof(float);
+		report.multiplyAdds = CompileDecoder(*material.model).stats.multiplyAdds;
+
+		std::stringstream layers;
+		for (size_t i = 0; i < material.model->layer_sizes.size(); i++)
+		{
+			layers << (i > 0 ? "-" : "") << material.model->layer_sizes[i];
+		}
+		report.layers = layers.str();
+	}
+
+	for (const std::string& file : files)
+	{
+		std::error_code error;
+		uintmax_t fileSize = std::filesystem::file_size(file, error);
+		if (!error)
+		{
+			report.diskBytes += fileSize;
+		}
+	}
+}
+
+static void CompareWithReference(const std::vector<float>& image, const std::vector<float>& reference, uint32_t size, VariantReport& report)
+{
+	const float* a = image.data();
+	const float* b = reference.data();
+	size_t pixelCount = (size_t)size * size;
+
+	using namespace ImageMetrics;
+	report.albedoPSNR = PSNR(MeanSquaredError(a, b, pixelCount, ChannelCount, 0, 3));
+	report.albedoSSIM = (SSIM(a, b, size, size, ChannelCount, 0) + SSIM(a, b, size, size, ChannelCount, 1) + SSIM(a, b, size, size, ChannelCount, 2)) / 3.0;
+	report.normalPSNR = PSNR(MeanSquaredError(a, b, pixelCount, ChannelCount, 3, 3));
+	report.normalAngle = NormalAngularError(a, b, pixelCount, ChannelCount, 3);
+	report.aoPSNR = PSNR(MeanSquaredError(a, b, pixelCount, ChannelCount, 6, 1));
+	report.aoSSIM = SSIM(a, b, size, size, ChannelCount, 6);
+	report.roughnessPSNR = PSNR(MeanSquaredError(a, b, pixelCount, ChannelCount, 7, 1));
+	report.roughnessSSIM = SSIM(a, b, size, size, ChannelCount, 7);
+	report.overallPSNR = PSNR(MeanSquaredError(a, b, pixelCount, ChannelCount, 0, ChannelCount));
+}
+
+//a variant is on the front when no other one is at least as good on quality, decode cost and footprint and better on one of them
+static void MarkParetoFront(std::vector<VariantReport>& reports)
+{
+	for (VariantReport& report : reports)
+	{
+		if (!report.bLoaded || report.bReference)
+		{
+			continue;
+		}
+
+		report.bPareto = true;
+		for (const VariantReport& other : reports)
+		{
+			if (&other == &report || !other.bLoaded || other.bReference)
+			{
+				continue;
+			}
+
+			bool bNoWorse = other.overallPSNR >= report.overallPSNR && other.nsPerPixel <= report.nsPerPixel && other.residentBytes <= report.residentBytes;
+			bool bBetter = other.overallPSNR > report.overallPSNR || other.nsPerPixel < report.nsPerPixel || other.residentBytes < report.residentBytes;
+			if (bNoWorse && bBetter)
+			{
+				report.bPareto = false;
+				break;
+			}
+		}
+	}
+}
+
+static bool WriteCsv(const std::string& path, const std::vector<VariantReport>& reports)
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+
+	file << "Variant,Layers,MultiplyAdds,AlbedoPSNR,AlbedoSSIM,NormalPSNR,NormalAngleMean,NormalAngleP95,AOPSNR,AOSSIM,RoughnessPSNR,RoughnessSSIM,OverallPSNR,NsPerPixel,DiskBytes,ResidentBytes,Pareto,Source,Digest" << std::endl;
+	for (const VariantReport& report : reports)
+	{
+		if (!report.bLoaded)
+		{
+			continue;
+		}
+
+		file << report.name << "," << report.layers << "," << report.multiplyAdds << ",";
+		if (report.bReference)
+		{
+			file << ",,,,,,,,,,";
+		}
+		else
+		{
+			file << report.albedoPSNR << "," << report.albedoSSIM << ","
+				<< report.normalPSNR << "," << report.normalAngle.meanDegrees << "," << report.normalAngle.p95Degrees << ","
+				<< report.aoPSNR << "," << report.aoSSIM << ","
+				<< report.roughnessPSNR << "," << report.roughnessSSIM << ","
+				<< report.overallPSNR << ",";
+		}
+		file << report.nsPerPixel << ","
+			<< report.diskBytes << "," << report.residentBytes << ","
+			<< (report.bReference ? "reference" : (report.bPareto ? "1" : "0")) << "," << report.source << ","
+			<< std::hex << std::setw(16) << std::setfill('0') << report.digest << std::dec << std::setfill(' ') << std::endl;
+	}
+	return true;
+}
+
+static bool WriteMarkdown(const std::string& path, const std::vector<VariantReport>& reports, const ReportOptions& options)
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+
+	//cheapest first, the way a hardware tier is picked
+	std::vector<const VariantReport*> sorted;
+	for (const VariantReport& report : reports)
+	{
+		if (report.bLoaded)
+		{
+			sorted.push_back(&report);
+		}
+	}
+	std::stable_sort(sorted.begin(), sorted.end(), [](const VariantReport* a, const VariantReport* b) { return a->nsPerPixel < b->nsPerPixel; });
+
+	auto megabytes = [](uint64_t bytes)
+		{
+			std::stringstream stream;
+			stream << std::fixed << std::setprecision(2) << bytes / (1024.0 * 1024.0);
+			return stream.str();
+		};
+
+	file << std::fixed << std::setprecision(2);
+	file << "# Neural texture variants against " << options.reference << std::endl << std::endl;
+	file << options.size << "x" << options.size << " texel grid, decode cost per pixel on " << options.threadCount << " thread(s)";
+	file << (options.kernel.empty() ? "" : " with the " + options.kernel + " kernel") << "." << std::endl << std::endl;
+	file << "| Variant | Layers | MACs | Albedo PSNR | Albedo SSIM | Normal PSNR | Normal error mean/p95 (deg) | AO PSNR | AO SSIM | Roughness PSNR | Roughness SSIM | Overall PSNR | ns/pixel | Disk MB | Resident MB | Pareto |" << std::endl;
+	file << "|---|---|---:|---:|---:|---:|---:|---:|---:|---:|---:|---:|---:|---:|---:|:---:|" << std::endl;
+	for (const VariantReport* report : sorted)
+	{
+		file << "| " << report->name << " | " << (report->layers.empty() ? "-" : report->layers) << " | " << report->multiplyAdds << " | ";
+		if (report->bReference)
+		{
+			file << "reference | | | | | | | | | ";
+		}
+		else
+		{
+			file << report->albedoPSNR << " | " << std::setprecision(4) << report->albedoSSIM << std::setprecision(2) << " | "
+				<< report->normalPSNR << " | " << report->normalAngle.meanDegrees << " / " << report->normalAngle.p95Degrees << " | "
+				<< report->aoPSNR << " | " << std::setprecision(4) << report->aoSSIM << std::setprecision(2) << " | "
+				<< report->roughnessPSNR << " | " << std::setprecision(4) << report->roughnessSSIM << std::setprecision(2) << " | "
+				<< report->overallPSNR << " | ";
+		}
+		file << report->nsPerPixel << " | " << megabytes(report->diskBytes) << " | " << megabytes(report->residentBytes) << " | "
+			<< (report->bPareto ? "yes" : "") << " |" << std::endl;
+	}
+
+	//every pruned or factorized variant against the dense model it came from
+	bool bTransformed = false;
+	for (const VariantReport& report : reports)
+	{
+		if (!report.bLoaded || report.source.empty())
+		{
+			continue;
+		}
+		const VariantReport* source = nullptr;
+		for (const VariantReport& other : reports)
+		{
+			if (other.bLoaded && other.name == report.source)
+			{
+				source = &other;
+			}
+		}
+		if (source == nullptr)
+		{
+			continue;
+		}
+
+		if (!bTransformed)
+		{
+			file << std::endl << "## Pruning and factorization" << std::endl << std::endl;
+			file << "| Variant | Layers | MACs | MACs kept | Overall PSNR | PSNR change | ns/pixel | Speedup |" << std::endl;
+			file << "|---|---|---:|---:|---:|---:|---:|---:|" << std::endl;
+			bTransformed = true;
+		}
+		file << "| " << report.name << " | " << report.layers << " | " << report.multiplyAdds << " | "
+			<< 100.0 * report.multiplyAdds / std::max<size_t>(source->multiplyAdds, 1) << "% | "
+			<< report.overallPSNR << " | " << std::showpos << report.overallPSNR - source->overallPSNR << std::noshowpos << " | "
+			<< report.nsPerPixel << " | " << source->nsPerPixel / report.nsPerPixel << "x |" << std::endl;
+	}
+
+	bool bSkipped = false;
+	for (const VariantReport& report : reports)
+	{
+		if (!report.bLoaded)
+		{
+			if (!bSkipped)
+			{
+				file << std::endl << "Skipped:" << std::endl << std::endl;
+				bSkipped = true;
+			}
+			file << "- " << report.name << ": " << report.error << std::endl;
+		}
+	}
+	return true;
+}
+
+//one row per material, layer and rank: the relative weight error and the multiply-adds of the layer at that rank
+static bool WriteRankErrors(const std::string& path, const std::vector<std::pair<std::string, std::vector<LayerRankErrors>>>& rankErrors)
+{
+	std::ofstream file(path);
+	file << "Variant,Layer,Inputs,Outputs,Rank,SingularValue,RelativeError,MultiplyAdds,DenseMultiplyAdds" << std::endl;
+	for (const auto& material : rankErrors)
+	{
+		for (const LayerRankErrors& layer : material.second)
+		{
+			const size_t denseMultiplyAdds = (size_t)layer.inputCount * layer.outputCount;
+			for (size_t rank = 1; rank <= layer.singularValues.size(); rank++)
+			{
+				file << material.first << "," << layer.layer << "," << layer.inputCount << "," << layer.outputCount << "," << rank << ","
+					<< layer.singularValues[rank - 1] << "," << layer.errors[rank] << "," << rank * (layer.inputCount + layer.outputCount) << ","
+					<< denseMultiplyAdds << std::endl;
+			}
+
+			//the ranks that save multiply-adds, at a glance
+			std::cout << material.first << " layer " << layer.layer << " (" << layer.inputCount << "x" << layer.outputCount << "):";
+			for (size_t rank = 1; rank <= layer.singularValues.size() && rank * (layer.inputCount + layer.outputCount) < denseMultiplyAdds; rank *= 2)
+			{
+				std::cout << " rank " << rank << " " << std::setprecision(3) << 100.0 * layer.errors[rank] << "%";
+			}
+			std::cout << std::setprecision(6) << std::endl;
+		}
+	}
+	return (bool)file;
+}
+
+//decoder inputs at the texel centers of a size x size grid, what pruning levels are chosen on
+static std::vector<float> SampleDecoderInputs(const SoftwareMaterial& material, uint32_t size)
+{
+	const size_t inputCount = material.decoder->GetInputCount();
+	std::vector<float> inputs((size_t)size * size * inputCount);
+	std::vector<float> uvs((size_t)size * 2);
+	for (uint32_t y = 0; y < size; y++)
+	{
+		for (uint32_t x = 0; x < size; x++)
+		{
+			uvs[x * 2 + 0] = (x + 0.5f) / size;
+			uvs[x * 2 + 1] = (y + 0.5f) / size;
+		}
+		material.GetDecoderInputs(uvs.data(), size, &inputs[(size_t)y * size * inputCount]);
+	}
+	return inputs;
+}
+
+static std::shared_ptr<NeuralDecoderCPU> CreateDecoder(const NeuralModelPtr& model, const ReportOptions& options)
+{
+	auto decoder = std::make_shared<NeuralDecoderCPU>(model);
+	DecoderKernel kernel;
+	if (ParseKernel(options.kernel, &kernel))
+	{
+		decoder->SetKernel(kernel);
+	}
+	return decoder;
+}
+
+//<directory>/<name>/decodermodel.bin and .json, the json is what a material library entry loads. The baked
+//decoders generated from the model go next to the directory
+static void SaveModel(const std::string& directory, const std::string& name, const NeuralModel& model)
+{
+	std::string identifier = name;
+	for (char& c : identifier)
+	{
+		c = std::isalnum((unsigned char)c) ? c : '_';
+	}
+
+	std::filesystem::path modelDirectory = std::filesystem::path(directory) / identifier;
+	std::error_code errorCode;
+	std::filesystem::create_directories(modelDirectory, errorCode);
+	if (!model.SaveBinary((modelDirectory / "decodermodel.bin").string()))
+	{
+		std::cout << "can't write " << (modelDirectory / "decodermodel.bin").string() << std::endl;
+		return;
+	}
+	if (!model.SaveJson((modelDirectory / "decodermodel.json").string()))
+	{
+		std::cout << "can't write " << (modelDirectory / "decodermodel.json").string() << std::endl;
+		return;
+	}
+
+	CompiledDecoder compiled = CompileDecoder(model);
+	std::ofstream(std::filesystem::path(directory) / ("BakedDecoder_" + identifier + ".cpp")) << GenerateDecoderCPP(compiled, identifier);
+
+	std::string error;
+	std::string hlsl = GenerateDecoderHLSL(compiled, identifier, &error);
+	if (hlsl.empty())
+	{
+		std::cout << "no shader for " << name << ": " << error << std::endl;
+		return;
+	}
+	std::ofstream(std::filesystem::path(directory) / (identifier + ".hlsl")) << hlsl;
+}
+
+static VariantReport LoadVariant(const std::string& name, SoftwareMaterialPtr& outMaterial, const MaterialDesc*& outDesc)
+{
+	VariantReport report;
+	report.name = name;
+
+	outDesc = FindMaterialDesc(name);
+	if (outDesc == nullptr)
+	{
+		report.error = "Unknown material";
+		return report;
+	}
+
+	outMaterial = SoftwareMaterial::Create(*outDesc, &report.error);
+	report.bLoaded = outMaterial != nullptr;
+	return report;
+}
+
+int main(int argc, char** argv)
+{
+	ReportOptions options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::cout << "Usage: ParetoReport [--reference=1K_DDS] [--materials=a,b] [--size=1024] [--threads=1] [--repeats=3]" << std::endl;
+		std::cout << "                    [--csv=pareto.csv] [--markdown=pareto.md]" << std::endl;
+		std::cout << "                    [--prune=2:4,1:4,dead,dead+2:4] [--factorize=rank=16,macs=0.5] [--kernel=JIT]" << std::endl;
+		std::cout << "                    [--save-models=directory] [--rank-errors=ranks.csv] [--deterministic]" << std::endl;
+		return 2;
+	}
+
+	ThreadPool threadPool(options.threadCount);
+	std::vector<VariantReport> reports;
+	std::vector<std::pair<std::string, std::vector<LayerRankErrors>>> rankErrors;
+
+	//the reference goes through the same path, its cost row is the baseline to beat
+	SoftwareMaterialPtr referenceMaterial;
+	const MaterialDesc* referenceDesc = nullptr;
+	VariantReport referenceReport = LoadVariant(options.reference, referenceMaterial, referenceDesc);
+	if (!referenceReport.bLoaded)
+	{
+		//png sources need WIC, the cpu path only reads dds
+		std::cout << "Can't load reference " << options.reference << ": " << referenceReport.error << std::endl;
+		return 1;
+	}
+	referenceReport.bReference = true;
+
+	std::vector<float> reference;
+	referenceReport.nsPerPixel = EvaluateMaterial(*referenceMaterial, options.size, options.repeats, options.bDeterministic, threadPool, reference);
+	referenceReport.digest = DeterministicDecode::Digest(reference.data(), reference.size());
+	MeasureFootprint(*referenceDesc, *referenceMaterial, referenceReport);
+	referenceMaterial.reset();
+	reports.push_back(referenceReport);
+
+	for (const std::string& name : options.materials)
+	{
+		SoftwareMaterialPtr material;
+		const MaterialDesc* desc = nullptr;
+		VariantReport report = LoadVariant(name, material, desc);
+		if (!report.bLoaded)
+		{
+			std::cout << "skipped " << name << ": " << report.error << std::endl;
+			reports.push_back(report);
+			continue;
+		}
+		DecoderKernel kernel;
+		if (material->IsNeural() && ParseKernel(options.kernel, &kernel))
+		{
+			material->decoder->SetKernel(kernel);
+		}
+
+		std::vector<float> image;
+		report.nsPerPixel = EvaluateMaterial(*material, options.size, options.repeats, options.bDeterministic, threadPool, image);
+		report.digest = DeterministicDecode::Digest(image.data(), image.size());
+		CompareWithReference(image, reference, options.size, report);
+		MeasureFootprint(*desc, *material, report);
+
+		std::cout << name << ": overall " << report.overallPSNR << " dB, albedo " << report.albedoPSNR << " dB, normal "
+			<< report.normalAngle.meanDegrees << " deg, " << report.nsPerPixel << " ns/pixel" << std::endl;
+		reports.push_back(report);
+
+		if (!material->IsNeural())
+		{
+			continue;
+		}
+		NeuralModelPtr denseModel = material->model;
+		if (!options.rankErrorsPath.empty())
+		{
+			rankErrors.emplace_back(name, ComputeRankErrors(*denseModel));
+		}
+		if (options.pruneLevels.empty() && options.factorizeLevels.empty())
+		{
+			continue;
+		}
+
+		//levels are chosen on a coarser grid, the activations barely change past a few texels per sample
+		const uint32_t sampleSize = std::min<uint32_t>(options.size, 256);
+		std::vector<float> samples = options.pruneLevels.empty() ? std::vector<float>() : SampleDecoderInputs(*material, sampleSize);
+
+		std::vector<std::string> levels = options.pruneLevels;
+		levels.insert(levels.end(), options.factorizeLevels.begin(), options.factorizeLevels.end());
+		for (size_t l = 0; l < levels.size(); l++)
+		{
+			const std::string& level = levels[l];
+			VariantReport transformed;
+			transformed.name = name + " " + level;
+			transformed.source = name;
+
+			NeuralModelPtr transformedModel = l < options.pruneLevels.size()
+				? PruneModel(*denseModel, level, samples.data(), (size_t)sampleSize * sampleSize, &transformed.error)
+				: FactorizeModel(*denseModel, level, &transformed.error);
+			if (!transformedModel)
+			{
+				std::cout << "skipped " << transformed.name << ": " << transformed.error << std::endl;
+				reports.push_back(transformed);
+				continue;
+			}
+			transformed.bLoaded = true;
+
+			material->model = transformedModel;
+			material->decoder = CreateDecoder(transformedModel, options);
+			transformed.nsPerPixel = EvaluateMaterial(*material, options.size, options.repeats, options.bDeterministic, threadPool, image);
+			transformed.digest = DeterministicDecode::Digest(image.data(), image.size());
+			CompareWithReference(image, reference, options.size, transformed);
+			MeasureFootprint(*desc, *material, transformed);
+
+			std::cout << transformed.name << ": overall " << transformed.overallPSNR << " dB (" << std::showpos << transformed.overallPSNR - report.overallPSNR << std::noshowpos
+				<< "), " << transformed.multiplyAdds << " multiply-adds, " << transformed.nsPerPixel << " ns/pixel" << std::endl;
+			if (!options.saveModelsDirectory.empty())
+			{
+				SaveModel(options.saveModelsDirectory, transformed.name, *transformedModel);
+			}
+			reports.push_back(transformed);
+		}
+		material->model = denseModel;
+	}
+
+	if (!options.rankErrorsPath.empty() && !WriteRankErrors(options.rankErrorsPath, rankErrors))
+	{
+		std::cout << "can't write " << options.rankErrorsPath << std::endl;
+		return 1;
+	}
+
+	MarkParetoFront(reports);
+
+	bool bWritten = WriteCsv(options.csvPath, reports);
+	bWritten = WriteMarkdown(options.markdownPath, reports, options) && bWritten;
+	if (!bWritten)
+	{
+		std::cout << "can't write " << options.csvPath << " or " << options.markdownPath << std::endl;
+		return 1;
+	}
+
+	std::cout << "wrote " << options.csvPath << " and " << options.markdownPath << std::endl;
+	return 0;
+}
@@ -0,0 +1,185 @@
+#include "Profiler.h"
+#include <mutex>
+#include <memory>
+#include <fstream>
+#include <iomanip>
+
+namespace Profiler
+{
+	// Registered thread buffers, buffers stay alive after their thread exits so they can still be exported
+	struct Registry
+	{
+		std::mutex mutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+		//buffers of threads that exited, taken over by the next threads that register
+		std::vector<ThreadBuffer*> freeBuffers;
+
+		//reference points to convert ticks to time
+		uint64_t startTicks = Now();
+		std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	};
+
+	static Registry& GetRegistry()
+	{
+		static Registry registry;
+		return registry;
+	}
+
+	// Gives the buffer of its thread back when the thread exits
+	struct ThreadExit
+	{
+		ThreadBuffer* buffer = nullptr;
+
+		~ThreadExit()
+		{
+			Registry& registry = GetRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			registry.freeBuffers.push_back(buffer);
+		}
+	};
+
+	ThreadBuffer* RegisterThread()
+	{
+		Registry& registry = GetRegistry();
+		ThreadBuffer* buffer = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			if (!registry.freeBuffers.empty())
+			{
+				//keeps its track and the zones of the threads before, they ended before this one started
+				buffer = registry.freeBuffers.back();
+				registry.freeBuffers.pop_back();
+			}
+			else
+			{
+				registry.buffers.push_back(std::make_unique<ThreadBuffer>());
+				buffer = registry.buffers.back().get();
+				buffer->threadId = (uint32_t)registry.buffers.size();
+			}
+			buffer->threadName = "Thread " + std::to_string(buffer->threadId);
+		}
+
+		static thread_local ThreadExit threadExit;
+		threadExit.buffer = buffer;
+		return buffer;
+	}
+
+	void SetThreadName(const char* name)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> lock(GetRegistry().mutex);
+		buffer->threadName = name;
+	}
+
+	uint64_t GetZoneCount()
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		uint64_t count = 0;
+		for (auto& buffer : registry.buffers)
+		{
+			count += buffer->writeIndex.load(std::memory_order_acquire);
+		}
+		return count;
+	}
+
+	size_t GetThreadBufferCount()
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		return registry.buffers.size();
+	}
+
+	static void WriteEscaped(std::ofstream& file, const std::string& text)
+	{
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+			{
+				file << '\\';
+			}
+			file << c;
+		}
+	}
+
+	bool WriteChromeTrace(const std::string& path)
+	{
+		std::ofstream file(path);
+		if (!file)
+		{
+			return false;
+		}
+
+		Registry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		//tick rate measured over the whole run
+		uint64_t nowTicks = Now();
+		double elapsedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - registry.startTime).count();
+		double usPerTick = (nowTicks > registry.startTicks && elapsedUs > 0.0) ? elapsedUs / (double)(nowTicks - registry.startTicks) : 0.0;
+
+		file << std::fixed << std::setprecision(3);
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		//zones are copied out of a ring first and formatted after, so the owner thread overwrites fewer of them meanwhile
+		struct CopiedZone
+		{
+			const char* name;
+			uint64_t start;
+			uint64_t end;
+		};
+		std::vector<CopiedZone> zones;
+		zones.reserve(ThreadBuffer::Capacity);
+
+		bool bFirst = true;
+		for (auto& buffer : registry.buffers)
+		{
+			if (!bFirst)
+			{
+				file << ",\n";
+			}
+			bFirst = false;
+
+			file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":\"";
+			WriteEscaped(file, buffer->threadName);
+			file << "\"}}";
+
+			uint64_t end = buffer->writeIndex.load(std::memory_order_acquire);
+			uint64_t begin = end > ThreadBuffer::Capacity ? end - ThreadBuffer::Capacity : 0;
+
+			zones.clear();
+			for (uint64_t index = begin; index < end; index++)
+			{
+				const ZoneEvent& event = buffer->events[index & (ThreadBuffer::Capacity - 1)];
+
+				uint64_t tag = event.tag.load(std::memory_order_acquire);
+				CopiedZone zone;
+				zone.name = event.name.load(std::memory_order_relaxed);
+				zone.start = event.start.load(std::memory_order_relaxed);
+				zone.end = event.end.load(std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				//overwritten by the owner thread while copying
+				if (tag != index + 1 || event.tag.load(std::memory_order_relaxed) != tag || zone.end < zone.start)
+				{
+					continue;
+				}
+				zones.push_back(zone);
+			}
+
+			for (const CopiedZone& zone : zones)
+			{
+				double ts = (double)(int64_t)(zone.start - registry.startTicks) * usPerTick;
+				double dur = (double)(zone.end - zone.start) * usPerTick;
+
+				file << ",\n{\"name\":\"";
+				WriteEscaped(file, zone.name);
+				file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+			}
+		}
+
+		file << "\n]}\n";
+		return true;
+	}
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define PROFILER_HAS_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_HAS_RDTSC 1
+#else
+#define PROFILER_HAS_RDTSC 0
+#endif
+
+// Zone profiler switch, define USE_ZONE_PROFILER=0 to compile every zone out
+#ifndef USE_ZONE_PROFILER
+#define USE_ZONE_PROFILER 1
+#endif
+
+// Scoped CPU zone profiler.
+// Every thread records completed zones into its own fixed size ring, no locks on the recording path.
+// Zones nest by time on each thread, the Chrome trace viewer / Perfetto rebuilds the hierarchy from that.
+// A thread that exits gives its ring back and the next new thread takes it over, track and all, so
+// thread pools that are created again and again don't add a ring per thread.
+namespace Profiler
+{
+	// One slot of a ring. Every slot is tagged with the index of its zone, so an export reading while the
+	// owner thread writes can detect and skip slots that were overwritten while it copied them
+	struct ZoneEvent
+	{
+		//zone index + 1 of the event in this slot, 0 while empty or being written
+		std::atomic<uint64_t> tag{ 0 };
+		//must be a string literal or otherwise outlive the profiler
+		std::atomic<const char*> name{ nullptr };
+		std::atomic<uint64_t> start{ 0 };
+		std::atomic<uint64_t> end{ 0 };
+	};
+
+	// Per thread event ring, written only by the thread that holds it
+	struct ThreadBuffer
+	{
+		static const uint64_t Capacity = 1 << 16;
+
+		ZoneEvent events[Capacity];
+		std::atomic<uint64_t> writeIndex{ 0 };
+
+		uint32_t threadId = 0;
+		std::string threadName;
+	};
+
+	//raw timestamp in ticks, rdtsc where available
+	inline uint64_t Now()
+	{
+#if PROFILER_HAS_RDTSC
+		return __rdtsc();
+#else
+		return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+	}
+
+	//buffer of the calling thread, registered on first use: one a thread that exited gave back, or a new one
+	ThreadBuffer* RegisterThread();
+
+	inline ThreadBuffer* GetThreadBuffer()
+	{
+		static thread_local ThreadBuffer* buffer = nullptr;
+		if (buffer == nullptr)
+		{
+			buffer = RegisterThread();
+		}
+		return buffer;
+	}
+
+	inline void RecordZone(const char* name, uint64_t start, uint64_t end)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+		uint64_t index = buffer->writeIndex.load(std::memory_order_relaxed);
+		ZoneEvent& event = buffer->events[index & (ThreadBuffer::Capacity - 1)];
+
+		//invalidate, write, then publish with the new tag
+		event.tag.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		event.name.store(name, std::memory_order_relaxed);
+		event.start.store(start, std::memory_order_relaxed);
+		event.end.store(end, std::memory_order_relaxed);
+
+		event.tag.store(index + 1, std::memory_order_release);
+		buffer->writeIndex.store(index + 1, std::memory_order_release);
+	}
+
+	//name shown for the calling thread in the trace
+	void SetThreadName(const char* name);
+
+	//write every zone still in the thread rings as Chrome trace event json
+	bool WriteChromeTrace(const std::string& path);
+
+	//number of zones recorded since startup, all threads
+	uint64_t GetZoneCount();
+
+	//rings allocated so far, at most the number of threads alive at once that recorded a zone
+	size_t GetThreadBufferCount();
+
+	// RAII zone, use through PROFILE_ZONE
+	class ScopedZone
+	{
+	public:
+		explicit ScopedZone(const char* inName) : name(inName), start(Now()) {}
+		~ScopedZone() { RecordZone(name, start, Now()); }
+
+		ScopedZone(const ScopedZone&) = delete;
+		ScopedZone& operator=(const ScopedZone&) = delete;
+
+	private:
+		const char* name;
+		uint64_t start;
+	};
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if USE_ZONE_PROFILER
+#define PROFILE_ZONE(name) Profiler::ScopedZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_THREAD_NAME(name) Profiler::SetThreadName(name)
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_THREAD_NAME(name)
+#endif
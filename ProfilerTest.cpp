@@ -0,0 +1,137 @@
+#include "UnitTest.h"
+#include "Profiler.h"
+#include "nlohmann/json.hpp"
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+
+using Json = nlohmann::json;
+
+//zone i is named after i % 4 and lasts (i % 4 + 1) million ticks, so a slot torn between two zones has a
+//duration that doesn't match its name
+static const char* const ZoneNames[] = { "zone0", "zone1", "zone2", "zone3" };
+static const uint64_t TicksPerStep = 1000000;
+
+//threads that start after others exited take over their rings instead of adding one each, and exports
+//while a thread keeps wrapping its ring around contain only whole zones
+bool CheckProfiler(std::string& outMessage)
+{
+	std::string failures;
+
+	//one more when this thread recorded nothing yet
+	const size_t bufferCount = Profiler::GetThreadBufferCount();
+	for (int i = 0; i < 16; i++)
+	{
+		std::thread([]() { PROFILE_ZONE("short lived"); }).join();
+	}
+	if (Profiler::GetThreadBufferCount() > bufferCount + 1)
+	{
+		failures += ", 16 threads one after another registered " + std::to_string(Profiler::GetThreadBufferCount() - bufferCount) + " rings";
+	}
+
+	std::atomic<bool> bStop{ false };
+	std::atomic<uint64_t> recordedCount{ 0 };
+	std::thread writer([&]()
+	{
+		PROFILE_THREAD_NAME("writer");
+		const uint64_t base = Profiler::Now();
+		for (uint64_t i = 0; !bStop.load(std::memory_order_relaxed) || i < 2 * Profiler::ThreadBuffer::Capacity; i++)
+		{
+			const uint64_t start = base + i * 4 * TicksPerStep;
+			Profiler::RecordZone(ZoneNames[i % 4], start, start + (i % 4 + 1) * TicksPerStep);
+			recordedCount.store(i + 1, std::memory_order_relaxed);
+		}
+	});
+
+	//exports start once the ring wrapped
+	while (recordedCount.load() < Profiler::ThreadBuffer::Capacity)
+	{
+		std::this_thread::yield();
+	}
+
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "UnitTestTrace.json";
+	uint64_t checkedCount = 0;
+	uint64_t tornCount = 0;
+	for (int exportIndex = 0; exportIndex < 4 && failures.empty(); exportIndex++)
+	{
+		if (!Profiler::WriteChromeTrace(path.string()))
+		{
+			failures += ", can't write " + path.string();
+			break;
+		}
+
+		Json trace;
+		try
+		{
+			std::ifstream file(path);
+			trace = Json::parse(file);
+		}
+		catch (const std::exception& exception)
+		{
+			failures += std::string(", trace isn't json: ") + exception.what();
+			break;
+		}
+
+		//duration of zone0 on each thread, every other zone is a multiple of it
+		std::map<std::string, int> nameSteps = { { "zone0", 1 }, { "zone1", 2 }, { "zone2", 3 }, { "zone3", 4 } };
+		std::map<int, double> stepDurations;
+		std::map<int, uint64_t> eventCounts;
+		for (const Json& event : trace["traceEvents"])
+		{
+			if (event["ph"] != "X")
+			{
+				continue;
+			}
+			int tid = event["tid"];
+			eventCounts[tid]++;
+			auto step = nameSteps.find(event["name"].get<std::string>());
+			if (step == nameSteps.end())
+			{
+				continue;
+			}
+			double duration = event["dur"].get<double>() / step->second;
+			if (stepDurations.count(tid) == 0)
+			{
+				stepDurations[tid] = duration;
+			}
+			else if (std::abs(duration - stepDurations[tid]) > 0.01 * stepDurations[tid] + 0.002)
+			{
+				tornCount++;
+			}
+			checkedCount++;
+		}
+		for (const auto& count : eventCounts)
+		{
+			if (count.second > Profiler::ThreadBuffer::Capacity)
+			{
+				failures += ", thread " + std::to_string(count.first) + " exported " + std::to_string(count.second) + " zones";
+			}
+		}
+	}
+	bStop = true;
+	writer.join();
+	std::filesystem::remove(path);
+
+	if (tornCount > 0)
+	{
+		failures += ", " + std::to_string(tornCount) + " exported zones were torn between two";
+	}
+	if (checkedCount == 0)
+	{
+		failures += ", no zones of the writer exported";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	const size_t ringCount = Profiler::GetThreadBufferCount();
+	outMessage = "17 threads on " + std::to_string(ringCount) + (ringCount == 1 ? " ring, " : " rings, ") + std::to_string(checkedCount) +
+		" zones exported while " + std::to_string(recordedCount.load()) + " were recorded";
+	return true;
+}
@@ -0,0 +1,154 @@
+#include "QualityGovernor.h"
+#include <algorithm>
+
+void QualityGovernor::SetLevels(const std::vector<QualityLevel>& inLevels)
+{
+	levels = inLevels;
+	decisions.clear();
+	bestLevel = 0;
+	Reset(0);
+}
+
+void QualityGovernor::Reset(int level)
+{
+	currentLevel = levels.empty() ? 0 : std::clamp(level, bestLevel, (int)levels.size() - 1);
+	bHasSample = false;
+	framesOver = 0;
+	framesUnder = 0;
+	framesOnLevel = 0;
+	cooldown = settings.cooldownFrames;
+}
+
+void QualityGovernor::SetBestLevel(int level)
+{
+	bestLevel = levels.empty() ? 0 : std::clamp(level, 0, (int)levels.size() - 1);
+	if (currentLevel < bestLevel)
+	{
+		Reset(bestLevel);
+	}
+}
+
+int QualityGovernor::Update(float measuredCost)
+{
+	frame++;
+
+	if (levels.empty())
+	{
+		return 0;
+	}
+
+	//moving average restarts on every switch so it only ever reflects the active level
+	if (!bHasSample)
+	{
+		smoothedCost = measuredCost;
+		bHasSample = true;
+	}
+	else
+	{
+		smoothedCost += settings.smoothing * (measuredCost - smoothedCost);
+	}
+
+	framesOnLevel++;
+	if (cooldown > 0)
+	{
+		cooldown--;
+	}
+
+	//remember what this level costs once there are enough samples
+	if (framesOnLevel >= settings.downFrames)
+	{
+		QualityLevel& level = levels[currentLevel];
+		level.measuredCost = smoothedCost;
+		level.lastMeasuredFrame = frame;
+		level.bMeasured = true;
+	}
+
+	const float overBudget = settings.target * (1.0f + settings.downThreshold);
+	const float underBudget = settings.target * (1.0f - settings.upThreshold);
+
+	if (smoothedCost > overBudget)
+	{
+		framesOver++;
+		framesUnder = 0;
+	}
+	else if (smoothedCost < underBudget)
+	{
+		framesUnder++;
+		framesOver = 0;
+	}
+	else
+	{
+		framesOver = 0;
+		framesUnder = 0;
+	}
+
+	const int lastLevel = (int)levels.size() - 1;
+
+	//over budget, degrade to the best level predicted to fit (at least one step)
+	if (framesOver >= settings.downFrames && currentLevel < lastLevel)
+	{
+		int next = currentLevel + 1;
+		while (next < lastLevel && PredictCost(next) > settings.target)
+		{
+			next++;
+		}
+		SwitchLevel(next, smoothedCost > settings.target * 2.0f ? "hitch" : "over budget");
+	}
+	//enough headroom for a while, try one step better
+	else if (framesUnder >= settings.upFrames && cooldown == 0 && currentLevel > bestLevel)
+	{
+		int next = currentLevel - 1;
+		const QualityLevel& level = levels[next];
+		bool bFresh = level.bMeasured && (frame - level.lastMeasuredFrame) < (uint64_t)settings.remeasureFrames;
+
+		if (!bFresh)
+		{
+			//never measured or stale, probe it, a failed probe is reverted after downFrames
+			SwitchLevel(next, "probe");
+		}
+		else if (level.measuredCost < underBudget)
+		{
+			SwitchLevel(next, "headroom");
+		}
+		else
+		{
+			//known to be too expensive, wait for the measurement to go stale
+			framesUnder = 0;
+		}
+	}
+
+	return currentLevel;
+}
+
+float QualityGovernor::PredictCost(int level) const
+{
+	const QualityLevel& target = levels[level];
+	if (target.bMeasured && (frame - target.lastMeasuredFrame) < (uint64_t)settings.remeasureFrames)
+	{
+		return target.measuredCost;
+	}
+
+	//scale the current cost by the relative cost guesses
+	const QualityLevel& current = levels[currentLevel];
+	float ratio = target.relativeCost / std::max(current.relativeCost, 1e-6f);
+	return smoothedCost * ratio;
+}
+
+void QualityGovernor::SwitchLevel(int level, const char* reason)
+{
+	QualityDecision decision;
+	decision.frame = frame;
+	decision.fromLevel = currentLevel;
+	decision.toLevel = level;
+	decision.smoothedCost = smoothedCost;
+	decision.target = settings.target;
+	decision.reason = reason;
+
+	decisions.push_back(decision);
+	if (decisions.size() > MaxDecisions)
+	{
+		decisions.pop_front();
+	}
+
+	Reset(level);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <deque>
+#include <cstdint>
+
+// Quality level the governor can pick, ordered from best quality to cheapest
+struct QualityLevel
+{
+	std::string name;
+
+	//relative cost guess used before the level was ever measured (1.0 = most expensive level)
+	float relativeCost = 1.0f;
+
+	//smoothed cost measured while this level was active
+	float measuredCost = 0.0f;
+	uint64_t lastMeasuredFrame = 0;
+	bool bMeasured = false;
+};
+
+// Record of a level switch, kept for the perf overlay
+struct QualityDecision
+{
+	uint64_t frame = 0;
+	int fromLevel = 0;
+	int toLevel = 0;
+	float smoothedCost = 0.0f;
+	float target = 0.0f;
+	const char* reason = "";
+};
+
+// Feedback controller that picks the best quality level fitting a cost budget.
+// Cost units are up to the caller (frame time in ms, decode ns/pixel, ...), the target just has to use the same unit.
+// Steps down quickly when over budget and only steps up again when the next level is predicted to fit with margin.
+class QualityGovernor
+{
+public:
+	struct Settings
+	{
+		//budget in caller units
+		float target = 16.6f;
+
+		//smoothing factor of the cost moving average
+		float smoothing = 0.1f;
+
+		//hysteresis band, step down above target * (1 + downThreshold), step up below target * (1 - upThreshold)
+		float downThreshold = 0.05f;
+		float upThreshold = 0.15f;
+
+		//consecutive frames outside the band before switching
+		int downFrames = 3;
+		int upFrames = 60;
+
+		//frames after a switch before stepping up again, lets the moving average settle on the new level
+		int cooldownFrames = 30;
+
+		//measurements older than this are treated as stale and the level may be probed again
+		int remeasureFrames = 600;
+	};
+
+	void SetLevels(const std::vector<QualityLevel>& inLevels);
+	const std::vector<QualityLevel>& GetLevels() const { return levels; }
+
+	Settings& GetSettings() { return settings; }
+
+	//feed the cost of the last frame, returns the level to use for the next one
+	int Update(float measuredCost);
+
+	//force a level, used when the governor is disabled. Clamped to the best level
+	void Reset(int level = 0);
+
+	//best quality level the governor may pick, the caller's own choice. It only ever steps down from there
+	void SetBestLevel(int level);
+	int GetBestLevel() const { return bestLevel; }
+
+	int GetLevel() const { return currentLevel; }
+	float GetSmoothedCost() const { return smoothedCost; }
+	uint64_t GetFrame() const { return frame; }
+
+	const std::deque<QualityDecision>& GetDecisions() const { return decisions; }
+
+	//predicted cost of a level, based on its own measurement or scaled from the current one
+	float PredictCost(int level) const;
+
+private:
+	void SwitchLevel(int level, const char* reason);
+
+	Settings settings;
+
+	std::vector<QualityLevel> levels;
+
+	int currentLevel = 0;
+	int bestLevel = 0;
+	float smoothedCost = 0.0f;
+	bool bHasSample = false;
+
+	int framesOver = 0;
+	int framesUnder = 0;
+	int framesOnLevel = 0;
+	int cooldown = 0;
+
+	uint64_t frame = 0;
+
+	//recent decisions, newest last
+	std::deque<QualityDecision> decisions;
+	static const size_t MaxDecisions = 16;
+};
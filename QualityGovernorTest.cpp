@@ -0,0 +1,128 @@
+#include "UnitTest.h"
+#include "QualityGovernor.h"
+#include <string>
+#include <vector>
+
+//synthetic frame costs through the hysteresis controller: it steps down after downFrames over budget in a row,
+//up only after upFrames under budget and the cooldown, never switches while the cost stays inside the band and
+//never steps up past the best level the caller picked
+bool CheckQualityGovernor(std::string& outMessage)
+{
+	std::vector<QualityLevel> levels(3);
+	levels[0].name = "full";
+	levels[0].relativeCost = 1.0f;
+	levels[1].name = "half";
+	levels[1].relativeCost = 0.5f;
+	levels[2].name = "quarter";
+	levels[2].relativeCost = 0.25f;
+
+	QualityGovernor governor;
+	QualityGovernor::Settings& settings = governor.GetSettings();
+	settings.target = 10.0f;
+	//every frame's cost is what the band sees
+	settings.smoothing = 1.0f;
+	settings.downFrames = 3;
+	settings.upFrames = 20;
+	settings.cooldownFrames = 30;
+	governor.SetLevels(levels);
+
+	//frames fed until the level changed, 0 when it didn't
+	auto feed = [&governor](float cost, int frameCount)
+	{
+		const int level = governor.GetLevel();
+		for (int i = 1; i <= frameCount; i++)
+		{
+			if (governor.Update(cost) != level)
+			{
+				return i;
+			}
+		}
+		return 0;
+	};
+
+	std::string failures;
+
+	//over budget twice, a frame in the band starts the count again
+	if (feed(12.0f, 2) != 0 || feed(10.0f, 1) != 0 || feed(12.0f, 2) != 0)
+	{
+		failures += ", stepped down before downFrames over budget in a row";
+	}
+	if (feed(12.0f, 1) != 1 || governor.GetLevel() != 1)
+	{
+		failures += ", didn't step down to level 1 on the third frame over budget";
+	}
+
+	//anywhere inside the band, long enough at either end for level 0's measurement to go stale
+	const size_t decisionCount = governor.GetDecisions().size();
+	for (int i = 0; i < 3000; i++)
+	{
+		governor.Update(i < 1000 ? 8.6f : (i < 2000 ? 10.4f : (i % 2 == 0 ? 8.6f : 10.4f)));
+	}
+	if (governor.GetLevel() != 1 || governor.GetDecisions().size() != decisionCount)
+	{
+		failures += ", switched inside the hysteresis band";
+	}
+
+	if (feed(30.0f, 3) != 3 || governor.GetLevel() != 2 || std::string(governor.GetDecisions().back().reason) != "hitch")
+	{
+		failures += ", a hitch didn't step down to the cheapest level";
+	}
+
+	//unmeasured levels, the cooldown is longer than upFrames and decides
+	governor.SetLevels(levels);
+	governor.Reset(2);
+	int upFrame = feed(5.0f, 100);
+	if (upFrame != settings.cooldownFrames || governor.GetLevel() != 1 || std::string(governor.GetDecisions().back().reason) != "probe")
+	{
+		failures += ", stepped up after " + std::to_string(upFrame) + " frames under budget instead of the cooldown";
+	}
+	upFrame = feed(5.0f, 100);
+	if (upFrame != settings.cooldownFrames || governor.GetLevel() != 0)
+	{
+		failures += ", second step up after " + std::to_string(upFrame) + " frames";
+	}
+
+	//a probe that doesn't fit goes back down after downFrames
+	if (feed(12.0f, 10) != settings.downFrames || governor.GetLevel() != 1)
+	{
+		failures += ", a failed probe wasn't reverted";
+	}
+
+	//with a short cooldown upFrames decides
+	settings.cooldownFrames = 5;
+	governor.SetLevels(levels);
+	governor.Reset(2);
+	upFrame = feed(5.0f, 100);
+	if (upFrame != settings.upFrames)
+	{
+		failures += ", stepped up after " + std::to_string(upFrame) + " frames under budget instead of upFrames";
+	}
+
+	//the caller picked the half cost level, plenty of headroom never brings back the full one
+	governor.SetLevels(levels);
+	governor.SetBestLevel(1);
+	if (governor.GetLevel() != 1)
+	{
+		failures += ", didn't start on the best level";
+	}
+	governor.Reset(2);
+	feed(1.0f, 1000);
+	if (governor.GetLevel() != 1)
+	{
+		failures += ", stepped up to level " + std::to_string(governor.GetLevel()) + " past the best level 1";
+	}
+	governor.Reset(0);
+	if (governor.GetLevel() != 1)
+	{
+		failures += ", reset above the best level";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = "down after 3 frames, up after 30 with the cooldown and 20 without, no switch in 3000 frames inside the band, "
+		"none past the best level";
+	return true;
+}
@@ -0,0 +1,115 @@
+#include "RenderBackend.h"
+#include "NeuralModel.h"
+#include "NeuralModelPool.h"
+#include "NullRenderBackend.h"
+#include "Profiler.h"
+#include "SoftwareRenderBackend.h"
+
+BackendMaterial::BackendMaterial(RenderBackend& inBackend, const MaterialDesc& inDesc)
+	: backend(inBackend), desc(inDesc)
+{
+}
+
+BackendMaterial::~BackendMaterial()
+{
+	backend.Destroy(table);
+	backend.Destroy(weightBuffer);
+	backend.Destroy(biasBuffer);
+	for (BackendTexture texture : textures)
+	{
+		backend.Destroy(texture);
+	}
+}
+
+std::unique_ptr<BackendMaterial> BackendMaterial::Create(RenderBackend& backend, const MaterialDesc& desc, std::string* error)
+{
+	PROFILE_ZONE("BackendMaterial::Create");
+
+	auto fail = [&](const std::string& message) -> std::unique_ptr<BackendMaterial>
+		{
+			if (error)
+			{
+				*error = message;
+			}
+			return nullptr;
+		};
+
+	//PSMain samples exactly four textures
+	if (desc.textures.size() != 4)
+	{
+		return fail("Material " + desc.name + " needs 4 textures");
+	}
+
+	MemoryTracker::OwnerScope ownerScope(desc.name);
+
+	std::unique_ptr<BackendMaterial> material(new BackendMaterial(backend, desc));
+	for (const MaterialTextureDesc& textureDesc : desc.textures)
+	{
+		std::string textureError;
+		BackendTexture texture = backend.CreateTexture(textureDesc.path, desc.name + "/" + textureDesc.slotName, &textureError);
+		if (texture.IsNull())
+		{
+			return fail(textureError);
+		}
+		material->textures.push_back(texture);
+	}
+
+	std::vector<BackendBuffer> buffers;
+	if (desc.IsNeural())
+	{
+		try
+		{
+			material->model = NeuralModelPool::Get().Load(desc.modelPath);
+		}
+		catch (const std::exception& exception)
+		{
+			return fail(std::string(exception.what()) + ": " + desc.modelPath);
+		}
+
+		//feature grids + uv in, albedo, normal, ao and roughness out
+		const std::vector<int32_t>& layerSizes = material->model->layer_sizes;
+		if (layerSizes.size() < 2 || layerSizes.front() != 14 || layerSizes.back() != 8)
+		{
+			return fail("Decoder must map 14 inputs to 8 outputs: " + desc.modelPath);
+		}
+
+		const NeuralModel& model = *material->model;
+		material->weightBuffer = backend.CreateBuffer(model.weights.data(), sizeof(float), model.weights.size(), MemoryCategory::ModelWeightsGPU, desc.name + "/weights");
+		material->biasBuffer = backend.CreateBuffer(model.bias.data(), sizeof(float), model.bias.size(), MemoryCategory::ModelWeightsGPU, desc.name + "/bias");
+		buffers = { material->weightBuffer, material->biasBuffer };
+	}
+
+	material->table = backend.CreateDescriptorTable(material->textures, buffers);
+	if (material->table.IsNull())
+	{
+		return fail("Can't create the descriptor table of " + desc.name);
+	}
+	return material;
+}
+
+void BackendMaterial::Draw(const RectConstantBuffer& constants)
+{
+	BackendDraw draw;
+	draw.shader = desc.shader;
+	draw.table = table;
+	draw.model = model;
+	draw.constants = constants;
+	backend.Draw(draw);
+}
+
+std::unique_ptr<RenderBackend> CreateHeadlessBackend(const std::string& name, uint32_t threadCount, std::string* error)
+{
+	if (name == "null")
+	{
+		return std::make_unique<NullRenderBackend>();
+	}
+	if (name == "software")
+	{
+		return std::make_unique<SoftwareRenderBackend>(threadCount);
+	}
+	if (error)
+	{
+		*error = "Unknown backend " + name + ", expected null or software";
+	}
+	return nullptr;
+}
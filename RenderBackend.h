@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ConstantBuffers.h"
+#include "MaterialLibrary.h"
+#include "MemoryTracker.h"
+
+typedef std::shared_ptr<class NeuralModel> NeuralModelPtr;
+
+// Id of an object owned by a RenderBackend, 0 is null. The tag keeps textures, buffers and
+// descriptor tables from being mixed up.
+template<typename Tag>
+struct BackendHandle
+{
+	uint32_t id = 0;
+
+	bool IsNull() const { return id == 0; }
+
+	bool operator==(const BackendHandle& other) const { return id == other.id; }
+	bool operator!=(const BackendHandle& other) const { return id != other.id; }
+};
+
+typedef BackendHandle<struct BackendTextureTag> BackendTexture;
+typedef BackendHandle<struct BackendBufferTag> BackendBuffer;
+typedef BackendHandle<struct BackendDescriptorTableTag> BackendDescriptorTable;
+
+// One full screen rect, everything PSMain reads
+struct BackendDraw
+{
+	MaterialShader shader = MaterialShader::PBR;
+
+	//views of the feature grids or textures, then the decoder weights and biases
+	BackendDescriptorTable table;
+
+	//neural shaders only, the cpu backends decode with it instead of reading the buffers back
+	NeuralModelPtr model;
+
+	RectConstantBuffer constants;
+};
+
+// What the pipeline above the device needs from it: buffers, textures, descriptors, command submission
+// and fences. The d3d12 viewer, a null backend recording commands for assertions and the cpu reference
+// of PSMain implement it, so materials and benchmark scenarios run the same code on each of them.
+// Destroyed objects stay alive until every submitted frame that could use them completed.
+class RenderBackend
+{
+public:
+	virtual ~RenderBackend() = default;
+
+	virtual std::string GetName() const = 0;
+
+	//null handle and error filled when the file can't be loaded
+	virtual BackendTexture CreateTexture(const std::string& path, const std::string& name, std::string* error = nullptr) = 0;
+	virtual BackendBuffer CreateBuffer(const void* data, size_t elementSize, size_t elementCount, MemoryCategory category, const std::string& name) = 0;
+
+	//views of textures then buffers in register order, null when one of them isn't live
+	virtual BackendDescriptorTable CreateDescriptorTable(const std::vector<BackendTexture>& textures, const std::vector<BackendBuffer>& buffers) = 0;
+
+	virtual void Destroy(BackendTexture texture) = 0;
+	virtual void Destroy(BackendBuffer buffer) = 0;
+	virtual void Destroy(BackendDescriptorTable table) = 0;
+
+	//size of the frames rendered from now on
+	virtual void SetResolution(uint32_t width, uint32_t height) = 0;
+
+	virtual void BeginFrame() = 0;
+	virtual void Draw(const BackendDraw& draw) = 0;
+
+	//submits the frame and returns the fence value signaled after it
+	virtual uint64_t EndFrame() = 0;
+
+	virtual uint64_t GetCompletedFenceValue() = 0;
+	virtual uint64_t GetLastSubmittedFenceValue() const = 0;
+	virtual void WaitForFence(uint64_t fenceValue) = 0;
+
+	void WaitForIdle() { WaitForFence(GetLastSubmittedFenceValue()); }
+
+	//gpu time of the last frame that finished, 0 when the backend has no timestamps
+	virtual double GetLastGpuMs() const { return 0.0; }
+
+	//time of that frame spent producing material inputs, on the gpu decode and shading are one pass
+	virtual double GetLastDecodeMs() const { return GetLastGpuMs(); }
+
+	//RGBA8 image of the last finished frame, false when the backend produces no pixels
+	virtual bool ReadFrame(std::vector<uint8_t>& outRGBA8, uint32_t& outWidth, uint32_t& outHeight) = 0;
+};
+
+// A MaterialDesc built on a backend: its textures, the decoder buffers and the descriptor table
+// binding them. Owns what it created and destroys it through the backend.
+// The headless counterpart of the viewer's Material, which stays on d3d12. Descriptor tables bind whole
+// buffers, so the decoder buffers are made per material rather than as ranges of the model pool arenas.
+class BackendMaterial
+{
+public:
+	~BackendMaterial();
+
+	//nullptr and error filled when a texture or the model can't be loaded
+	static std::unique_ptr<BackendMaterial> Create(RenderBackend& backend, const MaterialDesc& desc, std::string* error = nullptr);
+
+	const MaterialDesc& GetDesc() const { return desc; }
+
+	void Draw(const RectConstantBuffer& constants);
+
+private:
+	BackendMaterial(RenderBackend& inBackend, const MaterialDesc& inDesc);
+
+	RenderBackend& backend;
+	MaterialDesc desc;
+
+	std::vector<BackendTexture> textures;
+	NeuralModelPtr model;
+	BackendBuffer weightBuffer;
+	BackendBuffer biasBuffer;
+	BackendDescriptorTable table;
+};
+
+//"null" or "software", nullptr and error filled for any other name. The d3d12 backend needs a window
+//and is created by the windows entry point
+std::unique_ptr<RenderBackend> CreateHeadlessBackend(const std::string& name, uint32_t threadCount, std::string* error = nullptr);
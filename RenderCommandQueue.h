@@ -0,0 +1,297 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bounded multi-producer, single-consumer queue of render commands.
+// Commands are placement-constructed back to back in one of two linear arenas. Producers reserve space
+// with an atomic add, the consumer flips the arenas once per frame, runs and destroys everything in the
+// retired one and resets it. Pushing never allocates, a full arena makes Push fail instead. Once a push of a
+// frame failed every later one fails too, even one small enough for the space left, so push order is kept by
+// PushOrOverflow: what doesn't fit is constructed in spill chunks of the same arena, run after the arena's
+// commands. Spill chunks are kept for the next frames, they only allocate when a frame spills more than any before.
+// Context is what commands are called with, the device in the viewer or a mock in tests.
+template<typename Context>
+class RenderCommandQueue
+{
+public:
+	static const size_t DefaultArenaSize = 256 * 1024;
+
+	explicit RenderCommandQueue(size_t arenaSize = DefaultArenaSize)
+	{
+		for (Arena& arena : arenas)
+		{
+			arena.capacity = arenaSize / SlotAlignment * SlotAlignment;
+			arena.memory = std::make_unique<Slot[]>(arena.capacity / SlotAlignment);
+		}
+	}
+
+	~RenderCommandQueue()
+	{
+		//commands that never ran still own their captures
+		for (Arena& arena : arenas)
+		{
+			Reset(arena, nullptr);
+		}
+	}
+
+	RenderCommandQueue(const RenderCommandQueue&) = delete;
+	RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+	//thread safe, false when the arena of this frame is full and command was left untouched
+	template<typename Command>
+	bool Push(Command&& command)
+	{
+		Arena& arena = BeginWrite();
+		bool bFits = Write(arena, std::forward<Command>(command));
+		EndWrite(arena);
+		return bFits;
+	}
+
+	//thread safe, like Push but a command that fails goes to the spill chunks of the same frame. False when it
+	//went there
+	template<typename Command>
+	bool PushOrOverflow(Command&& command)
+	{
+		Arena& arena = BeginWrite();
+		bool bFits = Write(arena, std::forward<Command>(command));
+		if (!bFits)
+		{
+			//still a writer, the consumer can't take the chunks before this is in them
+			Spill(arena, std::forward<Command>(command));
+		}
+		EndWrite(arena);
+		return bFits;
+	}
+
+	//consumer thread only: flip the arenas, run every command pushed so far in order, spilled ones last, and reset.
+	//Returns the number of commands run
+	uint32_t Execute(Context& context)
+	{
+		uint32_t retiredIndex = current.fetch_xor(1);
+		Arena& arena = arenas[retiredIndex];
+
+		//producers that picked the retired arena before the flip are still writing
+		while (arena.writers.load() != 0)
+		{
+			std::this_thread::yield();
+		}
+
+		size_t used = arena.head.load();
+		size_t usedBytes = used < arena.capacity ? used : arena.capacity;
+		if (usedBytes > peakBytes)
+		{
+			peakBytes = usedBytes;
+		}
+
+		lastOverflowCount = arena.spilledCount;
+		return Reset(arena, &context);
+	}
+
+	size_t GetArenaSize() const { return arenas[0].capacity; }
+
+	//most bytes one frame used, to size the arenas
+	size_t GetPeakBytes() const { return peakBytes; }
+
+	//pushes that didn't go into an arena, overflowed ones included
+	uint64_t GetFailedPushCount() const { return failedPushes.load(std::memory_order_relaxed); }
+
+	//commands of the last Execute that ran from the spill chunks
+	size_t GetLastOverflowCount() const { return lastOverflowCount; }
+
+private:
+	//every command starts on a slot boundary, the header fits in one slot
+	static const size_t SlotAlignment = 32;
+
+	struct Header
+	{
+		uint32_t size = 0;
+		//null for padding
+		void (*invoke)(void* storage, Context& context) = nullptr;
+		void (*destroy)(void* storage) = nullptr;
+	};
+	static_assert(sizeof(Header) <= SlotAlignment, "Header must fit in one slot");
+
+	struct alignas(SlotAlignment) Slot
+	{
+		uint8_t bytes[SlotAlignment];
+	};
+
+	//commands laid out like the arena's, filled under the spill mutex
+	struct SpillChunk
+	{
+		std::unique_ptr<Slot[]> memory;
+		size_t capacity = 0;
+		size_t used = 0;
+	};
+
+	struct Arena
+	{
+		std::unique_ptr<Slot[]> memory;
+		size_t capacity = 0;
+		std::atomic<size_t> head{ 0 };
+		std::atomic<uint32_t> writers{ 0 };
+
+		std::mutex spillMutex;
+		std::vector<SpillChunk> spillChunks;
+		//chunks in use this frame, in spill order
+		size_t spillChunkCount = 0;
+		size_t spilledCount = 0;
+
+		void* At(size_t offset) { return reinterpret_cast<uint8_t*>(memory.get()) + offset; }
+	};
+
+	static void* GetStorage(Header* header)
+	{
+		return reinterpret_cast<uint8_t*>(header) + SlotAlignment;
+	}
+
+	//header slot, then the command
+	template<typename Stored>
+	static constexpr size_t GetCommandSize()
+	{
+		static_assert(alignof(Stored) <= SlotAlignment, "Render command is over aligned");
+		return SlotAlignment + (sizeof(Stored) + SlotAlignment - 1) / SlotAlignment * SlotAlignment;
+	}
+
+	template<typename Command>
+	static void Construct(void* at, size_t size, Command&& command)
+	{
+		typedef std::decay_t<Command> Stored;
+		Header* header = new (at) Header();
+		header->size = (uint32_t)size;
+		header->invoke = [](void* storage, Context& context) { (*static_cast<Stored*>(storage))(context); };
+		header->destroy = [](void* storage) { static_cast<Stored*>(storage)->~Stored(); };
+		new (GetStorage(header)) Stored(std::forward<Command>(command));
+	}
+
+	//runs the commands of [memory, memory + end) when context is set and destroys them
+	static uint32_t RunCommands(uint8_t* memory, size_t end, Context* context)
+	{
+		uint32_t count = 0;
+		for (size_t offset = 0; offset < end;)
+		{
+			Header* header = reinterpret_cast<Header*>(memory + offset);
+			if (header->invoke)
+			{
+				void* storage = GetStorage(header);
+				if (context)
+				{
+					header->invoke(storage, *context);
+					count++;
+				}
+				header->destroy(storage);
+			}
+			offset += header->size;
+		}
+		return count;
+	}
+
+	//registers as a writer of the current arena, retries when the consumer flipped in between
+	Arena& BeginWrite()
+	{
+		for (;;)
+		{
+			uint32_t index = current.load();
+			Arena& arena = arenas[index];
+			arena.writers.fetch_add(1);
+			if (current.load() == index)
+			{
+				return arena;
+			}
+			arena.writers.fetch_sub(1);
+		}
+	}
+
+	void EndWrite(Arena& arena)
+	{
+		arena.writers.fetch_sub(1);
+	}
+
+	//constructs command in the arena, false with command untouched when it doesn't fit
+	template<typename Command>
+	bool Write(Arena& arena, Command&& command)
+	{
+		const size_t size = GetCommandSize<std::decay_t<Command>>();
+
+		//the head only grows, once a reservation ends past the capacity every later one of the frame does too
+		size_t offset = arena.head.fetch_add(size);
+		bool bFits = offset + size <= arena.capacity;
+		if (bFits)
+		{
+			Construct(arena.At(offset), size, std::forward<Command>(command));
+		}
+		else
+		{
+			if (offset < arena.capacity)
+			{
+				//this push straddles the end, pad the rest so the consumer can walk past it
+				Header* header = new (arena.At(offset)) Header();
+				header->size = (uint32_t)(arena.capacity - offset);
+			}
+			failedPushes.fetch_add(1, std::memory_order_relaxed);
+		}
+		return bFits;
+	}
+
+	//constructs command at the end of the spill chunks in use, moving on to a kept chunk or a new one when it's full
+	template<typename Command>
+	void Spill(Arena& arena, Command&& command)
+	{
+		const size_t size = GetCommandSize<std::decay_t<Command>>();
+
+		std::lock_guard<std::mutex> lock(arena.spillMutex);
+		while (arena.spillChunkCount == 0 || arena.spillChunks[arena.spillChunkCount - 1].used + size > arena.spillChunks[arena.spillChunkCount - 1].capacity)
+		{
+			if (arena.spillChunkCount == arena.spillChunks.size())
+			{
+				SpillChunk chunk;
+				chunk.capacity = size > arena.capacity ? size : arena.capacity;
+				chunk.memory = std::make_unique<Slot[]>(chunk.capacity / SlotAlignment);
+				arena.spillChunks.push_back(std::move(chunk));
+			}
+			arena.spillChunks[arena.spillChunkCount].used = 0;
+			arena.spillChunkCount++;
+		}
+
+		SpillChunk& chunk = arena.spillChunks[arena.spillChunkCount - 1];
+		Construct(reinterpret_cast<uint8_t*>(chunk.memory.get()) + chunk.used, size, std::forward<Command>(command));
+		chunk.used += size;
+		arena.spilledCount++;
+	}
+
+	//runs the commands when context is set, destroys them and empties the arena and its spill chunks
+	uint32_t Reset(Arena& arena, Context* context)
+	{
+		size_t used = arena.head.load();
+		size_t end = used < arena.capacity ? used : arena.capacity;
+
+		uint32_t count = RunCommands(reinterpret_cast<uint8_t*>(arena.memory.get()), end, context);
+		for (size_t i = 0; i < arena.spillChunkCount; i++)
+		{
+			SpillChunk& chunk = arena.spillChunks[i];
+			count += RunCommands(reinterpret_cast<uint8_t*>(chunk.memory.get()), chunk.used, context);
+			chunk.used = 0;
+		}
+		arena.spillChunkCount = 0;
+		arena.spilledCount = 0;
+
+		arena.head.store(0);
+		return count;
+	}
+
+	Arena arenas[2];
+	std::atomic<uint32_t> current{ 0 };
+
+	size_t peakBytes = 0;
+	size_t lastOverflowCount = 0;
+	std::atomic<uint64_t> failedPushes{ 0 };
+};
@@ -0,0 +1,160 @@
+#include "UnitTest.h"
+#include "RenderCommandQueue.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Stands in for the device, the consumer checks every producer's commands arrive in the order pushed
+struct MockCommandContext
+{
+	//sequence number each producer's next command must have
+	std::vector<uint32_t> nextSequences;
+	uint32_t outOfOrderCount = 0;
+	uint64_t executedCount = 0;
+};
+
+//a command of producer with sequence number, holding token like a command holds the resources it uses
+static auto MakeSequencedCommand(std::shared_ptr<int> token, uint32_t producer, uint32_t sequence)
+{
+	return [token, producer, sequence](MockCommandContext& context)
+	{
+		if (context.nextSequences[producer] != sequence)
+		{
+			context.outOfOrderCount++;
+		}
+		context.nextSequences[producer] = sequence + 1;
+		context.executedCount++;
+	};
+}
+
+//producer threads push into small arenas while the consumer executes, so frames overflow under contention: every
+//command runs once, in the order its producer pushed it, and is destroyed. A full arena refuses a push untouched,
+//and move-only commands spill like the others
+bool CheckRenderCommandQueue(std::string& outMessage)
+{
+	std::string failures;
+	std::shared_ptr<int> token = std::make_shared<int>(0);
+
+	const uint32_t producerCount = 4;
+	const uint32_t commandsPerProducer = 20000;
+	uint64_t overflowCount = 0;
+	{
+		RenderCommandQueue<MockCommandContext> queue(16 * 1024);
+		MockCommandContext context;
+		context.nextSequences.resize(producerCount);
+
+		std::atomic<uint32_t> finishedCount{ 0 };
+		std::vector<std::thread> producers;
+		for (uint32_t p = 0; p < producerCount; p++)
+		{
+			producers.emplace_back([&, p]()
+			{
+				for (uint32_t s = 0; s < commandsPerProducer; s++)
+				{
+					queue.PushOrOverflow(MakeSequencedCommand(token, p, s));
+					//lets the consumer flip now and then, frames end both in the arena and overflowed
+					if (s % 64 == 0)
+					{
+						std::this_thread::yield();
+					}
+				}
+				finishedCount++;
+			});
+		}
+		while (finishedCount.load() < producerCount)
+		{
+			queue.Execute(context);
+		}
+		for (std::thread& producer : producers)
+		{
+			producer.join();
+		}
+		//what was pushed after the last flip
+		queue.Execute(context);
+		overflowCount = queue.GetFailedPushCount();
+
+		if (context.executedCount != (uint64_t)producerCount * commandsPerProducer)
+		{
+			failures += ", " + std::to_string(context.executedCount) + " of " + std::to_string(producerCount * commandsPerProducer) + " commands ran";
+		}
+		if (context.outOfOrderCount > 0)
+		{
+			failures += ", " + std::to_string(context.outOfOrderCount) + " commands ran out of their producer's order";
+		}
+		if (token.use_count() != 1)
+		{
+			failures += ", " + std::to_string(token.use_count() - 1) + " commands weren't destroyed after running";
+		}
+	}
+
+	{
+		//room for four commands
+		RenderCommandQueue<MockCommandContext> queue(256);
+		MockCommandContext context;
+		context.nextSequences.resize(1);
+
+		uint32_t pushedCount = 0;
+		while (pushedCount < 16 && queue.Push(MakeSequencedCommand(token, 0, pushedCount)))
+		{
+			pushedCount++;
+		}
+		auto command = MakeSequencedCommand(token, 0, pushedCount);
+		long useCount = token.use_count();
+		if (pushedCount != 4 || queue.Push(std::move(command)) || token.use_count() != useCount)
+		{
+			failures += ", a full arena took " + std::to_string(pushedCount) + " commands or the one after them";
+		}
+		if (queue.GetFailedPushCount() != 2)
+		{
+			failures += ", " + std::to_string(queue.GetFailedPushCount()) + " failed pushes counted instead of 2";
+		}
+
+		//the refused command and one after it overflow and run after the arena, in order
+		queue.PushOrOverflow(std::move(command));
+		queue.PushOrOverflow(MakeSequencedCommand(token, 0, pushedCount + 1));
+		uint32_t executedCount = queue.Execute(context);
+		if (executedCount != pushedCount + 2 || queue.GetLastOverflowCount() != 2 || context.outOfOrderCount > 0)
+		{
+			failures += ", overflowed commands didn't run after the arena's";
+		}
+		if (!queue.Push(MakeSequencedCommand(token, 0, pushedCount + 2)) || queue.Execute(context) != 1)
+		{
+			failures += ", the arena wasn't empty again the next frame";
+		}
+		if (token.use_count() != 1)
+		{
+			failures += ", overflowed commands weren't destroyed";
+		}
+	}
+
+	{
+		RenderCommandQueue<MockCommandContext> queue(256);
+		MockCommandContext context;
+		uint32_t ranCount = 0;
+		for (int frame = 0; frame < 2; frame++)
+		{
+			//four fit, the rest spill
+			for (int i = 0; i < 12; i++)
+			{
+				std::unique_ptr<uint32_t> owned = std::make_unique<uint32_t>(1);
+				queue.PushOrOverflow([owned = std::move(owned), &ranCount](MockCommandContext&) { ranCount += *owned; });
+			}
+			queue.Execute(context);
+		}
+		if (ranCount != 24 || queue.GetLastOverflowCount() != 8)
+		{
+			failures += ", " + std::to_string(ranCount) + " of 24 move-only commands ran";
+		}
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(producerCount) + " producers, " + std::to_string(producerCount * commandsPerProducer) + " commands, " +
+		std::to_string(overflowCount) + " overflowed";
+	return true;
+}
@@ -5,45 +5,157 @@
 #include "Texture2D.h"
 #include "Graphics.h"
 #include "NeuralModel.h"
+#include "StructuredBuffer.h"
 #include <DirectXMath.h>
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "BakedDecoders.h"
+#include <filesystem>
 
 #pragma comment(lib, "d3dcompiler.lib")
 
-void Shader::Compile(D3D12GraphicsDevice& device)
+static const char* ShaderRoot = "Shaders/";
+
+const char* ShaderArchivePath = "Shaders/ShaderCache.bin";
+
+static UINT GetShaderCompileFlags()
 {
-	//compile shader
-	std::wstring shaderFilePath = GetShaderFilePath();
-	std::string shaderEntryPoint = GetShaderEntryPoint();
-	std::string shaderTarget = GetShaderTarget();
+	UINT compileFlags = 0;
+#ifdef _DEBUG
+	//compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+	compileFlags = D3DCOMPILE_OPTIMIZATION_LEVEL3;
+#endif
+	return compileFlags;
+}
 
-	ID3D10Blob* errorBlob = nullptr;
+ShaderPermutation Shader::GetPermutation() const
+{
+	ShaderPermutation permutation;
 
-	std::wstring shaderRoot = L"Shaders/";
-	shaderFilePath = shaderRoot + shaderFilePath;
+	std::wstring shaderFilePath = GetShaderFilePath();
+	permutation.file.assign(shaderFilePath.begin(), shaderFilePath.end());
+	permutation.entryPoint = GetShaderEntryPoint();
+	permutation.target = GetShaderTarget();
 
 	std::vector<D3D_SHADER_MACRO> defines;
 	GetDefines(defines);
+	for (const D3D_SHADER_MACRO& define : defines)
+	{
+		permutation.defines.push_back({ define.Name, define.Definition ? define.Definition : "" });
+	}
+
+	permutation.compileFlags = GetShaderCompileFlags();
+	return permutation;
+}
+
+//nullptr when the compiler fails, its errors are printed
+static Microsoft::WRL::ComPtr<ID3DBlob> CompileShaderBytecode(const ShaderPermutation& permutation)
+{
+	PROFILE_ZONE("Shader::Compile");
+
+	std::string path = ShaderRoot + permutation.file;
+	std::wstring shaderFilePath(path.begin(), path.end());
+
+	std::vector<D3D_SHADER_MACRO> defines;
+	for (const auto& define : permutation.defines)
+	{
+		defines.push_back({ define.first.c_str(), define.second.c_str() });
+	}
 	defines.push_back({ nullptr, nullptr });
 
 	//include
 	ID3DInclude* include = D3D_COMPILE_STANDARD_FILE_INCLUDE;
 
-	UINT compileFlags = 0;
-#ifdef _DEBUG
-	//compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-	compileFlags = D3DCOMPILE_OPTIMIZATION_LEVEL3;
-#endif
-
-	HRESULT hr = D3DCompileFromFile(shaderFilePath.c_str(), defines.data(), include, shaderEntryPoint.c_str(), shaderTarget.c_str(), compileFlags, 0, &shaderBlob, &errorBlob);
+	Microsoft::WRL::ComPtr<ID3DBlob> shaderBlob;
+	ID3D10Blob* errorBlob = nullptr;
+	HRESULT hr = D3DCompileFromFile(shaderFilePath.c_str(), defines.data(), include, permutation.entryPoint.c_str(), permutation.target.c_str(), permutation.compileFlags, 0, &shaderBlob, &errorBlob);
 	if (FAILED(hr))
 	{
-		std::cout << "Failed to compile shader" << std::endl;
+		std::cout << "Failed to compile shader " << permutation.GetDescription() << std::endl;
 		if (errorBlob)
 		{
 			std::cout << (char*)errorBlob->GetBufferPointer() << std::endl;
 			errorBlob->Release();
 		}
+		return nullptr;
+	}
+	return shaderBlob;
+}
+
+//bytecode from cache while the source, defines and flags are unchanged, compiled and stored in it otherwise
+static Microsoft::WRL::ComPtr<ID3DBlob> LoadShaderBytecode(ShaderCache& cache, const ShaderPermutation& permutation)
+{
+	uint64_t sourceHash = 0;
+	std::string error;
+	if (!HashShaderSource(ShaderRoot, permutation.file, sourceHash, nullptr, &error))
+	{
+		//the compiler reports it as well
+		std::cout << error << std::endl;
+		return CompileShaderBytecode(permutation);
+	}
+	uint64_t key = ComputeShaderKey(sourceHash, permutation);
+
+	std::vector<uint8_t> bytecode;
+	Microsoft::WRL::ComPtr<ID3DBlob> shaderBlob;
+	if (cache.Find(key, bytecode) && SUCCEEDED(D3DCreateBlob(bytecode.size(), &shaderBlob)))
+	{
+		memcpy(shaderBlob->GetBufferPointer(), bytecode.data(), bytecode.size());
+		return shaderBlob;
+	}
+
+	shaderBlob = CompileShaderBytecode(permutation);
+	if (shaderBlob)
+	{
+		cache.Store(key, shaderBlob->GetBufferPointer(), shaderBlob->GetBufferSize());
+	}
+	return shaderBlob;
+}
+
+void Shader::Compile(D3D12GraphicsDevice& device)
+{
+	shaderBlob = LoadShaderBytecode(ShaderCache::Get(), GetPermutation());
+}
+
+int PrecompileShaders(const std::string& archivePath)
+{
+	//every class ShaderMap is asked for
+	std::vector<std::shared_ptr<Shader>> shaders =
+	{
+		std::make_shared<VertexShader>(),
+		std::make_shared<PixelShader>(),
+		std::make_shared<NeuralPixelShader>(),
+		std::make_shared<NeuralPixelShaderLight<16>>(),
+		std::make_shared<NeuralPixelShaderLight<32>>(),
+	};
+	for (const BakedDecoder* decoder : GetBakedDecoders())
+	{
+		if (std::filesystem::exists(std::string(ShaderRoot) + "Baked/" + decoder->name + ".hlsl"))
+		{
+			shaders.push_back(std::make_shared<BakedNeuralPixelShader>(decoder->name));
+		}
+	}
+
+	//only what is compiled now goes into the archive, never stale loose files
+	ShaderCache archive;
+	int failed = 0;
+	for (const std::shared_ptr<Shader>& shader : shaders)
+	{
+		ShaderPermutation permutation = shader->GetPermutation();
+		std::cout << "Compiling " << permutation.GetDescription() << std::endl;
+		if (!LoadShaderBytecode(archive, permutation))
+		{
+			failed++;
+		}
+	}
+
+	std::string error;
+	if (!archive.SaveArchive(archivePath, &error))
+	{
+		std::cout << error << std::endl;
+		return 1;
 	}
+	std::cout << "Wrote " << archive.GetEntryCount() << " shaders to " << archivePath << std::endl;
+	return failed == 0 ? 0 : 1;
 }
 
 std::vector<D3D12_INPUT_ELEMENT_DESC> VertexShader::GetInputLayout() const
@@ -60,7 +172,6 @@ void PixelShader::Compile(D3D12GraphicsDevice& device)
 {
 	Shader::Compile(device);
 	CreateRootSignature(device);
-	CreateConstantBuffer(device);
 }
 
 void PixelShader::CreateRootSignature(D3D12GraphicsDevice& device)
@@ -71,23 +182,24 @@ void PixelShader::CreateRootSignature(D3D12GraphicsDevice& device)
 	GetCBVs(cbvs);
 	GetUAVs(uavs);
 
-	size_t numRootParameters = srvs.size() + cbvs.size() + uavs.size();
+	//every srv in one table, t0 to tN-1
+	size_t numRootParameters = (srvs.empty() ? 0 : 1) + cbvs.size() + uavs.size();
 
 	std::vector<CD3DX12_ROOT_PARAMETER> rootParameters(numRootParameters);
 	std::vector<CD3DX12_DESCRIPTOR_RANGE> ranges(numRootParameters);
 
 	int rootParameterIndex = 0;
-	for (int i = 0; i < srvs.size(); i++)
+	if (!srvs.empty())
 	{
-		ranges[rootParameterIndex].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, i);
+		ranges[rootParameterIndex].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, (UINT)srvs.size(), 0);
 		rootParameters[rootParameterIndex].InitAsDescriptorTable(1, &ranges[rootParameterIndex]);
 		rootParameterIndex++;
 	}
 
+	//constants are root CBVs, pointed straight at a slice of the device constant ring
 	for (int i = 0; i < cbvs.size(); i++)
 	{
-		ranges[rootParameterIndex].Init(D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, i);
-		rootParameters[rootParameterIndex].InitAsDescriptorTable(1, &ranges[rootParameterIndex]);
+		rootParameters[rootParameterIndex].InitAsConstantBufferView(i);
 		rootParameterIndex++;
 	}
 
@@ -117,84 +229,17 @@ void PixelShader::CreateRootSignature(D3D12GraphicsDevice& device)
 	CHECKHR(device.GetDevice()->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&rootSignature)));
 }
 
-void PixelShader::CreateConstantBuffer(D3D12GraphicsDevice& device)
-{
-	UINT cbSize = sizeof(RectConstantBuffer);
-
-	D3D12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
-
-	CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(cbSize);
-	device.GetDevice()->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&constantBuffer.resource));
-
-	//create constant buffer view
-	D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
-	cbvDesc.BufferLocation = constantBuffer.resource->GetGPUVirtualAddress();
-	cbvDesc.SizeInBytes = cbSize;
-
-	heapAllocator.Alloc(&constantBuffer.cpuHandle, &constantBuffer.gpuHandle);
-	device.GetDevice()->CreateConstantBufferView(&cbvDesc, constantBuffer.cpuHandle);
-}
-
-void PixelShader::SetShaderParameters(D3D12GraphicsDevice& device, const std::vector<Texture2DPtr>& textures, const RectConstantBuffer& rectConstantBuffer)
+void PixelShader::SetShaderParameters(D3D12GraphicsDevice& device, D3D12_GPU_DESCRIPTOR_HANDLE srvTable, const RectConstantBuffer& rectConstantBuffer)
 {
 	//set shader parameters
 	ID3D12GraphicsCommandList* commandList = device.GetCommandList();
 
 	commandList->SetGraphicsRootSignature(rootSignature.Get());
 
+	//textures and buffers in one call
 	int rootdescriptorIndex = 0;
-	for (int i = 0; i < textures.size(); i++)
-	{	
-		commandList->SetGraphicsRootDescriptorTable(i, textures[i]->gpuHandle);
-	}
-
-	rootdescriptorIndex += (int)textures.size();
-
-;
-	//update constant buffer
-	void* mappedBuffer;
-	CHECKHR(constantBuffer.resource->Map(0, 0, &mappedBuffer));
-	memcpy(mappedBuffer, &rectConstantBuffer, sizeof(RectConstantBuffer));
-	constantBuffer.resource->Unmap(0, 0);
-
-	commandList->SetGraphicsRootDescriptorTable(rootdescriptorIndex, constantBuffer.gpuHandle);
-
-	//commandList->SetGraphicsRootConstantBufferView(ConstantBuffer, constantBuffer.resource->GetGPUVirtualAddress());
-}
-
-void NeuralPixelShader::SetShaderParameters(D3D12GraphicsDevice& device, const std::vector<Texture2DPtr>& textures, const RectConstantBuffer& rectConstantBuffer, const NeuralModelPtr& model)
-{
-	//Set Model Parameters
-	ID3D12GraphicsCommandList* commandList = device.GetCommandList();
-
-	//Set Shader Parameters
-	commandList->SetGraphicsRootSignature(rootSignature.Get());
-
-	int rootdescriptorIndex = 0;
-	//Set Textures
-	for (int i = 0; i < textures.size(); i++)
-	{
-		commandList->SetGraphicsRootDescriptorTable(i, textures[i]->gpuHandle);
-	}
-
-	rootdescriptorIndex += (int)textures.size();
-
-	if (model->weightBuffer == nullptr || model->biasBuffer == nullptr)
-	{
-		model->CreateBuffers(device);
-	}
-
-	//Set Model Parameters
-	commandList->SetGraphicsRootDescriptorTable(rootdescriptorIndex++, model->weightBuffer->gpuHandle);
-	commandList->SetGraphicsRootDescriptorTable(rootdescriptorIndex++, model->biasBuffer->gpuHandle);
-
-	//Set rect constant buffer
-	void* mappedBuffer;
-	CHECKHR(constantBuffer.resource->Map(0, 0, &mappedBuffer));
-	memcpy(mappedBuffer, &rectConstantBuffer, sizeof(RectConstantBuffer));
-	constantBuffer.resource->Unmap(0, 0);
-
-	commandList->SetGraphicsRootDescriptorTable(rootdescriptorIndex++, constantBuffer.gpuHandle);
-
+	commandList->SetGraphicsRootDescriptorTable(rootdescriptorIndex++, srvTable);
 
+	//every draw gets its own copy of the constants, earlier draws of the frame keep theirs
+	commandList->SetGraphicsRootConstantBufferView(rootdescriptorIndex, device.UploadConstants(rectConstantBuffer));
 }
@@ -4,6 +4,7 @@
 #include <wrl\client.h>
 #include <d3d12.h>
 #include <memory>
+#include "ShaderCache.h"
 
 class Shader
 {
@@ -37,6 +38,9 @@ public :
 	{
 	}
 
+	//file, entry point, target, defines and flags passed to the compiler, the shader cache key is made from these
+	ShaderPermutation GetPermutation() const;
+
 protected:
 	virtual void Compile(class D3D12GraphicsDevice& device);
 
@@ -111,26 +115,16 @@ public:
 		return rootSignature;
 	}
 
-	typedef std::shared_ptr<struct Texture2D> Texture2DPtr;
-	void SetShaderParameters(class D3D12GraphicsDevice& device, const std::vector<Texture2DPtr>& textures, const struct RectConstantBuffer& rectConstantBuffer);
+	//srvTable holds the views of GetSRVs in order, bound with a single root descriptor table. Constants go to a root CBV
+	void SetShaderParameters(class D3D12GraphicsDevice& device, D3D12_GPU_DESCRIPTOR_HANDLE srvTable, const struct RectConstantBuffer& rectConstantBuffer);
 
 protected:
 	Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature;
 	Microsoft::WRL::ComPtr<ID3DBlob> signature;
 
-	//constant buffer
-	struct {
-		Microsoft::WRL::ComPtr<ID3D12Resource> resource;
-		D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle;
-		D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
-	} constantBuffer;
-
-
 	virtual void Compile(D3D12GraphicsDevice& device) override;
 
 	void CreateRootSignature(class D3D12GraphicsDevice& device);
-
-	virtual void CreateConstantBuffer(class D3D12GraphicsDevice& device);
 };
 
 class NeuralPixelShader : public PixelShader
@@ -171,10 +165,6 @@ protected:
 		samplerDesc.ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;
 		outSamplerStates.push_back(samplerDesc);
 	}
-
-public:
-	typedef std::shared_ptr<class NeuralModel> NeuralModelPtr;
-	void SetShaderParameters(class D3D12GraphicsDevice& device, const std::vector<Texture2DPtr>& textures, const struct RectConstantBuffer& rectConstantBuffer, const NeuralModelPtr& model);
 };
 
 
@@ -200,6 +190,25 @@ protected:
 };
 
 
+//NeuralPixelShader with the forward() of one model baked in, Shaders/Baked/<model>.hlsl written by DecoderCompiler
+class BakedNeuralPixelShader : public NeuralPixelShader
+{
+public:
+	explicit BakedNeuralPixelShader(const std::string& inModelName)
+		: modelName(inModelName)
+	{
+	}
+
+	std::wstring GetShaderFilePath() const override
+	{
+		return L"Baked/" + std::wstring(modelName.begin(), modelName.end()) + L".hlsl";
+	}
+
+private:
+	std::string modelName;
+};
+
+
 class ShaderMap
 {
 
@@ -217,9 +226,14 @@ public:
 	{
 		shaders[name] = shader;
 	}
-	//Get shader
-	template<typename T>
-	std::shared_ptr<T> GetShader(class D3D12GraphicsDevice& device, const std::string& name)
+	//release every shader, at shutdown
+	void Clear()
+	{
+		shaders.clear();
+	}
+	//Get shader, arguments go to the constructor when it's created
+	template<typename T, typename... Args>
+	std::shared_ptr<T> GetShader(class D3D12GraphicsDevice& device, const std::string& name, Args&&... args)
 	{
 		//found
 		if (shaders.find(name) != shaders.end())
@@ -227,7 +241,7 @@ public:
 			return std::dynamic_pointer_cast<T>(shaders[name]);
 		}
 
-		auto shader = std::make_shared<T>();
+		auto shader = std::make_shared<T>(std::forward<Args>(args)...);
 		shader->Initialize(device);
 		shaders[name] = shader;
 
@@ -239,3 +253,10 @@ private:
 	std::unordered_map<std::string, std::shared_ptr<Shader>> shaders;
 };
 
+//shader archive loaded at startup and written by --precompile-shaders
+extern const char* ShaderArchivePath;
+
+//compile every variant ShaderMap hands out into one archive at path, no device needed.
+//Returns the process exit code
+int PrecompileShaders(const std::string& archivePath);
+
@@ -0,0 +1,363 @@
+#include "ShaderCache.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+
+static const char ShaderArchiveMagic[4] = { 'N', 'T', 'S', 'A' };
+static const uint32_t ShaderArchiveVersion = 1;
+
+//part of every key, bumped when the layout of keys or bytecode changes
+static const uint32_t ShaderKeyVersion = 1;
+
+static bool Fail(std::string* error, const std::string& message)
+{
+	if (error)
+	{
+		*error = message;
+	}
+	return false;
+}
+
+std::string ShaderPermutation::GetDescription() const
+{
+	std::string description = file + " " + entryPoint + " " + target;
+	for (const auto& define : defines)
+	{
+		description += " " + define.first + "=" + define.second;
+	}
+	return description;
+}
+
+uint64_t HashShaderBytes(const void* data, size_t size, uint64_t hash)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
+//strings are hashed with their length so "a" "bc" and "ab" "c" differ
+static uint64_t HashString(const std::string& value, uint64_t hash)
+{
+	uint64_t size = value.size();
+	hash = HashShaderBytes(&size, sizeof(size), hash);
+	return HashShaderBytes(value.data(), value.size(), hash);
+}
+
+//name of the #include on line, empty for any other line
+static std::string ParseInclude(const std::string& line)
+{
+	size_t position = line.find_first_not_of(" \t");
+	if (position == std::string::npos || line[position] != '#')
+	{
+		return "";
+	}
+	position = line.find_first_not_of(" \t", position + 1);
+	if (position == std::string::npos || line.compare(position, 7, "include") != 0)
+	{
+		return "";
+	}
+	position = line.find_first_of("\"<", position + 7);
+	if (position == std::string::npos)
+	{
+		return "";
+	}
+	size_t end = line.find(line[position] == '"' ? '"' : '>', position + 1);
+	if (end == std::string::npos)
+	{
+		return "";
+	}
+	return line.substr(position + 1, end - position - 1);
+}
+
+static bool HashSourceFile(const std::filesystem::path& root, const std::filesystem::path& path, uint64_t& hash, std::set<std::filesystem::path>& visited, std::vector<std::string>* outFiles, std::string* error)
+{
+	std::filesystem::path normalized = path.lexically_normal();
+	if (!visited.insert(normalized).second)
+	{
+		return true;
+	}
+
+	std::ifstream file(normalized, std::ios::binary);
+	if (!file)
+	{
+		return Fail(error, "Shader source not found: " + normalized.generic_string());
+	}
+	std::stringstream stream;
+	stream << file.rdbuf();
+	std::string text = stream.str();
+
+	//relative names, so a checkout anywhere else gives the same keys
+	std::string name = normalized.lexically_relative(root.lexically_normal()).generic_string();
+	hash = HashString(name, hash);
+	hash = HashString(text, hash);
+	if (outFiles)
+	{
+		outFiles->push_back(name);
+	}
+
+	std::istringstream lines(text);
+	std::string line;
+	while (std::getline(lines, line))
+	{
+		std::string include = ParseInclude(line);
+		if (include.empty())
+		{
+			continue;
+		}
+
+		//next to the including file first, then the root
+		std::filesystem::path includePath = normalized.parent_path() / include;
+		if (!std::filesystem::exists(includePath))
+		{
+			includePath = root / include;
+		}
+		if (!HashSourceFile(root, includePath, hash, visited, outFiles, error))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool HashShaderSource(const std::string& root, const std::string& file, uint64_t& outHash, std::vector<std::string>* outFiles, std::string* error)
+{
+	PROFILE_ZONE("HashShaderSource");
+
+	std::set<std::filesystem::path> visited;
+	uint64_t hash = HashShaderBytes(nullptr, 0);
+	if (!HashSourceFile(root, std::filesystem::path(root) / file, hash, visited, outFiles, error))
+	{
+		return false;
+	}
+	outHash = hash;
+	return true;
+}
+
+uint64_t ComputeShaderKey(uint64_t sourceHash, const ShaderPermutation& permutation)
+{
+	uint64_t hash = HashShaderBytes(&ShaderKeyVersion, sizeof(ShaderKeyVersion));
+	hash = HashShaderBytes(&sourceHash, sizeof(sourceHash), hash);
+	hash = HashString(permutation.entryPoint, hash);
+	hash = HashString(permutation.target, hash);
+
+	uint64_t defineCount = permutation.defines.size();
+	hash = HashShaderBytes(&defineCount, sizeof(defineCount), hash);
+	for (const auto& define : permutation.defines)
+	{
+		hash = HashString(define.first, hash);
+		hash = HashString(define.second, hash);
+	}
+	return HashShaderBytes(&permutation.compileFlags, sizeof(permutation.compileFlags), hash);
+}
+
+std::string FormatShaderKey(uint64_t key)
+{
+	static const char digits[] = "0123456789abcdef";
+
+	std::string text(16, '0');
+	for (int i = 15; i >= 0; i--)
+	{
+		text[i] = digits[key & 0xf];
+		key >>= 4;
+	}
+	return text;
+}
+
+void ShaderCache::SetDirectory(const std::string& inDirectory)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	directory = inDirectory;
+}
+
+bool ShaderCache::Find(uint64_t key, std::vector<uint8_t>& outBytecode)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto it = entries.find(key);
+	if (it != entries.end())
+	{
+		outBytecode = it->second;
+		stats.hits++;
+		return true;
+	}
+
+	if (!directory.empty())
+	{
+		std::ifstream file(GetFilePath(key), std::ios::binary | std::ios::ate);
+		if (file)
+		{
+			std::vector<uint8_t> bytecode((size_t)file.tellg());
+			file.seekg(0);
+			file.read((char*)bytecode.data(), bytecode.size());
+			if (file && !bytecode.empty())
+			{
+				outBytecode = bytecode;
+				entries[key] = std::move(bytecode);
+				stats.hits++;
+				stats.fileEntries++;
+				return true;
+			}
+		}
+	}
+
+	stats.misses++;
+	return false;
+}
+
+void ShaderCache::Store(uint64_t key, const void* bytecode, size_t size)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	const uint8_t* bytes = (const uint8_t*)bytecode;
+	entries[key].assign(bytes, bytes + size);
+
+	if (!directory.empty())
+	{
+		std::error_code errorCode;
+		std::filesystem::create_directories(directory, errorCode);
+
+		std::ofstream file(GetFilePath(key), std::ios::binary);
+		file.write((const char*)bytes, size);
+		if (!file)
+		{
+			std::cout << "Failed to write shader cache file " << GetFilePath(key) << std::endl;
+		}
+	}
+}
+
+bool ShaderCache::LoadArchive(const std::string& path, std::string* error)
+{
+	PROFILE_ZONE("ShaderCache::LoadArchive");
+
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		return Fail(error, "Shader archive not found: " + path);
+	}
+
+	std::vector<uint8_t> bytes((size_t)file.tellg());
+	file.seekg(0);
+	file.read((char*)bytes.data(), bytes.size());
+
+	//magic, version, entry count
+	const size_t headerSize = sizeof(ShaderArchiveMagic) + 2 * sizeof(uint32_t);
+	uint32_t version = 0;
+	uint32_t count = 0;
+	if (bytes.size() < headerSize || memcmp(bytes.data(), ShaderArchiveMagic, sizeof(ShaderArchiveMagic)) != 0)
+	{
+		return Fail(error, "Not a shader archive: " + path);
+	}
+	memcpy(&version, bytes.data() + 4, sizeof(version));
+	memcpy(&count, bytes.data() + 8, sizeof(count));
+	if (version != ShaderArchiveVersion)
+	{
+		return Fail(error, "Shader archive version " + std::to_string(version) + " instead of " + std::to_string(ShaderArchiveVersion) + ": " + path);
+	}
+
+	//key, size and hash of the bytecode, then the bytecode
+	std::vector<std::pair<uint64_t, std::vector<uint8_t>>> archiveEntries;
+	size_t offset = headerSize;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint64_t entryHeader[3];
+		if (bytes.size() - offset < sizeof(entryHeader))
+		{
+			return Fail(error, "Shader archive truncated: " + path);
+		}
+		memcpy(entryHeader, bytes.data() + offset, sizeof(entryHeader));
+		offset += sizeof(entryHeader);
+
+		uint64_t size = entryHeader[1];
+		if (bytes.size() - offset < size)
+		{
+			return Fail(error, "Shader archive truncated: " + path);
+		}
+		if (HashShaderBytes(bytes.data() + offset, (size_t)size) != entryHeader[2])
+		{
+			return Fail(error, "Shader archive entry " + FormatShaderKey(entryHeader[0]) + " is damaged: " + path);
+		}
+		archiveEntries.emplace_back(entryHeader[0], std::vector<uint8_t>(bytes.data() + offset, bytes.data() + offset + size));
+		offset += (size_t)size;
+	}
+	if (offset != bytes.size())
+	{
+		return Fail(error, "Shader archive has trailing bytes: " + path);
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto& entry : archiveEntries)
+	{
+		entries[entry.first] = std::move(entry.second);
+	}
+	stats.archiveEntries += archiveEntries.size();
+	return true;
+}
+
+bool ShaderCache::SaveArchive(const std::string& path, std::string* error) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	std::vector<uint64_t> keys;
+	for (const auto& entry : entries)
+	{
+		keys.push_back(entry.first);
+	}
+	std::sort(keys.begin(), keys.end());
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return Fail(error, "Failed to open " + path);
+	}
+
+	uint32_t count = (uint32_t)keys.size();
+	file.write(ShaderArchiveMagic, sizeof(ShaderArchiveMagic));
+	file.write((const char*)&ShaderArchiveVersion, sizeof(ShaderArchiveVersion));
+	file.write((const char*)&count, sizeof(count));
+	for (uint64_t key : keys)
+	{
+		const std::vector<uint8_t>& bytecode = entries.at(key);
+		uint64_t entryHeader[3] = { key, bytecode.size(), HashShaderBytes(bytecode.data(), bytecode.size()) };
+		file.write((const char*)entryHeader, sizeof(entryHeader));
+		file.write((const char*)bytecode.data(), bytecode.size());
+	}
+
+	if (!file)
+	{
+		return Fail(error, "Failed to write " + path);
+	}
+	return true;
+}
+
+size_t ShaderCache::GetEntryCount() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return entries.size();
+}
+
+ShaderCacheStats ShaderCache::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return stats;
+}
+
+void ShaderCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+	stats = ShaderCacheStats();
+}
+
+std::string ShaderCache::GetFilePath(uint64_t key) const
+{
+	return (std::filesystem::path(directory) / (FormatShaderKey(key) + ".cso")).string();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Everything the compiler is given for one shader variant
+struct ShaderPermutation
+{
+	//relative to the shader root
+	std::string file;
+	std::string entryPoint;
+	std::string target;
+	//in the order they are passed to the compiler, an empty value defines the name as empty
+	std::vector<std::pair<std::string, std::string>> defines;
+	uint32_t compileFlags = 0;
+
+	//"PixelShader.hlsl PSMain ps_5_0 USE_NEURAL_TEXTURES=1", for logs
+	std::string GetDescription() const;
+};
+
+//64 bit FNV-1a, continues from hash
+uint64_t HashShaderBytes(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ull);
+
+//hash of file and every file it includes, followed recursively relative to the including file like
+//the standard file include of the compiler. Includes inside disabled #if blocks are followed too, which
+//only costs a spurious miss. outFiles gets each file once in the order it was reached
+bool HashShaderSource(const std::string& root, const std::string& file, uint64_t& outHash, std::vector<std::string>* outFiles = nullptr, std::string* error = nullptr);
+
+//cache key of a permutation whose source hashed to sourceHash
+uint64_t ComputeShaderKey(uint64_t sourceHash, const ShaderPermutation& permutation);
+
+//16 hex digits
+std::string FormatShaderKey(uint64_t key);
+
+struct ShaderCacheStats
+{
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+	//entries read from archives, then from loose files
+	uint64_t archiveEntries = 0;
+	uint64_t fileEntries = 0;
+};
+
+// Compiled shader bytecode by ComputeShaderKey. Entries come from an archive of every permutation
+// precompiled offline and loaded at startup, then from loose files written next to it for each compile
+// the archive missed. A changed source, define or flag gives a different key, stale entries are never hit.
+class ShaderCache
+{
+public:
+	static ShaderCache& Get()
+	{
+		static ShaderCache instance;
+		return instance;
+	}
+
+	ShaderCache() = default;
+
+	//where loose files are read and written, empty keeps compiles in memory only
+	void SetDirectory(const std::string& inDirectory);
+	const std::string& GetDirectory() const { return directory; }
+
+	//memory first, then the loose file of key
+	bool Find(uint64_t key, std::vector<uint8_t>& outBytecode);
+
+	//kept in memory and written as a loose file
+	void Store(uint64_t key, const void* bytecode, size_t size);
+
+	//adds every entry of the archive, nothing when any part of it is damaged
+	bool LoadArchive(const std::string& path, std::string* error = nullptr);
+
+	//every entry in memory, sorted by key so the same shaders give the same file
+	bool SaveArchive(const std::string& path, std::string* error = nullptr) const;
+
+	size_t GetEntryCount() const;
+	ShaderCacheStats GetStats() const;
+
+	void Clear();
+
+private:
+	std::string GetFilePath(uint64_t key) const;
+
+	mutable std::mutex mutex;
+	std::unordered_map<uint64_t, std::vector<uint8_t>> entries;
+	std::string directory;
+	ShaderCacheStats stats;
+};
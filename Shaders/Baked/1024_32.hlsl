@@ -0,0 +1,220 @@
+// Decoder model 1024_32 with its weights as constants, generated by DecoderCompiler from the model
+// hashing to 0x8d1c818726095321. 704 multiply-adds per pixel instead of 704, 0 neurons eliminated.
+// Regenerate with NeuralTexture --bake-decoders, don't edit.
+// Compiled as the pixel shader, PixelShader.hlsl follows with this forward() in place of the generic ones.
+#define BAKED_NN 1
+
+struct NNOutputs
+{
+    float outputs[8];
+};
+
+NNOutputs forward(float input[14])
+{
+    float h0_0 = max(0.0f, -0.108289421f - 0.248642504f * input[0] - 0.151766211f * input[1] - 0.173601091f * input[2]
+        - 0.128731444f * input[3] - 0.287003011f * input[4] + 0.074037604f * input[5] - 0.0434892662f * input[6]
+        + 0.124507219f * input[7] + 0.119322583f * input[8] - 0.0395486951f * input[9] - 0.287399441f * input[10]
+        - 0.02106167f * input[11] + 0.196606025f * input[12] - 0.0276253875f * input[13]);
+    float h0_1 = max(0.0f, -0.110665224f - 0.0905820727f * input[0] + 0.046624247f * input[1] - 0.294144899f * input[2]
+        - 0.314914256f * input[3] - 0.0788209438f * input[4] - 0.0428274684f * input[5] - 0.0813278556f * input[6]
+        - 0.216860205f * input[7] + 0.171087161f * input[8] - 0.302964687f * input[9] + 0.0374992788f * input[10]
+        - 0.112742223f * input[11] - 0.0741233155f * input[12] - 0.0238013379f * input[13]);
+    float h0_2 = max(0.0f, -0.304169357f + 0.494009435f * input[0] - 1.21362484f * input[1] + 1.01323354f * input[2]
+        - 0.333705813f * input[3] - 0.230846271f * input[4] + 0.771661222f * input[5] + 0.309940815f * input[6]
+        + 0.366086841f * input[7] + 0.154038161f * input[8] + 0.124407031f * input[9] - 0.1743339f * input[10]
+        + 0.266618818f * input[11] - 0.0522711575f * input[12] + 0.0492471978f * input[13]);
+    float h0_3 = max(0.0f, -0.69093138f + 0.0974380821f * input[0] + 1.44753861f * input[1] + 0.819527268f * input[2]
+        + 0.223506272f * input[3] - 0.394830167f * input[4] + 0.155982926f * input[5] - 0.0278783981f * input[6]
+        + 0.116830334f * input[7] + 0.614866018f * input[8] + 0.00266188988f * input[9] - 0.381007999f * input[10]
+        + 0.0798909068f * input[11] + 0.015688248f * input[12] + 0.015552938f * input[13]);
+    float h0_4 = max(0.0f, 0.00824304111f + 0.427692562f * input[0] + 0.0319952257f * input[1] - 0.11949183f * input[2]
+        - 1.08643329f * input[3] + 0.714116096f * input[4] + 0.120172031f * input[5] + 0.0934817269f * input[6]
+        + 0.215334192f * input[7] + 0.350751102f * input[8] + 0.161223963f * input[9] + 0.249263242f * input[10]
+        - 0.266109526f * input[11] + 0.0352772288f * input[12] + 0.031616658f * input[13]);
+    float h0_5 = max(0.0f, 0.238047138f - 0.0309503507f * input[0] + 1.01560867f * input[1] - 0.953978837f * input[2]
+        + 1.03095937f * input[3] - 0.111230373f * input[4] - 0.0814305767f * input[5] - 0.124677904f * input[6]
+        + 0.366693079f * input[7] + 0.396469444f * input[8] + 0.0198241156f * input[9] + 0.326054096f * input[10]
+        + 0.291586101f * input[11] + 0.0426522382f * input[12] - 0.0320094787f * input[13]);
+    float h0_6 = max(0.0f, 0.0211510677f - 0.222218573f * input[0] - 0.265299976f * input[1] + 0.0195371136f * input[2]
+        - 0.0431204624f * input[3] - 0.14575693f * input[4] - 0.250650078f * input[5] + 0.0123304026f * input[6]
+        - 0.235489473f * input[7] + 0.0211911835f * input[8] + 0.133746743f * input[9] - 0.293521076f * input[10]
+        + 0.21332325f * input[11] + 0.131158218f * input[12] - 0.0278995503f * input[13]);
+    float h0_7 = max(0.0f, -0.525202811f + 0.224714428f * input[0] - 1.27054429f * input[1] + 1.14435244f * input[2]
+        - 0.109987594f * input[3] + 0.393011451f * input[4] - 0.00985865947f * input[5] + 0.00537689496f * input[6]
+        + 0.408944249f * input[7] + 0.281059027f * input[8] + 0.666621804f * input[9] - 0.594194889f * input[10]
+        - 0.499724746f * input[11] - 0.0407491326f * input[12] + 0.0109581854f * input[13]);
+    float h0_8 = max(0.0f, -0.103140667f - 0.177620128f * input[0] - 0.0508403741f * input[1] - 0.0234178249f * input[2]
+        - 0.233977914f * input[3] - 0.210949838f * input[4] - 0.0974179357f * input[5] - 0.190400913f * input[6]
+        + 0.199583068f * input[7] - 0.301284462f * input[8] - 0.138644248f * input[9] + 0.0806723759f * input[10]
+        - 0.133169383f * input[11] - 0.0895907581f * input[12] - 0.0972697213f * input[13]);
+    float h0_9 = max(0.0f, -0.208498672f - 0.203727633f * input[0] + 0.0242192112f * input[1] + 0.150226399f * input[2]
+        - 0.203002989f * input[3] - 0.024779398f * input[4] - 0.034051057f * input[5] - 0.212699726f * input[6]
+        - 0.278320104f * input[7] + 0.0314965807f * input[8] - 0.181617603f * input[9] + 0.0400475301f * input[10]
+        + 0.162943631f * input[11] - 0.068103835f * input[12] + 0.219049677f * input[13]);
+    float h0_10 = max(0.0f, -0.178444847f + 0.156928584f * input[0] - 0.0464729518f * input[1] - 0.0150441313f * input[2]
+        - 0.127628297f * input[3] - 0.113720663f * input[4] - 0.0985699371f * input[5] - 0.060539633f * input[6]
+        + 0.217980593f * input[7] - 0.220799461f * input[8] - 0.219340444f * input[9] + 0.189761654f * input[10]
+        + 0.0166554134f * input[11] + 0.114972793f * input[12] - 0.00346863805f * input[13]);
+    float h0_11 = max(0.0f, 0.501965344f - 0.246421248f * input[0] + 0.346182317f * input[1] - 1.08498406f * input[2]
+        + 0.701191247f * input[3] - 0.107072353f * input[4] + 0.824305952f * input[5] - 0.132280424f * input[6]
+        - 0.188345671f * input[7] - 0.0676595345f * input[8] - 0.150447577f * input[9] + 0.309203565f * input[10]
+        - 0.0934869498f * input[11] + 0.0285977181f * input[12] - 0.00170862966f * input[13]);
+    float h0_12 = max(0.0f, 0.67102176f + 0.11562036f * input[0] - 0.385433346f * input[1] + 0.156148791f * input[2]
+        - 0.333039522f * input[3] - 1.8853972f * input[4] - 0.203515723f * input[5] + 0.692036808f * input[6]
+        - 0.26642105f * input[7] - 0.262543261f * input[8] - 0.299061239f * input[9] + 0.0418334045f * input[10]
+        - 0.00442674197f * input[11] + 0.0288425386f * input[12] - 0.00854181685f * input[13]);
+    float h0_13 = max(0.0f, -0.265058011f - 0.181492984f * input[0] - 0.172181904f * input[1] + 0.160530478f * input[2]
+        - 0.106238201f * input[3] - 0.088877514f * input[4] + 0.103934556f * input[5] - 0.203805894f * input[6]
+        - 0.136020243f * input[7] + 0.117553949f * input[8] - 0.198256373f * input[9] - 0.0205250531f * input[10]
+        - 0.249034852f * input[11] - 0.0942754298f * input[12] + 0.221510828f * input[13]);
+    float h0_14 = max(0.0f, -1.01977396f + 0.938598156f * input[0] - 0.139427692f * input[1] - 0.480922878f * input[2]
+        + 1.0826956f * input[3] - 1.4237926f * input[4] + 1.00057662f * input[5] + 0.152893811f * input[6]
+        + 0.191368535f * input[7] + 0.196546018f * input[8] - 0.194619402f * input[9] - 0.441426814f * input[10]
+        + 0.101030558f * input[11] + 0.00633090455f * input[12] - 0.0360188559f * input[13]);
+    float h0_15 = max(0.0f, -0.843518853f + 0.280004889f * input[0] + 1.12805557f * input[1] + 0.94059962f * input[2]
+        - 0.42909044f * input[3] - 0.0617272258f * input[4] + 0.148477763f * input[5] - 0.644096375f * input[6]
+        + 0.370413691f * input[7] + 0.734611273f * input[8] + 0.0024855386f * input[9] - 0.371130258f * input[10]
+        + 0.114402279f * input[11] - 0.0579178818f * input[12] + 0.0240838844f * input[13]);
+    float h0_16 = max(0.0f, 0.558876932f - 0.0745339766f * input[0] - 0.832248807f * input[1] - 0.601004839f * input[2]
+        + 0.694844961f * input[3] + 0.995669305f * input[4] - 0.51203084f * input[5] + 0.316635698f * input[6]
+        - 0.111197427f * input[7] - 0.44526127f * input[8] + 0.480411202f * input[9] + 0.190695211f * input[10]
+        + 0.158953696f * input[11] - 0.00141377107f * input[12] - 0.0329392925f * input[13]);
+    float h0_17 = max(0.0f, 0.279437155f + 1.36226785f * input[0] + 0.157329112f * input[1] - 0.489991963f * input[2]
+        - 0.00746772438f * input[3] - 0.181577355f * input[4] - 0.375821382f * input[5] - 0.193801165f * input[6]
+        + 0.353022844f * input[7] - 0.0972416922f * input[8] - 0.536207736f * input[9] - 0.12239489f * input[10]
+        - 0.504374981f * input[11] - 0.00472499197f * input[12] + 0.00821866374f * input[13]);
+    float h0_18 = max(0.0f, -0.27673319f - 0.164913476f * input[0] - 0.274166346f * input[1] + 0.0872567073f * input[2]
+        - 0.0469127595f * input[3] - 0.0122444741f * input[4] - 0.232945442f * input[5] + 0.0750205219f * input[6]
+        - 0.188398734f * input[7] - 0.0222887173f * input[8] + 0.0691155046f * input[9] + 0.129194945f * input[10]
+        + 0.0869785026f * input[11] - 0.134924516f * input[12] - 0.148504883f * input[13]);
+    float h0_19 = max(0.0f, 0.00131161907f - 0.102491938f * input[0] + 0.948560715f * input[1] + 0.615691841f * input[2]
+        + 0.378783047f * input[3] + 0.384655476f * input[4] - 1.10996175f * input[5] - 0.144760847f * input[6]
+        - 0.392492533f * input[7] + 0.635187507f * input[8] - 0.285749674f * input[9] - 0.0642203689f * input[10]
+        - 1.13609278f * input[11] - 0.0127227074f * input[12] - 0.0010691128f * input[13]);
+    float h0_20 = max(0.0f, -0.305403113f - 0.340276659f * input[0] - 0.027901575f * input[1] - 0.27046591f * input[2]
+        - 0.106717139f * input[3] + 0.110020153f * input[4] + 0.0289023034f * input[5] - 0.0372925922f * input[6]
+        + 0.106973357f * input[7] - 0.27435115f * input[8] + 0.159248769f * input[9] - 0.211787447f * input[10]
+        - 0.272882223f * input[11] + 0.19408156f * input[12] + 0.142080858f * input[13]);
+    float h0_21 = max(0.0f, -0.241592169f - 0.254386663f * input[0] - 0.282028675f * input[1] - 0.0720493942f * input[2]
+        - 0.0460938811f * input[3] + 0.0203481279f * input[4] + 0.108106494f * input[5] + 0.0490590371f * input[6]
+        - 0.0394388624f * input[7] + 0.109245539f * input[8] - 0.0701966584f * input[9] - 0.0739288405f * input[10]
+        - 0.179070368f * input[11] - 0.147293612f * input[12] - 0.0929022878f * input[13]);
+    float h0_22 = max(0.0f, -0.199476019f + 0.0782226399f * input[0] - 0.147232711f * input[1] + 0.0941844359f * input[2]
+        - 0.317101955f * input[3] - 0.11628563f * input[4] - 0.106711522f * input[5] - 0.0851057917f * input[6]
+        + 0.00508100959f * input[7] - 0.132688791f * input[8] - 0.238080084f * input[9] - 0.177340969f * input[10]
+        - 0.336069077f * input[11] - 0.13276729f * input[12] + 0.148663759f * input[13]);
+    float h0_23 = max(0.0f, -0.265788138f + 0.133230463f * input[0] + 0.040499717f * input[1] - 0.17797029f * input[2]
+        - 0.236784056f * input[3] + 0.0633956119f * input[4] - 0.219400764f * input[5] - 0.0611751713f * input[6]
+        + 0.160961673f * input[7] - 0.236441299f * input[8] + 0.124056049f * input[9] - 0.232991561f * input[10]
+        - 0.270906538f * input[11] - 0.117903687f * input[12] - 0.0892478973f * input[13]);
+    float h0_24 = max(0.0f, -0.224018991f - 0.150889069f * input[0] + 0.158984452f * input[1] - 0.201823622f * input[2]
+        + 0.229154259f * input[3] - 0.227075934f * input[4] - 0.224239692f * input[5] - 0.194592446f * input[6]
+        - 0.218957335f * input[7] + 0.0693455935f * input[8] - 0.131397426f * input[9] - 0.136299819f * input[10]
+        + 0.10196349f * input[11] - 0.0160835385f * input[12] + 0.222497821f * input[13]);
+    float h0_25 = max(0.0f, 0.293185532f - 1.2244494f * input[0] - 0.459447265f * input[1] + 0.867045522f * input[2]
+        + 0.0686465353f * input[3] + 0.334454626f * input[4] - 0.026712019f * input[5] + 0.447284698f * input[6]
+        + 0.140007913f * input[7] + 0.494995326f * input[8] + 0.414310038f * input[9] + 0.0718493462f * input[10]
+        - 0.213366091f * input[11] + 0.00922063366f * input[12] - 0.00250688405f * input[13]);
+    float h0_26 = max(0.0f, -0.278596282f + 0.0720815584f * input[0] + 0.0671216547f * input[1] - 0.24029918f * input[2]
+        + 0.102658443f * input[3] - 0.285732448f * input[4] + 0.0620328002f * input[5] + 0.0187468324f * input[6]
+        + 0.129289597f * input[7] - 0.348462105f * input[8] + 0.146248251f * input[9] - 0.0092603527f * input[10]
+        + 0.0112228133f * input[11] - 0.0379681066f * input[12] + 0.113716267f * input[13]);
+    float h0_27 = max(0.0f, -0.0424034707f + 0.559276104f * input[0] + 0.00900033955f * input[1] - 0.980833173f * input[2]
+        + 0.813884735f * input[3] + 0.00962885749f * input[4] + 0.386922926f * input[5] - 0.10402476f * input[6]
+        - 0.196733445f * input[7] - 0.377015412f * input[8] - 0.384888738f * input[9] - 0.0669394732f * input[10]
+        + 0.130505428f * input[11] - 0.0309666023f * input[12] - 0.015917046f * input[13]);
+    float h0_28 = max(0.0f, 0.0681421682f + 1.10794687f * input[0] - 0.398060054f * input[1] + 0.291945308f * input[2]
+        - 0.103281774f * input[3] + 0.146174252f * input[4] - 0.829988778f * input[5] + 0.00589117827f * input[6]
+        + 0.490409464f * input[7] + 0.133032173f * input[8] + 0.152423531f * input[9] - 0.344727308f * input[10]
+        + 0.0975190699f * input[11] - 0.0303513147f * input[12] - 0.0308625717f * input[13]);
+    float h0_29 = max(0.0f, -0.974747241f + 0.579801857f * input[0] - 0.27538383f * input[1] + 0.871816754f * input[2]
+        + 0.493654281f * input[3] + 0.479194432f * input[4] + 0.903127015f * input[5] - 0.278240889f * input[6]
+        + 0.482619286f * input[7] + 0.0115523906f * input[8] + 0.0367585793f * input[9] - 0.117102176f * input[10]
+        + 0.358330131f * input[11] - 0.0877147093f * input[12] + 0.029473735f * input[13]);
+    float h0_30 = max(0.0f, 0.543471873f + 0.424731433f * input[0] - 1.10302615f * input[1] + 0.488708645f * input[2]
+        + 0.239382789f * input[3] - 0.804989398f * input[4] - 0.176451027f * input[5] + 0.331186026f * input[6]
+        + 0.397794753f * input[7] + 0.1321567f * input[8] + 0.0500409678f * input[9] - 0.318685204f * input[10]
+        - 0.219838277f * input[11] - 0.0265324395f * input[12] + 0.0197841357f * input[13]);
+    float h0_31 = max(0.0f, -0.443304509f + 0.553355992f * input[0] - 0.880716085f * input[1] + 0.480420768f * input[2]
+        + 0.31347391f * input[3] + 0.692287147f * input[4] + 0.0646413639f * input[5] - 0.367005169f * input[6]
+        + 0.341517001f * input[7] - 0.109288469f * input[8] - 0.440214276f * input[9] - 0.782963693f * input[10]
+        + 0.221438646f * input[11] - 0.0445544161f * input[12] + 0.0347930603f * input[13]);
+
+    NNOutputs nnOutputs;
+    nnOutputs.outputs[0] = 1.0f / (1.0f + exp(-(0.244296342f + 0.0126183955f * h0_0 - 0.0778971538f * h0_1 + 0.610656798f * h0_2
+        - 0.0831519514f * h0_3 - 0.363843769f * h0_4 - 0.978637218f * h0_5 - 0.13085103f * h0_6
+        + 0.0862227231f * h0_7 + 0.117415339f * h0_8 - 0.14210315f * h0_9 - 0.00948141329f * h0_10
+        - 0.646049857f * h0_11 - 0.0602762587f * h0_12 + 0.174291566f * h0_13 + 0.114234619f * h0_14
+        + 0.0602116212f * h0_15 - 0.534197867f * h0_16 + 0.0435800962f * h0_17 - 0.151799276f * h0_18
+        - 0.308589131f * h0_19 - 0.0042605293f * h0_20 - 0.112881072f * h0_21 - 0.0204390474f * h0_22
+        + 0.164866328f * h0_23 - 0.114690527f * h0_24 + 0.233439937f * h0_25 - 0.109057046f * h0_26
+        - 0.328371704f * h0_27 + 0.227925688f * h0_28 - 0.261647969f * h0_29 + 0.830798984f * h0_30
+        + 0.22537449f * h0_31)));
+    nnOutputs.outputs[1] = 1.0f / (1.0f + exp(-(-0.257823378f - 0.038870573f * h0_0 + 0.0106521957f * h0_1 + 0.565801144f * h0_2
+        - 0.148793504f * h0_3 - 0.238166675f * h0_4 - 0.558830261f * h0_5 + 0.0228287186f * h0_6
+        + 0.592059255f * h0_7 - 0.00354792411f * h0_8 - 0.125606313f * h0_9 - 0.0621136203f * h0_10
+        - 0.420072705f * h0_11 + 0.233563483f * h0_12 - 0.125728518f * h0_13 - 0.138747573f * h0_14
+        + 0.0403003693f * h0_15 + 0.520662367f * h0_16 - 0.027338095f * h0_17 + 0.0676287636f * h0_18
+        + 0.202412203f * h0_19 - 0.130028009f * h0_20 + 0.0698547736f * h0_21 + 0.0653031766f * h0_22
+        + 0.0454093032f * h0_23 + 0.034768939f * h0_24 + 0.421623498f * h0_25 + 0.127745658f * h0_26
+        + 0.0170607455f * h0_27 + 0.316794485f * h0_28 + 0.781609654f * h0_29 + 0.222384125f * h0_30
+        + 0.467504621f * h0_31)));
+    nnOutputs.outputs[2] = 1.0f / (1.0f + exp(-(-0.112034045f - 0.0960986093f * h0_0 + 0.133569747f * h0_1 + 0.605345011f * h0_2
+        - 0.082415767f * h0_3 - 0.31131053f * h0_4 - 0.526052892f * h0_5 + 0.00247285748f * h0_6
+        + 1.08825755f * h0_7 - 0.0756201297f * h0_8 - 0.0196252353f * h0_9 + 0.0244411863f * h0_10
+        - 0.44104293f * h0_11 - 0.475844622f * h0_12 + 0.140266135f * h0_13 - 0.0316075757f * h0_14
+        - 0.146648332f * h0_15 + 0.401006579f * h0_16 - 0.0237204153f * h0_17 + 0.149158046f * h0_18
+        + 0.141814277f * h0_19 + 0.141125485f * h0_20 + 0.166554704f * h0_21 - 0.0969800055f * h0_22
+        + 0.0857547745f * h0_23 + 0.0355719179f * h0_24 + 0.410986185f * h0_25 + 0.0410312675f * h0_26
+        + 0.00709105795f * h0_27 + 0.401005834f * h0_28 + 0.764768004f * h0_29 + 0.314834118f * h0_30
+        - 0.290731728f * h0_31)));
+    nnOutputs.outputs[3] = 1.0f / (1.0f + exp(-(0.808968604f + 0.117016107f * h0_0 + 0.0593999885f * h0_1 + 0.374954879f * h0_2
+        + 1.02603781f * h0_3 - 1.38075054f * h0_4 + 0.692156553f * h0_5 + 0.0246379431f * h0_6
+        + 1.1727432f * h0_7 - 0.10890229f * h0_8 - 0.0180300307f * h0_9 - 0.126363918f * h0_10
+        + 0.74448514f * h0_11 + 2.19181609f * h0_12 - 0.0851938277f * h0_13 + 7.01901245f * h0_14
+        - 3.04904366f * h0_15 - 0.469879448f * h0_16 + 0.621552587f * h0_17 + 0.0209913272f * h0_18
+        + 0.86846751f * h0_19 + 0.0849940181f * h0_20 + 0.0333987288f * h0_21 - 0.0164285321f * h0_22
+        + 0.0246999953f * h0_23 - 0.0790306702f * h0_24 - 0.370735765f * h0_25 - 0.142585412f * h0_26
+        + 0.672551632f * h0_27 - 0.0246992745f * h0_28 + 0.160394162f * h0_29 + 0.79435873f * h0_30
+        + 0.419351459f * h0_31)));
+    nnOutputs.outputs[4] = 1.0f / (1.0f + exp(-(0.537442923f + 0.136623099f * h0_0 - 0.0465147868f * h0_1 + 0.17098178f * h0_2
+        - 1.02453959f * h0_3 - 0.365653187f * h0_4 - 0.0146876657f * h0_5 - 0.0846609399f * h0_6
+        + 0.0376500525f * h0_7 + 0.0370299779f * h0_8 + 0.141421095f * h0_9 - 0.101007827f * h0_10
+        + 0.624654293f * h0_11 + 0.0423911512f * h0_12 - 0.123693332f * h0_13 - 0.099295266f * h0_14
+        - 0.208766192f * h0_15 + 0.478145689f * h0_16 - 0.523507297f * h0_17 + 0.075404048f * h0_18
+        - 0.538453281f * h0_19 - 0.0760819763f * h0_20 - 0.00199525314f * h0_21 + 0.0964520276f * h0_22
+        - 0.103181601f * h0_23 - 0.0882318094f * h0_24 + 1.06802142f * h0_25 - 0.113629825f * h0_26
+        - 0.109802023f * h0_27 - 0.54034251f * h0_28 - 0.567968488f * h0_29 + 0.565058649f * h0_30
+        + 0.114214018f * h0_31)));
+    nnOutputs.outputs[5] = 1.0f / (1.0f + exp(-(-0.24127847f + 0.070839487f * h0_0 + 0.212324113f * h0_1 + 0.165243864f * h0_2
+        + 1.09135079f * h0_3 - 0.310482949f * h0_4 + 0.023124747f * h0_5 + 0.0285478849f * h0_6
+        - 0.163973272f * h0_7 + 0.0981056169f * h0_8 + 0.00842382386f * h0_9 - 0.166189522f * h0_10
+        - 0.160855159f * h0_11 + 0.130527601f * h0_12 + 0.124380752f * h0_13 - 0.0990553722f * h0_14
+        - 0.152173266f * h0_15 - 0.694032371f * h0_16 - 0.778034031f * h0_17 - 0.0319659784f * h0_18
+        + 0.423627853f * h0_19 + 0.0430118218f * h0_20 - 0.131107643f * h0_21 + 0.067303136f * h0_22
+        - 0.0660866275f * h0_23 + 0.017240122f * h0_24 + 0.912780523f * h0_25 + 0.15310894f * h0_26
+        - 0.260745794f * h0_27 - 0.47971797f * h0_28 + 0.621530354f * h0_29 - 0.415146887f * h0_30
+        + 0.149719968f * h0_31)));
+    nnOutputs.outputs[6] = 1.0f / (1.0f + exp(-(0.139026195f + 0.0684692264f * h0_0 + 0.0394820124f * h0_1 + 0.652680039f * h0_2
+        + 0.405528367f * h0_3 - 0.370897502f * h0_4 + 0.516572475f * h0_5 - 0.160844922f * h0_6
+        - 0.825302064f * h0_7 - 0.129639819f * h0_8 + 0.111050591f * h0_9 + 0.128842905f * h0_10
+        + 0.585626125f * h0_11 + 0.357266963f * h0_12 + 0.0606648624f * h0_13 + 3.46344566f * h0_14
+        - 0.303187549f * h0_15 - 0.256461918f * h0_16 + 0.517205656f * h0_17 - 0.415361285f * h0_18
+        - 0.59887737f * h0_19 - 0.0690386519f * h0_20 + 0.0317156799f * h0_21 + 0.0866858065f * h0_22
+        + 0.0537448861f * h0_23 + 0.0589493811f * h0_24 - 0.831176162f * h0_25 + 0.0583581589f * h0_26
+        + 0.711259842f * h0_27 + 0.0546845011f * h0_28 + 0.931612432f * h0_29 + 0.488265753f * h0_30
+        + 0.737532377f * h0_31)));
+    nnOutputs.outputs[7] = 1.0f / (1.0f + exp(-(-0.0867879167f + 0.011369653f * h0_0 - 0.0120432135f * h0_1 - 0.44011125f * h0_2
+        + 0.110519856f * h0_3 - 0.96013391f * h0_4 + 0.437700301f * h0_5 - 0.0240598284f * h0_6
+        - 0.185032234f * h0_7 - 0.00609783037f * h0_8 + 0.0282416344f * h0_9 - 0.0475640036f * h0_10
+        - 0.324019253f * h0_11 + 0.109974384f * h0_12 - 0.0845748186f * h0_13 - 0.00978615507f * h0_14
+        - 0.124799632f * h0_15 + 0.448821545f * h0_16 + 0.0153333005f * h0_17 - 0.0242638215f * h0_18
+        + 0.590329051f * h0_19 - 0.0192667544f * h0_20 + 0.0961636826f * h0_21 + 0.044771757f * h0_22
+        - 0.134350464f * h0_23 + 0.116644636f * h0_24 + 0.444204777f * h0_25 - 0.154541612f * h0_26
+        - 0.0735368282f * h0_27 + 0.350055546f * h0_28 - 0.457466215f * h0_29 + 0.453757972f * h0_30
+        + 0.263834506f * h0_31)));
+
+    return nnOutputs;
+}
+
+#include "../PixelShader.hlsl"
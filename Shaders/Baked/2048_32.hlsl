@@ -0,0 +1,220 @@
+// Decoder model 2048_32 with its weights as constants, generated by DecoderCompiler from the model
+// hashing to 0x3bdc9ca4ababd4b0. 704 multiply-adds per pixel instead of 704, 0 neurons eliminated.
+// Regenerate with NeuralTexture --bake-decoders, don't edit.
+// Compiled as the pixel shader, PixelShader.hlsl follows with this forward() in place of the generic ones.
+#define BAKED_NN 1
+
+struct NNOutputs
+{
+    float outputs[8];
+};
+
+NNOutputs forward(float input[14])
+{
+    float h0_0 = max(0.0f, -0.622300625f + 0.620573521f * input[0] - 0.39015919f * input[1] + 0.498498499f * input[2]
+        + 0.984005928f * input[3] - 0.698058784f * input[4] + 0.812249184f * input[5] - 0.649901032f * input[6]
+        + 0.0739519373f * input[7] - 0.433809668f * input[8] - 0.472952008f * input[9] - 0.664353788f * input[10]
+        - 0.216045231f * input[11] + 0.0169078782f * input[12] + 0.0162463859f * input[13]);
+    float h0_1 = max(0.0f, 0.085540466f + 0.161575109f * input[0] - 0.13676028f * input[1] - 0.334649056f * input[2]
+        - 0.0471118502f * input[3] - 0.344830483f * input[4] - 0.303178489f * input[5] + 0.00866779406f * input[6]
+        - 0.307191253f * input[7] - 0.0263717677f * input[8] - 0.295554638f * input[9] + 0.0895337984f * input[10]
+        - 0.117817737f * input[11] + 0.0596485287f * input[12] + 0.0270101484f * input[13]);
+    float h0_2 = max(0.0f, -0.0226370133f + 0.307308584f * input[0] - 1.31332397f * input[1] + 1.20272696f * input[2]
+        - 0.0826347023f * input[3] + 0.0324662291f * input[4] - 0.323640585f * input[5] + 1.3424561f * input[6]
+        + 0.504149079f * input[7] + 0.0109884972f * input[8] - 0.280080587f * input[9] + 0.489093482f * input[10]
+        - 0.317743152f * input[11] - 0.0305464268f * input[12] + 0.00584930135f * input[13]);
+    float h0_3 = max(0.0f, -0.26639244f - 0.13698867f * input[0] + 0.746816635f * input[1] + 0.143151417f * input[2]
+        + 0.683810472f * input[3] + 0.297227591f * input[4] + 0.103082076f * input[5] + 0.244812459f * input[6]
+        - 0.366876364f * input[7] + 0.094845511f * input[8] - 0.186933011f * input[9] - 0.456792831f * input[10]
+        - 0.533132911f * input[11] + 0.0199033041f * input[12] - 0.00856588129f * input[13]);
+    float h0_4 = max(0.0f, 0.0177771281f + 0.0309340861f * input[0] - 0.203243956f * input[1] - 0.00754882628f * input[2]
+        + 0.00290261954f * input[3] - 0.187966391f * input[4] - 0.365278423f * input[5] - 0.131736562f * input[6]
+        - 0.336582541f * input[7] - 0.119379833f * input[8] - 0.127503514f * input[9] + 0.182841256f * input[10]
+        - 0.0592795461f * input[11] + 0.0638703257f * input[12] - 0.00328639545f * input[13]);
+    float h0_5 = max(0.0f, -0.924994349f + 0.929291129f * input[0] + 0.132793844f * input[1] + 0.105260611f * input[2]
+        - 0.729192138f * input[3] + 0.89681828f * input[4] + 1.50501382f * input[5] + 0.176217839f * input[6]
+        - 0.613123119f * input[7] + 0.214675918f * input[8] - 0.395200491f * input[9] - 0.480223358f * input[10]
+        - 0.849920213f * input[11] + 0.00635138946f * input[12] + 0.0293484852f * input[13]);
+    float h0_6 = max(0.0f, -0.102349043f - 0.255636454f * input[0] - 0.172005251f * input[1] - 0.211975425f * input[2]
+        + 0.0560753942f * input[3] - 0.247304305f * input[4] + 0.153721273f * input[5] + 0.236637324f * input[6]
+        - 0.230621323f * input[7] - 0.0678307861f * input[8] - 0.0147363842f * input[9] - 0.205762178f * input[10]
+        - 0.0575155318f * input[11] - 0.0131631792f * input[12] + 0.245428234f * input[13]);
+    float h0_7 = max(0.0f, -0.000131294277f + 0.0146712475f * input[0] - 0.0923244804f * input[1] - 0.330492318f * input[2]
+        - 0.197572038f * input[3] + 0.148089573f * input[4] - 0.250391155f * input[5] + 0.0835408196f * input[6]
+        + 0.0633058399f * input[7] - 0.0991620123f * input[8] - 0.0109291486f * input[9] - 0.241121858f * input[10]
+        - 0.189539552f * input[11] - 0.0651754811f * input[12] + 0.00498248916f * input[13]);
+    float h0_8 = max(0.0f, -0.498158604f + 0.774653554f * input[0] + 0.0533838011f * input[1] + 0.276017815f * input[2]
+        + 0.625275493f * input[3] - 0.46769616f * input[4] + 0.72923559f * input[5] + 0.31090489f * input[6]
+        - 0.584737897f * input[7] + 0.00882162806f * input[8] - 0.208449468f * input[9] + 0.00844289921f * input[10]
+        - 0.352663547f * input[11] - 0.0271551888f * input[12] + 0.0123210009f * input[13]);
+    float h0_9 = max(0.0f, -0.187029004f + 0.414420515f * input[0] - 0.0194584634f * input[1] - 1.17136371f * input[2]
+        + 0.511091888f * input[3] + 0.780194819f * input[4] + 0.729183316f * input[5] + 0.462716609f * input[6]
+        - 0.537782013f * input[7] + 0.282569319f * input[8] - 0.499247104f * input[9] - 0.373014688f * input[10]
+        + 0.134831637f * input[11] + 0.00624330249f * input[12] + 0.00840264838f * input[13]);
+    float h0_10 = max(0.0f, 0.157786772f + 0.485453725f * input[0] - 0.38017723f * input[1] + 0.414437056f * input[2]
+        - 1.2080251f * input[3] + 0.156066269f * input[4] + 0.414056033f * input[5] + 0.166117772f * input[6]
+        + 0.255711764f * input[7] + 0.032550212f * input[8] + 0.339972615f * input[9] + 0.131623775f * input[10]
+        - 0.151145607f * input[11] - 0.01396049f * input[12] + 0.00355145824f * input[13]);
+    float h0_11 = max(0.0f, -0.0918770507f + 0.444138676f * input[0] + 0.904901087f * input[1] + 0.019302804f * input[2]
+        + 0.424998909f * input[3] - 0.487781763f * input[4] - 0.718887568f * input[5] - 0.446302801f * input[6]
+        + 0.314269125f * input[7] - 0.610563755f * input[8] + 0.297464043f * input[9] - 0.422072947f * input[10]
+        - 0.109135568f * input[11] - 0.00706795184f * input[12] - 0.00549428677f * input[13]);
+    float h0_12 = max(0.0f, 0.77739948f - 0.0445416421f * input[0] - 0.481981456f * input[1] - 1.05533218f * input[2]
+        - 0.0679048374f * input[3] - 0.294306368f * input[4] - 0.128667831f * input[5] - 0.0953867584f * input[6]
+        + 0.269941658f * input[7] + 0.331708074f * input[8] + 0.550073922f * input[9] + 0.291953117f * input[10]
+        + 0.580701351f * input[11] + 0.00932971854f * input[12] + 0.0314625613f * input[13]);
+    float h0_13 = max(0.0f, -0.118363738f + 0.414486498f * input[0] - 1.14754033f * input[1] + 1.07132864f * input[2]
+        + 0.650800765f * input[3] - 0.465971947f * input[4] + 0.344197214f * input[5] + 0.20362635f * input[6]
+        + 0.254780442f * input[7] - 0.621133387f * input[8] - 0.245479867f * input[9] - 0.182956442f * input[10]
+        - 0.610926867f * input[11] - 0.0403244272f * input[12] - 0.0052191182f * input[13]);
+    float h0_14 = max(0.0f, -0.111397125f - 0.0903852358f * input[0] + 0.0227506049f * input[1] - 0.275702506f * input[2]
+        + 0.158904374f * input[3] - 0.175038695f * input[4] + 0.117655963f * input[5] - 0.247635275f * input[6]
+        + 0.122554615f * input[7] - 0.197817162f * input[8] - 0.0613555238f * input[9] - 0.202349335f * input[10]
+        - 0.302592307f * input[11] + 0.262221366f * input[12] - 0.0936495811f * input[13]);
+    float h0_15 = max(0.0f, 0.456806213f - 0.266627073f * input[0] + 0.955092549f * input[1] - 0.693930745f * input[2]
+        - 0.464003921f * input[3] - 0.771536887f * input[4] + 0.410142541f * input[5] - 0.106411576f * input[6]
+        + 0.0270310957f * input[7] + 0.359293729f * input[8] + 0.406952053f * input[9] + 0.0241932385f * input[10]
+        + 0.489623666f * input[11] + 0.0534074455f * input[12] - 0.00674090907f * input[13]);
+    float h0_16 = max(0.0f, 0.393673956f + 1.09201801f * input[0] - 0.750011325f * input[1] - 1.44044864f * input[2]
+        - 0.0279965326f * input[3] - 0.13878572f * input[4] - 0.135438144f * input[5] + 0.130351961f * input[6]
+        - 0.0811629444f * input[7] + 0.6996907f * input[8] + 0.0303891022f * input[9] - 0.353579074f * input[10]
+        + 0.224416628f * input[11] + 0.00694338279f * input[12] + 0.0116005111f * input[13]);
+    float h0_17 = max(0.0f, 0.258988649f - 1.32916999f * input[0] - 0.124936394f * input[1] + 0.740907013f * input[2]
+        + 0.096911259f * input[3] + 0.242744997f * input[4] - 0.217197627f * input[5] + 0.143109754f * input[6]
+        + 0.3331379f * input[7] - 0.183596551f * input[8] + 0.269542247f * input[9] + 0.244166374f * input[10]
+        + 0.484691799f * input[11] - 0.0118817016f * input[12] - 0.000467747916f * input[13]);
+    float h0_18 = max(0.0f, 0.251045108f + 0.807400644f * input[0] - 0.758964717f * input[1] - 0.067747198f * input[2]
+        + 0.573006749f * input[3] - 0.62058121f * input[4] - 0.161920771f * input[5] - 0.073782973f * input[6]
+        + 0.583426952f * input[7] - 0.528116405f * input[8] + 0.395083427f * input[9] + 0.148537576f * input[10]
+        + 0.252638429f * input[11] - 0.0164681412f * input[12] + 0.00436993828f * input[13]);
+    float h0_19 = max(0.0f, -0.230976388f + 0.502963722f * input[0] + 0.665197492f * input[1] - 0.983106315f * input[2]
+        - 0.00467487751f * input[3] + 0.455183327f * input[4] + 0.121206321f * input[5] - 0.110603794f * input[6]
+        + 0.162817389f * input[7] + 0.385183036f * input[8] - 0.134230196f * input[9] - 0.220275208f * input[10]
+        + 0.0963958129f * input[11] + 0.0233283248f * input[12] + 0.0388379991f * input[13]);
+    float h0_20 = max(0.0f, 0.368433803f - 1.00466228f * input[0] - 1.06771564f * input[1] - 0.411917239f * input[2]
+        + 0.181214198f * input[3] + 0.36832419f * input[4] + 0.276905358f * input[5] + 0.16102013f * input[6]
+        + 0.330905795f * input[7] + 0.578833818f * input[8] - 0.164901346f * input[9] + 0.770265341f * input[10]
+        + 0.530281186f * input[11] + 0.0154781956f * input[12] + 0.00986698363f * input[13]);
+    float h0_21 = max(0.0f, 0.0624378063f - 0.0139301317f * input[0] - 0.192264006f * input[1] - 0.262733668f * input[2]
+        + 0.0593008734f * input[3] - 0.298874825f * input[4] - 0.049425032f * input[5] + 0.159861088f * input[6]
+        - 0.27677989f * input[7] - 0.0194096845f * input[8] + 0.161518708f * input[9] - 0.0332595557f * input[10]
+        - 0.257581174f * input[11] + 0.0169423614f * input[12] + 0.0711300671f * input[13]);
+    float h0_22 = max(0.0f, -0.680026531f + 0.445302725f * input[0] + 0.545138896f * input[1] + 1.13345206f * input[2]
+        + 0.343764096f * input[3] - 0.0516910516f * input[4] + 0.0526890978f * input[5] + 0.0649794862f * input[6]
+        - 0.0952421278f * input[7] - 0.220982179f * input[8] - 0.00387170794f * input[9] - 0.268865943f * input[10]
+        - 0.221978605f * input[11] - 0.0169862714f * input[12] - 0.0206580292f * input[13]);
+    float h0_23 = max(0.0f, 0.523167908f - 1.06100702f * input[0] - 0.478529543f * input[1] - 0.331346661f * input[2]
+        + 0.587321281f * input[3] + 0.370144397f * input[4] + 0.692164242f * input[5] - 0.190339521f * input[6]
+        + 0.210232586f * input[7] + 0.401759237f * input[8] - 0.0108028427f * input[9] + 0.233395681f * input[10]
+        + 0.15822117f * input[11] + 0.00350242807f * input[12] + 0.00748819858f * input[13]);
+    float h0_24 = max(0.0f, -0.246181369f + 0.0660595f * input[0] - 0.0755952373f * input[1] + 0.219471157f * input[2]
+        - 0.148343638f * input[3] - 0.279662073f * input[4] - 0.177339122f * input[5] + 0.0588799529f * input[6]
+        - 0.121314496f * input[7] - 0.136138216f * input[8] - 0.020126937f * input[9] - 0.244544834f * input[10]
+        - 0.159046948f * input[11] + 0.05891487f * input[12] - 0.222847119f * input[13]);
+    float h0_25 = max(0.0f, -0.196724638f + 0.974631965f * input[0] - 0.104751341f * input[1] - 0.204699785f * input[2]
+        - 0.695575535f * input[3] + 1.00976419f * input[4] + 0.075789474f * input[5] + 0.125481158f * input[6]
+        - 0.402331114f * input[7] + 0.500015616f * input[8] - 0.227730229f * input[9] - 0.280319273f * input[10]
+        + 0.17512247f * input[11] + 0.0362319946f * input[12] - 0.00724740885f * input[13]);
+    float h0_26 = max(0.0f, -0.214245304f - 0.0714911222f * input[0] - 0.206411242f * input[1] - 0.190205216f * input[2]
+        - 0.26381126f * input[3] - 0.259765178f * input[4] - 0.199209884f * input[5] - 0.256570518f * input[6]
+        + 0.238200873f * input[7] + 0.247232586f * input[8] - 0.166558877f * input[9] + 0.0311962962f * input[10]
+        - 0.241532579f * input[11] - 0.145036817f * input[12] - 0.202486604f * input[13]);
+    float h0_27 = max(0.0f, 0.289412469f + 0.340963632f * input[0] - 1.28211415f * input[1] + 0.744139373f * input[2]
+        - 0.29497242f * input[3] - 0.270440459f * input[4] + 0.352877468f * input[5] + 0.244195893f * input[6]
+        + 0.204272822f * input[7] + 0.111720271f * input[8] - 0.317222536f * input[9] + 0.0534744449f * input[10]
+        + 0.354800135f * input[11] - 0.0215731729f * input[12] + 0.0339528695f * input[13]);
+    float h0_28 = max(0.0f, -0.306572706f - 0.211635336f * input[0] + 1.23818207f * input[1] + 0.453325421f * input[2]
+        - 0.155149147f * input[3] - 0.353347063f * input[4] + 0.356570423f * input[5] - 0.403661966f * input[6]
+        - 0.401543707f * input[7] + 0.0204815324f * input[8] + 0.248924106f * input[9] - 0.18391721f * input[10]
+        + 0.0699415803f * input[11] + 0.00295849307f * input[12] + 0.024125386f * input[13]);
+    float h0_29 = max(0.0f, 0.0178662371f - 0.288603097f * input[0] + 0.564464867f * input[1] - 0.748451114f * input[2]
+        + 0.847599983f * input[3] - 0.816085577f * input[4] + 0.835089803f * input[5] - 0.0345265493f * input[6]
+        + 0.545060873f * input[7] + 0.0476297475f * input[8] - 0.0148427468f * input[9] - 0.219052851f * input[10]
+        - 0.145707995f * input[11] + 0.000712538895f * input[12] - 0.0094112372f * input[13]);
+    float h0_30 = max(0.0f, 0.305025101f + 0.155389532f * input[0] - 0.84185493f * input[1] + 0.473312646f * input[2]
+        - 0.293774217f * input[3] - 0.394671291f * input[4] + 0.657212555f * input[5] + 0.661973834f * input[6]
+        - 0.162388295f * input[7] - 0.0357218608f * input[8] - 0.346169323f * input[9] + 0.227636337f * input[10]
+        + 0.0831959546f * input[11] - 0.013336706f * input[12] + 0.0218253732f * input[13]);
+    float h0_31 = max(0.0f, -0.198321432f - 0.289794683f * input[0] - 0.10773918f * input[1] + 0.0633614212f * input[2]
+        - 0.00536937313f * input[3] + 0.133053854f * input[4] - 0.0288126394f * input[5] + 0.136301905f * input[6]
+        - 0.0124982595f * input[7] + 0.0223714951f * input[8] - 0.205879107f * input[9] + 0.00627641426f * input[10]
+        + 0.0638998821f * input[11] - 0.0964022428f * input[12] + 0.000462949887f * input[13]);
+
+    NNOutputs nnOutputs;
+    nnOutputs.outputs[0] = 1.0f / (1.0f + exp(-(0.158128053f + 0.110838115f * h0_0 - 0.142317817f * h0_1 + 0.3911286f * h0_2
+        - 0.191891193f * h0_3 + 0.0902001709f * h0_4 + 0.0589827895f * h0_5 + 0.155969486f * h0_6
+        + 0.133344114f * h0_7 - 0.148467436f * h0_8 - 0.435221165f * h0_9 + 0.101190612f * h0_10
+        - 0.19736737f * h0_11 - 0.187054843f * h0_12 - 0.0864266753f * h0_13 - 0.00991890952f * h0_14
+        - 0.957421601f * h0_15 - 0.0324785635f * h0_16 + 0.339419365f * h0_17 + 0.176763356f * h0_18
+        - 0.162888035f * h0_19 + 0.133240566f * h0_20 + 0.0165233072f * h0_21 + 0.152029052f * h0_22
+        - 0.628367305f * h0_23 + 0.169366628f * h0_24 + 0.420598686f * h0_25 + 0.0737913698f * h0_26
+        + 0.676894546f * h0_27 - 0.405731797f * h0_28 - 0.653276145f * h0_29 + 0.135192752f * h0_30
+        - 0.113093853f * h0_31)));
+    nnOutputs.outputs[1] = 1.0f / (1.0f + exp(-(0.167681411f + 0.490420222f * h0_0 + 0.0605791397f * h0_1 + 1.02021205f * h0_2
+        - 0.0950235352f * h0_3 + 0.0425995737f * h0_4 + 0.0483757704f * h0_5 - 0.038371101f * h0_6
+        - 0.246742234f * h0_7 + 0.19213827f * h0_8 - 0.277791381f * h0_9 - 0.0536604784f * h0_10
+        - 0.167368129f * h0_11 - 0.394870937f * h0_12 - 0.142264053f * h0_13 + 0.0938061848f * h0_14
+        - 0.579466343f * h0_15 - 0.0322114378f * h0_16 - 0.0912480205f * h0_17 + 0.478249818f * h0_18
+        - 0.221356496f * h0_19 + 0.0814610273f * h0_20 + 0.00578265265f * h0_21 + 0.268139184f * h0_22
+        - 0.0667464808f * h0_23 + 0.116035216f * h0_24 - 0.00258016167f * h0_25 + 0.0179205388f * h0_26
+        + 0.940910578f * h0_27 - 0.0554084331f * h0_28 + 0.212058246f * h0_29 + 0.326061934f * h0_30
+        + 0.159043387f * h0_31)));
+    nnOutputs.outputs[2] = 1.0f / (1.0f + exp(-(0.142127633f - 0.53713876f * h0_0 - 0.0531970523f * h0_1 + 0.654460311f * h0_2
+        + 0.00637921458f * h0_3 + 0.0542837009f * h0_4 + 0.0682249516f * h0_5 - 0.116861194f * h0_6
+        + 0.0334209539f * h0_7 + 0.399330318f * h0_8 - 0.0357571803f * h0_9 + 0.0151643818f * h0_10
+        - 0.0862209126f * h0_11 - 0.363931417f * h0_12 + 2.0353086f * h0_13 + 0.0318676643f * h0_14
+        - 0.414549172f * h0_15 - 0.151653767f * h0_16 - 0.149647668f * h0_17 + 0.591232479f * h0_18
+        - 0.269734561f * h0_19 - 0.0870956108f * h0_20 - 0.0680374876f * h0_21 + 0.285380423f * h0_22
+        + 0.0982287228f * h0_23 - 0.0587718412f * h0_24 - 0.182116151f * h0_25 - 0.0800724551f * h0_26
+        + 0.879460335f * h0_27 - 0.098708652f * h0_28 - 0.302605987f * h0_29 + 0.447768718f * h0_30
+        + 0.0651906133f * h0_31)));
+    nnOutputs.outputs[3] = 1.0f / (1.0f + exp(-(0.908091009f + 0.807749331f * h0_0 - 0.0270183198f * h0_1 + 0.322787493f * h0_2
+        - 0.63188678f * h0_3 + 0.194067553f * h0_4 + 5.76205206f * h0_5 + 0.124240384f * h0_6
+        + 0.0125185847f * h0_7 - 0.548421144f * h0_8 + 0.340179026f * h0_9 + 2.29879189f * h0_10
+        - 0.735956788f * h0_11 + 1.379372f * h0_12 + 1.16500747f * h0_13 - 0.0113726361f * h0_14
+        + 0.685478806f * h0_15 - 3.77283406f * h0_16 + 0.150849968f * h0_17 + 0.0926692188f * h0_18
+        + 0.631048262f * h0_19 - 3.59785271f * h0_20 - 0.0289159287f * h0_21 - 0.541534185f * h0_22
+        + 0.334119469f * h0_23 - 0.114507325f * h0_24 + 1.23224163f * h0_25 + 0.0568136275f * h0_26
+        + 0.554828048f * h0_27 - 0.1706101f * h0_28 + 0.519112408f * h0_29 + 0.310237408f * h0_30
+        - 0.112355232f * h0_31)));
+    nnOutputs.outputs[4] = 1.0f / (1.0f + exp(-(0.0452211462f + 0.0961983725f * h0_0 + 0.0188295841f * h0_1 + 0.00433137361f * h0_2
+        + 0.164058879f * h0_3 + 0.231568173f * h0_4 - 0.028046174f * h0_5 - 0.0876608714f * h0_6
+        - 0.107213959f * h0_7 + 0.00893148128f * h0_8 - 0.429267943f * h0_9 + 0.0491403863f * h0_10
+        - 0.177993417f * h0_11 - 1.0348804f * h0_12 - 0.085667178f * h0_13 - 0.0935654044f * h0_14
+        + 0.0133303357f * h0_15 - 0.369133085f * h0_16 + 1.329247f * h0_17 - 0.989601374f * h0_18
+        - 0.346738607f * h0_19 - 0.129708812f * h0_20 + 0.0478276052f * h0_21 + 0.256750762f * h0_22
+        + 0.67961657f * h0_23 + 0.152049229f * h0_24 - 0.232013926f * h0_25 + 0.123097464f * h0_26
+        - 0.0139064966f * h0_27 + 0.513954461f * h0_28 + 0.0431021079f * h0_29 + 0.0857272148f * h0_30
+        + 0.273129016f * h0_31)));
+    nnOutputs.outputs[5] = 1.0f / (1.0f + exp(-(-0.104705475f + 0.107065186f * h0_0 - 0.00587207312f * h0_1 + 0.0433197208f * h0_2
+        - 0.248849899f * h0_3 + 0.109945878f * h0_4 - 0.0425813012f * h0_5 + 0.113567874f * h0_6
+        - 0.030817125f * h0_7 - 0.280605018f * h0_8 + 0.237801626f * h0_9 + 0.0508840233f * h0_10
+        - 0.441487402f * h0_11 + 1.0486424f * h0_12 + 0.0227655135f * h0_13 + 0.000495701039f * h0_14
+        - 0.166283667f * h0_15 - 0.293736309f * h0_16 + 0.329639614f * h0_17 - 0.0857538581f * h0_18
+        - 0.203664079f * h0_19 + 0.12779057f * h0_20 + 0.128460199f * h0_21 - 0.847632706f * h0_22
+        + 1.05352294f * h0_23 + 0.146808892f * h0_24 - 0.138098225f * h0_25 + 0.0925917178f * h0_26
+        + 0.286742806f * h0_27 - 0.785055935f * h0_28 + 0.0817761794f * h0_29 + 0.122488603f * h0_30
+        + 0.0128231784f * h0_31)));
+    nnOutputs.outputs[6] = 1.0f / (1.0f + exp(-(0.351605892f + 0.67312479f * h0_0 - 0.169120908f * h0_1 + 0.278080165f * h0_2
+        + 0.0977521986f * h0_3 + 0.0816725567f * h0_4 + 3.50620866f * h0_5 - 0.101589411f * h0_6
+        + 0.0806897357f * h0_7 + 0.5221771f * h0_8 + 0.893339097f * h0_9 + 0.604429185f * h0_10
+        - 0.484870017f * h0_11 - 0.300382972f * h0_12 - 0.959014237f * h0_13 - 0.0588128306f * h0_14
+        - 0.0738478452f * h0_15 - 0.695151389f * h0_16 - 0.552936137f * h0_17 - 0.494601965f * h0_18
+        + 0.508459628f * h0_19 - 0.629104197f * h0_20 - 0.0390120521f * h0_21 + 0.309757292f * h0_22
+        - 0.16707094f * h0_23 - 0.0411061756f * h0_24 + 1.20678258f * h0_25 - 0.0909550264f * h0_26
+        + 0.416817367f * h0_27 + 0.254540443f * h0_28 + 0.0661493838f * h0_29 + 0.358071268f * h0_30
+        - 0.162674233f * h0_31)));
+    nnOutputs.outputs[7] = 1.0f / (1.0f + exp(-(0.193237245f + 0.0701794922f * h0_0 - 0.172861114f * h0_1 + 0.091818966f * h0_2
+        - 0.216758713f * h0_3 - 0.0412265807f * h0_4 + 0.089363277f * h0_5 + 0.0428218991f * h0_6
+        - 0.0714636371f * h0_7 - 0.126315504f * h0_8 - 0.659187138f * h0_9 - 0.0128901973f * h0_10
+        - 0.0830829889f * h0_11 + 0.597948372f * h0_12 - 0.199791968f * h0_13 - 0.108398668f * h0_14
+        + 0.93496418f * h0_15 - 0.0616821423f * h0_16 - 0.0279515442f * h0_17 - 0.0216119699f * h0_18
+        - 0.236853316f * h0_19 - 0.0220435299f * h0_20 - 0.0997176468f * h0_21 - 0.402315646f * h0_22
+        - 0.392702252f * h0_23 + 0.119269662f * h0_24 - 0.360841334f * h0_25 + 0.129023656f * h0_26
+        + 0.286194146f * h0_27 + 0.188414693f * h0_28 - 0.0943920538f * h0_29 + 0.387018442f * h0_30
+        + 0.0746098757f * h0_31)));
+
+    return nnOutputs;
+}
+
+#include "../PixelShader.hlsl"
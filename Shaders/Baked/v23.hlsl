@@ -0,0 +1,1501 @@
+// Decoder model v23 with its weights as constants, generated by DecoderCompiler from the model
+// hashing to 0x3577e1ca7ef2732d. 5504 multiply-adds per pixel instead of 5504, 0 neurons eliminated.
+// Regenerate with NeuralTexture --bake-decoders, don't edit.
+// Compiled as the pixel shader, PixelShader.hlsl follows with this forward() in place of the generic ones.
+#define BAKED_NN 1
+
+struct NNOutputs
+{
+    float outputs[8];
+};
+
+NNOutputs forward(float input[14])
+{
+    float h0_0 = max(0.0f, -0.120412715f + 0.620152652f * input[0] + 0.180028349f * input[1] + 0.134845763f * input[2]
+        + 0.0416507982f * input[3] + 0.328742206f * input[4] - 0.192517444f * input[5] - 0.0872524232f * input[6]
+        + 0.243231177f * input[7] - 0.0661026239f * input[8] + 0.178324357f * input[9] + 0.0517373607f * input[10]
+        - 0.270274162f * input[11] + 0.144624516f * input[12] + 0.0884057209f * input[13]);
+    float h0_1 = max(0.0f, -0.228843823f + 0.00590555277f * input[0] - 0.164284095f * input[1] - 0.0024183339f * input[2]
+        + 0.276435554f * input[3] + 0.393705189f * input[4] + 0.146223426f * input[5] + 0.194168851f * input[6]
+        + 0.0243071504f * input[7] - 0.110739723f * input[8] + 0.17019254f * input[9] - 0.174582779f * input[10]
+        - 0.331566364f * input[11] - 0.00940397102f * input[12] + 0.0126471464f * input[13]);
+    float h0_2 = max(0.0f, 0.322050035f - 0.427616537f * input[0] - 0.24700661f * input[1] - 0.0238668825f * input[2]
+        - 0.0178539511f * input[3] + 0.399439752f * input[4] + 0.321256876f * input[5] - 0.0179117154f * input[6]
+        + 0.040980991f * input[7] + 0.0759024918f * input[8] - 0.119885959f * input[9] - 0.0318902843f * input[10]
+        + 0.0485245511f * input[11] - 0.127466872f * input[12] + 0.211838141f * input[13]);
+    float h0_3 = max(0.0f, -0.181024805f - 0.0188625567f * input[0] - 0.146177053f * input[1] + 0.236137271f * input[2]
+        - 0.115611896f * input[3] - 0.257627517f * input[4] - 0.0334951505f * input[5] + 0.101536788f * input[6]
+        - 0.154547781f * input[7] + 0.123168342f * input[8] - 0.0168087557f * input[9] + 0.0718629658f * input[10]
+        + 0.00835640542f * input[11] + 0.0325735956f * input[12] - 0.145852312f * input[13]);
+    float h0_4 = max(0.0f, 0.018832311f - 0.0364328399f * input[0] + 0.652074695f * input[1] - 0.723064005f * input[2]
+        + 0.433353573f * input[3] + 0.0472799167f * input[4] - 0.00833311118f * input[5] + 0.200054064f * input[6]
+        + 0.194854468f * input[7] + 0.086985223f * input[8] - 0.0602127425f * input[9] - 0.181973532f * input[10]
+        + 0.275388449f * input[11] + 0.191842675f * input[12] + 0.15893282f * input[13]);
+    float h0_5 = max(0.0f, -0.130219266f - 0.526318371f * input[0] - 0.152918071f * input[1] + 0.423454165f * input[2]
+        + 0.0740987286f * input[3] - 0.222540334f * input[4] - 0.0151448995f * input[5] + 0.0495229363f * input[6]
+        + 0.319736391f * input[7] + 0.177396894f * input[8] + 0.213091791f * input[9] + 0.138506532f * input[10]
+        + 0.191380218f * input[11] + 0.0417999327f * input[12] + 0.111318253f * input[13]);
+    float h0_6 = max(0.0f, 0.0509780012f + 0.152938664f * input[0] + 0.415687084f * input[1] - 0.115023203f * input[2]
+        - 0.193267301f * input[3] + 0.534108043f * input[4] - 0.192308113f * input[5] + 0.268112719f * input[6]
+        - 0.0106045203f * input[7] + 0.329513639f * input[8] + 0.255645752f * input[9] - 0.113291547f * input[10]
+        - 0.060643889f * input[11] - 0.135243252f * input[12] - 0.0360369049f * input[13]);
+    float h0_7 = max(0.0f, -0.279750198f - 0.276362568f * input[0] + 0.603593886f * input[1] - 0.0493811332f * input[2]
+        + 0.27909857f * input[3] + 0.156956717f * input[4] + 0.370633423f * input[5] + 0.0938687846f * input[6]
+        + 0.12236917f * input[7] - 0.294047534f * input[8] + 0.160081387f * input[9] + 0.0723339692f * input[10]
+        + 0.201988354f * input[11] - 0.148625985f * input[12] - 0.101893917f * input[13]);
+    float h0_8 = max(0.0f, 0.0122554526f + 0.48767364f * input[0] - 0.231739402f * input[1] - 0.448649377f * input[2]
+        - 0.253874868f * input[3] - 0.135314018f * input[4] + 0.653800607f * input[5] + 0.19778581f * input[6]
+        + 0.403610021f * input[7] - 0.166576818f * input[8] - 0.0465557836f * input[9] + 0.0139445877f * input[10]
+        + 0.175330296f * input[11] + 0.256870031f * input[12] + 0.239711851f * input[13]);
+    float h0_9 = max(0.0f, 0.28775391f - 0.421250701f * input[0] + 0.330126226f * input[1] + 0.091021657f * input[2]
+        - 0.0485013127f * input[3] - 0.505091012f * input[4] - 0.0978828594f * input[5] + 0.31205374f * input[6]
+        - 0.0259819385f * input[7] - 0.215564936f * input[8] + 0.193186402f * input[9] + 0.208429188f * input[10]
+        + 0.109910451f * input[11] + 0.224321887f * input[12] + 0.0795384273f * input[13]);
+    float h0_10 = max(0.0f, 0.341839343f - 0.049542252f * input[0] + 0.423594505f * input[1] + 0.440831155f * input[2]
+        - 0.414950341f * input[3] - 0.162235379f * input[4] - 0.241499946f * input[5] + 0.406818956f * input[6]
+        - 0.101711139f * input[7] + 0.113992527f * input[8] + 0.0157225318f * input[9] + 0.0898146778f * input[10]
+        - 0.203466013f * input[11] - 0.152774394f * input[12] - 0.0792433545f * input[13]);
+    float h0_11 = max(0.0f, -0.0479722992f + 0.283771396f * input[0] - 0.55604589f * input[1] + 0.151710495f * input[2]
+        - 0.146983713f * input[3] - 0.0136210267f * input[4] + 0.0617842562f * input[5] + 0.0453895405f * input[6]
+        + 0.209869355f * input[7] + 0.0242280252f * input[8] + 0.186523423f * input[9] + 0.143933728f * input[10]
+        + 0.2147291f * input[11] - 0.140977621f * input[12] + 0.187482208f * input[13]);
+    float h0_12 = max(0.0f, -0.0258783419f + 0.181654409f * input[0] - 0.537656188f * input[1] - 0.272323996f * input[2]
+        + 0.321109056f * input[3] - 0.250526369f * input[4] + 0.183240622f * input[5] + 0.161079735f * input[6]
+        + 0.0106522785f * input[7] + 0.0163740944f * input[8] + 0.0117201852f * input[9] + 0.216544017f * input[10]
+        + 0.118168704f * input[11] + 0.069315441f * input[12] + 0.251886308f * input[13]);
+    float h0_13 = max(0.0f, -0.0918993354f - 0.0437235087f * input[0] + 0.0453827679f * input[1] + 0.135782897f * input[2]
+        - 0.0551526546f * input[3] + 0.199777603f * input[4] + 0.266652852f * input[5] - 0.176325664f * input[6]
+        - 0.131214961f * input[7] - 0.0570244044f * input[8] - 0.240066037f * input[9] - 0.265589088f * input[10]
+        + 0.251245528f * input[11] - 0.206682682f * input[12] - 0.169766277f * input[13]);
+    float h0_14 = max(0.0f, 0.0301367585f - 0.0594520867f * input[0] + 0.498697996f * input[1] + 0.32939145f * input[2]
+        - 0.16097106f * input[3] - 0.273980141f * input[4] + 0.438313395f * input[5] - 0.1151364f * input[6]
+        + 0.189663693f * input[7] - 0.0921349898f * input[8] - 0.171724841f * input[9] - 0.0848552436f * input[10]
+        + 0.151307374f * input[11] + 0.0639619678f * input[12] - 0.0681034327f * input[13]);
+    float h0_15 = max(0.0f, -0.260850072f - 0.145849839f * input[0] - 0.0340452604f * input[1] + 0.418659687f * input[2]
+        + 0.546745598f * input[3] + 0.288863242f * input[4] + 0.16206342f * input[5] - 0.125319719f * input[6]
+        + 0.0336419083f * input[7] + 0.16944012f * input[8] + 0.0380748585f * input[9] - 0.282841742f * input[10]
+        - 0.167703807f * input[11] + 3.8690192e-05f * input[12] + 0.00915336423f * input[13]);
+    float h0_16 = max(0.0f, -0.237738624f + 0.383122712f * input[0] + 0.355768889f * input[1] + 0.486376017f * input[2]
+        - 0.00942605268f * input[3] - 0.0475132465f * input[4] + 0.243333802f * input[5] + 0.0371198915f * input[6]
+        - 0.127173141f * input[7] + 0.342883348f * input[8] + 0.310509294f * input[9] - 0.327925295f * input[10]
+        - 0.200870275f * input[11] + 0.172780886f * input[12] + 0.185580269f * input[13]);
+    float h0_17 = max(0.0f, 0.28784433f - 0.234478131f * input[0] + 0.112839065f * input[1] + 0.102326453f * input[2]
+        + 0.538609564f * input[3] + 0.244533047f * input[4] - 0.223960742f * input[5] + 0.252017796f * input[6]
+        + 0.34253788f * input[7] + 0.363589704f * input[8] + 0.162240386f * input[9] + 0.0185850989f * input[10]
+        - 0.192904487f * input[11] + 0.0464525148f * input[12] - 0.196533725f * input[13]);
+    float h0_18 = max(0.0f, 0.246116668f + 0.216474652f * input[0] - 0.353025883f * input[1] - 0.42734924f * input[2]
+        + 0.39944011f * input[3] + 0.079675667f * input[4] + 0.0157330018f * input[5] + 0.129988536f * input[6]
+        + 0.306391686f * input[7] + 0.172368497f * input[8] + 0.0863869786f * input[9] + 0.228859112f * input[10]
+        - 0.0346821584f * input[11] + 0.149262697f * input[12] - 0.190608263f * input[13]);
+    float h0_19 = max(0.0f, 0.146837264f + 0.543313384f * input[0] + 0.481320113f * input[1] - 0.0112289395f * input[2]
+        + 0.34135589f * input[3] + 0.0407185592f * input[4] - 0.154551715f * input[5] + 0.193885729f * input[6]
+        - 0.174904972f * input[7] + 0.184715152f * input[8] + 0.197592556f * input[9] - 0.173015147f * input[10]
+        + 0.167377263f * input[11] + 0.217004478f * input[12] + 0.150041997f * input[13]);
+    float h0_20 = max(0.0f, 0.142881304f - 0.175609753f * input[0] + 0.432522863f * input[1] - 0.562045574f * input[2]
+        - 0.0278971419f * input[3] - 0.085569948f * input[4] + 0.188663393f * input[5] - 0.0995818675f * input[6]
+        + 0.282821864f * input[7] + 0.244375959f * input[8] + 0.0949985683f * input[9] + 0.0609015711f * input[10]
+        + 0.0741272867f * input[11] - 0.0783551782f * input[12] - 0.0486654341f * input[13]);
+    float h0_21 = max(0.0f, -0.212017581f - 0.00984066725f * input[0] + 0.125370026f * input[1] + 0.0698799789f * input[2]
+        - 0.158933401f * input[3] - 0.206852719f * input[4] - 0.069803521f * input[5] + 0.0195300281f * input[6]
+        - 0.222905457f * input[7] + 0.0425391197f * input[8] - 0.0232894868f * input[9] - 0.139364332f * input[10]
+        + 0.0978826582f * input[11] + 0.138513476f * input[12] - 0.113148823f * input[13]);
+    float h0_22 = max(0.0f, -0.094592005f - 0.564785898f * input[0] - 0.284600556f * input[1] + 0.156696618f * input[2]
+        - 0.165200084f * input[3] + 0.338493526f * input[4] + 0.364989817f * input[5] + 0.09011776f * input[6]
+        + 0.103805698f * input[7] - 0.0762335584f * input[8] + 0.310390294f * input[9] + 0.272960782f * input[10]
+        - 0.00306340586f * input[11] - 0.0833228827f * input[12] + 0.215926856f * input[13]);
+    float h0_23 = max(0.0f, 0.119801857f + 0.186982483f * input[0] - 0.189898536f * input[1] - 0.116489813f * input[2]
+        + 0.19071506f * input[3] + 0.167025849f * input[4] + 0.00118693244f * input[5] + 0.134848505f * input[6]
+        + 0.200155064f * input[7] + 0.237611026f * input[8] - 0.0632654652f * input[9] + 0.125878498f * input[10]
+        + 0.0786865279f * input[11] + 0.197362527f * input[12] + 0.143268928f * input[13]);
+    float h0_24 = max(0.0f, 0.346367419f + 0.214045614f * input[0] - 0.196077526f * input[1] - 0.367371857f * input[2]
+        - 0.159881696f * input[3] - 0.396618903f * input[4] + 0.309038401f * input[5] + 0.192954794f * input[6]
+        + 0.00257156626f * input[7] - 0.361798763f * input[8] - 0.110096335f * input[9] + 0.281497002f * input[10]
+        + 0.123355292f * input[11] + 0.177607164f * input[12] + 0.0364643559f * input[13]);
+    float h0_25 = max(0.0f, 0.0503797829f - 0.0534802675f * input[0] - 0.222318247f * input[1] - 0.0147101581f * input[2]
+        - 0.173051238f * input[3] + 0.0574199557f * input[4] + 0.126146197f * input[5] - 0.239634067f * input[6]
+        - 0.150360435f * input[7] - 0.0284213126f * input[8] - 0.0172901154f * input[9] - 0.226935342f * input[10]
+        + 0.250853926f * input[11] - 0.204028815f * input[12] - 0.236958444f * input[13]);
+    float h0_26 = max(0.0f, 0.0219662618f + 0.0297686979f * input[0] + 0.624922931f * input[1] - 0.81507796f * input[2]
+        + 0.00256826775f * input[3] + 0.213580981f * input[4] - 0.0471880548f * input[5] + 0.26637271f * input[6]
+        + 0.0410205089f * input[7] + 0.0601629429f * input[8] - 0.15115428f * input[9] - 0.0366682895f * input[10]
+        + 0.00745407911f * input[11] - 0.00347606f * input[12] + 0.00655441964f * input[13]);
+    float h0_27 = max(0.0f, 0.0119895916f - 0.266563177f * input[0] + 0.230895579f * input[1] + 0.0239389408f * input[2]
+        - 0.397361666f * input[3] + 0.501158297f * input[4] - 0.460007489f * input[5] + 0.181112722f * input[6]
+        - 0.0951771513f * input[7] + 0.240076274f * input[8] + 0.255030483f * input[9] + 0.354329407f * input[10]
+        - 0.272564799f * input[11] - 0.0537771061f * input[12] + 0.19026956f * input[13]);
+    float h0_28 = max(0.0f, -0.148449093f - 0.0371889696f * input[0] - 0.140704811f * input[1] + 0.380761713f * input[2]
+        - 0.671338737f * input[3] - 0.0979262963f * input[4] - 0.325633615f * input[5] + 0.341626585f * input[6]
+        + 0.112292804f * input[7] + 0.19815357f * input[8] + 0.194750249f * input[9] + 0.269495577f * input[10]
+        - 0.0287179369f * input[11] - 0.00837463699f * input[12] + 0.00125598884f * input[13]);
+    float h0_29 = max(0.0f, 0.302770823f - 0.183258012f * input[0] - 0.135110408f * input[1] - 0.0413107276f * input[2]
+        + 0.535253882f * input[3] + 0.331186086f * input[4] + 0.482298464f * input[5] + 0.153412536f * input[6]
+        + 0.137055412f * input[7] - 0.0481295064f * input[8] - 0.0985376313f * input[9] + 0.190589383f * input[10]
+        - 0.0591388792f * input[11] - 0.0815168694f * input[12] + 0.0999520421f * input[13]);
+    float h0_30 = max(0.0f, 0.041139394f - 0.121529914f * input[0] + 0.373133242f * input[1] + 0.384141386f * input[2]
+        + 0.369907856f * input[3] + 0.299970388f * input[4] - 0.344956487f * input[5] - 0.128500938f * input[6]
+        - 0.113649622f * input[7] - 0.0927860662f * input[8] + 0.243636608f * input[9] + 0.263505757f * input[10]
+        + 0.0921198055f * input[11] - 0.057045985f * input[12] + 0.252854377f * input[13]);
+    float h0_31 = max(0.0f, 0.0955938995f - 0.100542307f * input[0] - 0.225768879f * input[1] - 0.155395508f * input[2]
+        + 0.22598663f * input[3] - 0.117010832f * input[4] + 0.0429051109f * input[5] + 0.0209609773f * input[6]
+        - 0.219394565f * input[7] + 0.156267658f * input[8] - 0.168962508f * input[9] - 0.0981966108f * input[10]
+        - 0.21913749f * input[11] - 0.130230799f * input[12] + 0.118088074f * input[13]);
+    float h0_32 = max(0.0f, -0.144243956f + 0.0921622664f * input[0] - 0.144658238f * input[1] + 0.113932967f * input[2]
+        - 0.193921164f * input[3] + 0.0843489394f * input[4] + 0.151225641f * input[5] - 0.0878908262f * input[6]
+        + 0.243993029f * input[7] - 0.223445848f * input[8] - 0.240626946f * input[9] - 0.261640638f * input[10]
+        + 0.238928735f * input[11] + 0.0743680671f * input[12] - 0.112677097f * input[13]);
+    float h0_33 = max(0.0f, 0.153791755f + 0.44406575f * input[0] - 0.265759408f * input[1] + 0.574484706f * input[2]
+        - 0.125231072f * input[3] + 0.0129569573f * input[4] + 0.330710918f * input[5] - 0.0795629323f * input[6]
+        + 0.172029167f * input[7] + 0.116739467f * input[8] - 0.0637867302f * input[9] + 0.0353447758f * input[10]
+        - 0.140575573f * input[11] - 0.208217084f * input[12] + 0.132978424f * input[13]);
+    float h0_34 = max(0.0f, -0.247064501f + 0.0838335007f * input[0] + 0.198389009f * input[1] - 0.0112099918f * input[2]
+        - 0.096160017f * input[3] + 0.254548758f * input[4] - 0.110216126f * input[5] - 0.159836978f * input[6]
+        - 0.0769276991f * input[7] + 0.139095813f * input[8] + 0.144634351f * input[9] - 0.133388311f * input[10]
+        + 0.0223132484f * input[11] - 0.104814626f * input[12] - 0.0504059717f * input[13]);
+    float h0_35 = max(0.0f, -0.137368739f + 0.798030198f * input[0] + 0.503955901f * input[1] - 0.574680746f * input[2]
+        + 0.368768334f * input[3] - 0.0165480301f * input[4] + 0.0756923482f * input[5] - 0.109139115f * input[6]
+        + 0.0596323796f * input[7] - 0.102158681f * input[8] + 0.136494264f * input[9] - 0.103819564f * input[10]
+        + 0.257454813f * input[11] - 0.0196212567f * input[12] + 0.236224085f * input[13]);
+    float h0_36 = max(0.0f, 0.203265458f + 0.473260075f * input[0] - 0.432092369f * input[1] + 0.550237417f * input[2]
+        + 0.326110005f * input[3] + 0.358282894f * input[4] - 0.000822660688f * input[5] + 0.0128907189f * input[6]
+        - 0.0736157075f * input[7] + 0.29035154f * input[8] + 0.135761321f * input[9] - 0.166756749f * input[10]
+        - 0.137025297f * input[11] + 0.270276368f * input[12] - 0.234820321f * input[13]);
+    float h0_37 = max(0.0f, 0.19363445f - 0.168115646f * input[0] + 0.536538363f * input[1] + 0.61007762f * input[2]
+        - 0.0727778301f * input[3] + 0.0291549582f * input[4] - 0.180636361f * input[5] - 0.109312125f * input[6]
+        + 0.106923804f * input[7] - 0.00351138785f * input[8] - 0.096418187f * input[9] - 0.167982608f * input[10]
+        + 0.221283346f * input[11] + 0.263531953f * input[12] + 0.0671763495f * input[13]);
+    float h0_38 = max(0.0f, -0.152341992f - 0.266703308f * input[0] + 0.186807096f * input[1] + 0.0196107347f * input[2]
+        + 0.116953634f * input[3] - 0.210885704f * input[4] - 0.0439398475f * input[5] - 0.158674315f * input[6]
+        - 0.0420293584f * input[7] - 0.120859779f * input[8] - 0.0987678319f * input[9] + 0.0972080827f * input[10]
+        + 0.26659137f * input[11] - 0.189088032f * input[12] + 0.033561103f * input[13]);
+    float h0_39 = max(0.0f, -0.339675635f + 0.44362402f * input[0] + 0.227524057f * input[1] + 0.383099109f * input[2]
+        + 0.443682551f * input[3] + 0.129105538f * input[4] + 0.0669485927f * input[5] + 0.0509792566f * input[6]
+        - 0.281513333f * input[7] - 0.160527349f * input[8] + 0.0560929477f * input[9] + 0.0643570423f * input[10]
+        + 0.0152930925f * input[11] + 0.0696994662f * input[12] + 0.0432692096f * input[13]);
+    float h0_40 = max(0.0f, 0.0953982323f + 0.0452638678f * input[0] - 0.40631783f * input[1] + 0.453936279f * input[2]
+        + 0.297873318f * input[3] - 0.281151474f * input[4] - 0.155964881f * input[5] + 0.216496289f * input[6]
+        - 0.163164899f * input[7] + 0.0919540673f * input[8] + 0.145983011f * input[9] + 0.134440929f * input[10]
+        + 0.195180058f * input[11] + 0.0398028493f * input[12] + 0.0705420449f * input[13]);
+    float h0_41 = max(0.0f, -0.120114207f - 0.00390034146f * input[0] + 0.290348679f * input[1] + 0.121182524f * input[2]
+        + 0.460366756f * input[3] - 0.205926895f * input[4] + 0.321676821f * input[5] + 0.0642855018f * input[6]
+        + 0.249306902f * input[7] + 0.135080352f * input[8] + 0.0583843142f * input[9] + 0.232623339f * input[10]
+        + 0.283632338f * input[11] - 0.229958296f * input[12] + 0.215346724f * input[13]);
+    float h0_42 = max(0.0f, 0.127533272f - 0.329995781f * input[0] - 0.336793095f * input[1] - 0.349442512f * input[2]
+        + 0.189152464f * input[3] - 0.196152702f * input[4] + 0.358730435f * input[5] + 0.016352322f * input[6]
+        + 0.291972995f * input[7] + 0.14140594f * input[8] + 0.145671934f * input[9] + 0.22665979f * input[10]
+        + 0.0912970155f * input[11] + 0.147533685f * input[12] + 0.0543703884f * input[13]);
+    float h0_43 = max(0.0f, 0.246787578f + 0.0522205643f * input[0] + 0.265805572f * input[1] + 0.139531285f * input[2]
+        + 0.604167879f * input[3] + 0.0224664342f * input[4] - 0.112859622f * input[5] - 0.137546107f * input[6]
+        - 0.0801213756f * input[7] + 0.0131983636f * input[8] - 0.292918533f * input[9] - 0.0575811043f * input[10]
+        + 0.162629619f * input[11] - 0.00481290184f * input[12] - 0.149847239f * input[13]);
+    float h0_44 = max(0.0f, 0.0503866225f - 0.48186481f * input[0] - 0.160198122f * input[1] + 0.342399001f * input[2]
+        + 0.264359862f * input[3] + 0.00830428302f * input[4] + 0.441013455f * input[5] + 0.225592181f * input[6]
+        + 0.128370732f * input[7] + 0.273641288f * input[8] + 0.0715640262f * input[9] - 0.244342059f * input[10]
+        + 0.230244622f * input[11] - 0.17101489f * input[12] + 0.0462553091f * input[13]);
+    float h0_45 = max(0.0f, 0.10853944f - 0.133538738f * input[0] + 0.144904375f * input[1] - 0.138731971f * input[2]
+        - 0.0380065478f * input[3] - 0.0286455881f * input[4] + 0.422471613f * input[5] + 0.28969124f * input[6]
+        + 0.108399995f * input[7] + 0.136842251f * input[8] + 0.161766201f * input[9] - 0.0927815959f * input[10]
+        + 0.29013148f * input[11] + 0.123492233f * input[12] + 0.1902408f * input[13]);
+    float h0_46 = max(0.0f, 0.231209368f - 0.2449404f * input[0] - 0.011038959f * input[1] + 0.12106064f * input[2]
+        - 0.236122429f * input[3] + 0.062368691f * input[4] + 0.00176081061f * input[5] - 0.216525421f * input[6]
+        - 0.221902281f * input[7] + 0.226147711f * input[8] - 0.153621763f * input[9] - 0.204362765f * input[10]
+        - 0.207515344f * input[11] + 0.0527779162f * input[12] + 0.0414409041f * input[13]);
+    float h0_47 = max(0.0f, -0.0826341733f + 0.395792574f * input[0] - 0.276225001f * input[1] - 0.397570074f * input[2]
+        - 0.000766746933f * input[3] + 0.470166892f * input[4] + 0.094254978f * input[5] + 0.117286623f * input[6]
+        - 0.141943455f * input[7] + 0.158484235f * input[8] - 0.211857751f * input[9] + 0.275046021f * input[10]
+        - 0.0654486269f * input[11] + 0.113679156f * input[12] - 0.176716536f * input[13]);
+    float h0_48 = max(0.0f, -0.266429424f + 0.638178408f * input[0] - 0.421885341f * input[1] - 0.115859903f * input[2]
+        - 0.408188373f * input[3] + 0.295687854f * input[4] + 0.140078247f * input[5] + 0.0930906385f * input[6]
+        + 0.262145191f * input[7] + 0.0531548485f * input[8] - 0.0388191082f * input[9] + 0.191391841f * input[10]
+        - 0.0307297464f * input[11] + 0.104088157f * input[12] - 0.010497231f * input[13]);
+    float h0_49 = max(0.0f, -0.00601576827f + 0.659530103f * input[0] + 0.3418338f * input[1] - 0.239457816f * input[2]
+        - 0.0229297895f * input[3] - 0.0904712826f * input[4] + 0.020269122f * input[5] + 0.279549539f * input[6]
+        - 0.201755017f * input[7] + 0.212531477f * input[8] - 0.0367816836f * input[9] + 0.159287244f * input[10]
+        - 0.103397422f * input[11] - 0.257611424f * input[12] - 0.0237723403f * input[13]);
+    float h0_50 = max(0.0f, -0.226862609f - 0.219026208f * input[0] + 0.176169962f * input[1] - 0.20719105f * input[2]
+        + 0.143681407f * input[3] + 0.0174446404f * input[4] - 0.202018633f * input[5] - 0.00847768784f * input[6]
+        + 0.107525498f * input[7] + 0.126788288f * input[8] - 0.0295189172f * input[9] - 0.126446754f * input[10]
+        - 0.146293968f * input[11] - 0.0230966657f * input[12] - 0.0114977956f * input[13]);
+    float h0_51 = max(0.0f, -0.179489166f + 0.0427401066f * input[0] - 0.0676458627f * input[1] + 0.2547234f * input[2]
+        + 0.0885059237f * input[3] + 0.114928544f * input[4] - 0.262193829f * input[5] - 0.1944976f * input[6]
+        - 0.211974099f * input[7] - 0.196435988f * input[8] - 0.174497336f * input[9] + 0.215067953f * input[10]
+        - 0.265388817f * input[11] + 0.0863531828f * input[12] - 0.0375225991f * input[13]);
+    float h0_52 = max(0.0f, 0.0938352048f + 0.460797787f * input[0] - 0.514627218f * input[1] - 0.0474814549f * input[2]
+        - 0.0114799356f * input[3] - 0.174964875f * input[4] - 0.0596878827f * input[5] + 0.102321871f * input[6]
+        + 0.285842896f * input[7] - 0.0719165578f * input[8] + 0.0438724197f * input[9] + 0.316443175f * input[10]
+        + 0.072107628f * input[11] - 0.198654532f * input[12] - 0.192797825f * input[13]);
+    float h0_53 = max(0.0f, 0.166760966f + 0.125399664f * input[0] - 0.368416399f * input[1] + 0.84117198f * input[2]
+        + 0.342776448f * input[3] + 0.188932583f * input[4] + 0.17100887f * input[5] + 0.146496072f * input[6]
+        - 0.218587995f * input[7] - 0.285367221f * input[8] - 0.17464824f * input[9] - 0.0806797445f * input[10]
+        + 0.18039161f * input[11] - 0.0553687736f * input[12] - 0.0965728015f * input[13]);
+    float h0_54 = max(0.0f, 0.0436529331f + 0.0760101005f * input[0] + 0.526416302f * input[1] + 0.459605098f * input[2]
+        - 0.190734714f * input[3] + 0.184304923f * input[4] + 0.120278791f * input[5] + 0.0209949035f * input[6]
+        - 0.140713483f * input[7] + 0.244458064f * input[8] - 0.124334656f * input[9] + 0.129939795f * input[10]
+        - 0.135015368f * input[11] - 0.107322954f * input[12] - 0.255174726f * input[13]);
+    float h0_55 = max(0.0f, -0.31114307f + 0.324608982f * input[0] + 0.391985089f * input[1] + 0.52824825f * input[2]
+        - 0.399322569f * input[3] - 0.179017216f * input[4] + 0.298842698f * input[5] + 0.326663285f * input[6]
+        + 0.200371474f * input[7] - 0.168147519f * input[8] + 0.0412062295f * input[9] - 0.296499491f * input[10]
+        + 0.093813397f * input[11] + 0.0790029764f * input[12] + 0.269238144f * input[13]);
+    float h0_56 = max(0.0f, -0.231038094f + 0.467153162f * input[0] + 0.157003388f * input[1] + 0.198544681f * input[2]
+        - 0.155815795f * input[3] - 0.37602219f * input[4] + 0.485224724f * input[5] + 0.0238633566f * input[6]
+        + 0.257225364f * input[7] + 0.162717462f * input[8] + 0.0908576921f * input[9] - 0.0449134223f * input[10]
+        + 0.295084238f * input[11] - 0.0152619313f * input[12] - 0.106005549f * input[13]);
+    float h0_57 = max(0.0f, -0.214602411f + 0.165794045f * input[0] + 0.0585715175f * input[1] - 0.187428236f * input[2]
+        + 0.187380046f * input[3] - 0.144599736f * input[4] + 0.172988296f * input[5] + 0.111886322f * input[6]
+        - 0.205371648f * input[7] + 0.036755383f * input[8] - 0.166855484f * input[9] - 0.252304465f * input[10]
+        - 0.225513577f * input[11] - 0.144508868f * input[12] + 0.174372196f * input[13]);
+    float h0_58 = max(0.0f, 0.114005946f - 0.508338511f * input[0] + 0.0604230277f * input[1] + 0.251196444f * input[2]
+        - 0.301832169f * input[3] + 0.386019886f * input[4] + 0.235412642f * input[5] + 0.0290115401f * input[6]
+        + 0.220600188f * input[7] - 0.133107856f * input[8] + 0.128290638f * input[9] - 0.0517354459f * input[10]
+        + 0.0797003806f * input[11] + 0.0998824388f * input[12] + 0.0692972392f * input[13]);
+    float h0_59 = max(0.0f, 0.341668099f - 0.312167346f * input[0] - 0.145155907f * input[1] - 0.23891671f * input[2]
+        - 0.0875856727f * input[3] - 0.313393116f * input[4] + 0.0936687812f * input[5] + 0.194041714f * input[6]
+        + 0.303050101f * input[7] + 0.207594216f * input[8] - 0.228290096f * input[9] + 0.143206924f * input[10]
+        - 0.0693041161f * input[11] + 0.216288134f * input[12] + 0.105265036f * input[13]);
+    float h0_60 = max(0.0f, -0.121659465f - 0.0716684312f * input[0] - 0.146091327f * input[1] + 0.426054776f * input[2]
+        + 0.757389307f * input[3] + 0.306643158f * input[4] + 0.229076862f * input[5] - 0.139895678f * input[6]
+        + 0.0822532326f * input[7] + 0.0339192785f * input[8] - 0.272531629f * input[9] - 0.192502022f * input[10]
+        + 0.192721412f * input[11] + 0.13992013f * input[12] + 0.0652852356f * input[13]);
+    float h0_61 = max(0.0f, 0.206143364f + 0.57303381f * input[0] - 0.156587422f * input[1] + 0.0467513427f * input[2]
+        + 0.436135322f * input[3] - 0.0729440525f * input[4] - 0.286298454f * input[5] - 0.240817457f * input[6]
+        - 0.220281661f * input[7] + 0.106512591f * input[8] - 0.0112617882f * input[9] + 0.233722046f * input[10]
+        + 0.357022047f * input[11] - 0.118806228f * input[12] + 0.189068511f * input[13]);
+    float h0_62 = max(0.0f, 0.311569452f + 0.106761009f * input[0] + 0.308022499f * input[1] - 0.785030723f * input[2]
+        + 0.0905989781f * input[3] - 0.270293772f * input[4] + 0.0433989614f * input[5] - 0.159461483f * input[6]
+        - 0.0454483777f * input[7] + 0.0288433973f * input[8] + 0.240794167f * input[9] + 0.215089381f * input[10]
+        + 0.490870744f * input[11] + 0.137760699f * input[12] + 0.105758861f * input[13]);
+    float h0_63 = max(0.0f, 0.127544224f + 0.568270862f * input[0] - 0.383597314f * input[1] + 0.238234311f * input[2]
+        - 0.544773638f * input[3] - 0.0281933006f * input[4] + 0.0563094243f * input[5] + 0.100709423f * input[6]
+        + 0.296079963f * input[7] - 0.0461374186f * input[8] - 0.0334949829f * input[9] - 0.0940843672f * input[10]
+        - 0.0954987034f * input[11] + 0.16376324f * input[12] - 0.06244874f * input[13]);
+
+    float h1_0 = max(0.0f, -0.0980682895f + 0.190965831f * h0_0 - 0.011000528f * h0_1 - 0.12368723f * h0_2
+        + 0.082699731f * h0_3 + 0.0790602937f * h0_4 + 0.0273740776f * h0_5 + 0.196329251f * h0_6
+        + 0.162680432f * h0_7 + 0.041348014f * h0_8 - 0.133779764f * h0_9 + 0.00561302109f * h0_10
+        - 0.0348790735f * h0_11 - 0.20466873f * h0_12 - 0.0461623222f * h0_13 + 0.0850190967f * h0_14
+        + 0.0766213685f * h0_15 + 0.121034473f * h0_16 - 0.068753548f * h0_17 + 0.130595267f * h0_18
+        + 0.244180933f * h0_19 + 0.156637013f * h0_20 - 0.0907975286f * h0_21 - 0.286144882f * h0_22
+        + 0.0871215314f * h0_23 - 0.116555221f * h0_24 - 0.00796929002f * h0_25 + 0.23805584f * h0_26
+        - 0.0317973308f * h0_27 - 0.398611009f * h0_28 + 0.131520256f * h0_29 + 0.081803292f * h0_30
+        - 0.05238536f * h0_31 + 0.111276709f * h0_32 - 0.0931640789f * h0_33 + 0.114110097f * h0_34
+        + 0.394892335f * h0_35 + 0.0131162619f * h0_36 + 0.148155838f * h0_37 + 0.0801736712f * h0_38
+        + 0.0990553051f * h0_39 - 0.476028711f * h0_40 + 0.0472090393f * h0_41 + 0.0567168407f * h0_42
+        + 0.249686033f * h0_43 - 0.0332744531f * h0_44 + 0.0903251544f * h0_45 - 0.120130897f * h0_46
+        + 0.0618816838f * h0_47 + 0.149666652f * h0_48 + 0.214353785f * h0_49 - 0.11676015f * h0_50
+        + 0.0441562682f * h0_51 - 0.196947858f * h0_52 - 0.0501430668f * h0_53 + 0.147430107f * h0_54
+        + 0.288282394f * h0_55 - 0.0129811484f * h0_56 + 0.0198188722f * h0_57 + 0.0698125064f * h0_58
+        - 0.273031205f * h0_59 + 0.0733195916f * h0_60 + 0.146563992f * h0_61 + 0.121151015f * h0_62
+        - 0.123697281f * h0_63);
+    float h1_1 = max(0.0f, 0.0505931526f + 0.188377619f * h0_0 - 0.169077337f * h0_1 + 0.000288483163f * h0_2
+        - 0.0486285016f * h0_3 + 0.180734411f * h0_4 + 0.0601662286f * h0_5 + 0.220784515f * h0_6
+        + 0.272643894f * h0_7 + 0.0309731308f * h0_8 - 0.142555982f * h0_9 - 0.0589704178f * h0_10
+        - 0.0908426493f * h0_11 - 0.396028548f * h0_12 + 0.033089444f * h0_13 - 0.102288708f * h0_14
+        + 0.18406339f * h0_15 + 0.019482119f * h0_16 + 0.176541954f * h0_17 - 0.0621057265f * h0_18
+        + 0.1304003f * h0_19 - 0.0138270324f * h0_20 + 0.0883051753f * h0_21 - 0.128082246f * h0_22
+        + 0.119047031f * h0_23 - 0.307256907f * h0_24 + 0.0502346754f * h0_25 + 0.0691480413f * h0_26
+        + 0.20398666f * h0_27 - 0.247662559f * h0_28 + 0.139322907f * h0_29 + 0.239718214f * h0_30
+        + 0.0760661513f * h0_31 + 0.019244941f * h0_32 + 0.0185674429f * h0_33 - 0.116968215f * h0_34
+        + 0.183005467f * h0_35 + 0.0475655422f * h0_36 + 0.148870394f * h0_37 - 0.102100857f * h0_38
+        + 0.159031212f * h0_39 - 0.37437126f * h0_40 + 0.072119236f * h0_41 - 0.0903538242f * h0_42
+        + 0.416512311f * h0_43 + 0.0815334395f * h0_44 + 0.1407094f * h0_45 - 0.0395047069f * h0_46
+        + 0.17098023f * h0_47 - 0.0474341363f * h0_48 + 0.0920566991f * h0_49 - 0.0801801533f * h0_50
+        - 0.121006027f * h0_51 - 0.320440322f * h0_52 + 0.0884643644f * h0_53 + 0.130441427f * h0_54
+        + 0.00294973142f * h0_55 - 0.158530787f * h0_56 + 0.112998158f * h0_57 + 0.178771004f * h0_58
+        - 0.20868136f * h0_59 + 0.18874073f * h0_60 + 0.0897698328f * h0_61 - 0.0590950735f * h0_62
+        - 0.258669496f * h0_63);
+    float h1_2 = max(0.0f, -0.021390412f + 0.124840274f * h0_0 - 0.0454092696f * h0_1 - 0.00111169927f * h0_2
+        - 0.0304370858f * h0_3 + 0.0854410902f * h0_4 - 0.241696373f * h0_5 - 0.036978472f * h0_6
+        + 0.0193537809f * h0_7 - 0.00375289563f * h0_8 + 0.0521430969f * h0_9 - 0.111457542f * h0_10
+        - 0.0747449622f * h0_11 + 0.229884565f * h0_12 + 0.0796721429f * h0_13 - 0.20403865f * h0_14
+        - 0.127821475f * h0_15 - 0.191381693f * h0_16 + 0.137058273f * h0_17 + 0.165983498f * h0_18
+        + 0.0967113376f * h0_19 + 0.0974017754f * h0_20 - 0.0485299975f * h0_21 - 0.0567331836f * h0_22
+        + 0.114660978f * h0_23 - 0.0917377919f * h0_24 - 0.122142941f * h0_25 + 0.0376463234f * h0_26
+        + 0.4144319f * h0_27 + 0.197468072f * h0_28 - 0.000682048034f * h0_29 + 0.0128755085f * h0_30
+        + 0.0470904037f * h0_31 + 0.0764399543f * h0_32 - 0.00808718242f * h0_33 + 0.0409030914f * h0_34
+        + 0.0610082708f * h0_35 - 0.0811054111f * h0_36 + 0.00691491738f * h0_37 + 0.0507001616f * h0_38
+        - 0.110599324f * h0_39 - 0.219743058f * h0_40 + 0.117836766f * h0_41 + 0.0337084644f * h0_42
+        + 0.0195560083f * h0_43 - 0.133342832f * h0_44 + 0.0613880046f * h0_45 - 0.0285010487f * h0_46
+        + 0.21418348f * h0_47 + 0.0822365135f * h0_48 + 0.0442488231f * h0_49 - 0.0950277448f * h0_50
+        + 0.0125434995f * h0_51 + 0.123497352f * h0_52 - 0.150929049f * h0_53 - 0.0129680615f * h0_54
+        - 0.349520355f * h0_55 - 0.0308447797f * h0_56 - 0.028217271f * h0_57 - 0.0332804471f * h0_58
+        + 0.179252952f * h0_59 - 0.225315273f * h0_60 + 0.235470042f * h0_61 + 0.158237875f * h0_62
+        - 0.211903363f * h0_63);
+    float h1_3 = max(0.0f, -0.0627882034f + 0.0419260263f * h0_0 + 0.178871647f * h0_1 + 0.274700582f * h0_2
+        + 0.0911408588f * h0_3 + 0.00775322085f * h0_4 - 0.253572702f * h0_5 - 0.119669206f * h0_6
+        + 0.0359055214f * h0_7 + 0.239190534f * h0_8 + 0.120864876f * h0_9 + 0.128247142f * h0_10
+        + 0.0846091956f * h0_11 + 0.0636320487f * h0_12 + 0.116881013f * h0_13 + 0.0195975974f * h0_14
+        - 0.165508449f * h0_15 - 0.243962809f * h0_16 - 0.0496230088f * h0_17 + 0.123150423f * h0_18
+        - 0.0397082381f * h0_19 + 0.211142763f * h0_20 - 0.0654941499f * h0_21 + 0.350568146f * h0_22
+        - 0.0448140986f * h0_23 + 0.304217041f * h0_24 + 0.053560704f * h0_25 - 0.0568778217f * h0_26
+        + 0.093922399f * h0_27 + 0.407557845f * h0_28 - 0.0227198731f * h0_29 - 0.00300280564f * h0_30
+        - 0.0199820213f * h0_31 + 0.0764076784f * h0_32 + 0.071016103f * h0_33 + 0.0679189116f * h0_34
+        - 0.124626651f * h0_35 - 0.000430614047f * h0_36 - 0.172149017f * h0_37 - 0.0882975161f * h0_38
+        - 0.287730962f * h0_39 + 0.163228855f * h0_40 + 0.0430965312f * h0_41 + 0.209377497f * h0_42
+        - 0.282767564f * h0_43 + 0.0467782915f * h0_44 + 0.13622041f * h0_45 + 0.12087892f * h0_46
+        + 0.132937998f * h0_47 + 0.121121466f * h0_48 + 0.0504921302f * h0_49 + 0.0619947761f * h0_50
+        - 0.0792265087f * h0_51 + 0.242974684f * h0_52 - 0.15583159f * h0_53 - 0.140125066f * h0_54
+        + 0.0186327584f * h0_55 - 0.0226500854f * h0_56 - 0.0368527323f * h0_57 + 0.196092278f * h0_58
+        + 0.224521562f * h0_59 - 0.362168014f * h0_60 - 0.154650509f * h0_61 + 0.159069449f * h0_62
+        + 0.178207025f * h0_63);
+    float h1_4 = max(0.0f, -0.0717206374f + 0.0719881728f * h0_0 - 0.111760266f * h0_1 + 0.277949899f * h0_2
+        + 0.00131043268f * h0_3 + 0.0356413759f * h0_4 - 0.214234486f * h0_5 + 0.0824189261f * h0_6
+        + 0.177416325f * h0_7 + 0.24700816f * h0_8 - 0.127994686f * h0_9 - 0.356131583f * h0_10
+        + 0.0890828371f * h0_11 + 0.173117071f * h0_12 + 0.0403272659f * h0_13 - 0.0493525565f * h0_14
+        + 0.15967077f * h0_15 - 0.146672532f * h0_16 + 0.100812614f * h0_17 + 0.104310252f * h0_18
+        + 0.00773394201f * h0_19 + 0.0571990907f * h0_20 + 0.120345235f * h0_21 + 0.17155987f * h0_22
+        - 0.000811542966f * h0_23 + 0.199202433f * h0_24 + 0.0358022451f * h0_25 + 0.245946333f * h0_26
+        - 0.0427819826f * h0_27 - 0.139383927f * h0_28 + 0.0312915705f * h0_29 - 0.0496337041f * h0_30
+        + 0.0187784359f * h0_31 + 0.0950538367f * h0_32 + 0.114858747f * h0_33 - 0.0924184471f * h0_34
+        + 0.212961853f * h0_35 + 0.0287046097f * h0_36 - 0.22108148f * h0_37 + 0.0732375756f * h0_38
+        + 0.00444136653f * h0_39 - 0.279692382f * h0_40 - 0.00323399156f * h0_41 + 0.226313993f * h0_42
+        - 0.186396271f * h0_43 - 0.0389863551f * h0_44 + 0.00968477502f * h0_45 + 0.0863275528f * h0_46
+        + 0.146027088f * h0_47 + 0.221205115f * h0_48 + 0.0950842574f * h0_49 - 0.0540312827f * h0_50
+        - 0.0756704062f * h0_51 + 0.116113223f * h0_52 - 0.0946224406f * h0_53 + 0.000408321823f * h0_54
+        - 0.0700603873f * h0_55 - 0.00383752049f * h0_56 + 0.11892657f * h0_57 + 0.121023811f * h0_58
+        + 0.239948735f * h0_59 - 0.219423503f * h0_60 - 0.145603895f * h0_61 - 0.0624619909f * h0_62
+        + 0.107680209f * h0_63);
+    float h1_5 = max(0.0f, 0.0243211929f + 0.0521962829f * h0_0 + 0.359624177f * h0_1 - 0.0601614639f * h0_2
+        - 0.108318552f * h0_3 + 0.0904069468f * h0_4 - 0.213240698f * h0_5 + 0.00552772637f * h0_6
+        - 0.0537250973f * h0_7 + 0.193020001f * h0_8 - 0.136634991f * h0_9 - 0.087433584f * h0_10
+        + 0.330406785f * h0_11 + 0.161200732f * h0_12 - 0.0523055792f * h0_13 - 0.177276134f * h0_14
+        + 0.207151428f * h0_15 - 0.125073642f * h0_16 - 0.0911815688f * h0_17 + 0.0156815592f * h0_18
+        + 0.0841675028f * h0_19 - 0.083660543f * h0_20 - 0.0628840029f * h0_21 - 0.135994479f * h0_22
+        + 0.0113778878f * h0_23 + 0.252375096f * h0_24 + 0.0724529177f * h0_25 - 0.0262005553f * h0_26
+        - 0.0740401894f * h0_27 + 0.152764335f * h0_28 + 0.0951014459f * h0_29 - 0.1407803f * h0_30
+        - 0.0126625644f * h0_31 + 0.118616022f * h0_32 + 0.15924935f * h0_33 + 0.108226553f * h0_34
+        + 0.27384004f * h0_35 + 0.0231592376f * h0_36 - 0.359337747f * h0_37 + 0.0614441223f * h0_38
+        + 0.114925779f * h0_39 - 0.163676858f * h0_40 - 0.0781087279f * h0_41 + 0.113622218f * h0_42
+        - 0.0493695177f * h0_43 - 0.127476469f * h0_44 + 0.0282595865f * h0_45 - 0.0543915331f * h0_46
+        + 0.292674273f * h0_47 + 0.368453443f * h0_48 + 0.0895481929f * h0_49 - 0.118075401f * h0_50
+        + 0.101595163f * h0_51 + 0.390042067f * h0_52 + 0.038827002f * h0_53 - 0.0966970399f * h0_54
+        + 0.0411782265f * h0_55 + 0.221280783f * h0_56 - 0.00428250432f * h0_57 - 0.0294985883f * h0_58
+        + 0.0507907197f * h0_59 - 0.0466348752f * h0_60 + 0.0855476856f * h0_61 + 0.115640812f * h0_62
+        + 0.345972002f * h0_63);
+    float h1_6 = max(0.0f, 0.16151002f + 0.0549970865f * h0_0 + 0.398430258f * h0_1 + 0.0170725081f * h0_2
+        + 0.103549942f * h0_3 + 0.16423358f * h0_4 - 0.076065056f * h0_5 - 0.104312867f * h0_6
+        - 0.0992300585f * h0_7 + 0.146483749f * h0_8 + 0.272955686f * h0_9 + 0.204490155f * h0_10
+        + 0.0579090752f * h0_11 + 0.16649951f * h0_12 + 0.0251473337f * h0_13 - 0.0318175666f * h0_14
+        - 0.108196743f * h0_15 - 0.269913763f * h0_16 - 0.0140997674f * h0_17 - 0.0973109975f * h0_18
+        + 0.124545582f * h0_19 + 0.0647623539f * h0_20 - 0.119683057f * h0_21 - 0.0477955006f * h0_22
+        + 0.0491432101f * h0_23 + 0.258005738f * h0_24 + 0.124049798f * h0_25 + 0.129978895f * h0_26
+        + 0.138305053f * h0_27 + 0.300653666f * h0_28 - 0.130173653f * h0_29 - 0.0957735106f * h0_30
+        + 0.0392589644f * h0_31 + 0.0598946512f * h0_32 - 0.142990917f * h0_33 - 0.101312742f * h0_34
+        + 0.0586291142f * h0_35 - 0.0598824359f * h0_36 + 0.0910238773f * h0_37 + 0.0783226565f * h0_38
+        - 0.158236638f * h0_39 + 0.0824850127f * h0_40 - 0.0923311636f * h0_41 + 0.135110617f * h0_42
+        - 0.0712820515f * h0_43 - 0.0373639017f * h0_44 + 0.127600268f * h0_45 - 0.00838185847f * h0_46
+        - 0.0674814731f * h0_47 + 0.00167214812f * h0_48 + 0.103742041f * h0_49 + 0.123055458f * h0_50
+        + 0.113886118f * h0_51 + 0.210278347f * h0_52 - 0.0926947072f * h0_53 - 0.019972926f * h0_54
+        - 0.122131124f * h0_55 + 0.0337048247f * h0_56 + 0.116152972f * h0_57 - 0.0283719711f * h0_58
+        + 0.406580895f * h0_59 - 0.453541309f * h0_60 + 0.153406739f * h0_61 + 0.105979562f * h0_62
+        - 0.114957973f * h0_63);
+    float h1_7 = max(0.0f, 0.0559202433f + 0.0962088779f * h0_0 - 0.238944143f * h0_1 - 0.000502454408f * h0_2
+        + 0.0574573688f * h0_3 + 0.278552949f * h0_4 - 0.0313519649f * h0_5 + 0.218698815f * h0_6
+        + 0.131680191f * h0_7 + 0.0374907739f * h0_8 - 0.258221418f * h0_9 - 0.286177099f * h0_10
+        - 0.13253656f * h0_11 - 0.234843448f * h0_12 + 0.00010882318f * h0_13 - 0.0527243428f * h0_14
+        + 0.134265572f * h0_15 - 0.0146234492f * h0_16 + 0.146853745f * h0_17 + 0.0247143377f * h0_18
+        + 0.169667572f * h0_19 + 0.144212231f * h0_20 + 0.0687696934f * h0_21 - 0.0468165465f * h0_22
+        + 0.156766102f * h0_23 - 0.0867879018f * h0_24 + 0.0733557194f * h0_25 + 0.287617326f * h0_26
+        + 0.054229673f * h0_27 - 0.479554296f * h0_28 - 0.030378921f * h0_29 + 0.227605522f * h0_30
+        + 0.0521147773f * h0_31 + 0.00154230557f * h0_32 - 0.063027218f * h0_33 - 0.0773069635f * h0_34
+        + 0.254537642f * h0_35 + 0.123183407f * h0_36 + 0.173016816f * h0_37 + 0.122461125f * h0_38
+        + 0.281962633f * h0_39 - 0.483014792f * h0_40 + 0.075036943f * h0_41 - 0.112224124f * h0_42
+        + 0.420810997f * h0_43 - 0.014038315f * h0_44 + 0.0452387668f * h0_45 - 0.0883640945f * h0_46
+        + 0.0578010753f * h0_47 - 0.121440426f * h0_48 + 0.133019656f * h0_49 - 0.0433396101f * h0_50
+        - 0.0755585879f * h0_51 - 0.275751203f * h0_52 + 0.0945757926f * h0_53 + 0.213856801f * h0_54
+        - 0.11636588f * h0_55 - 0.0325693861f * h0_56 - 0.0690848678f * h0_57 + 0.00230508228f * h0_58
+        - 0.211118892f * h0_59 + 0.0580514111f * h0_60 + 0.145297527f * h0_61 - 0.00830081943f * h0_62
+        - 0.22688216f * h0_63);
+    float h1_8 = max(0.0f, 0.095454067f - 0.0304091256f * h0_0 - 0.149809882f * h0_1 - 0.105022185f * h0_2
+        + 0.10263969f * h0_3 + 0.134053513f * h0_4 + 0.130425185f * h0_5 - 0.101955138f * h0_6
+        + 0.00572690135f * h0_7 - 0.0725259408f * h0_8 + 0.0109939203f * h0_9 - 0.0179105997f * h0_10
+        - 0.16033414f * h0_11 + 0.22588864f * h0_12 - 0.0405182689f * h0_13 - 0.150285929f * h0_14
+        + 0.086276345f * h0_15 - 0.142973512f * h0_16 + 0.123289503f * h0_17 + 0.11157079f * h0_18
+        + 0.152078435f * h0_19 + 0.163152903f * h0_20 - 0.0930336416f * h0_21 + 0.010169615f * h0_22
+        + 0.0303179603f * h0_23 + 0.0384670459f * h0_24 - 0.0932013541f * h0_25 - 0.0311919264f * h0_26
+        - 0.100978628f * h0_27 - 0.477067858f * h0_28 + 0.11156176f * h0_29 + 0.262018025f * h0_30
+        + 0.0686451495f * h0_31 - 0.0103304079f * h0_32 + 0.0333126821f * h0_33 - 0.0363248475f * h0_34
+        + 0.239348948f * h0_35 + 0.123283021f * h0_36 + 0.0399269275f * h0_37 - 0.108274192f * h0_38
+        + 0.0306007992f * h0_39 - 0.0094144661f * h0_40 + 0.20354405f * h0_41 + 0.140281588f * h0_42
+        + 0.435629815f * h0_43 + 0.0583841354f * h0_44 + 0.034814015f * h0_45 - 0.117342353f * h0_46
+        - 0.0304753687f * h0_47 - 0.0587495677f * h0_48 + 0.17919451f * h0_49 - 0.0261646062f * h0_50
+        - 0.081588462f * h0_51 - 0.0106792366f * h0_52 + 0.101296701f * h0_53 + 0.12201485f * h0_54
+        - 0.528717816f * h0_55 - 0.0801998451f * h0_56 - 0.0231993645f * h0_57 - 0.14062269f * h0_58
+        - 0.0329515785f * h0_59 + 0.0972915366f * h0_60 + 0.258198917f * h0_61 + 0.0717344508f * h0_62
+        - 0.321475744f * h0_63);
+    float h1_9 = max(0.0f, -0.175859064f + 0.174838439f * h0_0 + 0.173712507f * h0_1 - 0.232921064f * h0_2
+        - 0.0736790523f * h0_3 + 0.1153211f * h0_4 - 0.103838369f * h0_5 + 0.249838546f * h0_6
+        + 0.0807250515f * h0_7 + 0.115571313f * h0_8 + 0.00430759601f * h0_9 + 0.321459025f * h0_10
+        + 0.0460758768f * h0_11 - 0.0607753769f * h0_12 + 0.0337261409f * h0_13 + 0.101743281f * h0_14
+        + 0.0824961141f * h0_15 + 0.268326849f * h0_16 - 0.0783560351f * h0_17 - 0.0568530783f * h0_18
+        + 0.169585198f * h0_19 + 0.0444171131f * h0_20 + 0.120909899f * h0_21 - 0.242741734f * h0_22
+        + 0.101136707f * h0_23 - 0.0861858726f * h0_24 - 0.0214306116f * h0_25 + 0.120660834f * h0_26
+        + 0.0222037416f * h0_27 + 0.453507423f * h0_28 - 0.0875926316f * h0_29 - 0.0906017721f * h0_30
+        - 0.052530773f * h0_31 - 0.109528139f * h0_32 + 0.136262551f * h0_33 - 0.0478287861f * h0_34
+        + 0.0585754253f * h0_35 + 0.114259772f * h0_36 + 0.0953255668f * h0_37 + 0.00405659014f * h0_38
+        + 0.165460542f * h0_39 - 0.0852679834f * h0_40 - 0.104826257f * h0_41 - 0.253182948f * h0_42
+        - 0.231205449f * h0_43 + 0.0570739321f * h0_44 + 0.128952727f * h0_45 + 0.0672425777f * h0_46
+        - 0.00423173048f * h0_47 + 0.259159029f * h0_48 + 0.221755877f * h0_49 + 0.0935555249f * h0_50
+        - 0.100964934f * h0_51 - 0.0782195553f * h0_52 - 0.0419948995f * h0_53 + 0.201810852f * h0_54
+        + 0.414310008f * h0_55 + 0.192706615f * h0_56 + 0.0010740906f * h0_57 - 0.173334435f * h0_58
+        - 0.0735750571f * h0_59 - 0.198554844f * h0_60 - 0.000173501496f * h0_61 - 0.079973191f * h0_62
+        + 0.166782737f * h0_63);
+    float h1_10 = max(0.0f, 0.0553969815f + 0.0738759413f * h0_0 + 0.0243043397f * h0_1 - 0.0673688501f * h0_2
+        + 0.0344618075f * h0_3 - 0.108059414f * h0_4 + 0.175789014f * h0_5 - 0.160190329f * h0_6
+        + 0.139765695f * h0_7 + 0.0116629973f * h0_8 - 0.0548811033f * h0_9 + 0.000242557842f * h0_10
+        - 0.0208166502f * h0_11 + 0.0763367936f * h0_12 + 0.0142745525f * h0_13 + 0.0359144062f * h0_14
+        + 0.180086583f * h0_15 - 0.108376428f * h0_16 + 0.119504608f * h0_17 - 0.0194446146f * h0_18
+        + 0.119673379f * h0_19 - 0.0882344097f * h0_20 - 0.0377867222f * h0_21 - 0.0308148041f * h0_22
+        + 0.0324517861f * h0_23 + 0.0442637838f * h0_24 + 0.0244030207f * h0_25 - 0.180432156f * h0_26
+        - 0.41683197f * h0_27 - 0.265575588f * h0_28 + 0.0568751767f * h0_29 - 0.0709016249f * h0_30
+        - 0.123556651f * h0_31 + 0.0785860941f * h0_32 + 0.176785737f * h0_33 - 0.0151738701f * h0_34
+        - 0.0140728913f * h0_35 + 0.0749870762f * h0_36 + 0.0983830616f * h0_37 + 0.0794045031f * h0_38
+        + 0.237300202f * h0_39 + 0.419522494f * h0_40 + 0.145948783f * h0_41 + 0.149968311f * h0_42
+        + 0.248890013f * h0_43 + 0.117667347f * h0_44 + 0.0731614679f * h0_45 + 0.0906515568f * h0_46
+        - 0.0979114175f * h0_47 - 0.127588823f * h0_48 + 0.0572346263f * h0_49 + 0.0326513052f * h0_50
+        - 0.122362882f * h0_51 + 0.231306091f * h0_52 + 0.286242783f * h0_53 + 0.0437831245f * h0_54
+        - 0.00146771304f * h0_55 + 0.181767136f * h0_56 + 0.0497154742f * h0_57 - 0.0713610575f * h0_58
+        - 0.0445554182f * h0_59 + 0.331582457f * h0_60 + 0.206144825f * h0_61 - 0.0998632908f * h0_62
+        + 0.137904495f * h0_63);
+    float h1_11 = max(0.0f, 0.012270703f - 0.0635018498f * h0_0 + 0.0288524851f * h0_1 + 0.164292067f * h0_2
+        - 0.109169126f * h0_3 - 0.164144754f * h0_4 + 0.26204586f * h0_5 - 0.170863435f * h0_6
+        + 0.00028973131f * h0_7 - 0.0494647585f * h0_8 + 0.263724893f * h0_9 + 0.123629682f * h0_10
+        + 0.139220953f * h0_11 - 0.0864654854f * h0_12 + 0.107841f * h0_13 + 0.398602068f * h0_14
+        - 0.144585848f * h0_15 + 0.168020636f * h0_16 - 0.0583673194f * h0_17 + 0.0203811638f * h0_18
+        - 0.174975097f * h0_19 - 0.201820537f * h0_20 - 0.0693385601f * h0_21 + 0.219092026f * h0_22
+        - 0.0626653358f * h0_23 + 0.105952211f * h0_24 + 0.0191563517f * h0_25 - 0.298589051f * h0_26
+        - 0.208187699f * h0_27 + 0.135736272f * h0_28 - 0.038698364f * h0_29 + 0.00012310702f * h0_30
+        + 0.0380480811f * h0_31 + 0.0503990911f * h0_32 + 0.164905697f * h0_33 + 0.0170617551f * h0_34
+        - 0.208818331f * h0_35 + 0.165154368f * h0_36 + 0.211340725f * h0_37 + 0.123057693f * h0_38
+        + 0.00959591288f * h0_39 + 0.402062774f * h0_40 + 0.0809811801f * h0_41 - 0.000199635208f * h0_42
+        - 0.133074716f * h0_43 + 0.324616045f * h0_44 + 0.120545961f * h0_45 - 0.0954515189f * h0_46
+        - 0.276082128f * h0_47 - 0.0863673985f * h0_48 - 0.119641192f * h0_49 + 0.124550343f * h0_50
+        - 0.0622162074f * h0_51 + 0.103449576f * h0_52 + 0.334349692f * h0_53 + 0.199522704f * h0_54
+        + 0.280847102f * h0_55 + 0.15879865f * h0_56 - 0.00208112597f * h0_57 + 0.247737095f * h0_58
+        + 0.0461534448f * h0_59 + 0.1203302f * h0_60 - 0.00403511059f * h0_61 - 0.149029151f * h0_62
+        + 0.118045695f * h0_63);
+    float h1_12 = max(0.0f, -0.0116305249f + 0.0755342096f * h0_0 - 0.0841817185f * h0_1 + 0.0586344376f * h0_2
+        + 0.0164805446f * h0_3 + 0.0155563299f * h0_4 + 0.165199175f * h0_5 + 0.121006556f * h0_6
+        + 0.218009815f * h0_7 + 0.150821581f * h0_8 - 0.22507897f * h0_9 - 0.0908008143f * h0_10
+        - 0.0442189462f * h0_11 - 0.038003426f * h0_12 - 0.00753502548f * h0_13 + 0.186336547f * h0_14
+        + 0.23402749f * h0_15 + 0.061825525f * h0_16 - 0.112427056f * h0_17 - 0.0347847641f * h0_18
+        - 0.0544837862f * h0_19 + 0.0110642379f * h0_20 + 0.116699815f * h0_21 + 0.144941255f * h0_22
+        + 0.102008827f * h0_23 + 0.151432559f * h0_24 + 0.00718154013f * h0_25 + 0.0183741003f * h0_26
+        - 0.222386807f * h0_27 - 0.200764239f * h0_28 + 0.0273436308f * h0_29 + 0.0464361645f * h0_30
+        - 0.0389970653f * h0_31 - 0.0903953239f * h0_32 + 0.157591954f * h0_33 - 0.00166606542f * h0_34
+        - 0.00847109593f * h0_35 + 0.0356986709f * h0_36 - 0.037824098f * h0_37 - 0.0432295501f * h0_38
+        - 0.0190571006f * h0_39 - 0.195858136f * h0_40 + 0.107433133f * h0_41 + 0.0503871366f * h0_42
+        - 0.0174030326f * h0_43 + 0.087927945f * h0_44 + 0.178054914f * h0_45 + 0.0601825416f * h0_46
+        + 0.114792228f * h0_47 + 0.0482915863f * h0_48 + 0.00411282945f * h0_49 - 0.0583304912f * h0_50
+        - 0.0963112563f * h0_51 + 0.0261318814f * h0_52 + 0.0613803118f * h0_53 + 0.107362583f * h0_54
+        + 0.308079809f * h0_55 + 0.0763574094f * h0_56 - 0.0714424849f * h0_57 + 0.175874725f * h0_58
+        - 0.203032002f * h0_59 + 0.252785921f * h0_60 - 0.200954482f * h0_61 - 0.207396448f * h0_62
+        + 0.0312017892f * h0_63);
+    float h1_13 = max(0.0f, 0.0552910529f + 0.0998436958f * h0_0 - 0.0137374084f * h0_1 - 0.108223684f * h0_2
+        - 0.0840706378f * h0_3 + 0.084893249f * h0_4 - 0.0381106138f * h0_5 + 0.200105011f * h0_6
+        + 0.290964991f * h0_7 + 0.302253515f * h0_8 - 0.0491623692f * h0_9 - 0.00389924366f * h0_10
+        - 0.00641401811f * h0_11 - 0.0113193635f * h0_12 - 0.0615680814f * h0_13 + 0.0687268004f * h0_14
+        + 0.12414591f * h0_15 - 0.0284853186f * h0_16 + 0.011358818f * h0_17 + 0.00202626735f * h0_18
+        + 0.0635770783f * h0_19 + 0.172509253f * h0_20 - 0.0320927948f * h0_21 - 0.263944954f * h0_22
+        + 0.0834711939f * h0_23 + 0.178073093f * h0_24 + 0.0816217214f * h0_25 + 0.287404388f * h0_26
+        - 0.240501493f * h0_27 - 0.0737372637f * h0_28 + 0.102872804f * h0_29 - 0.0359956212f * h0_30
+        - 0.0284864195f * h0_31 + 0.0182752088f * h0_32 + 0.128671974f * h0_33 - 0.102990463f * h0_34
+        + 0.18071346f * h0_35 + 0.0533853993f * h0_36 - 0.0508434288f * h0_37 + 0.119592831f * h0_38
+        - 0.0103164883f * h0_39 - 0.257322073f * h0_40 + 0.111931972f * h0_41 - 0.0962040052f * h0_42
+        - 0.231312633f * h0_43 + 0.122405991f * h0_44 + 0.203653768f * h0_45 - 0.0024472177f * h0_46
+        + 0.00799212977f * h0_47 + 0.18344599f * h0_48 + 0.349297673f * h0_49 - 0.0805355608f * h0_50
+        + 0.0519172698f * h0_51 + 0.191755846f * h0_52 - 0.0298733804f * h0_53 - 0.0466567837f * h0_54
+        + 0.279504836f * h0_55 + 0.220597118f * h0_56 + 0.0241033286f * h0_57 + 0.0127588892f * h0_58
+        - 0.107764632f * h0_59 - 0.150141761f * h0_60 - 0.0749308541f * h0_61 + 0.224924669f * h0_62
+        + 0.0993237421f * h0_63);
+    float h1_14 = max(0.0f, -0.0305849034f + 0.110383503f * h0_0 - 0.0343845896f * h0_1 - 0.0400551781f * h0_2
+        - 0.114532962f * h0_3 - 0.0574586727f * h0_4 - 0.118497431f * h0_5 - 0.107919067f * h0_6
+        - 0.0221721996f * h0_7 + 0.026045654f * h0_8 - 0.0274890419f * h0_9 - 0.0140928375f * h0_10
+        + 0.0362195149f * h0_11 + 0.0599720143f * h0_12 + 0.0149550438f * h0_13 - 0.0660541505f * h0_14
+        + 0.103287548f * h0_15 + 0.0837191492f * h0_16 - 0.00551451789f * h0_17 - 0.0397577435f * h0_18
+        - 0.0342113636f * h0_19 + 0.103435442f * h0_20 + 0.0741262287f * h0_21 - 0.0321183763f * h0_22
+        + 0.0875212476f * h0_23 - 0.11569716f * h0_24 + 0.00570116937f * h0_25 - 0.101695076f * h0_26
+        - 0.0437840745f * h0_27 - 0.0470938608f * h0_28 - 0.00313704764f * h0_29 + 0.0608255565f * h0_30
+        + 0.03531982f * h0_31 - 0.0883711725f * h0_32 - 0.100560337f * h0_33 + 0.10302563f * h0_34
+        - 0.0157476738f * h0_35 + 0.114111364f * h0_36 - 0.0674783587f * h0_37 - 0.101781711f * h0_38
+        - 0.0738603324f * h0_39 + 0.105227306f * h0_40 - 0.0798162073f * h0_41 - 0.0980010927f * h0_42
+        + 0.054339014f * h0_43 + 0.0933757126f * h0_44 + 0.0580417998f * h0_45 - 9.58442688e-05f * h0_46
+        - 0.00530734891f * h0_47 + 0.0392305851f * h0_48 + 0.045915246f * h0_49 - 0.0756524801f * h0_50
+        - 0.0852233022f * h0_51 + 0.095176138f * h0_52 - 0.0264706332f * h0_53 - 0.0416669734f * h0_54
+        + 0.091490984f * h0_55 - 0.124103263f * h0_56 + 0.0258525461f * h0_57 - 0.00923243258f * h0_58
+        + 0.0978667364f * h0_59 - 0.0457810909f * h0_60 - 0.107285798f * h0_61 + 0.00567430863f * h0_62
+        - 0.0436148308f * h0_63);
+    float h1_15 = max(0.0f, 0.130023628f + 0.0131381126f * h0_0 + 0.0868761018f * h0_1 + 0.0804121345f * h0_2
+        + 0.112534136f * h0_3 + 0.197198153f * h0_4 - 0.0109535726f * h0_5 + 0.0426351354f * h0_6
+        + 0.145731002f * h0_7 + 0.103450984f * h0_8 + 0.0453713648f * h0_9 - 0.146781772f * h0_10
+        - 0.0856353119f * h0_11 + 0.128518492f * h0_12 + 0.0795695782f * h0_13 - 0.0836715102f * h0_14
+        - 0.0930760875f * h0_15 - 0.355790287f * h0_16 + 0.113302261f * h0_17 + 0.105288595f * h0_18
+        + 0.0176649243f * h0_19 + 0.229513839f * h0_20 - 0.122220293f * h0_21 + 0.297809899f * h0_22
+        - 0.0712656975f * h0_23 + 0.232643634f * h0_24 - 0.110773996f * h0_25 + 0.136021465f * h0_26
+        + 0.0405489877f * h0_27 - 0.2142452f * h0_28 + 0.207136735f * h0_29 - 0.0405350402f * h0_30
+        + 0.0378231481f * h0_31 - 0.0180553328f * h0_32 - 0.144707024f * h0_33 + 0.100023471f * h0_34
+        - 0.0411134884f * h0_35 - 0.123631507f * h0_36 - 0.0359451286f * h0_37 + 0.0847277716f * h0_38
+        - 0.108442128f * h0_39 - 0.136407956f * h0_40 + 0.0496399663f * h0_41 + 0.269435853f * h0_42
+        + 0.230254278f * h0_43 + 0.028200347f * h0_44 - 0.0824032277f * h0_45 - 0.0206072181f * h0_46
+        + 0.163334787f * h0_47 - 0.0616201758f * h0_48 + 0.00858291145f * h0_49 + 0.110820264f * h0_50
+        + 0.0426466167f * h0_51 + 0.157655135f * h0_52 - 0.117359057f * h0_53 - 0.0755625665f * h0_54
+        - 0.359224439f * h0_55 - 0.0554560311f * h0_56 - 0.0803978145f * h0_57 + 0.190159917f * h0_58
+        + 0.307731241f * h0_59 - 0.184811115f * h0_60 + 0.0882984698f * h0_61 + 0.189083189f * h0_62
+        - 0.238749385f * h0_63);
+    float h1_16 = max(0.0f, 0.0414492115f - 0.139096618f * h0_0 - 0.467850357f * h0_1 + 0.213372633f * h0_2
+        - 0.0772246793f * h0_3 - 0.108509593f * h0_4 + 0.201018393f * h0_5 - 0.245002404f * h0_6
+        - 0.124198176f * h0_7 + 0.123088829f * h0_8 + 0.25693807f * h0_9 - 0.0363704897f * h0_10
+        + 0.156651676f * h0_11 + 0.358296603f * h0_12 + 0.00507748127f * h0_13 - 0.099467501f * h0_14
+        + 0.105691269f * h0_15 - 0.445039332f * h0_16 + 0.0586229004f * h0_17 + 0.152142912f * h0_18
+        - 0.17377311f * h0_19 - 0.00152882608f * h0_20 - 0.0976351947f * h0_21 + 0.444784045f * h0_22
+        - 0.026863955f * h0_23 + 0.274982572f * h0_24 + 0.0182867646f * h0_25 - 0.194600478f * h0_26
+        - 0.257848233f * h0_27 - 0.178486809f * h0_28 + 0.156312108f * h0_29 - 0.22796075f * h0_30
+        - 0.0215464104f * h0_31 + 0.0878803581f * h0_32 + 0.0569103695f * h0_33 + 0.106996939f * h0_34
+        - 0.292497337f * h0_35 - 0.0826200023f * h0_36 - 0.308661997f * h0_37 + 0.0313558877f * h0_38
+        - 0.510968149f * h0_39 + 0.0586450882f * h0_40 - 0.0422284938f * h0_41 + 0.392762214f * h0_42
+        - 0.453622937f * h0_43 + 0.143868357f * h0_44 + 0.0074158092f * h0_45 + 0.0732395947f * h0_46
+        - 0.0755719244f * h0_47 + 0.137396634f * h0_48 - 0.131306753f * h0_49 + 0.113174632f * h0_50
+        - 0.0291516185f * h0_51 + 0.188148811f * h0_52 - 0.142521858f * h0_53 - 0.252081215f * h0_54
+        - 0.228305206f * h0_55 + 0.049721323f * h0_56 + 0.0729153156f * h0_57 + 0.0706285611f * h0_58
+        + 0.334181488f * h0_59 + 0.0300594419f * h0_60 - 0.164435863f * h0_61 + 0.169865608f * h0_62
+        + 0.00846980978f * h0_63);
+    float h1_17 = max(0.0f, 0.0654420704f - 0.0735648647f * h0_0 + 0.186463237f * h0_1 + 0.20843944f * h0_2
+        - 0.0134206768f * h0_3 + 0.0945969895f * h0_4 - 0.0566028878f * h0_5 + 0.0386214331f * h0_6
+        + 0.0016124954f * h0_7 + 0.341142297f * h0_8 - 0.0519606024f * h0_9 - 0.253701061f * h0_10
+        + 0.139004782f * h0_11 + 0.270473391f * h0_12 - 0.120283008f * h0_13 - 0.0233988799f * h0_14
+        + 0.0306326766f * h0_15 - 0.144699544f * h0_16 - 0.0137949148f * h0_17 + 0.131493121f * h0_18
+        - 0.0742254704f * h0_19 + 0.128262997f * h0_20 - 0.0558109134f * h0_21 + 0.109182864f * h0_22
+        + 0.168120369f * h0_23 + 0.0565496124f * h0_24 - 0.00368155539f * h0_25 + 0.126685753f * h0_26
+        - 0.294190168f * h0_27 - 0.23991178f * h0_28 + 0.146755397f * h0_29 + 0.00499028387f * h0_30
+        - 0.112510696f * h0_31 + 0.0394336134f * h0_32 - 0.016548574f * h0_33 + 0.0385383964f * h0_34
+        + 0.211296797f * h0_35 - 0.142140284f * h0_36 - 0.320386946f * h0_37 + 0.0180775858f * h0_38
+        - 0.119292423f * h0_39 - 0.327585757f * h0_40 + 0.133506641f * h0_41 + 0.181245357f * h0_42
+        - 0.193312928f * h0_43 + 0.0974261686f * h0_44 + 0.121137559f * h0_45 + 0.0364693701f * h0_46
+        + 0.19984436f * h0_47 + 0.116742976f * h0_48 + 0.193221465f * h0_49 - 0.0950963944f * h0_50
+        + 0.104556754f * h0_51 + 0.104376622f * h0_52 + 0.0314072743f * h0_53 - 0.0962371677f * h0_54
+        - 0.0883270204f * h0_55 + 0.0320698097f * h0_56 + 0.0789857656f * h0_57 + 0.143581167f * h0_58
+        + 0.0152356792f * h0_59 - 0.165545449f * h0_60 - 0.105775118f * h0_61 + 0.164840594f * h0_62
+        + 0.147437856f * h0_63);
+    float h1_18 = max(0.0f, 0.141329482f + 0.105882421f * h0_0 - 0.0213549845f * h0_1 + 0.309072077f * h0_2
+        - 0.0857999548f * h0_3 + 0.090364553f * h0_4 - 0.00509185065f * h0_5 - 0.00427688379f * h0_6
+        + 0.0413726568f * h0_7 - 0.0857181102f * h0_8 - 0.137120441f * h0_9 - 0.000506370678f * h0_10
+        - 0.0374895819f * h0_11 - 0.0939812437f * h0_12 - 0.093086496f * h0_13 + 0.0209333263f * h0_14
+        + 0.115400337f * h0_15 - 0.179375201f * h0_16 + 0.176122844f * h0_17 + 0.107940018f * h0_18
+        + 0.076471962f * h0_19 + 0.120621003f * h0_20 + 0.0465432107f * h0_21 + 0.244206354f * h0_22
+        + 0.095711045f * h0_23 - 0.191452697f * h0_24 + 0.100953445f * h0_25 + 0.1019051f * h0_26
+        + 0.310785115f * h0_27 - 0.0394979604f * h0_28 + 0.136882842f * h0_29 + 0.0485160723f * h0_30
+        + 0.0475575291f * h0_31 - 0.00997757073f * h0_32 + 0.0257230233f * h0_33 + 0.102851301f * h0_34
+        - 0.188716143f * h0_35 - 0.0360198133f * h0_36 + 0.0345687419f * h0_37 - 0.120191567f * h0_38
+        - 0.0470392294f * h0_39 - 0.248809233f * h0_40 + 0.0728818849f * h0_41 + 0.00798316393f * h0_42
+        - 0.0475174785f * h0_43 - 0.0198262352f * h0_44 + 0.0482521392f * h0_45 - 0.0250177383f * h0_46
+        + 0.140531033f * h0_47 + 0.00753227714f * h0_48 - 0.254747182f * h0_49 + 0.00797829032f * h0_50
+        + 0.0798114985f * h0_51 - 0.136356995f * h0_52 - 0.121030681f * h0_53 + 0.124357402f * h0_54
+        - 0.249630317f * h0_55 - 0.157195136f * h0_56 + 0.0800391138f * h0_57 + 0.168565422f * h0_58
+        - 0.00169341185f * h0_59 + 0.0846723393f * h0_60 - 0.190924495f * h0_61 - 0.13802278f * h0_62
+        - 0.260469407f * h0_63);
+    float h1_19 = max(0.0f, -0.00523144379f - 0.134871542f * h0_0 + 0.0233665667f * h0_1 + 0.0163803659f * h0_2
+        - 0.00656306604f * h0_3 + 0.0584382638f * h0_4 + 0.170148954f * h0_5 + 0.115567788f * h0_6
+        + 0.247535452f * h0_7 - 0.0298336223f * h0_8 + 0.331277877f * h0_9 + 0.350073874f * h0_10
+        - 0.280010104f * h0_11 - 0.0899589658f * h0_12 - 0.100753918f * h0_13 + 0.479001135f * h0_14
+        - 0.263377398f * h0_15 + 0.0539291203f * h0_16 + 0.154709607f * h0_17 - 0.0870660841f * h0_18
+        - 0.0347233601f * h0_19 + 0.206282347f * h0_20 + 0.0592959523f * h0_21 + 0.294425637f * h0_22
+        - 0.0502572022f * h0_23 - 0.0732001886f * h0_24 - 0.000655338168f * h0_25 - 0.0378314778f * h0_26
+        + 0.153206736f * h0_27 + 0.0450980738f * h0_28 + 0.0307648238f * h0_29 + 0.102901414f * h0_30
+        + 0.0228157435f * h0_31 + 0.108624466f * h0_32 - 0.0929200128f * h0_33 + 0.0798323303f * h0_34
+        - 0.218952671f * h0_35 - 0.120424189f * h0_36 + 0.190465569f * h0_37 - 0.0721797347f * h0_38
+        - 0.138537183f * h0_39 - 0.289176941f * h0_40 + 0.109435536f * h0_41 + 0.167781472f * h0_42
+        + 0.0400584489f * h0_43 + 0.12934579f * h0_44 + 0.0966086611f * h0_45 - 0.102829129f * h0_46
+        - 0.199111685f * h0_47 - 0.260805637f * h0_48 + 0.0258043446f * h0_49 + 0.0985012501f * h0_50
+        + 0.102804348f * h0_51 - 0.215937719f * h0_52 - 0.150520265f * h0_53 + 0.193365321f * h0_54
+        + 0.311044991f * h0_55 + 0.115594573f * h0_56 + 0.0693361908f * h0_57 + 0.218294799f * h0_58
+        + 0.182263002f * h0_59 - 0.0245595239f * h0_60 - 0.265094072f * h0_61 + 0.0342237428f * h0_62
+        - 0.313426763f * h0_63);
+    float h1_20 = max(0.0f, 0.0493119173f + 0.202151671f * h0_0 - 0.399395078f * h0_1 - 0.107916504f * h0_2
+        - 0.12391904f * h0_3 - 0.464987576f * h0_4 - 0.178418502f * h0_5 - 0.164376304f * h0_6
+        - 0.765490115f * h0_7 + 0.0871243477f * h0_8 - 0.347407311f * h0_9 - 0.22907868f * h0_10
+        + 0.554480553f * h0_11 + 0.277458638f * h0_12 - 0.0250182301f * h0_13 - 0.37357226f * h0_14
+        - 0.0538925305f * h0_15 + 0.237878636f * h0_16 - 0.0642047301f * h0_17 + 0.0757086128f * h0_18
+        + 0.0854509175f * h0_19 - 0.587570012f * h0_20 + 0.097326681f * h0_21 - 0.0205099098f * h0_22
+        + 0.0442381836f * h0_23 - 0.0141698755f * h0_24 + 0.0854128748f * h0_25 - 1.00967228f * h0_26
+        - 0.266505808f * h0_27 + 0.303977579f * h0_28 - 0.0566712841f * h0_29 - 0.166545972f * h0_30
+        + 0.106736518f * h0_31 + 0.0237577222f * h0_32 + 0.381523073f * h0_33 + 0.0746919811f * h0_34
+        - 0.117979981f * h0_35 + 0.366442055f * h0_36 - 0.210994303f * h0_37 + 0.00440358883f * h0_38
+        + 0.180076033f * h0_39 + 0.583378613f * h0_40 - 0.0662723109f * h0_41 - 0.022834558f * h0_42
+        - 0.162702709f * h0_43 - 0.0875452235f * h0_44 - 0.221894369f * h0_45 - 0.1101311f * h0_46
+        + 0.249845877f * h0_47 + 0.535035372f * h0_48 - 0.0892322809f * h0_49 + 0.096947521f * h0_50
+        - 0.0106700957f * h0_51 + 0.508881867f * h0_52 + 0.548042715f * h0_53 - 0.0944043025f * h0_54
+        + 0.169800639f * h0_55 + 0.110619895f * h0_56 - 0.0872583538f * h0_57 - 0.141267985f * h0_58
+        - 0.185093805f * h0_59 + 0.0395156331f * h0_60 + 0.541921079f * h0_61 - 0.374890029f * h0_62
+        + 0.426102817f * h0_63);
+    float h1_21 = max(0.0f, -0.0343808793f - 0.152251661f * h0_0 + 0.0159940105f * h0_1 + 0.240885422f * h0_2
+        - 0.0354407728f * h0_3 + 0.108058318f * h0_4 - 0.0819465593f * h0_5 + 0.00351522886f * h0_6
+        + 0.292880863f * h0_7 + 0.0374289639f * h0_8 + 0.242248401f * h0_9 + 0.234878302f * h0_10
+        - 0.181369707f * h0_11 - 0.186303511f * h0_12 + 0.094800055f * h0_13 + 0.511212111f * h0_14
+        - 0.00417788606f * h0_15 + 0.000237964385f * h0_16 - 0.0487956256f * h0_17 + 0.02538912f * h0_18
+        - 0.0347105376f * h0_19 + 0.16417335f * h0_20 + 0.12350674f * h0_21 + 0.302847832f * h0_22
+        + 0.0361361131f * h0_23 + 0.0691297501f * h0_24 + 0.115375102f * h0_25 + 0.0237938594f * h0_26
+        - 0.0474272557f * h0_27 + 0.177516192f * h0_28 + 0.0534577295f * h0_29 - 0.0664542541f * h0_30
+        - 0.101658948f * h0_31 - 0.0824298263f * h0_32 - 0.0755877793f * h0_33 - 0.0833229721f * h0_34
+        - 0.122583091f * h0_35 - 0.0264299177f * h0_36 + 0.0526999421f * h0_37 - 0.113824733f * h0_38
+        + 0.0438830517f * h0_39 - 0.259829581f * h0_40 + 0.0606177449f * h0_41 + 0.158048391f * h0_42
+        - 0.133842036f * h0_43 + 0.129311442f * h0_44 + 0.00192916067f * h0_45 + 0.0305635631f * h0_46
+        - 0.157276601f * h0_47 + 0.0587602071f * h0_48 - 0.0319608152f * h0_49 + 0.0862963498f * h0_50
+        - 0.0402945131f * h0_51 - 0.162689507f * h0_52 - 0.163671806f * h0_53 + 0.055264242f * h0_54
+        + 0.28495869f * h0_55 + 0.0677301064f * h0_56 + 0.0194305778f * h0_57 + 0.306880474f * h0_58
+        + 0.13354747f * h0_59 - 0.169019535f * h0_60 - 0.401020527f * h0_61 + 0.114057928f * h0_62
+        - 0.00561482972f * h0_63);
+    float h1_22 = max(0.0f, -0.0632249117f + 0.201410219f * h0_0 + 0.14395842f * h0_1 + 0.0552026853f * h0_2
+        + 0.037527889f * h0_3 + 0.0883770809f * h0_4 - 0.167588145f * h0_5 + 0.25301525f * h0_6
+        + 0.0459298566f * h0_7 - 0.041154854f * h0_8 + 0.0274527706f * h0_9 + 0.103658721f * h0_10
+        - 0.00429267529f * h0_11 - 0.291816115f * h0_12 - 0.0414535403f * h0_13 - 0.302987695f * h0_14
+        + 0.0864043534f * h0_15 - 0.0853699371f * h0_16 + 0.0646628812f * h0_17 - 0.0894717798f * h0_18
+        + 0.024138473f * h0_19 - 0.106446087f * h0_20 - 0.0939939767f * h0_21 - 0.0898152366f * h0_22
+        - 0.0209535602f * h0_23 - 0.125093386f * h0_24 - 0.0544614643f * h0_25 + 0.233215466f * h0_26
+        + 0.355690658f * h0_27 + 0.0491207168f * h0_28 - 0.0906798169f * h0_29 + 0.146599159f * h0_30
+        + 0.0633820146f * h0_31 - 0.0642177463f * h0_32 - 0.0724067166f * h0_33 + 0.105217233f * h0_34
+        - 0.003694474f * h0_35 + 0.0625185445f * h0_36 + 0.177242309f * h0_37 - 0.120666906f * h0_38
+        + 0.183799222f * h0_39 + 0.0210803896f * h0_40 - 0.0432136841f * h0_41 - 0.269394219f * h0_42
+        + 0.0984829441f * h0_43 - 0.202800483f * h0_44 - 0.126066357f * h0_45 + 0.0307580084f * h0_46
+        + 0.0534122251f * h0_47 + 0.0823807493f * h0_48 - 0.029282527f * h0_49 + 0.046525687f * h0_50
+        + 0.0435684919f * h0_51 - 0.0213931929f * h0_52 + 0.0889507607f * h0_53 + 0.0468161926f * h0_54
+        - 0.0695190951f * h0_55 - 0.175310552f * h0_56 + 0.0887531638f * h0_57 + 0.00495466916f * h0_58
+        - 0.257627428f * h0_59 + 0.0895089656f * h0_60 + 0.152360544f * h0_61 - 0.0405349247f * h0_62
+        + 0.0249938425f * h0_63);
+    float h1_23 = max(0.0f, 0.0786185935f - 0.0262981784f * h0_0 + 0.184823796f * h0_1 + 0.147036135f * h0_2
+        + 0.00640769396f * h0_3 - 0.104992069f * h0_4 + 0.163279548f * h0_5 + 0.00355989323f * h0_6
+        - 0.205291733f * h0_7 - 0.118032262f * h0_8 - 0.0958079696f * h0_9 + 0.144872636f * h0_10
+        + 0.183160663f * h0_11 + 0.0973245651f * h0_12 + 0.043062821f * h0_13 - 0.124631919f * h0_14
+        + 0.215322316f * h0_15 - 0.0889617354f * h0_16 + 0.138721287f * h0_17 - 0.0126737272f * h0_18
+        - 0.0596000068f * h0_19 - 0.19638145f * h0_20 + 0.105898038f * h0_21 + 0.3025451f * h0_22
+        - 0.00630151248f * h0_23 - 0.0488889851f * h0_24 - 0.0200281292f * h0_25 - 0.121580839f * h0_26
+        + 0.223234579f * h0_27 + 0.194685146f * h0_28 + 0.145508572f * h0_29 + 0.0598439425f * h0_30
+        + 0.0254978687f * h0_31 - 0.0649506524f * h0_32 + 0.0909139737f * h0_33 + 0.0628043264f * h0_34
+        - 0.401139557f * h0_35 + 0.130809382f * h0_36 + 0.152454272f * h0_37 - 0.0198939592f * h0_38
+        - 0.0594941117f * h0_39 + 0.229087114f * h0_40 - 0.148579314f * h0_41 - 0.062437173f * h0_42
+        - 0.0528423674f * h0_43 + 0.037941426f * h0_44 + 0.036392998f * h0_45 - 0.104066193f * h0_46
+        + 0.0216029733f * h0_47 + 0.154075429f * h0_48 - 0.135557175f * h0_49 - 0.0290393233f * h0_50
+        + 0.00739733875f * h0_51 + 0.0690570921f * h0_52 + 0.283385664f * h0_53 + 0.138944104f * h0_54
+        + 0.0295983944f * h0_55 - 0.184185222f * h0_56 + 0.0849812627f * h0_57 + 0.0929353014f * h0_58
+        + 0.137433067f * h0_59 + 0.253805548f * h0_60 + 0.0581564754f * h0_61 - 0.249498412f * h0_62
+        + 0.140278772f * h0_63);
+    float h1_24 = max(0.0f, -0.0379221626f - 0.0577322021f * h0_0 + 0.00985588599f * h0_1 + 0.0900154561f * h0_2
+        - 0.117332198f * h0_3 - 0.0627234876f * h0_4 - 0.0171594005f * h0_5 - 0.0159595441f * h0_6
+        + 0.180363044f * h0_7 + 0.235411242f * h0_8 - 0.00907839928f * h0_9 - 0.253547996f * h0_10
+        + 0.266564757f * h0_11 + 0.32367608f * h0_12 + 0.108771622f * h0_13 + 0.000148769046f * h0_14
+        - 0.00397295412f * h0_15 + 0.0353535078f * h0_16 - 0.0112571521f * h0_17 + 0.0532662086f * h0_18
+        + 0.0208900608f * h0_19 + 0.0709866807f * h0_20 + 0.123131722f * h0_21 + 0.188359797f * h0_22
+        + 0.00707671791f * h0_23 + 0.230811402f * h0_24 - 0.116227463f * h0_25 + 0.148471892f * h0_26
+        - 0.294285625f * h0_27 - 0.0231683534f * h0_28 + 0.086178869f * h0_29 - 0.0422096141f * h0_30
+        + 0.00128878758f * h0_31 - 0.0947254002f * h0_32 + 0.110016748f * h0_33 - 0.0261552222f * h0_34
+        + 0.177253902f * h0_35 - 0.0863169357f * h0_36 - 0.135091215f * h0_37 - 0.112970889f * h0_38
+        - 0.16384539f * h0_39 - 0.108747788f * h0_40 + 0.0404861905f * h0_41 - 0.00646092976f * h0_42
+        - 0.305285543f * h0_43 + 0.14828141f * h0_44 + 0.147223935f * h0_45 + 0.02106902f * h0_46
+        + 0.113312498f * h0_47 + 0.171550184f * h0_48 - 0.0237675868f * h0_49 - 0.0761187524f * h0_50
+        + 0.0236632377f * h0_51 + 0.252990186f * h0_52 - 0.0458470918f * h0_53 - 0.0489141643f * h0_54
+        + 0.0839985758f * h0_55 + 0.153249413f * h0_56 + 0.0922226608f * h0_57 + 0.0230743904f * h0_58
+        - 0.0275098998f * h0_59 - 0.0249843467f * h0_60 - 0.132279918f * h0_61 - 0.0479884967f * h0_62
+        + 0.106866069f * h0_63);
+    float h1_25 = max(0.0f, 0.0326793492f + 0.00602091849f * h0_0 - 0.068916291f * h0_1 - 0.0796459466f * h0_2
+        + 0.0390576869f * h0_3 - 0.122159287f * h0_4 - 0.0909730047f * h0_5 - 0.0530446768f * h0_6
+        - 0.0265575647f * h0_7 - 0.0353245288f * h0_8 + 0.108707964f * h0_9 + 0.0998604596f * h0_10
+        - 0.10189265f * h0_11 + 0.0323128104f * h0_12 - 0.0812075585f * h0_13 - 0.0121050626f * h0_14
+        + 0.0233040154f * h0_15 + 0.0503768921f * h0_16 - 0.0969414264f * h0_17 - 0.0936348885f * h0_18
+        - 0.0475403965f * h0_19 + 0.0209132582f * h0_20 + 0.123321295f * h0_21 + 0.110334396f * h0_22
+        - 0.0139282644f * h0_23 + 0.0681113452f * h0_24 + 0.0246780217f * h0_25 + 0.0524238199f * h0_26
+        - 0.0530949533f * h0_27 + 0.0892099291f * h0_28 - 0.0402888209f * h0_29 + 0.100915566f * h0_30
+        + 0.082343176f * h0_31 + 0.0929717273f * h0_32 - 0.00758393109f * h0_33 + 0.020574674f * h0_34
+        + 0.0621486455f * h0_35 - 0.0189289451f * h0_36 + 0.0393013805f * h0_37 - 0.020549193f * h0_38
+        - 0.0631462187f * h0_39 + 0.0235054493f * h0_40 - 0.0707728416f * h0_41 - 0.110484526f * h0_42
+        + 0.0787764192f * h0_43 - 0.10960333f * h0_44 - 0.0160279721f * h0_45 + 0.117648765f * h0_46
+        + 0.110682353f * h0_47 - 0.0894960612f * h0_48 - 0.0326556116f * h0_49 - 0.0927706212f * h0_50
+        + 0.106577992f * h0_51 - 0.00899642706f * h0_52 - 0.0619890839f * h0_53 - 0.0414068997f * h0_54
+        - 0.0728507489f * h0_55 - 0.104700625f * h0_56 - 0.0363604128f * h0_57 - 0.123696879f * h0_58
+        + 0.0970577151f * h0_59 - 0.0832670182f * h0_60 - 0.124540493f * h0_61 - 0.0612378418f * h0_62
+        + 0.0635725558f * h0_63);
+    float h1_26 = max(0.0f, 0.0195414126f - 0.0841189325f * h0_0 + 0.054708153f * h0_1 - 0.0520635843f * h0_2
+        - 0.00308696926f * h0_3 - 0.0782795846f * h0_4 - 0.122023851f * h0_5 - 0.0976114571f * h0_6
+        - 0.0990708917f * h0_7 - 0.112382799f * h0_8 + 0.0635985434f * h0_9 - 0.0367776006f * h0_10
+        - 0.11865592f * h0_11 + 0.0638381541f * h0_12 - 0.100519672f * h0_13 - 0.0663476288f * h0_14
+        + 0.0272038579f * h0_15 + 0.0707768649f * h0_16 + 0.0662374496f * h0_17 - 0.0473791212f * h0_18
+        - 0.0646112114f * h0_19 - 0.0149316043f * h0_20 + 0.0460602045f * h0_21 + 0.000920847058f * h0_22
+        + 0.0955166817f * h0_23 - 0.0482539237f * h0_24 + 0.0455612242f * h0_25 - 0.0366621017f * h0_26
+        - 0.109241977f * h0_27 - 0.113303661f * h0_28 - 0.102747113f * h0_29 - 0.0857390314f * h0_30
+        - 0.0360403508f * h0_31 - 0.00985969603f * h0_32 - 0.00555843115f * h0_33 - 0.0725312233f * h0_34
+        - 0.00953072309f * h0_35 - 0.111061022f * h0_36 - 0.0612706244f * h0_37 + 0.0705294907f * h0_38
+        - 0.0319427401f * h0_39 - 0.0375403166f * h0_40 + 0.0694066137f * h0_41 - 0.0638211519f * h0_42
+        - 0.113934174f * h0_43 - 0.0203184634f * h0_44 + 0.0157812834f * h0_45 - 0.0869733095f * h0_46
+        - 0.0123040676f * h0_47 - 0.0801119357f * h0_48 - 0.0280570537f * h0_49 + 0.0548735857f * h0_50
+        + 0.0321946591f * h0_51 + 0.0156951547f * h0_52 + 0.0507191271f * h0_53 + 0.118761122f * h0_54
+        + 0.062903896f * h0_55 - 0.0635839105f * h0_56 - 0.0804307908f * h0_57 + 0.105278492f * h0_58
+        + 0.0236502737f * h0_59 + 0.118584618f * h0_60 - 0.00818353891f * h0_61 - 0.0380759686f * h0_62
+        - 0.0887944996f * h0_63);
+    float h1_27 = max(0.0f, -0.0832173079f + 0.215715095f * h0_0 + 0.221619904f * h0_1 - 0.11489103f * h0_2
+        + 0.0962976813f * h0_3 + 0.0170141179f * h0_4 - 0.196297824f * h0_5 + 0.192667589f * h0_6
+        + 0.180434465f * h0_7 + 0.164904118f * h0_8 - 0.282215446f * h0_9 + 0.0333004072f * h0_10
+        + 0.113179825f * h0_11 - 0.234804109f * h0_12 - 0.0911738873f * h0_13 + 0.358074069f * h0_14
+        + 0.0598880947f * h0_15 + 0.18263188f * h0_16 - 0.0500727482f * h0_17 - 0.0593528301f * h0_18
+        - 0.0401121005f * h0_19 + 0.0328543819f * h0_20 + 0.0385489017f * h0_21 + 0.024230212f * h0_22
+        - 0.0670083836f * h0_23 - 0.0813216865f * h0_24 + 0.101601213f * h0_25 + 0.00589874852f * h0_26
+        + 0.0650459379f * h0_27 + 0.0704808459f * h0_28 + 0.00523513183f * h0_29 - 0.034983661f * h0_30
+        - 0.000165773556f * h0_31 + 0.104507603f * h0_32 + 0.116682522f * h0_33 - 0.018537797f * h0_34
+        + 0.0793488547f * h0_35 + 0.052591823f * h0_36 + 0.140580997f * h0_37 + 0.0534391105f * h0_38
+        + 0.118529133f * h0_39 - 0.284680903f * h0_40 + 0.0893134549f * h0_41 - 0.0464891307f * h0_42
+        - 0.189794451f * h0_43 + 0.0401263013f * h0_44 + 0.145658612f * h0_45 + 0.0686958134f * h0_46
+        + 0.186235979f * h0_47 + 0.204871297f * h0_48 + 0.188504085f * h0_49 + 0.0228357762f * h0_50
+        + 0.114572853f * h0_51 - 0.0835454836f * h0_52 + 0.131629035f * h0_53 + 0.0277071614f * h0_54
+        + 0.387227327f * h0_55 + 0.226103842f * h0_56 - 0.080043152f * h0_57 + 0.0342479311f * h0_58
+        - 0.226740599f * h0_59 + 0.00250967848f * h0_60 - 0.121041797f * h0_61 - 0.117451191f * h0_62
+        + 0.194482327f * h0_63);
+    float h1_28 = max(0.0f, 0.0786860883f - 0.0810384378f * h0_0 - 0.0753030181f * h0_1 + 0.109994851f * h0_2
+        + 0.0617491752f * h0_3 + 0.0280416626f * h0_4 - 0.0720575303f * h0_5 + 0.0443951078f * h0_6
+        + 0.00775974058f * h0_7 - 0.0861083716f * h0_8 - 0.0163010694f * h0_9 + 0.0224463511f * h0_10
+        + 0.0312345978f * h0_11 + 0.0425165109f * h0_12 - 0.0476107448f * h0_13 + 0.0229890123f * h0_14
+        - 0.060954988f * h0_15 + 0.0808775127f * h0_16 + 0.0774777755f * h0_17 + 0.0355565436f * h0_18
+        + 0.0636354238f * h0_19 - 0.137716055f * h0_20 + 0.00257095695f * h0_21 + 0.0946393982f * h0_22
+        - 0.108631738f * h0_23 + 0.104143478f * h0_24 - 0.0505438149f * h0_25 - 0.0817497298f * h0_26
+        - 0.0389939733f * h0_27 + 0.0304195918f * h0_28 - 0.112190299f * h0_29 + 0.0708590597f * h0_30
+        - 0.00930982828f * h0_31 - 0.0748355538f * h0_32 + 0.0695721433f * h0_33 - 0.100663602f * h0_34
+        + 0.103365153f * h0_35 + 0.0349933244f * h0_36 - 0.0772315711f * h0_37 + 0.108760454f * h0_38
+        - 0.129722431f * h0_39 + 0.0483509973f * h0_40 - 0.134632364f * h0_41 - 0.0286368206f * h0_42
+        - 0.0491138473f * h0_43 + 0.0813381448f * h0_44 + 0.0704820827f * h0_45 + 0.112267375f * h0_46
+        - 0.119868226f * h0_47 - 0.107213229f * h0_48 + 0.0946469903f * h0_49 + 0.0775739849f * h0_50
+        + 0.00346131623f * h0_51 - 0.0467457175f * h0_52 - 0.12619254f * h0_53 - 0.0456072539f * h0_54
+        + 0.086274229f * h0_55 + 0.032011047f * h0_56 + 0.0769898593f * h0_57 - 0.104321815f * h0_58
+        - 0.112966493f * h0_59 - 0.138920873f * h0_60 - 0.0317055508f * h0_61 - 0.0699343309f * h0_62
+        - 0.108115084f * h0_63);
+    float h1_29 = max(0.0f, -0.0351337045f - 0.00358599471f * h0_0 - 0.0403910466f * h0_1 + 0.0556894019f * h0_2
+        + 0.0572360605f * h0_3 - 0.0163800996f * h0_4 - 0.0388730466f * h0_5 - 0.102784805f * h0_6
+        + 0.0819848031f * h0_7 - 0.0281912796f * h0_8 + 0.100511678f * h0_9 + 0.0515610799f * h0_10
+        - 0.0207153484f * h0_11 + 0.0322815627f * h0_12 + 0.0550637841f * h0_13 - 0.0928830653f * h0_14
+        + 0.0516377389f * h0_15 - 0.0251438785f * h0_16 - 0.121872008f * h0_17 + 0.0536303408f * h0_18
+        + 0.105376251f * h0_19 + 0.0367142335f * h0_20 + 0.0104401857f * h0_21 + 0.0124153458f * h0_22
+        + 0.0964029878f * h0_23 - 0.133958742f * h0_24 - 0.0034186244f * h0_25 + 0.0718424395f * h0_26
+        - 0.0562636405f * h0_27 + 0.0909650922f * h0_28 + 0.0640269667f * h0_29 + 0.0298260339f * h0_30
+        + 0.0289680213f * h0_31 - 0.000609502196f * h0_32 + 0.0490723401f * h0_33 + 0.00369790196f * h0_34
+        - 0.108366393f * h0_35 - 0.140798435f * h0_36 + 0.00665013306f * h0_37 + 0.0704232156f * h0_38
+        - 0.114067063f * h0_39 + 0.0723783597f * h0_40 - 0.0781127959f * h0_41 - 0.0704769045f * h0_42
+        - 0.0985815972f * h0_43 - 0.0646428838f * h0_44 + 0.0206962358f * h0_45 + 0.0754801631f * h0_46
+        - 0.00110941823f * h0_47 - 0.101770692f * h0_48 + 0.0405314788f * h0_49 + 0.105733424f * h0_50
+        - 0.0456911027f * h0_51 - 0.0471660718f * h0_52 + 0.0308120772f * h0_53 - 0.113100879f * h0_54
+        - 0.0908815786f * h0_55 - 0.031065315f * h0_56 + 0.0211944729f * h0_57 + 0.0216536652f * h0_58
+        - 0.122307539f * h0_59 + 0.0565531328f * h0_60 + 0.0295699872f * h0_61 + 0.101823419f * h0_62
+        + 0.0550295673f * h0_63);
+    float h1_30 = max(0.0f, -0.0688973516f + 0.060296189f * h0_0 + 0.0868120492f * h0_1 - 0.019931864f * h0_2
+        - 0.0768739581f * h0_3 + 0.0997271985f * h0_4 - 0.0537955351f * h0_5 + 0.00314105023f * h0_6
+        + 0.0556168817f * h0_7 + 0.0344074555f * h0_8 - 0.0669661984f * h0_9 - 0.0631199256f * h0_10
+        + 0.00419184007f * h0_11 + 0.0173440743f * h0_12 - 0.114182055f * h0_13 - 0.105416045f * h0_14
+        - 0.0620516576f * h0_15 + 0.0621115938f * h0_16 - 0.00972402003f * h0_17 - 0.0558212139f * h0_18
+        + 0.0196885075f * h0_19 - 0.0951220393f * h0_20 - 0.100079715f * h0_21 + 0.119116254f * h0_22
+        - 0.107699297f * h0_23 - 0.077532135f * h0_24 + 0.0524695814f * h0_25 - 0.127285406f * h0_26
+        + 0.0722522214f * h0_27 + 0.0873307064f * h0_28 + 0.0549031422f * h0_29 - 0.132058486f * h0_30
+        + 0.0482411981f * h0_31 - 0.0446859151f * h0_32 + 0.0540869422f * h0_33 + 0.0738550425f * h0_34
+        - 0.0174764805f * h0_35 - 0.0873891264f * h0_36 - 0.045559559f * h0_37 - 0.062871024f * h0_38
+        + 0.051638104f * h0_39 - 0.0103086401f * h0_40 + 0.0598789416f * h0_41 - 0.0360470191f * h0_42
+        + 0.0006051971f * h0_43 + 0.0980990678f * h0_44 - 0.105029002f * h0_45 - 0.0320585668f * h0_46
+        - 0.00567000825f * h0_47 - 0.0391249247f * h0_48 + 0.0129296565f * h0_49 + 0.0423611403f * h0_50
+        - 0.032645613f * h0_51 - 0.0216768458f * h0_52 - 0.0732390434f * h0_53 + 0.0464490056f * h0_54
+        + 0.0409718715f * h0_55 + 0.0485910773f * h0_56 + 0.0924320966f * h0_57 + 0.0366047397f * h0_58
+        + 0.042919822f * h0_59 - 0.00389210018f * h0_60 + 0.0804568008f * h0_61 - 0.0807378218f * h0_62
+        - 0.115785852f * h0_63);
+    float h1_31 = max(0.0f, 0.0412374288f + 0.160841778f * h0_0 - 1.34366691f * h0_1 - 0.147435129f * h0_2
+        - 0.0306476578f * h0_3 + 0.47350657f * h0_4 - 0.790425539f * h0_5 + 0.244904026f * h0_6
+        + 0.0721373037f * h0_7 + 0.166135415f * h0_8 - 0.0528655425f * h0_9 - 0.0409625992f * h0_10
+        - 0.121182099f * h0_11 + 0.110841595f * h0_12 + 0.10239242f * h0_13 - 0.202273205f * h0_14
+        - 1.01072264f * h0_15 - 0.0313254595f * h0_16 + 0.0262426063f * h0_17 + 0.103193641f * h0_18
+        + 0.162075549f * h0_19 + 0.485332847f * h0_20 + 0.000465646386f * h0_21 - 0.279500455f * h0_22
+        - 0.0251143016f * h0_23 + 0.251424074f * h0_24 + 0.0739923418f * h0_25 + 0.484178156f * h0_26
+        + 0.0318909883f * h0_27 - 0.586040497f * h0_28 + 0.000389541121f * h0_29 - 0.112933688f * h0_30
+        - 0.0876125693f * h0_31 + 0.0902574062f * h0_32 - 0.162927151f * h0_33 + 0.0592745394f * h0_34
+        + 0.74995929f * h0_35 - 0.169634685f * h0_36 - 0.359135568f * h0_37 + 0.0628567487f * h0_38
+        - 0.0387726054f * h0_39 - 0.80698061f * h0_40 - 0.0569384769f * h0_41 - 0.0482591875f * h0_42
+        + 0.0419929549f * h0_43 - 0.469489843f * h0_44 + 0.123789094f * h0_45 - 0.0485874265f * h0_46
+        + 0.354656428f * h0_47 + 0.185817167f * h0_48 + 0.403260529f * h0_49 + 0.0771590918f * h0_50
+        + 0.0392143875f * h0_51 + 0.138729945f * h0_52 - 0.720842719f * h0_53 - 0.0961460695f * h0_54
+        - 0.279235125f * h0_55 - 0.0427548066f * h0_56 - 0.0971328616f * h0_57 - 0.330826372f * h0_58
+        - 0.050524801f * h0_59 - 0.457748741f * h0_60 + 0.390265048f * h0_61 + 0.513594627f * h0_62
+        - 0.117560603f * h0_63);
+    float h1_32 = max(0.0f, 0.110514574f + 0.0695464984f * h0_0 - 0.144068673f * h0_1 - 0.0669229925f * h0_2
+        + 0.0186294895f * h0_3 - 0.0192302205f * h0_4 + 0.0592244677f * h0_5 - 0.111162886f * h0_6
+        + 0.0481442809f * h0_7 + 0.0719198212f * h0_8 - 0.0126921339f * h0_9 - 0.239601642f * h0_10
+        - 0.0108698485f * h0_11 + 0.377594978f * h0_12 + 0.0272542387f * h0_13 + 0.188523844f * h0_14
+        + 0.0105793783f * h0_15 - 0.00424574967f * h0_16 - 0.0196038224f * h0_17 + 0.101073138f * h0_18
+        + 0.00883763935f * h0_19 + 0.0953712165f * h0_20 - 0.0349742174f * h0_21 + 0.04746259f * h0_22
+        - 0.006009656f * h0_23 + 0.256181419f * h0_24 + 0.0412724912f * h0_25 - 0.0795924664f * h0_26
+        - 0.291057944f * h0_27 - 0.496905625f * h0_28 + 0.0318260863f * h0_29 - 0.0643779039f * h0_30
+        + 0.114614792f * h0_31 - 0.100352325f * h0_32 - 0.0681885555f * h0_33 + 0.0379851162f * h0_34
+        - 0.0253444929f * h0_35 + 0.0452965498f * h0_36 - 0.238203362f * h0_37 - 0.0931364372f * h0_38
+        + 0.0832652152f * h0_39 + 0.0689565912f * h0_40 + 0.135237142f * h0_41 + 0.151904106f * h0_42
+        + 0.208914876f * h0_43 + 0.0514881574f * h0_44 + 0.0781585872f * h0_45 + 0.11571312f * h0_46
+        - 0.00829192996f * h0_47 - 0.119275965f * h0_48 - 0.0643777549f * h0_49 + 0.0998679101f * h0_50
+        - 0.0501998514f * h0_51 + 0.178588703f * h0_52 + 0.0565960519f * h0_53 - 0.141493902f * h0_54
+        - 0.333208591f * h0_55 + 0.0264298413f * h0_56 + 0.1217933f * h0_57 - 0.0344306044f * h0_58
+        + 0.229452267f * h0_59 + 0.211698428f * h0_60 + 0.146505356f * h0_61 + 0.15560931f * h0_62
+        + 0.027786985f * h0_63);
+    float h1_33 = max(0.0f, 0.129815206f + 0.0397704095f * h0_0 - 0.350284964f * h0_1 + 0.0926175341f * h0_2
+        + 0.0656517446f * h0_3 + 0.0825804174f * h0_4 + 0.40009594f * h0_5 - 0.17343542f * h0_6
+        + 0.0600842834f * h0_7 + 0.0628869683f * h0_8 - 0.128586724f * h0_9 - 0.227750659f * h0_10
+        + 0.00682503078f * h0_11 + 0.0174331274f * h0_12 + 0.0819172412f * h0_13 - 0.113107502f * h0_14
+        + 0.140500382f * h0_15 + 0.0749092177f * h0_16 - 0.0119195525f * h0_17 - 0.0181775689f * h0_18
+        + 0.0575558767f * h0_19 - 0.0563458093f * h0_20 - 0.0393974185f * h0_21 - 0.212466434f * h0_22
+        - 0.00675600767f * h0_23 - 0.0175955892f * h0_24 + 0.00981262326f * h0_25 - 0.123360716f * h0_26
+        - 0.282338411f * h0_27 - 0.574534059f * h0_28 - 0.0479458198f * h0_29 + 0.0877566934f * h0_30
+        + 0.110494785f * h0_31 + 0.0728091449f * h0_32 + 0.0616060048f * h0_33 + 0.00097042456f * h0_34
+        + 0.177964196f * h0_35 + 0.158590734f * h0_36 + 0.0328183249f * h0_37 + 0.0505242534f * h0_38
+        + 0.215862945f * h0_39 + 0.243804589f * h0_40 + 0.0114412587f * h0_41 + 0.0134856375f * h0_42
+        + 0.178397015f * h0_43 + 0.0446549095f * h0_44 + 0.0430881791f * h0_45 - 0.123772785f * h0_46
+        - 0.097110793f * h0_47 - 0.0731543601f * h0_48 + 0.0832393393f * h0_49 - 0.100610152f * h0_50
+        - 0.108574122f * h0_51 + 0.165112004f * h0_52 + 0.159283221f * h0_53 - 0.025767073f * h0_54
+        - 0.156885996f * h0_55 + 0.0668088943f * h0_56 - 0.0528441519f * h0_57 - 0.185598642f * h0_58
+        - 0.0910477489f * h0_59 + 0.301643759f * h0_60 + 0.230192751f * h0_61 - 0.0224047136f * h0_62
+        - 0.00621944573f * h0_63);
+    float h1_34 = max(0.0f, 0.0258513242f + 0.162748486f * h0_0 - 0.121470101f * h0_1 - 0.105254076f * h0_2
+        - 0.0947011709f * h0_3 + 0.169895992f * h0_4 - 0.127379522f * h0_5 + 0.15050672f * h0_6
+        + 0.125494063f * h0_7 + 0.223562002f * h0_8 - 0.251187176f * h0_9 - 0.264184356f * h0_10
+        + 0.0291166473f * h0_11 + 0.0249720663f * h0_12 + 0.0753115863f * h0_13 + 0.138012186f * h0_14
+        + 0.11214672f * h0_15 + 0.318083167f * h0_16 + 0.0546865426f * h0_17 + 0.0239344798f * h0_18
+        + 0.104103714f * h0_19 + 0.20930101f * h0_20 + 0.0643805265f * h0_21 - 0.0365790538f * h0_22
+        - 0.0506063029f * h0_23 - 0.0390134417f * h0_24 + 0.0617539436f * h0_25 + 0.0918198526f * h0_26
+        - 0.105304465f * h0_27 - 0.037744578f * h0_28 - 0.0743717849f * h0_29 - 0.0650245473f * h0_30
+        - 0.0852919072f * h0_31 - 0.0511759967f * h0_32 + 0.0432828479f * h0_33 + 0.0147230215f * h0_34
+        + 0.321919918f * h0_35 - 0.0415200964f * h0_36 - 0.177124307f * h0_37 - 0.112972923f * h0_38
+        + 0.190366462f * h0_39 - 0.522799194f * h0_40 + 0.0140258092f * h0_41 - 0.00306999777f * h0_42
+        - 0.20165737f * h0_43 + 0.107786521f * h0_44 + 0.204567805f * h0_45 + 0.0144256353f * h0_46
+        + 0.0487850159f * h0_47 + 0.301754713f * h0_48 + 0.277023286f * h0_49 + 0.0953042358f * h0_50
+        + 0.0579509139f * h0_51 - 0.0186708905f * h0_52 - 0.145761967f * h0_53 - 0.0209979769f * h0_54
+        + 0.460993469f * h0_55 + 0.177689433f * h0_56 + 0.0710480511f * h0_57 - 0.0671980232f * h0_58
+        - 0.195980623f * h0_59 - 0.0868166536f * h0_60 - 0.172017217f * h0_61 - 0.0506036878f * h0_62
+        + 0.257169694f * h0_63);
+    float h1_35 = max(0.0f, -0.067500785f - 0.127726555f * h0_0 + 0.328154206f * h0_1 + 0.213603258f * h0_2
+        + 0.0599262305f * h0_3 - 0.0231437702f * h0_4 - 0.0223767795f * h0_5 + 0.0827184916f * h0_6
+        + 0.0209399387f * h0_7 + 0.206543773f * h0_8 + 0.0819847807f * h0_9 - 0.0947404876f * h0_10
+        + 0.359786063f * h0_11 + 0.0749640539f * h0_12 - 0.0434547067f * h0_13 - 0.0441648588f * h0_14
+        - 0.00743020279f * h0_15 - 0.229445204f * h0_16 + 0.101556785f * h0_17 + 0.0419055745f * h0_18
+        + 0.0776239634f * h0_19 + 0.142448202f * h0_20 - 0.0518022031f * h0_21 + 0.36154449f * h0_22
+        + 0.129953936f * h0_23 + 0.12193244f * h0_24 - 0.0535779595f * h0_25 + 0.165459603f * h0_26
+        + 0.127396733f * h0_27 + 0.616070986f * h0_28 + 0.113316394f * h0_29 - 0.0404294953f * h0_30
+        - 0.0132997669f * h0_31 - 0.0816932768f * h0_32 + 0.0243087187f * h0_33 - 0.0413364135f * h0_34
+        - 0.110993549f * h0_35 - 0.0376408361f * h0_36 - 0.0488493294f * h0_37 + 0.00725382147f * h0_38
+        - 0.266055375f * h0_39 + 0.00771282334f * h0_40 - 0.0991539359f * h0_41 + 0.153240919f * h0_42
+        - 0.381609112f * h0_43 + 0.00492704241f * h0_44 + 0.00622640504f * h0_45 - 0.0689186454f * h0_46
+        + 0.065373078f * h0_47 + 0.287576675f * h0_48 - 0.122468628f * h0_49 - 0.0397958159f * h0_50
+        - 0.0342140645f * h0_51 + 0.284475058f * h0_52 - 0.200805277f * h0_53 - 0.0217182506f * h0_54
+        - 0.107841186f * h0_55 + 0.156692609f * h0_56 - 0.0593378842f * h0_57 + 0.265723139f * h0_58
+        + 0.236211479f * h0_59 - 0.299794227f * h0_60 - 0.0439778864f * h0_61 + 0.150016651f * h0_62
+        + 0.377859652f * h0_63);
+    float h1_36 = max(0.0f, 0.0428188592f + 0.050217621f * h0_0 - 0.0837711021f * h0_1 - 0.33201158f * h0_2
+        - 0.078982316f * h0_3 + 0.0528712533f * h0_4 + 0.212113589f * h0_5 - 0.0593314506f * h0_6
+        - 0.0051417551f * h0_7 - 0.114311114f * h0_8 + 0.0284735598f * h0_9 + 0.183615565f * h0_10
+        - 0.040407747f * h0_11 - 0.0908241495f * h0_12 - 0.0841869861f * h0_13 + 0.252398491f * h0_14
+        + 0.0662678257f * h0_15 + 0.141898781f * h0_16 + 0.112866774f * h0_17 + 0.103696719f * h0_18
+        + 0.161431342f * h0_19 + 0.0326048583f * h0_20 - 0.0641680956f * h0_21 - 0.373517573f * h0_22
+        + 0.0765157267f * h0_23 - 0.0988483801f * h0_24 - 0.110394537f * h0_25 + 0.0529730357f * h0_26
+        - 0.190734744f * h0_27 - 0.00457416475f * h0_28 - 0.107789829f * h0_29 - 0.0181335602f * h0_30
+        + 0.11606741f * h0_31 - 0.0551956929f * h0_32 + 0.174482018f * h0_33 + 0.0789781287f * h0_34
+        + 0.145197853f * h0_35 - 0.0542783104f * h0_36 + 0.0918823704f * h0_37 - 0.10967046f * h0_38
+        + 0.0853262693f * h0_39 + 0.355268002f * h0_40 + 0.0877530128f * h0_41 - 0.122924715f * h0_42
+        + 0.100765504f * h0_43 - 0.0326752514f * h0_44 + 0.077123642f * h0_45 - 0.00647118688f * h0_46
+        - 0.187318698f * h0_47 - 0.0136149591f * h0_48 + 0.222148106f * h0_49 + 0.0111460984f * h0_50
+        + 0.0342121571f * h0_51 + 0.165159762f * h0_52 + 0.0530151762f * h0_53 + 0.00440493459f * h0_54
+        + 0.34463954f * h0_55 + 0.18516846f * h0_56 + 0.0848244131f * h0_57 - 0.231597826f * h0_58
+        - 0.140465796f * h0_59 - 0.163551778f * h0_60 + 0.224380299f * h0_61 + 0.0828491226f * h0_62
+        + 0.128997326f * h0_63);
+    float h1_37 = max(0.0f, 0.0550745204f + 0.150271848f * h0_0 + 0.230849996f * h0_1 - 0.13691777f * h0_2
+        - 0.113513812f * h0_3 - 0.0876991004f * h0_4 - 0.200635016f * h0_5 - 0.0652402788f * h0_6
+        - 0.153294742f * h0_7 + 0.179796234f * h0_8 - 0.150988773f * h0_9 + 0.00527629862f * h0_10
+        + 0.132305726f * h0_11 + 0.195786715f * h0_12 + 0.123387322f * h0_13 - 0.269768476f * h0_14
+        + 0.164083332f * h0_15 - 0.149782538f * h0_16 + 0.0895882845f * h0_17 + 0.064395912f * h0_18
+        + 0.118680142f * h0_19 - 0.0632159561f * h0_20 + 0.00923706591f * h0_21 - 0.189142659f * h0_22
+        + 0.14137283f * h0_23 + 0.191544816f * h0_24 - 0.0456321985f * h0_25 + 0.109753758f * h0_26
+        + 0.0282303449f * h0_27 + 0.175277829f * h0_28 - 0.0652805567f * h0_29 + 0.0279646795f * h0_30
+        + 0.00442825025f * h0_31 - 0.121546365f * h0_32 + 0.0196997337f * h0_33 + 0.0233274251f * h0_34
+        + 0.245833591f * h0_35 + 0.10914059f * h0_36 - 0.184309065f * h0_37 + 0.0644255579f * h0_38
+        + 0.013285853f * h0_39 + 0.214294538f * h0_40 - 0.0754608735f * h0_41 + 0.00334253674f * h0_42
+        + 0.0517358258f * h0_43 - 0.243540376f * h0_44 - 0.0500586405f * h0_45 - 0.0892356485f * h0_46
+        + 0.199664176f * h0_47 + 0.238708526f * h0_48 + 0.0864512324f * h0_49 + 0.100731909f * h0_50
+        + 0.123921931f * h0_51 + 0.3551085f * h0_52 + 0.0857682973f * h0_53 - 0.0285610575f * h0_54
+        - 0.0916268826f * h0_55 + 0.051243566f * h0_56 + 0.0247968584f * h0_57 - 0.332109302f * h0_58
+        + 0.0804374963f * h0_59 - 0.0421884134f * h0_60 + 0.327767879f * h0_61 + 0.177306876f * h0_62
+        + 0.169149995f * h0_63);
+    float h1_38 = max(0.0f, -0.0333819203f + 0.157820284f * h0_0 - 0.094466418f * h0_1 - 0.151909679f * h0_2
+        - 0.101377994f * h0_3 + 0.162055239f * h0_4 - 0.153735399f * h0_5 + 0.223195195f * h0_6
+        + 0.122358687f * h0_7 - 0.0381482281f * h0_8 + 0.234685317f * h0_9 + 0.168248191f * h0_10
+        - 0.353101432f * h0_11 - 0.259768158f * h0_12 - 0.0606421083f * h0_13 - 0.08873377f * h0_14
+        - 0.0413100794f * h0_15 + 0.139730781f * h0_16 + 0.0332685113f * h0_17 + 0.0859760493f * h0_18
+        + 0.0796365887f * h0_19 - 0.00252876268f * h0_20 - 0.0236454308f * h0_21 - 0.169014707f * h0_22
+        + 0.0745984837f * h0_23 + 0.0370637104f * h0_24 + 0.0248554349f * h0_25 + 0.278111309f * h0_26
+        + 0.29785946f * h0_27 - 0.06030415f * h0_28 + 0.106194913f * h0_29 + 0.175191313f * h0_30
+        + 0.0702183321f * h0_31 - 0.0227307267f * h0_32 + 0.0413581692f * h0_33 - 0.0712081566f * h0_34
+        - 0.00717755314f * h0_35 - 0.103129841f * h0_36 + 0.108462811f * h0_37 + 0.0930064619f * h0_38
+        + 0.177710682f * h0_39 - 0.289064974f * h0_40 - 0.00391930435f * h0_41 - 0.153463855f * h0_42
+        + 0.307366639f * h0_43 + 0.0623198636f * h0_44 + 0.0167819187f * h0_45 + 0.097406432f * h0_46
+        - 0.00498046866f * h0_47 - 0.226029009f * h0_48 + 0.243028745f * h0_49 + 0.0984364599f * h0_50
+        + 0.119205967f * h0_51 - 0.313613117f * h0_52 - 0.141405374f * h0_53 + 0.215427324f * h0_54
+        + 0.119782455f * h0_55 + 0.0501396544f * h0_56 + 0.0616838485f * h0_57 + 0.113840014f * h0_58
+        - 0.151161864f * h0_59 + 0.00331993448f * h0_60 + 0.0769722611f * h0_61 + 0.0932718962f * h0_62
+        - 0.291262597f * h0_63);
+    float h1_39 = max(0.0f, 0.0359207951f + 0.0434556529f * h0_0 - 0.0285767447f * h0_1 + 0.245998427f * h0_2
+        + 0.120918415f * h0_3 + 0.0300190486f * h0_4 - 0.0897243619f * h0_5 - 0.041307807f * h0_6
+        + 0.368113726f * h0_7 + 0.107916303f * h0_8 - 0.105806962f * h0_9 - 0.171199486f * h0_10
+        - 0.181453079f * h0_11 - 0.161551312f * h0_12 + 0.00843073428f * h0_13 + 0.194566414f * h0_14
+        + 0.119533285f * h0_15 + 0.222210795f * h0_16 - 0.006384735f * h0_17 - 0.122133546f * h0_18
+        - 0.0787206516f * h0_19 + 0.196428791f * h0_20 + 0.0328184664f * h0_21 - 0.016422864f * h0_22
+        + 0.0146532943f * h0_23 + 0.00491095893f * h0_24 + 0.07655406f * h0_25 + 0.215505734f * h0_26
+        - 0.214942783f * h0_27 - 0.347123027f * h0_28 + 0.0508949496f * h0_29 - 0.0912671909f * h0_30
+        + 0.0555010773f * h0_31 + 0.0243256595f * h0_32 + 0.0602701902f * h0_33 - 0.100180723f * h0_34
+        - 0.0305181034f * h0_35 + 0.0682632923f * h0_36 - 0.0490666777f * h0_37 - 0.107710525f * h0_38
+        + 0.0363357887f * h0_39 - 0.416253448f * h0_40 + 0.0221706554f * h0_41 - 0.0430568196f * h0_42
+        + 0.00323539041f * h0_43 + 0.169165015f * h0_44 + 0.0727547705f * h0_45 - 0.0244691819f * h0_46
+        + 0.127351657f * h0_47 + 0.151747555f * h0_48 + 0.122211568f * h0_49 + 0.0438592732f * h0_50
+        + 0.0736291111f * h0_51 - 0.235092029f * h0_52 + 0.00548056467f * h0_53 + 0.0335438028f * h0_54
+        + 0.381491542f * h0_55 + 0.209144995f * h0_56 - 0.0256451368f * h0_57 + 0.192967266f * h0_58
+        - 0.114206202f * h0_59 + 0.128491521f * h0_60 - 0.131506741f * h0_61 - 0.048635941f * h0_62
+        - 0.0141824195f * h0_63);
+    float h1_40 = max(0.0f, 0.0620642006f - 0.0513292551f * h0_0 + 0.0279374272f * h0_1 + 0.0323913395f * h0_2
+        + 0.0913637578f * h0_3 - 0.101302564f * h0_4 - 0.0740320534f * h0_5 + 0.0757887363f * h0_6
+        + 0.00366975367f * h0_7 + 0.116918817f * h0_8 + 0.0952675939f * h0_9 + 0.041465193f * h0_10
+        - 0.0294039994f * h0_11 - 0.103173316f * h0_12 + 0.0434794724f * h0_13 + 0.0111615062f * h0_14
+        + 0.0436616987f * h0_15 + 0.00656162202f * h0_16 - 0.0541582257f * h0_17 - 0.102845296f * h0_18
+        + 0.0502279401f * h0_19 - 0.108960956f * h0_20 + 0.118115529f * h0_21 + 0.035531044f * h0_22
+        - 0.0800674111f * h0_23 - 0.0378933847f * h0_24 + 0.12003386f * h0_25 - 0.106055826f * h0_26
+        - 0.0375203937f * h0_27 - 0.0549295694f * h0_28 - 0.118210465f * h0_29 - 0.0162617415f * h0_30
+        + 0.0935733318f * h0_31 - 0.032457903f * h0_32 - 0.119510636f * h0_33 - 0.0456159562f * h0_34
+        - 0.0891414434f * h0_35 + 0.0586876124f * h0_36 - 0.0491666496f * h0_37 + 0.114262268f * h0_38
+        - 0.0271591395f * h0_39 - 0.055315271f * h0_40 + 0.0216995478f * h0_41 - 0.0776560754f * h0_42
+        - 0.0502790362f * h0_43 - 0.119128674f * h0_44 - 0.0284069031f * h0_45 + 0.0022329092f * h0_46
+        + 0.103629753f * h0_47 - 0.0554607958f * h0_48 + 0.0238885283f * h0_49 - 0.00808614492f * h0_50
+        - 0.0779811442f * h0_51 - 0.0464736074f * h0_52 - 0.0860963315f * h0_53 + 0.0851550847f * h0_54
+        - 0.0084746033f * h0_55 - 0.0474990755f * h0_56 - 0.0818655044f * h0_57 - 0.0994755626f * h0_58
+        + 0.0141321272f * h0_59 + 0.0385862142f * h0_60 + 0.0764330178f * h0_61 + 0.035502106f * h0_62
+        - 0.0556329042f * h0_63);
+    float h1_41 = max(0.0f, -0.04362344f + 0.0599692687f * h0_0 + 0.171925619f * h0_1 + 0.116179094f * h0_2
+        + 0.0438441262f * h0_3 - 0.177784741f * h0_4 - 0.149739534f * h0_5 + 0.138204083f * h0_6
+        - 0.165269613f * h0_7 - 0.0556741841f * h0_8 - 0.0457365178f * h0_9 + 0.111273341f * h0_10
+        + 0.28558591f * h0_11 + 0.190636843f * h0_12 + 0.0824979842f * h0_13 - 0.255441815f * h0_14
+        - 0.0417486951f * h0_15 + 0.0984381139f * h0_16 + 0.0512179509f * h0_17 + 0.130678892f * h0_18
+        - 0.101751484f * h0_19 - 0.0485017337f * h0_20 - 0.0882505327f * h0_21 + 0.173420578f * h0_22
+        + 0.0889612287f * h0_23 - 0.023949014f * h0_24 + 0.058432892f * h0_25 - 0.0785105526f * h0_26
+        + 0.318537742f * h0_27 + 0.612673044f * h0_28 - 0.104091018f * h0_29 + 0.0470720343f * h0_30
+        + 0.0972212851f * h0_31 - 0.0533648431f * h0_32 + 0.0472815782f * h0_33 - 0.0212816298f * h0_34
+        - 0.252514392f * h0_35 + 0.177528575f * h0_36 + 0.0644924939f * h0_37 + 0.0558933429f * h0_38
+        - 0.116605774f * h0_39 + 0.310106784f * h0_40 - 0.0264897738f * h0_41 + 0.0107516469f * h0_42
+        - 0.184126511f * h0_43 - 0.096292831f * h0_44 - 0.121494979f * h0_45 + 0.114042222f * h0_46
+        + 0.162743822f * h0_47 + 0.104431912f * h0_48 + 0.00016448331f * h0_49 + 0.0403217673f * h0_50
+        + 0.108382136f * h0_51 + 0.291975409f * h0_52 + 0.0739017278f * h0_53 + 0.0109306555f * h0_54
+        + 0.0513244271f * h0_55 - 0.0605883151f * h0_56 + 0.0635026395f * h0_57 + 0.160163864f * h0_58
+        + 0.00149355934f * h0_59 - 0.268599361f * h0_60 + 0.0153038288f * h0_61 + 0.0467264988f * h0_62
+        + 0.400934786f * h0_63);
+    float h1_42 = max(0.0f, -0.0683761835f + 0.0824339613f * h0_0 - 0.155788869f * h0_1 + 0.308224797f * h0_2
+        - 0.074961625f * h0_3 - 0.0882859156f * h0_4 + 0.376154751f * h0_5 - 0.177507326f * h0_6
+        + 0.152835414f * h0_7 + 0.105462141f * h0_8 - 0.0587691925f * h0_9 + 0.0818601325f * h0_10
+        + 0.11343722f * h0_11 + 0.0996412784f * h0_12 - 0.0727623254f * h0_13 + 0.11062371f * h0_14
+        + 0.111386105f * h0_15 - 0.0383756794f * h0_16 - 0.0450163595f * h0_17 - 0.0221087765f * h0_18
+        + 0.0603065751f * h0_19 - 0.035568431f * h0_20 + 0.111340478f * h0_21 + 0.248776689f * h0_22
+        + 0.0725342631f * h0_23 - 0.101223759f * h0_24 + 0.0786287189f * h0_25 - 0.250588745f * h0_26
+        - 0.107743502f * h0_27 - 0.0367232673f * h0_28 + 0.029911017f * h0_29 - 0.0300637875f * h0_30
+        + 0.121010646f * h0_31 + 0.0183180962f * h0_32 + 0.00940895546f * h0_33 - 0.0642574877f * h0_34
+        - 0.334722996f * h0_35 + 0.0636220202f * h0_36 + 0.0959341004f * h0_37 - 0.0179197341f * h0_38
+        + 0.0626324713f * h0_39 + 0.219051257f * h0_40 + 0.00883747265f * h0_41 + 0.0767117962f * h0_42
+        + 0.0190021247f * h0_43 + 0.262420654f * h0_44 - 0.029286541f * h0_45 + 0.119168669f * h0_46
+        - 0.0152338715f * h0_47 + 0.0265215579f * h0_48 - 0.273424059f * h0_49 - 0.0621166527f * h0_50
+        + 0.0816862285f * h0_51 + 0.0377642065f * h0_52 + 0.427966624f * h0_53 - 0.0689900964f * h0_54
+        + 0.0704418048f * h0_55 - 0.0976486951f * h0_56 + 0.0663702339f * h0_57 + 0.23808673f * h0_58
+        + 0.142588034f * h0_59 + 0.341769069f * h0_60 - 0.0688490272f * h0_61 - 0.184864029f * h0_62
+        - 0.0418086313f * h0_63);
+    float h1_43 = max(0.0f, 0.0775473937f + 0.213746428f * h0_0 - 0.260769337f * h0_1 + 0.0740623549f * h0_2
+        - 0.0699958876f * h0_3 + 0.00980783068f * h0_4 - 0.014431945f * h0_5 + 0.0949329883f * h0_6
+        + 0.181347221f * h0_7 - 0.173953742f * h0_8 - 0.449024916f * h0_9 - 0.43664822f * h0_10
+        + 0.0503906943f * h0_11 - 0.155768037f * h0_12 - 0.0617111623f * h0_13 - 0.071375221f * h0_14
+        + 0.269903272f * h0_15 + 0.206413046f * h0_16 + 0.187781066f * h0_17 - 0.0838333517f * h0_18
+        + 0.109347694f * h0_19 - 0.168859139f * h0_20 - 0.0623948127f * h0_21 + 0.0440759659f * h0_22
+        + 0.101163782f * h0_23 - 0.202946573f * h0_24 - 0.110122696f * h0_25 - 0.0575467758f * h0_26
+        + 0.0096810665f * h0_27 - 0.479132265f * h0_28 - 0.0211092345f * h0_29 + 0.150814101f * h0_30
+        + 0.120584108f * h0_31 - 0.101179101f * h0_32 + 0.148273006f * h0_33 - 0.0487750657f * h0_34
+        - 0.0106091332f * h0_35 + 0.289334625f * h0_36 + 0.0267653726f * h0_37 + 0.0604177378f * h0_38
+        + 0.156593755f * h0_39 + 0.0496147275f * h0_40 - 0.0650406554f * h0_41 + 0.0299220122f * h0_42
+        + 0.354965508f * h0_43 + 0.0825430825f * h0_44 + 0.00971711613f * h0_45 - 0.12122035f * h0_46
+        + 0.0723191351f * h0_47 + 0.0764542371f * h0_48 - 0.044584468f * h0_49 - 0.0664922446f * h0_50
+        - 0.0620164275f * h0_51 - 0.230143085f * h0_52 + 0.232890308f * h0_53 + 0.0383104831f * h0_54
+        - 0.0701202229f * h0_55 - 0.0735528618f * h0_56 - 0.0342271924f * h0_57 + 0.14285022f * h0_58
+        - 0.248030141f * h0_59 + 0.445319414f * h0_60 + 0.0854626521f * h0_61 - 0.0860304683f * h0_62
+        + 0.0414975174f * h0_63);
+    float h1_44 = max(0.0f, 0.0104383416f + 0.130551115f * h0_0 - 0.179309502f * h0_1 - 0.0998096839f * h0_2
+        - 0.114034496f * h0_3 + 0.0788060948f * h0_4 + 0.199927315f * h0_5 + 0.111921683f * h0_6
+        + 0.069832541f * h0_7 + 0.0854504555f * h0_8 + 0.309042931f * h0_9 + 0.280392885f * h0_10
+        - 0.0471431725f * h0_11 - 0.0572675616f * h0_12 + 0.0505878776f * h0_13 + 0.319231778f * h0_14
+        + 0.0136450632f * h0_15 + 0.13212502f * h0_16 + 0.133345947f * h0_17 - 0.00389485224f * h0_18
+        - 0.0649032146f * h0_19 + 0.128529608f * h0_20 + 0.0831767172f * h0_21 + 0.164364517f * h0_22
+        + 0.010667718f * h0_23 + 0.0622697473f * h0_24 + 0.0583240092f * h0_25 + 0.123582475f * h0_26
+        + 0.0822723657f * h0_27 + 0.0982325152f * h0_28 + 0.0585943796f * h0_29 - 0.0117404358f * h0_30
+        - 0.0695592836f * h0_31 - 0.00450193603f * h0_32 + 0.101706021f * h0_33 + 0.0967233852f * h0_34
+        + 0.0732907429f * h0_35 + 0.0259745345f * h0_36 + 0.121745087f * h0_37 + 0.0794453993f * h0_38
+        - 0.0911959186f * h0_39 - 0.0123507511f * h0_40 + 0.158199802f * h0_41 - 0.0594163984f * h0_42
+        - 0.22769995f * h0_43 + 0.0914406255f * h0_44 + 0.099420689f * h0_45 - 0.0302417576f * h0_46
+        - 0.0297262408f * h0_47 - 0.0355010517f * h0_48 + 0.0245367531f * h0_49 - 0.105903253f * h0_50
+        + 0.121223345f * h0_51 - 0.0126768807f * h0_52 - 0.0831608921f * h0_53 + 0.285881996f * h0_54
+        + 0.333751678f * h0_55 + 0.150529712f * h0_56 - 0.0725273937f * h0_57 + 0.177888989f * h0_58
+        + 0.0765582547f * h0_59 - 0.171224445f * h0_60 - 0.120262146f * h0_61 + 0.0401553214f * h0_62
+        + 0.174549684f * h0_63);
+    float h1_45 = max(0.0f, -0.0833330229f + 0.143796012f * h0_0 + 0.331401616f * h0_1 - 0.183686137f * h0_2
+        - 0.0306791943f * h0_3 - 0.105058685f * h0_4 - 0.113827564f * h0_5 + 0.108124875f * h0_6
+        - 0.096785605f * h0_7 + 0.115277939f * h0_8 - 0.117442973f * h0_9 + 0.380143166f * h0_10
+        + 0.0306551754f * h0_11 - 0.113363661f * h0_12 - 0.0768297613f * h0_13 - 0.00841250923f * h0_14
+        - 0.0903029889f * h0_15 + 0.266602188f * h0_16 + 0.0524550676f * h0_17 - 0.120747089f * h0_18
+        + 0.0509840138f * h0_19 - 0.0306929145f * h0_20 - 0.0811969638f * h0_21 + 0.0619411394f * h0_22
+        - 0.152583644f * h0_23 - 0.145518407f * h0_24 + 0.0498055965f * h0_25 + 0.00468591321f * h0_26
+        + 0.0749946982f * h0_27 + 0.45364207f * h0_28 - 0.0481512994f * h0_29 + 0.0386638194f * h0_30
+        - 0.00878043938f * h0_31 - 0.113157205f * h0_32 + 0.130104125f * h0_33 + 0.0564030036f * h0_34
+        + 0.0767426416f * h0_35 + 0.113838926f * h0_36 + 0.140396044f * h0_37 + 0.0481057949f * h0_38
+        + 0.0863974541f * h0_39 + 0.162507087f * h0_40 + 0.0597738698f * h0_41 - 0.0989443436f * h0_42
+        + 0.0206785407f * h0_43 - 0.0518094786f * h0_44 - 0.0109371338f * h0_45 + 0.101954758f * h0_46
+        - 0.0650255904f * h0_47 + 0.0745920688f * h0_48 + 0.184495687f * h0_49 + 0.0808421075f * h0_50
+        + 0.0883708894f * h0_51 - 0.163247615f * h0_52 + 0.03467701f * h0_53 + 0.176141813f * h0_54
+        + 0.389595002f * h0_55 + 0.0967913792f * h0_56 - 0.0441826433f * h0_57 + 0.105002858f * h0_58
+        - 0.149695098f * h0_59 + 0.0334547125f * h0_60 - 0.159059048f * h0_61 - 0.0880135447f * h0_62
+        + 0.287719876f * h0_63);
+    float h1_46 = max(0.0f, -0.0824580863f - 0.0793137327f * h0_0 - 0.012936553f * h0_1 - 0.0608047619f * h0_2
+        + 0.0298791975f * h0_3 - 0.038317956f * h0_4 + 0.0729018822f * h0_5 - 0.0796950236f * h0_6
+        + 0.0895703286f * h0_7 - 0.081791006f * h0_8 - 0.0602005757f * h0_9 - 0.0494324341f * h0_10
+        - 0.025818713f * h0_11 + 0.0749748051f * h0_12 - 0.0215351135f * h0_13 - 0.0986884907f * h0_14
+        - 0.101285696f * h0_15 + 0.11548017f * h0_16 + 0.0365297347f * h0_17 + 0.0905110911f * h0_18
+        - 0.0179660637f * h0_19 + 0.0460948609f * h0_20 - 0.115863949f * h0_21 + 0.00577972503f * h0_22
+        - 0.0430312119f * h0_23 - 0.0314600877f * h0_24 + 0.085992977f * h0_25 - 0.0665133297f * h0_26
+        + 0.0876125768f * h0_27 - 0.0713635534f * h0_28 + 0.0703406706f * h0_29 + 0.0785059556f * h0_30
+        - 0.0820991099f * h0_31 - 0.113633737f * h0_32 - 0.0584830083f * h0_33 - 0.111973286f * h0_34
+        - 0.0936101228f * h0_35 + 0.101006649f * h0_36 + 0.0285962354f * h0_37 + 0.0141999125f * h0_38
+        + 0.115358189f * h0_39 + 0.0507542118f * h0_40 - 0.10924834f * h0_41 - 0.0500710495f * h0_42
+        + 0.060960196f * h0_43 - 0.0907197744f * h0_44 - 0.0277175531f * h0_45 - 0.113426685f * h0_46
+        - 0.0493324175f * h0_47 + 0.0602201931f * h0_48 + 0.0147062447f * h0_49 + 0.00754471123f * h0_50
+        - 0.109394565f * h0_51 + 0.0268378574f * h0_52 + 0.0818617791f * h0_53 - 0.119289786f * h0_54
+        - 0.0962461233f * h0_55 + 0.0159593467f * h0_56 - 0.101682156f * h0_57 + 0.0354425199f * h0_58
+        - 0.0456852503f * h0_59 - 0.0297819879f * h0_60 - 0.0502061695f * h0_61 - 0.0152466958f * h0_62
+        + 0.00999674201f * h0_63);
+    float h1_47 = max(0.0f, -0.10700544f + 0.0971277654f * h0_0 + 0.233206227f * h0_1 - 0.00734024309f * h0_2
+        - 0.101601101f * h0_3 + 0.0167412367f * h0_4 + 0.237166002f * h0_5 - 0.015101281f * h0_6
+        + 0.0967418775f * h0_7 + 0.12191429f * h0_8 - 0.279292554f * h0_9 - 0.228408992f * h0_10
+        + 0.251332462f * h0_11 + 0.121970072f * h0_12 + 0.0146622509f * h0_13 + 0.00145065261f * h0_14
+        + 0.258880794f * h0_15 + 0.0204510223f * h0_16 - 0.0161370803f * h0_17 - 0.0251577664f * h0_18
+        + 0.0204488691f * h0_19 - 0.102283441f * h0_20 + 0.0561939329f * h0_21 + 0.0118722757f * h0_22
+        - 0.0313009359f * h0_23 - 0.0150597906f * h0_24 - 0.0428992212f * h0_25 + 0.0291762743f * h0_26
+        - 0.169273466f * h0_27 + 0.135563567f * h0_28 + 0.0127980541f * h0_29 - 0.135836959f * h0_30
+        - 0.00309932162f * h0_31 + 0.0952116698f * h0_32 + 0.181849897f * h0_33 - 0.00130390027f * h0_34
+        + 0.0109265372f * h0_35 + 0.0555376336f * h0_36 - 0.0930668637f * h0_37 + 0.11125426f * h0_38
+        + 0.00109058793f * h0_39 + 0.377748758f * h0_40 + 0.0837629139f * h0_41 + 0.0830794051f * h0_42
+        + 0.00608846452f * h0_43 + 0.0309700202f * h0_44 + 0.125174224f * h0_45 - 0.064064458f * h0_46
+        + 0.136423469f * h0_47 + 0.303284019f * h0_48 - 0.0493529513f * h0_49 - 0.0130345821f * h0_50
+        + 0.0119422972f * h0_51 + 0.445204228f * h0_52 + 0.300156981f * h0_53 + 0.0680975914f * h0_54
+        + 0.223204926f * h0_55 + 0.240934342f * h0_56 - 0.0530509502f * h0_57 + 0.0532684252f * h0_58
+        - 0.117228493f * h0_59 + 0.229272172f * h0_60 + 0.00931094866f * h0_61 + 0.0509718545f * h0_62
+        + 0.329622388f * h0_63);
+    float h1_48 = max(0.0f, -0.138641223f - 0.0256630126f * h0_0 + 0.898033917f * h0_1 - 0.0216748938f * h0_2
+        - 0.0547719374f * h0_3 + 0.0656012595f * h0_4 - 0.0428553186f * h0_5 - 0.175428092f * h0_6
+        + 0.295982331f * h0_7 + 0.123972468f * h0_8 - 0.673509181f * h0_9 - 1.04892087f * h0_10
+        - 0.0460332781f * h0_11 + 0.432386249f * h0_12 - 0.0143994838f * h0_13 - 0.12215285f * h0_14
+        + 0.915469348f * h0_15 + 0.342631042f * h0_16 + 0.0232075527f * h0_17 + 0.0958802551f * h0_18
+        - 0.0246987063f * h0_19 - 0.144838423f * h0_20 - 0.016050294f * h0_21 - 0.310771406f * h0_22
+        - 0.0433633551f * h0_23 - 0.392077148f * h0_24 + 0.105927855f * h0_25 - 0.111015327f * h0_26
+        - 0.906523347f * h0_27 - 1.71220636f * h0_28 + 0.153517365f * h0_29 + 0.0640994832f * h0_30
+        + 0.0239692386f * h0_31 - 0.0951547325f * h0_32 - 0.041082155f * h0_33 + 0.00994235277f * h0_34
+        + 0.502343833f * h0_35 + 0.23357895f * h0_36 - 0.200777143f * h0_37 - 0.0495198295f * h0_38
+        + 0.492892414f * h0_39 - 0.074810341f * h0_40 + 0.0640697181f * h0_41 - 0.0359227769f * h0_42
+        + 0.505644619f * h0_43 + 0.289065778f * h0_44 - 0.0796254277f * h0_45 - 0.0186922103f * h0_46
+        + 0.140179977f * h0_47 - 0.12657477f * h0_48 - 0.0670840144f * h0_49 + 0.0755687505f * h0_50
+        + 0.114323661f * h0_51 - 0.345068038f * h0_52 + 0.219787315f * h0_53 - 0.171749264f * h0_54
+        - 0.163800701f * h0_55 + 0.212537661f * h0_56 - 0.10611327f * h0_57 - 0.275280148f * h0_58
+        - 0.372635335f * h0_59 + 0.858525693f * h0_60 + 0.151444256f * h0_61 - 0.0760991946f * h0_62
+        - 0.543343425f * h0_63);
+    float h1_49 = max(0.0f, -0.046340391f - 0.119099081f * h0_0 + 0.0347445607f * h0_1 - 0.0547047406f * h0_2
+        - 0.109023437f * h0_3 - 0.0128043294f * h0_4 + 0.00295302272f * h0_5 - 0.1068739f * h0_6
+        + 0.0201780647f * h0_7 - 0.0334188342f * h0_8 - 0.0726345032f * h0_9 - 0.031434074f * h0_10
+        + 0.0051868856f * h0_11 + 0.034474805f * h0_12 + 0.116871148f * h0_13 + 0.114398792f * h0_14
+        + 0.123234868f * h0_15 + 0.0872829705f * h0_16 + 0.011044398f * h0_17 - 0.00954568386f * h0_18
+        - 0.0649811476f * h0_19 + 0.0516250581f * h0_20 + 0.108361512f * h0_21 - 0.000198483467f * h0_22
+        - 0.00835815072f * h0_23 - 0.0877270848f * h0_24 + 0.0894649327f * h0_25 + 0.000312387943f * h0_26
+        - 0.0472567528f * h0_27 + 0.109623775f * h0_28 - 0.0536848307f * h0_29 - 0.0881508887f * h0_30
+        - 0.111915946f * h0_31 + 0.0300112218f * h0_32 + 0.0733811855f * h0_33 + 0.0429050326f * h0_34
+        - 0.106836393f * h0_35 + 0.084376052f * h0_36 - 0.12421748f * h0_37 + 0.0233276188f * h0_38
+        - 0.0950235426f * h0_39 + 0.0682788938f * h0_40 + 0.0325296968f * h0_41 - 0.0027731359f * h0_42
+        + 0.0123870373f * h0_43 + 0.0749427527f * h0_44 + 0.0776551664f * h0_45 - 0.0472085178f * h0_46
+        - 0.0754941702f * h0_47 - 0.0438934714f * h0_48 - 0.0854610652f * h0_49 + 0.0895397067f * h0_50
+        - 0.120065108f * h0_51 - 0.102849886f * h0_52 + 0.118188456f * h0_53 - 0.0627986342f * h0_54
+        - 0.0468210727f * h0_55 - 0.0307432115f * h0_56 + 0.0886529237f * h0_57 + 0.00817735493f * h0_58
+        + 0.0649667233f * h0_59 + 0.0332006216f * h0_60 + 0.0209802985f * h0_61 - 0.114677519f * h0_62
+        - 0.112545401f * h0_63);
+    float h1_50 = max(0.0f, -0.26642406f + 0.146405712f * h0_0 + 0.103327014f * h0_1 - 0.566057861f * h0_2
+        - 0.002263495f * h0_3 + 0.179698631f * h0_4 - 0.113214143f * h0_5 - 0.0473696701f * h0_6
+        + 0.221080869f * h0_7 - 0.128676906f * h0_8 + 0.00518862437f * h0_9 + 0.154688731f * h0_10
+        - 0.244341537f * h0_11 - 0.15558207f * h0_12 + 0.0587395281f * h0_13 + 0.497883707f * h0_14
+        + 0.226660848f * h0_15 + 0.588884294f * h0_16 - 0.187460393f * h0_17 - 0.244060069f * h0_18
+        + 0.115462609f * h0_19 + 0.0632175505f * h0_20 - 0.0860580355f * h0_21 - 0.309188843f * h0_22
+        - 0.0897862092f * h0_23 - 0.0848527402f * h0_24 - 0.0974485874f * h0_25 + 0.152920753f * h0_26
+        - 0.156194761f * h0_27 - 0.088790141f * h0_28 - 0.165559098f * h0_29 - 0.082028389f * h0_30
+        - 0.044603534f * h0_31 - 0.034152776f * h0_32 + 0.0816456154f * h0_33 + 0.0657516569f * h0_34
+        + 0.380605996f * h0_35 - 0.136871651f * h0_36 + 0.190602392f * h0_37 - 0.0056319586f * h0_38
+        + 0.342909425f * h0_39 - 0.170030639f * h0_40 + 0.109031275f * h0_41 - 0.123336047f * h0_42
+        + 0.155851603f * h0_43 + 0.0239812303f * h0_44 - 0.0512702689f * h0_45 + 0.0443841815f * h0_46
+        - 0.188499287f * h0_47 - 0.0862799138f * h0_48 + 0.161861315f * h0_49 + 0.105605081f * h0_50
+        + 0.0113621503f * h0_51 - 0.173467845f * h0_52 + 0.0607737973f * h0_53 + 0.275826365f * h0_54
+        + 0.55644989f * h0_55 + 0.42139861f * h0_56 + 0.0719968081f * h0_57 - 0.0897913277f * h0_58
+        - 0.329781502f * h0_59 - 0.0796014369f * h0_60 + 0.0360658579f * h0_61 - 0.0853052437f * h0_62
+        + 0.0691070855f * h0_63);
+    float h1_51 = max(0.0f, 0.156467393f + 0.0348531269f * h0_0 + 0.106812976f * h0_1 - 0.0422315039f * h0_2
+        - 0.104194313f * h0_3 - 0.0295397919f * h0_4 + 0.356254905f * h0_5 - 0.132566467f * h0_6
+        - 0.0129551329f * h0_7 - 0.0690984726f * h0_8 + 0.195038259f * h0_9 + 0.150386617f * h0_10
+        + 0.0282865763f * h0_11 + 0.0606800355f * h0_12 + 0.0354072154f * h0_13 + 0.242274448f * h0_14
+        + 0.0642909631f * h0_15 - 0.0853503719f * h0_16 + 0.124968074f * h0_17 - 0.0961547345f * h0_18
+        + 0.0948728472f * h0_19 + 0.0304404721f * h0_20 - 0.109048545f * h0_21 - 0.0764755607f * h0_22
+        - 0.0133021055f * h0_23 + 0.139325127f * h0_24 + 0.123855665f * h0_25 - 0.0362280533f * h0_26
+        - 0.227146566f * h0_27 + 0.00514494535f * h0_28 + 0.153896973f * h0_29 + 0.173720509f * h0_30
+        + 0.0631104484f * h0_31 + 0.101171307f * h0_32 + 0.0836955756f * h0_33 - 0.0147982668f * h0_34
+        - 0.114833735f * h0_35 + 0.0941640139f * h0_36 + 0.0950677991f * h0_37 + 0.0414857864f * h0_38
+        + 0.154144183f * h0_39 + 0.501532257f * h0_40 - 0.0425611883f * h0_41 - 0.0612855777f * h0_42
+        + 0.256192356f * h0_43 + 0.132108003f * h0_44 - 0.00423632655f * h0_45 - 0.0872737914f * h0_46
+        - 0.181471869f * h0_47 - 0.107131958f * h0_48 + 0.146042451f * h0_49 + 0.107310385f * h0_50
+        - 0.0387657136f * h0_51 + 0.108921818f * h0_52 + 0.0823013932f * h0_53 + 0.0963359997f * h0_54
+        - 0.0264267009f * h0_55 + 0.172885701f * h0_56 - 0.019359529f * h0_57 + 0.0947861746f * h0_58
+        + 0.0408227183f * h0_59 + 0.127181962f * h0_60 + 0.208842814f * h0_61 + 0.0670748278f * h0_62
+        + 0.16774933f * h0_63);
+    float h1_52 = max(0.0f, 0.0940152034f - 0.0935068429f * h0_0 + 0.00463638129f * h0_1 + 0.0895128995f * h0_2
+        + 0.0865443647f * h0_3 + 0.0386872478f * h0_4 - 0.00940576289f * h0_5 - 0.101128429f * h0_6
+        + 0.0903406441f * h0_7 - 0.0700119585f * h0_8 + 0.088781327f * h0_9 - 0.00898043159f * h0_10
+        - 0.0860466212f * h0_11 - 0.0748692825f * h0_12 + 0.0678330958f * h0_13 - 0.0501696803f * h0_14
+        - 0.0697603375f * h0_15 + 0.0660613179f * h0_16 - 0.0789647102f * h0_17 + 0.0152692301f * h0_18
+        - 0.0336481184f * h0_19 - 0.121117614f * h0_20 - 0.00966849923f * h0_21 + 0.0379585028f * h0_22
+        - 0.073174879f * h0_23 - 0.107243732f * h0_24 + 0.0931154937f * h0_25 + 0.099262476f * h0_26
+        + 0.0167681109f * h0_27 + 0.102927804f * h0_28 - 0.0503153577f * h0_29 - 0.0610281751f * h0_30
+        - 0.112899765f * h0_31 + 0.00798740983f * h0_32 - 0.0545270294f * h0_33 + 0.0171330422f * h0_34
+        + 0.0230334401f * h0_35 + 0.0510882959f * h0_36 - 0.0958443731f * h0_37 + 0.0175761431f * h0_38
+        - 0.104532875f * h0_39 + 0.0137098031f * h0_40 - 0.0439434834f * h0_41 - 0.0609035194f * h0_42
+        + 0.101161733f * h0_43 - 0.118173398f * h0_44 + 0.121016994f * h0_45 - 0.0514513999f * h0_46
+        + 0.072080195f * h0_47 + 0.0464020111f * h0_48 + 0.105034903f * h0_49 - 0.01498878f * h0_50
+        - 0.0440291017f * h0_51 + 0.0252518971f * h0_52 - 0.0449986793f * h0_53 + 0.048494298f * h0_54
+        + 0.0735888183f * h0_55 - 0.0793670788f * h0_56 + 0.0426621884f * h0_57 - 0.0610396117f * h0_58
+        + 0.0643353537f * h0_59 - 0.064135246f * h0_60 + 0.0625661537f * h0_61 - 0.00944170263f * h0_62
+        + 0.105002224f * h0_63);
+    float h1_53 = max(0.0f, 0.0513452552f - 0.0313018076f * h0_0 + 0.109888129f * h0_1 + 0.107611768f * h0_2
+        + 0.0445008054f * h0_3 - 0.158923984f * h0_4 + 0.083531186f * h0_5 + 0.0485074446f * h0_6
+        + 0.154110298f * h0_7 + 0.243385747f * h0_8 - 0.12094406f * h0_9 - 0.0652914792f * h0_10
+        + 0.104307182f * h0_11 - 0.0730837807f * h0_12 - 0.022745505f * h0_13 + 0.106571935f * h0_14
+        + 0.159552217f * h0_15 + 0.0523530133f * h0_16 + 0.0460774377f * h0_17 + 0.0221794136f * h0_18
+        - 0.158666104f * h0_19 - 0.0475673862f * h0_20 - 0.0430378318f * h0_21 + 0.355430841f * h0_22
+        + 0.099233225f * h0_23 + 0.125675246f * h0_24 + 0.0450895131f * h0_25 - 0.0395907387f * h0_26
+        - 0.301630884f * h0_27 - 0.059464328f * h0_28 - 0.0460267477f * h0_29 - 0.057484962f * h0_30
+        + 0.0683380142f * h0_31 + 0.0284345709f * h0_32 + 0.0398305282f * h0_33 + 0.0249720626f * h0_34
+        - 0.166344702f * h0_35 + 0.0556721538f * h0_36 - 0.0891876295f * h0_37 - 0.0439524762f * h0_38
+        - 0.0106457602f * h0_39 - 0.139759481f * h0_40 + 0.0349678211f * h0_41 + 0.202060401f * h0_42
+        - 0.0834171996f * h0_43 + 0.228189826f * h0_44 + 0.125697359f * h0_45 - 0.0939263403f * h0_46
+        + 0.0501224026f * h0_47 + 0.221871302f * h0_48 - 0.0972493514f * h0_49 + 0.114572018f * h0_50
+        + 0.022223711f * h0_51 + 0.0154073443f * h0_52 + 0.227239564f * h0_53 + 0.088280946f * h0_54
+        + 0.0852338523f * h0_55 + 0.0133830039f * h0_56 + 0.123671055f * h0_57 + 0.167208731f * h0_58
+        - 0.0201197937f * h0_59 + 0.242562026f * h0_60 - 0.145831645f * h0_61 + 0.00518645393f * h0_62
+        + 0.249384597f * h0_63);
+    float h1_54 = max(0.0f, 0.0410125777f - 0.0869118348f * h0_0 - 1.18482995f * h0_1 + 0.268580228f * h0_2
+        - 0.0930538699f * h0_3 + 0.177051842f * h0_4 + 0.70772326f * h0_5 + 0.0944012776f * h0_6
+        + 0.268756092f * h0_7 - 0.16802007f * h0_8 + 0.351873755f * h0_9 + 0.265506744f * h0_10
+        - 0.26715672f * h0_11 - 0.475902855f * h0_12 - 0.0650289208f * h0_13 + 0.334300041f * h0_14
+        + 0.105439834f * h0_15 + 0.096139662f * h0_16 + 0.159376591f * h0_17 - 0.151001662f * h0_18
+        + 0.0056842179f * h0_19 + 0.0804525539f * h0_20 - 0.0128888637f * h0_21 + 0.149315253f * h0_22
+        - 0.118946508f * h0_23 - 0.340133369f * h0_24 + 0.0825947374f * h0_25 - 0.19463104f * h0_26
+        + 0.218239546f * h0_27 - 0.0792430937f * h0_28 + 0.0320559442f * h0_29 + 0.0523380563f * h0_30
+        - 0.0277956873f * h0_31 + 0.124157682f * h0_32 + 0.000630667957f * h0_33 + 0.0719357431f * h0_34
+        - 0.449122369f * h0_35 - 0.127827585f * h0_36 + 0.310394496f * h0_37 - 0.0130089726f * h0_38
+        - 0.0132375844f * h0_39 - 0.321623325f * h0_40 - 0.0321057476f * h0_41 - 0.00597997988f * h0_42
+        + 0.40237239f * h0_43 + 0.298661709f * h0_44 + 0.0655939654f * h0_45 - 0.0693610162f * h0_46
+        - 0.471845388f * h0_47 - 0.618003666f * h0_48 - 0.437876135f * h0_49 + 0.106085345f * h0_50
+        + 0.0679530203f * h0_51 - 0.491299361f * h0_52 + 0.138659328f * h0_53 + 0.291242123f * h0_54
+        - 0.0429883935f * h0_55 - 0.204581618f * h0_56 - 0.0878426433f * h0_57 + 0.25456512f * h0_58
+        + 0.156534046f * h0_59 + 0.206505477f * h0_60 - 0.208852038f * h0_61 - 0.111029021f * h0_62
+        - 0.444007486f * h0_63);
+    float h1_55 = max(0.0f, 0.117421448f - 0.0600644127f * h0_0 - 0.064083986f * h0_1 + 0.382107049f * h0_2
+        - 0.0779750049f * h0_3 - 0.0607227497f * h0_4 - 0.00290016225f * h0_5 + 0.0214659814f * h0_6
+        - 0.119723514f * h0_7 + 0.023285998f * h0_8 - 0.0902890116f * h0_9 - 0.243830711f * h0_10
+        + 0.0462516472f * h0_11 + 0.239324704f * h0_12 - 0.0598656833f * h0_13 - 0.369910866f * h0_14
+        + 0.260835707f * h0_15 - 0.252971619f * h0_16 + 0.0972702876f * h0_17 + 0.038156312f * h0_18
+        - 0.0496182702f * h0_19 - 0.0160357133f * h0_20 - 0.103853062f * h0_21 + 0.286454856f * h0_22
+        + 0.0734903961f * h0_23 + 0.0322984122f * h0_24 - 0.0257693231f * h0_25 - 0.0533409566f * h0_26
+        + 0.350682288f * h0_27 + 0.156107828f * h0_28 + 0.0742472783f * h0_29 - 0.013624277f * h0_30
+        - 0.123223007f * h0_31 + 0.042064812f * h0_32 + 0.0628151298f * h0_33 - 0.0663339645f * h0_34
+        + 0.00102479733f * h0_35 + 0.160633236f * h0_36 - 0.0779755861f * h0_37 + 0.0106076356f * h0_38
+        - 0.194833562f * h0_39 + 0.14473033f * h0_40 + 0.0939664617f * h0_41 + 0.268211007f * h0_42
+        + 0.082010366f * h0_43 + 0.164582267f * h0_44 - 0.0692604855f * h0_45 - 0.0537126809f * h0_46
+        + 0.34020716f * h0_47 + 0.0901640281f * h0_48 - 0.170877621f * h0_49 + 0.0655120611f * h0_50
+        + 0.108777359f * h0_51 + 0.170427009f * h0_52 + 0.0313547775f * h0_53 - 0.160092071f * h0_54
+        - 0.506420255f * h0_55 - 0.182578459f * h0_56 - 0.0403213948f * h0_57 + 0.0231931303f * h0_58
+        + 0.226958796f * h0_59 + 0.0858891755f * h0_60 + 0.184373081f * h0_61 + 0.083486408f * h0_62
+        - 0.0338570662f * h0_63);
+    float h1_56 = max(0.0f, 0.130071133f + 0.0889946744f * h0_0 - 0.348515779f * h0_1 + 0.0176355168f * h0_2
+        + 0.0930636302f * h0_3 - 0.101060219f * h0_4 + 0.316501707f * h0_5 - 0.0279682502f * h0_6
+        - 0.0380688459f * h0_7 - 0.0491126701f * h0_8 + 0.0961555541f * h0_9 - 0.338582933f * h0_10
+        + 0.0997454077f * h0_11 + 0.112797894f * h0_12 - 0.0379110724f * h0_13 - 0.229351074f * h0_14
+        + 0.10144107f * h0_15 - 0.00783326849f * h0_16 - 0.0415013656f * h0_17 + 0.176298231f * h0_18
+        - 0.0546894893f * h0_19 - 0.04439101f * h0_20 - 0.00102216005f * h0_21 + 0.063926287f * h0_22
+        + 0.1581586f * h0_23 + 0.0610927977f * h0_24 - 0.0585449487f * h0_25 - 0.24958539f * h0_26
+        - 0.304864943f * h0_27 - 0.46514684f * h0_28 + 0.135300934f * h0_29 + 0.180541039f * h0_30
+        + 0.00206175866f * h0_31 + 0.114992388f * h0_32 + 0.00285941362f * h0_33 + 0.0863688663f * h0_34
+        + 0.0224284958f * h0_35 + 0.0216469727f * h0_36 + 0.0546168126f * h0_37 - 0.113911599f * h0_38
+        + 0.167512164f * h0_39 + 0.368088186f * h0_40 + 0.0982702971f * h0_41 + 0.00896003656f * h0_42
+        + 0.339863986f * h0_43 + 0.133745342f * h0_44 + 0.0950662941f * h0_45 + 0.114018351f * h0_46
+        - 0.0881375074f * h0_47 - 0.171596676f * h0_48 - 0.186277911f * h0_49 + 0.0269311666f * h0_50
+        + 0.0942837149f * h0_51 + 0.00959633011f * h0_52 + 0.17846939f * h0_53 - 0.114227727f * h0_54
+        - 0.452041715f * h0_55 + 0.0290697031f * h0_56 + 0.0814466178f * h0_57 - 0.135888875f * h0_58
+        - 0.0138284778f * h0_59 + 0.41920197f * h0_60 + 0.178632587f * h0_61 - 0.0172919147f * h0_62
+        - 0.137754679f * h0_63);
+    float h1_57 = max(0.0f, -0.0889889076f + 0.188402936f * h0_0 - 0.0268980488f * h0_1 + 0.031203026f * h0_2
+        + 0.0189859774f * h0_3 - 0.00368160871f * h0_4 + 0.0762620345f * h0_5 + 0.24594295f * h0_6
+        + 0.0795263499f * h0_7 - 0.0428663865f * h0_8 - 0.0767415985f * h0_9 + 0.27180776f * h0_10
+        - 0.106851421f * h0_11 - 0.400797814f * h0_12 + 0.0252785385f * h0_13 + 0.0139881959f * h0_14
+        + 0.0237001833f * h0_15 + 0.147755295f * h0_16 + 0.141062394f * h0_17 - 0.00282338378f * h0_18
+        + 0.215480372f * h0_19 + 0.0100598559f * h0_20 + 0.0585394651f * h0_21 + 0.021987386f * h0_22
+        + 0.0476810187f * h0_23 - 0.279342383f * h0_24 + 0.0525698364f * h0_25 + 0.169551015f * h0_26
+        + 0.24392204f * h0_27 + 0.0870476738f * h0_28 + 0.0152808754f * h0_29 + 0.136146262f * h0_30
+        - 0.0567363463f * h0_31 + 0.0410020873f * h0_32 + 0.136167109f * h0_33 + 0.0365314223f * h0_34
+        + 0.118262194f * h0_35 + 0.0844708458f * h0_36 + 0.242579669f * h0_37 + 0.0826114416f * h0_38
+        + 0.089419432f * h0_39 - 0.33369565f * h0_40 + 0.0801912397f * h0_41 - 0.0812267885f * h0_42
+        + 0.000669043395f * h0_43 + 0.143082142f * h0_44 + 0.0660607144f * h0_45 + 0.0203331709f * h0_46
+        + 0.218501657f * h0_47 + 0.0985528007f * h0_48 + 0.180577815f * h0_49 + 0.0966180414f * h0_50
+        + 0.0543344021f * h0_51 - 0.19957079f * h0_52 + 0.0197181907f * h0_53 + 0.287461668f * h0_54
+        + 0.381348461f * h0_55 - 0.0133418841f * h0_56 - 0.0579374135f * h0_57 + 0.173161894f * h0_58
+        - 0.325299978f * h0_59 + 0.0881705657f * h0_60 - 0.0863561109f * h0_61 - 0.0666020662f * h0_62
+        + 0.0271176007f * h0_63);
+    float h1_58 = max(0.0f, -0.018052021f + 0.0575175062f * h0_0 + 0.116051912f * h0_1 - 0.244993895f * h0_2
+        + 0.0611041859f * h0_3 - 0.0797140226f * h0_4 - 0.108276255f * h0_5 - 0.0415095575f * h0_6
+        - 0.16552034f * h0_7 + 0.0699500367f * h0_8 + 0.0489709564f * h0_9 + 0.104998074f * h0_10
+        + 0.111021683f * h0_11 + 0.016126398f * h0_12 + 0.00953692198f * h0_13 - 0.108924322f * h0_14
+        - 0.0800385848f * h0_15 + 0.166276872f * h0_16 + 0.090891026f * h0_17 - 0.0746354759f * h0_18
+        + 0.0352204554f * h0_19 - 0.100772195f * h0_20 + 0.0262223482f * h0_21 - 0.332054555f * h0_22
+        - 0.10108725f * h0_23 + 0.00707601802f * h0_24 - 0.109397873f * h0_25 - 0.120945469f * h0_26
+        - 0.179005057f * h0_27 + 0.237812668f * h0_28 - 0.137245297f * h0_29 + 0.138790235f * h0_30
+        - 0.111344405f * h0_31 + 0.00025288522f * h0_32 + 0.146506935f * h0_33 - 0.010277234f * h0_34
+        + 0.257328898f * h0_35 + 0.151359424f * h0_36 - 0.0307754539f * h0_37 + 0.093534559f * h0_38
+        + 0.274430394f * h0_39 + 0.429612964f * h0_40 + 0.104178227f * h0_41 - 0.0974920094f * h0_42
+        + 0.108989783f * h0_43 - 0.0662538707f * h0_44 - 0.0730357245f * h0_45 - 0.0925098658f * h0_46
+        + 0.0088742841f * h0_47 + 0.0657992959f * h0_48 + 0.295349658f * h0_49 + 0.0888881832f * h0_50
+        + 0.0347423255f * h0_51 + 0.26477623f * h0_52 + 0.212970138f * h0_53 + 0.00200901902f * h0_54
+        + 0.39309606f * h0_55 + 0.134325489f * h0_56 + 0.07354635f * h0_57 - 0.172343925f * h0_58
+        - 0.0424001366f * h0_59 - 0.0375822932f * h0_60 + 0.301442027f * h0_61 - 0.00385148148f * h0_62
+        + 0.171482027f * h0_63);
+    float h1_59 = max(0.0f, -0.0314547122f + 0.108827055f * h0_0 - 0.0997996479f * h0_1 - 0.0514384955f * h0_2
+        - 0.107438251f * h0_3 - 0.0159983188f * h0_4 + 0.0754845887f * h0_5 - 0.104787156f * h0_6
+        + 0.121452376f * h0_7 - 0.0330056399f * h0_8 - 0.0430982709f * h0_9 - 0.0238682479f * h0_10
+        - 0.0263377428f * h0_11 - 0.0920457393f * h0_12 - 0.105959505f * h0_13 + 0.0244647861f * h0_14
+        + 0.014610365f * h0_15 + 0.03706792f * h0_16 - 0.0140733868f * h0_17 - 0.115139216f * h0_18
+        - 0.0586619228f * h0_19 - 0.0287031978f * h0_20 - 0.0335914493f * h0_21 + 0.0778217912f * h0_22
+        - 0.111501276f * h0_23 + 0.094943732f * h0_24 - 0.0918343663f * h0_25 - 0.0584346801f * h0_26
+        - 0.10246554f * h0_27 + 0.0288107991f * h0_28 + 0.010608539f * h0_29 - 0.00841300189f * h0_30
+        + 0.0568858236f * h0_31 + 0.0770468861f * h0_32 - 0.0170948803f * h0_33 - 0.0659052581f * h0_34
+        - 0.0241916478f * h0_35 - 0.0226814896f * h0_36 + 0.0260609984f * h0_37 + 0.000780209899f * h0_38
+        + 0.0152510703f * h0_39 + 0.0565753132f * h0_40 - 0.0208496004f * h0_41 - 0.00890831649f * h0_42
+        - 0.105524421f * h0_43 + 0.0257292241f * h0_44 - 0.111146718f * h0_45 - 0.0252296776f * h0_46
+        + 0.0243620425f * h0_47 + 0.0847535431f * h0_48 + 0.102207243f * h0_49 + 0.0647602528f * h0_50
+        + 0.0431871563f * h0_51 + 0.0143780857f * h0_52 - 0.0879148841f * h0_53 + 0.0219053626f * h0_54
+        - 0.0592881143f * h0_55 + 0.0870525241f * h0_56 - 0.122470841f * h0_57 + 0.117171273f * h0_58
+        - 0.0607380569f * h0_59 - 0.0687897056f * h0_60 - 0.110732839f * h0_61 - 0.0735805184f * h0_62
+        + 0.120899588f * h0_63);
+    float h1_60 = max(0.0f, -0.103932887f + 0.0678482652f * h0_0 + 0.123549178f * h0_1 + 0.0276601762f * h0_2
+        + 0.0648987591f * h0_3 + 0.0741529465f * h0_4 - 0.0174697191f * h0_5 + 0.116898f * h0_6
+        - 0.0735777915f * h0_7 - 0.0700962842f * h0_8 + 0.0246447176f * h0_9 - 0.102866679f * h0_10
+        - 0.109936014f * h0_11 - 0.0332264304f * h0_12 + 0.0909254104f * h0_13 + 0.053299576f * h0_14
+        + 0.0991590619f * h0_15 - 0.0250092894f * h0_16 - 0.0567747951f * h0_17 - 0.0184423029f * h0_18
+        + 0.018240869f * h0_19 - 0.0311233699f * h0_20 + 0.108721033f * h0_21 - 0.00326173007f * h0_22
+        - 0.0720598996f * h0_23 + 0.11864616f * h0_24 + 0.0679959059f * h0_25 - 0.106157824f * h0_26
+        + 0.0428639352f * h0_27 - 0.0487074107f * h0_28 - 0.0896673501f * h0_29 + 0.00246681273f * h0_30
+        + 0.0232914388f * h0_31 - 0.0788672864f * h0_32 - 0.0263589919f * h0_33 + 0.0801722556f * h0_34
+        + 0.106773466f * h0_35 - 0.0513157099f * h0_36 - 0.0563824773f * h0_37 - 0.107103527f * h0_38
+        + 0.0201788098f * h0_39 - 0.060871616f * h0_40 + 0.0645445287f * h0_41 + 0.0967847556f * h0_42
+        + 0.00189632177f * h0_43 - 0.117423326f * h0_44 + 0.107327253f * h0_45 - 0.00580558181f * h0_46
+        - 0.122565567f * h0_47 - 0.0912250578f * h0_48 + 0.0407190919f * h0_49 + 0.012867704f * h0_50
+        - 0.114589363f * h0_51 + 0.0111245215f * h0_52 + 0.0759933442f * h0_53 - 0.0200436264f * h0_54
+        - 0.0895748436f * h0_55 - 0.0245690346f * h0_56 + 0.0463710874f * h0_57 + 0.0176089406f * h0_58
+        - 0.073095575f * h0_59 + 0.0230280012f * h0_60 + 0.0565548688f * h0_61 - 0.0847593695f * h0_62
+        - 0.0453556925f * h0_63);
+    float h1_61 = max(0.0f, 0.00265064626f - 0.0998586789f * h0_0 - 0.113768823f * h0_1 - 0.0999524966f * h0_2
+        + 0.123519614f * h0_3 + 0.179196253f * h0_4 + 0.205714911f * h0_5 + 0.0134069473f * h0_6
+        + 0.224214599f * h0_7 - 0.029626511f * h0_8 + 0.340012819f * h0_9 + 0.275649756f * h0_10
+        - 0.320212543f * h0_11 + 0.0515420996f * h0_12 - 0.0910006464f * h0_13 + 0.324839085f * h0_14
+        - 0.185301945f * h0_15 - 0.0522445813f * h0_16 + 0.105264127f * h0_17 + 0.0477555059f * h0_18
+        + 0.0574378408f * h0_19 + 0.0612892024f * h0_20 - 0.0600930601f * h0_21 - 0.00265197572f * h0_22
+        + 0.0198251531f * h0_23 + 0.169030607f * h0_24 + 0.0733871609f * h0_25 + 0.0631246045f * h0_26
+        - 0.144681305f * h0_27 - 0.251109481f * h0_28 + 0.141276494f * h0_29 + 0.157498166f * h0_30
+        + 0.0451451577f * h0_31 - 0.113917001f * h0_32 + 0.0713322461f * h0_33 + 0.0200743377f * h0_34
+        - 0.0317469463f * h0_35 - 0.181020141f * h0_36 + 0.0469762199f * h0_37 - 0.0471209548f * h0_38
+        - 0.0425335616f * h0_39 + 0.315697759f * h0_40 + 0.108778663f * h0_41 - 0.0748457089f * h0_42
+        + 0.19755356f * h0_43 + 0.06273029f * h0_44 - 0.0890057907f * h0_45 - 0.0912246108f * h0_46
+        - 0.189415798f * h0_47 - 0.299601823f * h0_48 - 0.147362158f * h0_49 + 0.108173445f * h0_50
+        + 0.0411505252f * h0_51 - 0.213603005f * h0_52 + 0.0202536043f * h0_53 + 0.0698838905f * h0_54
+        - 0.0170738697f * h0_55 - 0.121056825f * h0_56 + 0.0703419298f * h0_57 - 0.157753527f * h0_58
+        + 0.152928218f * h0_59 - 0.0223635491f * h0_60 - 0.0565086156f * h0_61 + 0.0619137064f * h0_62
+        - 0.409649909f * h0_63);
+    float h1_62 = max(0.0f, -0.00957000349f + 0.145621374f * h0_0 - 0.151918441f * h0_1 - 0.210425198f * h0_2
+        + 0.00879600458f * h0_3 + 0.0543815754f * h0_4 - 0.0319635458f * h0_5 - 0.243221417f * h0_6
+        - 0.0835371539f * h0_7 + 0.0940129831f * h0_8 - 0.330760747f * h0_9 - 0.455079198f * h0_10
+        + 0.0746698976f * h0_11 + 0.222138301f * h0_12 - 0.0976225734f * h0_13 - 0.217448175f * h0_14
+        + 0.766686857f * h0_15 - 0.0507238843f * h0_16 + 0.0945467427f * h0_17 + 0.08119075f * h0_18
+        + 0.143290028f * h0_19 + 0.0227819476f * h0_20 - 0.0482533723f * h0_21 - 0.406447351f * h0_22
+        - 0.052349627f * h0_23 - 0.0659033954f * h0_24 - 0.0146552771f * h0_25 + 0.0338939056f * h0_26
+        - 0.5027619f * h0_27 - 0.8871696f * h0_28 + 0.0165216923f * h0_29 + 0.0610066578f * h0_30
+        + 0.0739690438f * h0_31 + 0.11854317f * h0_32 + 0.0779123679f * h0_33 - 0.0363989174f * h0_34
+        + 0.294459611f * h0_35 + 0.148307189f * h0_36 - 0.181520328f * h0_37 + 0.0354168676f * h0_38
+        + 0.21587801f * h0_39 + 0.139036223f * h0_40 + 0.159795091f * h0_41 + 0.0164167508f * h0_42
+        + 0.318356007f * h0_43 - 0.0784309432f * h0_44 - 0.144189388f * h0_45 + 0.123041481f * h0_46
+        - 0.0304130763f * h0_47 - 0.135938466f * h0_48 + 0.0903685391f * h0_49 - 0.0195417851f * h0_50
+        - 0.0483662486f * h0_51 + 0.196274921f * h0_52 + 0.125032485f * h0_53 - 0.239722028f * h0_54
+        - 0.0956061333f * h0_55 - 0.109233029f * h0_56 + 0.00911341608f * h0_57 - 0.235986248f * h0_58
+        - 0.20117189f * h0_59 + 0.535846293f * h0_60 + 0.201840669f * h0_61 + 0.0883769244f * h0_62
+        - 0.134084746f * h0_63);
+    float h1_63 = max(0.0f, 0.0573938489f - 0.0932063013f * h0_0 + 0.090355739f * h0_1 + 0.319695473f * h0_2
+        + 0.0166209061f * h0_3 - 0.0644456893f * h0_4 + 0.0683627501f * h0_5 + 0.0357145183f * h0_6
+        - 0.131448045f * h0_7 + 0.121109471f * h0_8 + 0.23274608f * h0_9 - 0.00414766558f * h0_10
+        + 0.0945027247f * h0_11 + 0.166517183f * h0_12 + 0.0246435106f * h0_13 - 0.265842021f * h0_14
+        - 0.0640696064f * h0_15 - 0.435740799f * h0_16 + 0.184316188f * h0_17 + 0.0508371405f * h0_18
+        - 0.148368225f * h0_19 + 0.172297716f * h0_20 + 0.0272390842f * h0_21 + 0.356126875f * h0_22
+        + 0.153744951f * h0_23 + 0.244493186f * h0_24 + 0.0760117173f * h0_25 + 0.0473382622f * h0_26
+        + 0.0804813504f * h0_27 + 0.186688676f * h0_28 + 0.0418349989f * h0_29 - 0.0515120178f * h0_30
+        - 0.100799955f * h0_31 + 0.0173392314f * h0_32 + 0.0347125605f * h0_33 + 0.0367501825f * h0_34
+        - 0.266534626f * h0_35 + 0.0263166763f * h0_36 - 0.0845493674f * h0_37 - 0.0150933629f * h0_38
+        - 0.332838207f * h0_39 + 0.220222443f * h0_40 + 0.114575267f * h0_41 + 0.178026557f * h0_42
+        - 0.0965621769f * h0_43 + 0.202954367f * h0_44 + 0.156726941f * h0_45 + 0.0164576173f * h0_46
+        + 0.0964185297f * h0_47 + 0.0290034171f * h0_48 - 0.17348434f * h0_49 - 0.0691645443f * h0_50
+        - 0.0263733715f * h0_51 + 0.118615784f * h0_52 + 0.0108953137f * h0_53 - 0.147436291f * h0_54
+        - 0.438757122f * h0_55 - 0.00106384372f * h0_56 - 0.0899157077f * h0_57 + 0.145484239f * h0_58
+        + 0.250108361f * h0_59 + 0.0309303254f * h0_60 - 0.122869208f * h0_61 + 0.0758362934f * h0_62
+        - 0.120495588f * h0_63);
+
+    NNOutputs nnOutputs;
+    nnOutputs.outputs[0] = 1.0f / (1.0f + exp(-(0.0324014686f + 0.202905416f * h1_0 + 0.201800242f * h1_1 + 0.0156101659f * h1_2
+        - 0.340999067f * h1_3 - 0.0982504636f * h1_4 - 0.0755511001f * h1_5 - 0.146352008f * h1_6
+        + 0.215507418f * h1_7 - 0.0166803822f * h1_8 + 0.381168038f * h1_9 - 0.0811829641f * h1_10
+        - 0.201313555f * h1_11 - 0.021946393f * h1_12 - 0.0550157689f * h1_13 + 0.0137656629f * h1_14
+        - 0.185789287f * h1_15 - 0.987322748f * h1_16 - 0.13168551f * h1_17 + 0.0996215791f * h1_18
+        - 0.0136409104f * h1_19 + 0.00648759818f * h1_20 - 0.134944022f * h1_21 + 0.176706851f * h1_22
+        + 0.269798398f * h1_23 - 0.134143114f * h1_24 + 0.0824059248f * h1_25 + 0.11813587f * h1_26
+        + 0.145282716f * h1_27 + 0.0269359984f * h1_28 + 0.0448302068f * h1_29 + 0.123867713f * h1_30
+        - 0.000788633595f * h1_31 - 0.166904077f * h1_32 - 0.0363667943f * h1_33 + 0.0654130951f * h1_34
+        - 0.189431533f * h1_35 - 0.0217670128f * h1_36 + 0.0106621925f * h1_37 + 0.330078751f * h1_38
+        + 0.0404969715f * h1_39 - 0.105760679f * h1_40 - 0.0400264598f * h1_41 - 0.20332928f * h1_42
+        + 0.204457253f * h1_43 - 0.0656279698f * h1_44 + 0.264258444f * h1_45 - 0.0284120552f * h1_46
+        - 0.0402396955f * h1_47 + 0.0245479513f * h1_48 + 0.0872026235f * h1_49 + 0.302453995f * h1_50
+        - 0.107786447f * h1_51 + 0.0651206672f * h1_52 - 0.153977469f * h1_53 + 0.0306559075f * h1_54
+        - 0.10646417f * h1_55 - 0.142169803f * h1_56 + 0.230897591f * h1_57 + 0.164178491f * h1_58
+        - 0.109255999f * h1_59 - 0.00194612145f * h1_60 - 0.152734339f * h1_61 - 0.0136827109f * h1_62
+        - 0.332598954f * h1_63)));
+    nnOutputs.outputs[1] = 1.0f / (1.0f + exp(-(0.0775154755f + 0.108309135f * h1_0 - 0.0627240837f * h1_1 - 0.317378968f * h1_2
+        - 0.0857592225f * h1_3 + 0.0328303762f * h1_4 + 0.0301028825f * h1_5 + 0.0174290054f * h1_6
+        - 0.080998458f * h1_7 - 0.0488041714f * h1_8 + 0.319686681f * h1_9 + 0.180149853f * h1_10
+        + 0.207005888f * h1_11 + 0.16931434f * h1_12 + 0.0909743309f * h1_13 - 0.0423727855f * h1_14
+        - 0.154020444f * h1_15 - 0.525704622f * h1_16 + 0.0806151256f * h1_17 - 0.231981322f * h1_18
+        + 0.209411189f * h1_19 - 0.0109319296f * h1_20 + 0.178338334f * h1_21 + 1.13212156f * h1_22
+        - 0.392136753f * h1_23 + 0.077396512f * h1_24 + 0.0301991105f * h1_25 + 0.0113095641f * h1_26
+        + 0.128697067f * h1_27 - 0.0298929382f * h1_28 + 0.117389143f * h1_29 - 0.0571065173f * h1_30
+        - 0.0086890664f * h1_31 + 0.107516341f * h1_32 + 0.0748753101f * h1_33 + 0.106663175f * h1_34
+        - 0.133804724f * h1_35 + 0.11274901f * h1_36 - 0.0909031332f * h1_37 + 0.0937591344f * h1_38
+        + 0.207511321f * h1_39 + 0.0553756356f * h1_40 - 0.352173507f * h1_41 - 0.0666429773f * h1_42
+        - 0.0487919599f * h1_43 - 0.0229519736f * h1_44 + 0.215125516f * h1_45 + 0.0954436213f * h1_46
+        + 0.0901478156f * h1_47 - 0.0138815558f * h1_48 + 0.0582525879f * h1_49 + 1.1695255f * h1_50
+        + 0.0564462952f * h1_51 - 0.0572404936f * h1_52 + 0.0350334905f * h1_53 - 0.000240077978f * h1_54
+        - 0.345875472f * h1_55 - 0.0902364478f * h1_56 - 0.021449117f * h1_57 + 0.230153739f * h1_58
+        + 0.0448698401f * h1_59 + 0.0520249307f * h1_60 + 0.21311821f * h1_61 - 0.0187106207f * h1_62
+        - 0.328362107f * h1_63)));
+    nnOutputs.outputs[2] = 1.0f / (1.0f + exp(-(0.0771368369f + 0.215592757f * h1_0 + 0.103184335f * h1_1 - 0.111787155f * h1_2
+        - 0.175638795f * h1_3 - 0.10848932f * h1_4 - 0.135841951f * h1_5 - 0.126774788f * h1_6
+        + 0.087979503f * h1_7 - 0.0201644562f * h1_8 + 0.318019718f * h1_9 + 0.0149524156f * h1_10
+        + 0.142403618f * h1_11 + 0.0625087023f * h1_12 + 0.130097508f * h1_13 - 0.0177642759f * h1_14
+        - 0.25069198f * h1_15 + 0.509984553f * h1_16 - 0.127455249f * h1_17 - 0.16792208f * h1_18
+        + 0.0446730405f * h1_19 - 0.0608220063f * h1_20 + 0.00166228297f * h1_21 - 1.23084688f * h1_22
+        - 0.380141199f * h1_23 - 0.0540669262f * h1_24 - 0.013904497f * h1_25 - 0.0969885439f * h1_26
+        + 0.147544175f * h1_27 + 0.0593569316f * h1_28 - 0.105491452f * h1_29 - 0.108385071f * h1_30
+        - 0.0387736782f * h1_31 - 0.101446569f * h1_32 + 0.0825651586f * h1_33 + 0.181424364f * h1_34
+        - 0.125709191f * h1_35 + 0.287449569f * h1_36 - 0.077831775f * h1_37 + 0.109880693f * h1_38
+        + 0.0381736793f * h1_39 - 0.0468005538f * h1_40 - 0.182044238f * h1_41 - 0.157896996f * h1_42
+        - 0.00940878037f * h1_43 + 0.165706813f * h1_44 + 0.170942903f * h1_45 - 0.0821571127f * h1_46
+        - 0.00327165611f * h1_47 - 0.0125313941f * h1_48 - 0.0247204006f * h1_49 + 1.19447732f * h1_50
+        + 0.0922780707f * h1_51 - 0.112746745f * h1_52 - 0.0169707052f * h1_53 - 0.0517747775f * h1_54
+        - 0.27273652f * h1_55 - 0.0179217681f * h1_56 + 0.195704997f * h1_57 + 0.22177738f * h1_58
+        - 0.121215701f * h1_59 - 0.123862207f * h1_60 + 0.0691865385f * h1_61 - 0.0253749043f * h1_62
+        - 0.286711931f * h1_63)));
+    nnOutputs.outputs[3] = 1.0f / (1.0f + exp(-(0.18919912f + 0.199255794f * h1_0 + 0.222292244f * h1_1 - 0.00887819007f * h1_2
+        - 0.0280824043f * h1_3 + 0.0649966374f * h1_4 + 0.209443077f * h1_5 - 0.040791709f * h1_6
+        + 0.127494365f * h1_7 + 0.0686583072f * h1_8 + 0.10035681f * h1_9 + 0.120545268f * h1_10
+        + 0.0336838625f * h1_11 + 0.150526315f * h1_12 + 0.148794934f * h1_13 + 0.0299281869f * h1_14
+        + 0.123371795f * h1_15 + 0.129952267f * h1_16 + 0.0861017853f * h1_17 + 0.188533753f * h1_18
+        + 0.00659733592f * h1_19 - 2.05407643f * h1_20 + 0.0209022835f * h1_21 - 0.396610051f * h1_22
+        + 0.13108854f * h1_23 + 0.00287755067f * h1_24 + 0.0659660548f * h1_25 + 0.049300909f * h1_26
+        + 0.151830494f * h1_27 - 0.0982037857f * h1_28 - 0.109679766f * h1_29 + 0.00819578115f * h1_30
+        - 1.76957226f * h1_31 - 0.0279342383f * h1_32 - 0.13705042f * h1_33 - 0.00215445156f * h1_34
+        + 0.209911034f * h1_35 - 0.0569475777f * h1_36 + 0.0166228022f * h1_37 + 0.19792822f * h1_38
+        + 0.0462536216f * h1_39 - 0.104212791f * h1_40 - 0.0491513796f * h1_41 + 0.0159030333f * h1_42
+        - 0.0265821163f * h1_43 + 0.146937042f * h1_44 + 0.124764442f * h1_45 + 0.0426750481f * h1_46
+        + 0.19453676f * h1_47 + 5.79184294f * h1_48 + 0.116231337f * h1_49 + 0.0733345598f * h1_50
+        + 0.150220022f * h1_51 - 0.0982156321f * h1_52 + 0.220638558f * h1_53 - 2.32588911f * h1_54
+        + 0.110066757f * h1_55 - 0.188852847f * h1_56 + 0.35564214f * h1_57 - 0.115154557f * h1_58
+        + 0.104529098f * h1_59 - 0.124433964f * h1_60 - 0.0610246547f * h1_61 + 0.772159398f * h1_62
+        + 0.116707794f * h1_63)));
+    nnOutputs.outputs[4] = 1.0f / (1.0f + exp(-(0.0312580541f + 0.163128614f * h1_0 + 0.182018757f * h1_1 + 0.14454551f * h1_2
+        + 0.00988901965f * h1_3 + 0.0734900013f * h1_4 - 0.263571262f * h1_5 + 0.0585455559f * h1_6
+        + 0.22745207f * h1_7 + 0.160647169f * h1_8 - 0.177862659f * h1_9 - 0.119366363f * h1_10
+        - 0.271313339f * h1_11 - 0.0278816149f * h1_12 + 0.068044588f * h1_13 + 0.0260786992f * h1_14
+        + 0.235843822f * h1_15 - 0.0111344894f * h1_16 + 0.0394969247f * h1_17 + 0.227269217f * h1_18
+        + 0.477627844f * h1_19 - 0.112114929f * h1_20 + 0.329248756f * h1_21 + 0.0491930358f * h1_22
+        - 0.520302415f * h1_23 - 0.0217525735f * h1_24 - 0.0777852535f * h1_25 + 0.0142909437f * h1_26
+        - 0.0844290927f * h1_27 - 0.0266570468f * h1_28 - 0.0341869779f * h1_29 + 0.00700282631f * h1_30
+        - 0.089446336f * h1_31 + 0.0243681278f * h1_32 - 0.0698596537f * h1_33 + 0.0360285975f * h1_34
+        - 0.0813900158f * h1_35 - 0.0753596351f * h1_36 - 0.238311917f * h1_37 + 0.327079266f * h1_38
+        + 0.115396224f * h1_39 - 0.0440850258f * h1_40 - 0.552175701f * h1_41 - 0.237364829f * h1_42
+        - 0.0721190125f * h1_43 + 0.0506961904f * h1_44 - 0.176231489f * h1_45 + 0.10190165f * h1_46
+        - 0.192343593f * h1_47 - 0.0479549132f * h1_48 - 0.117550611f * h1_49 + 0.0141289486f * h1_50
+        - 0.0915917009f * h1_51 - 0.102941349f * h1_52 - 0.0642615706f * h1_53 - 0.00980070885f * h1_54
+        - 0.030771682f * h1_55 - 0.0840690508f * h1_56 + 0.0686257482f * h1_57 - 0.33104071f * h1_58
+        + 0.0328862965f * h1_59 + 0.0172422379f * h1_60 + 0.455106348f * h1_61 - 0.201674312f * h1_62
+        + 0.0650398359f * h1_63)));
+    nnOutputs.outputs[5] = 1.0f / (1.0f + exp(-(-0.104932174f - 0.118798882f * h1_0 + 0.106803767f * h1_1 - 0.245535329f * h1_2
+        - 0.152160451f * h1_3 - 0.194252953f * h1_4 - 0.48196885f * h1_5 - 0.215564534f * h1_6
+        - 0.0430600531f * h1_7 - 0.0082496088f * h1_8 - 0.243714511f * h1_9 + 0.0822576433f * h1_10
+        + 0.59878546f * h1_11 + 0.0768012181f * h1_12 - 0.194584668f * h1_13 + 0.119839959f * h1_14
+        - 0.0983706787f * h1_15 - 0.0409764014f * h1_16 - 0.214774445f * h1_17 + 0.167641118f * h1_18
+        + 0.391183257f * h1_19 - 0.0366490483f * h1_20 + 0.193750888f * h1_21 + 0.0574198477f * h1_22
+        + 0.399693251f * h1_23 - 0.155505151f * h1_24 + 0.0612782985f * h1_25 - 0.0159953088f * h1_26
+        - 0.0511377379f * h1_27 - 0.0901544169f * h1_28 - 0.0901597962f * h1_29 + 0.0601910241f * h1_30
+        + 0.190860853f * h1_31 - 0.0616065189f * h1_32 + 0.0556398183f * h1_33 - 0.301326931f * h1_34
+        - 0.146106154f * h1_35 - 0.110469669f * h1_36 - 0.384713531f * h1_37 + 0.0369071327f * h1_38
+        + 0.0333898142f * h1_39 + 0.100084022f * h1_40 - 0.0771213695f * h1_41 + 0.49224171f * h1_42
+        + 0.146268189f * h1_43 + 0.0444098599f * h1_44 + 0.0924899131f * h1_45 + 0.0789579004f * h1_46
+        - 0.047101967f * h1_47 + 0.0102620404f * h1_48 + 0.066016525f * h1_49 - 0.0480134077f * h1_50
+        + 0.151502371f * h1_51 + 0.0381321795f * h1_52 + 0.0894125327f * h1_53 - 0.136307895f * h1_54
+        - 0.0441450253f * h1_55 + 0.202344537f * h1_56 + 0.0464129075f * h1_57 - 0.136134505f * h1_58
+        + 0.124448866f * h1_59 + 0.00125993788f * h1_60 + 0.313809842f * h1_61 - 0.189382195f * h1_62
+        + 0.106983379f * h1_63)));
+    nnOutputs.outputs[6] = 1.0f / (1.0f + exp(-(0.0798411444f + 0.173105836f * h1_0 + 0.106906556f * h1_1 - 0.112744994f * h1_2
+        - 0.215948522f * h1_3 + 0.131677106f * h1_4 + 0.249450102f * h1_5 - 0.348747075f * h1_6
+        + 0.249681309f * h1_7 + 0.146277085f * h1_8 - 0.285711318f * h1_9 + 0.18197538f * h1_10
+        - 0.0582939647f * h1_11 + 0.201372296f * h1_12 + 0.0758668557f * h1_13 + 0.0173440482f * h1_14
+        + 0.0329389237f * h1_15 + 0.0529220998f * h1_16 + 0.160656899f * h1_17 + 0.0263305418f * h1_18
+        - 0.391213953f * h1_19 - 0.0332540125f * h1_20 - 0.281210631f * h1_21 + 0.0904248133f * h1_22
+        - 0.112458773f * h1_23 + 0.100086264f * h1_24 + 0.0155778825f * h1_25 + 0.0196910203f * h1_26
+        + 0.0261534639f * h1_27 + 0.096527569f * h1_28 + 0.120563485f * h1_29 - 0.0539206974f * h1_30
+        - 0.0720678791f * h1_31 + 0.242133409f * h1_32 + 0.399913073f * h1_33 + 0.0847315267f * h1_34
+        - 0.168262884f * h1_35 - 0.0377158485f * h1_36 + 0.0595654137f * h1_37 - 0.129498422f * h1_38
+        + 0.194790408f * h1_39 - 0.0213879198f * h1_40 - 0.475603163f * h1_41 + 0.372581333f * h1_42
+        + 0.356007516f * h1_43 - 0.100592114f * h1_44 - 0.246739745f * h1_45 - 0.0105835842f * h1_46
+        + 0.121978931f * h1_47 + 3.44235802f * h1_48 + 0.0352861583f * h1_49 - 0.111018084f * h1_50
+        - 0.0208103023f * h1_51 + 0.0191220157f * h1_52 + 0.172611356f * h1_53 - 0.185643047f * h1_54
+        + 0.0814222395f * h1_55 + 0.447326213f * h1_56 - 0.0357655287f * h1_57 - 0.0765585229f * h1_58
+        - 0.0439752489f * h1_59 + 0.040963769f * h1_60 - 0.0609849617f * h1_61 + 1.03577816f * h1_62
+        - 0.206784025f * h1_63)));
+    nnOutputs.outputs[7] = 1.0f / (1.0f + exp(-(-0.0967585072f - 0.0263995845f * h1_0 - 0.0415998623f * h1_1 - 0.15233852f * h1_2
+        + 0.218684167f * h1_3 + 0.155071646f * h1_4 + 0.0774971172f * h1_5 - 0.151182801f * h1_6
+        - 0.0789937004f * h1_7 - 0.224007636f * h1_8 + 0.125446901f * h1_9 - 0.124859862f * h1_10
+        + 0.0526000224f * h1_11 + 0.214264184f * h1_12 + 0.0591512844f * h1_13 + 0.0225152187f * h1_14
+        - 0.067966558f * h1_15 - 0.190232366f * h1_16 + 0.122427128f * h1_17 + 0.0812364221f * h1_18
+        + 0.148732156f * h1_19 + 0.0201436058f * h1_20 + 0.371887118f * h1_21 + 0.060151808f * h1_22
+        + 0.0876800716f * h1_23 + 0.163867116f * h1_24 - 0.00106452405f * h1_25 - 0.0570122004f * h1_26
+        + 0.23655355f * h1_27 + 0.130506963f * h1_28 + 0.0470336154f * h1_29 + 0.118870325f * h1_30
+        - 0.00313346903f * h1_31 - 0.0951778516f * h1_32 - 0.157871187f * h1_33 + 0.268594712f * h1_34
+        + 0.161477417f * h1_35 - 0.192922071f * h1_36 - 0.15615283f * h1_37 - 0.131422281f * h1_38
+        + 0.369220465f * h1_39 + 0.0559782982f * h1_40 + 0.0754008219f * h1_41 + 0.0432912894f * h1_42
+        + 0.000366684602f * h1_43 + 0.0795115083f * h1_44 + 0.0821997225f * h1_45 - 0.103963487f * h1_46
+        + 0.0511162132f * h1_47 + 0.00321997539f * h1_48 + 0.115194961f * h1_49 - 0.0515312701f * h1_50
+        - 0.139855459f * h1_51 - 0.017883772f * h1_52 + 0.236758739f * h1_53 + 0.0255881138f * h1_54
+        - 0.0828659609f * h1_55 - 0.241546825f * h1_56 + 0.0608076043f * h1_57 - 0.194074154f * h1_58
+        + 0.0232229829f * h1_59 - 0.0301602334f * h1_60 - 0.287886828f * h1_61 + 0.0920997933f * h1_62
+        + 0.00750664342f * h1_63)));
+
+    return nnOutputs;
+}
+
+#include "../PixelShader.hlsl"
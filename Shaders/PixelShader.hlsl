@@ -46,12 +46,15 @@ float fast_sigmoid(float x)
 StructuredBuffer<float> nnWeights : register(t4);
 StructuredBuffer<float> nnBiases : register(t5);
 
+//baked decoders declare it with their forward() above this file
+#if !BAKED_NN
 struct NNOutputs
 {
     float outputs[8];
 };
+#endif
 
-#if !LIGHT_WEIGHT_NN
+#if !LIGHT_WEIGHT_NN && !BAKED_NN
 //layer 0 = 14, layer1 = 64, layer2 = 64, layer4 = 8
 NNOutputs forward(float input[14])
 {
@@ -124,7 +127,7 @@ NNOutputs forward(float input[14])
 }
 #endif
 
-#if LIGHT_WEIGHT_NN
+#if LIGHT_WEIGHT_NN && !BAKED_NN
 
 //#ifndef NODE_COUNT
 //#define NODE_COUNT 16
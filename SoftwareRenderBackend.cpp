@@ -0,0 +1,195 @@
+#include "SoftwareRenderBackend.h"
+#include "NeuralModel.h"
+#include "Profiler.h"
+#include <cstring>
+#include <iostream>
+
+SoftwareRenderBackend::SoftwareRenderBackend(uint32_t threadCount)
+	: renderer(threadCount)
+{
+}
+
+SoftwareRenderBackend::~SoftwareRenderBackend()
+{
+	for (const auto& texture : textures)
+	{
+		MemoryTracker::Get().Free(MemoryCategory::DecodedCache, texture.second.texture->GetByteSize(), texture.second.memoryOwner);
+	}
+	for (const auto& buffer : buffers)
+	{
+		MemoryTracker::Get().Free(buffer.second.category, buffer.second.data.size(), buffer.second.memoryOwner);
+	}
+}
+
+std::string SoftwareRenderBackend::GetName() const
+{
+	return "Software (" + std::to_string(renderer.GetThreadCount()) + " threads)";
+}
+
+BackendTexture SoftwareRenderBackend::CreateTexture(const std::string& path, const std::string&, std::string* error)
+{
+	PROFILE_ZONE("SoftwareRenderBackend::CreateTexture");
+
+	BackendTexture handle;
+	if (path.size() < 4 || path.compare(path.size() - 4, 4, ".dds") != 0)
+	{
+		if (error)
+		{
+			*error = "Only dds textures can be loaded on the cpu: " + path;
+		}
+		return handle;
+	}
+
+	auto texture = std::make_shared<SoftwareTexture>();
+	if (!texture->LoadDDS(path, error))
+	{
+		return handle;
+	}
+
+	handle.id = nextId++;
+	Texture& entry = textures[handle.id];
+	entry.texture = texture;
+	entry.memoryOwner = MemoryTracker::GetCurrentOwner();
+	MemoryTracker::Get().Allocate(MemoryCategory::DecodedCache, texture->GetByteSize(), entry.memoryOwner);
+	return handle;
+}
+
+BackendBuffer SoftwareRenderBackend::CreateBuffer(const void* data, size_t elementSize, size_t elementCount, MemoryCategory category, const std::string&)
+{
+	BackendBuffer handle;
+	handle.id = nextId++;
+
+	Buffer& buffer = buffers[handle.id];
+	buffer.data.resize(elementSize * elementCount);
+	if (!buffer.data.empty())
+	{
+		memcpy(buffer.data.data(), data, buffer.data.size());
+	}
+	buffer.category = category;
+	buffer.memoryOwner = MemoryTracker::GetCurrentOwner();
+	MemoryTracker::Get().Allocate(category, buffer.data.size(), buffer.memoryOwner);
+	return handle;
+}
+
+BackendDescriptorTable SoftwareRenderBackend::CreateDescriptorTable(const std::vector<BackendTexture>& tableTextures, const std::vector<BackendBuffer>& tableBuffers)
+{
+	BackendDescriptorTable handle;
+
+	//PSMain samples four textures, the decoder weights come with the model of the draw
+	if (tableTextures.size() != 4)
+	{
+		std::cout << "Software descriptor tables need 4 textures, got " << tableTextures.size() << std::endl;
+		return handle;
+	}
+
+	auto material = std::make_shared<SoftwareMaterial>();
+	for (size_t i = 0; i < 4; i++)
+	{
+		auto it = textures.find(tableTextures[i].id);
+		if (it == textures.end())
+		{
+			return handle;
+		}
+		material->textures[i] = it->second.texture;
+	}
+	for (BackendBuffer buffer : tableBuffers)
+	{
+		if (buffers.find(buffer.id) == buffers.end())
+		{
+			return handle;
+		}
+	}
+
+	handle.id = nextId++;
+	tables[handle.id] = material;
+	return handle;
+}
+
+void SoftwareRenderBackend::Destroy(BackendTexture texture)
+{
+	auto it = textures.find(texture.id);
+	if (it != textures.end())
+	{
+		//tables keep their own reference, only the tracked bytes go now
+		MemoryTracker::Get().Free(MemoryCategory::DecodedCache, it->second.texture->GetByteSize(), it->second.memoryOwner);
+		textures.erase(it);
+	}
+}
+
+void SoftwareRenderBackend::Destroy(BackendBuffer buffer)
+{
+	auto it = buffers.find(buffer.id);
+	if (it != buffers.end())
+	{
+		MemoryTracker::Get().Free(it->second.category, it->second.data.size(), it->second.memoryOwner);
+		buffers.erase(it);
+	}
+}
+
+void SoftwareRenderBackend::Destroy(BackendDescriptorTable table)
+{
+	tables.erase(table.id);
+}
+
+void SoftwareRenderBackend::SetResolution(uint32_t inWidth, uint32_t inHeight)
+{
+	width = inWidth;
+	height = inHeight;
+}
+
+void SoftwareRenderBackend::BeginFrame()
+{
+	frameStats = SoftwareRenderStats();
+
+	//cleared to white like the back buffer
+	imageWidth = width;
+	imageHeight = height;
+	image.assign((size_t)imageWidth * imageHeight * 4, 1.0f);
+}
+
+void SoftwareRenderBackend::Draw(const BackendDraw& draw)
+{
+	PROFILE_ZONE("SoftwareRenderBackend::Draw");
+
+	auto it = tables.find(draw.table.id);
+	if (it == tables.end() || image.empty())
+	{
+		return;
+	}
+
+	SoftwareMaterial& material = *it->second;
+	material.shader = draw.shader;
+	if (material.model != draw.model)
+	{
+		material.model = draw.model;
+		material.decoder = draw.model ? std::make_shared<NeuralDecoderCPU>(draw.model) : nullptr;
+	}
+
+	SoftwareRenderStats stats;
+	renderer.Render(material, draw.constants, imageWidth, imageHeight, image, &stats);
+
+	frameStats.sampleMs += stats.sampleMs;
+	frameStats.decodeMs += stats.decodeMs;
+	frameStats.shadeMs += stats.shadeMs;
+	frameStats.totalMs += stats.totalMs;
+	frameStats.threadCount = stats.threadCount;
+	frameStats.tileCount += stats.tileCount;
+}
+
+uint64_t SoftwareRenderBackend::EndFrame()
+{
+	lastStats = frameStats;
+	return ++fenceValue;
+}
+
+bool SoftwareRenderBackend::ReadFrame(std::vector<uint8_t>& outRGBA8, uint32_t& outWidth, uint32_t& outHeight)
+{
+	if (image.empty())
+	{
+		return false;
+	}
+	SoftwareRenderer::ToRGBA8(image, outRGBA8);
+	outWidth = imageWidth;
+	outHeight = imageHeight;
+	return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <map>
+#include "RenderBackend.h"
+#include "SoftwareRenderer.h"
+
+// Backend running the cpu reference of PSMain, for headless benchmarks and image regression tests.
+// Draws render right away into the frame image, so every frame has finished by the time it is submitted
+// and destroyed objects can go at once. Only dds textures can be loaded, buffers are kept as bytes and
+// neural draws decode with the model of the draw.
+class SoftwareRenderBackend : public RenderBackend
+{
+public:
+	//0 threads uses every hardware thread
+	explicit SoftwareRenderBackend(uint32_t threadCount = 0);
+	~SoftwareRenderBackend();
+
+	std::string GetName() const override;
+
+	BackendTexture CreateTexture(const std::string& path, const std::string& name, std::string* error = nullptr) override;
+	BackendBuffer CreateBuffer(const void* data, size_t elementSize, size_t elementCount, MemoryCategory category, const std::string& name) override;
+	BackendDescriptorTable CreateDescriptorTable(const std::vector<BackendTexture>& textures, const std::vector<BackendBuffer>& buffers) override;
+
+	void Destroy(BackendTexture texture) override;
+	void Destroy(BackendBuffer buffer) override;
+	void Destroy(BackendDescriptorTable table) override;
+
+	void SetResolution(uint32_t width, uint32_t height) override;
+
+	void BeginFrame() override;
+	void Draw(const BackendDraw& draw) override;
+	uint64_t EndFrame() override;
+
+	uint64_t GetCompletedFenceValue() override { return fenceValue; }
+	uint64_t GetLastSubmittedFenceValue() const override { return fenceValue; }
+	void WaitForFence(uint64_t) override {}
+
+	bool ReadFrame(std::vector<uint8_t>& outRGBA8, uint32_t& outWidth, uint32_t& outHeight) override;
+
+	double GetLastDecodeMs() const override { return lastStats.sampleMs + lastStats.decodeMs; }
+
+	//stage times of the draws of the last frame
+	const SoftwareRenderStats& GetLastRenderStats() const { return lastStats; }
+
+	SoftwareRenderer& GetRenderer() { return renderer; }
+
+private:
+	struct Texture
+	{
+		std::shared_ptr<const SoftwareTexture> texture;
+		std::string memoryOwner;
+	};
+
+	struct Buffer
+	{
+		std::vector<uint8_t> data;
+		MemoryCategory category = MemoryCategory::StructuredBuffer;
+		std::string memoryOwner;
+	};
+
+
+	SoftwareRenderer renderer;
+	uint64_t fenceValue = 0;
+
+	uint32_t nextId = 1;
+	std::map<uint32_t, Texture> textures;
+	std::map<uint32_t, Buffer> buffers;
+	//a table is the material handed to the renderer, its decoder is rebuilt when a draw brings another model
+	std::map<uint32_t, std::shared_ptr<SoftwareMaterial>> tables;
+
+	uint32_t width = 0;
+	uint32_t height = 0;
+
+	//frame being rendered or the last one, sized when it began
+	std::vector<float> image;
+	uint32_t imageWidth = 0;
+	uint32_t imageHeight = 0;
+	SoftwareRenderStats frameStats;
+	SoftwareRenderStats lastStats;
+};
@@ -0,0 +1,555 @@
+#include "SoftwareRenderer.h"
+#include "DDSImage.h"
+#include "DecoderCompiler.h"
+#include "DeterministicDecode.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+bool SoftwareTexture::LoadDDS(const std::string& path, std::string* error)
+{
+	DDSImage image;
+	if (!image.Load(path, error))
+	{
+		return false;
+	}
+
+	if (!image.DecodeMip(0, texels))
+	{
+		if (error)
+		{
+			*error = std::string("Can't decode ") + DDSImage::GetFormatName(image.format) + ": " + path;
+		}
+		return false;
+	}
+
+	width = image.width;
+	height = image.height;
+	return true;
+}
+
+void SoftwareTexture::Sample(float u, float v, float outRGBA[4]) const
+{
+	//texel centers sit at half texel offsets
+	float x = u * width - 0.5f;
+	float y = v * height - 0.5f;
+	float x0 = std::floor(x);
+	float y0 = std::floor(y);
+	float fx = x - x0;
+	float fy = y - y0;
+
+	auto wrap = [](int64_t value, uint32_t size)
+		{
+			int64_t result = value % (int64_t)size;
+			return (uint32_t)(result < 0 ? result + size : result);
+		};
+
+	uint32_t ix0 = wrap((int64_t)x0, width);
+	uint32_t iy0 = wrap((int64_t)y0, height);
+	uint32_t ix1 = ix0 + 1 == width ? 0 : ix0 + 1;
+	uint32_t iy1 = iy0 + 1 == height ? 0 : iy0 + 1;
+
+	const float* t00 = &texels[((size_t)iy0 * width + ix0) * 4];
+	const float* t10 = &texels[((size_t)iy0 * width + ix1) * 4];
+	const float* t01 = &texels[((size_t)iy1 * width + ix0) * 4];
+	const float* t11 = &texels[((size_t)iy1 * width + ix1) * 4];
+
+	for (int c = 0; c < 4; c++)
+	{
+		float top = t00[c] + (t10[c] - t00[c]) * fx;
+		float bottom = t01[c] + (t11[c] - t01[c]) * fx;
+		outRGBA[c] = top + (bottom - top) * fy;
+	}
+}
+
+SoftwareMaterial::~SoftwareMaterial()
+{
+	MemoryTracker::Get().Free(MemoryCategory::DecodedCache, trackedBytes, memoryOwner);
+}
+
+SoftwareMaterialPtr SoftwareMaterial::Create(const MaterialDesc& desc, std::string* error)
+{
+	PROFILE_ZONE("SoftwareMaterial::Create");
+
+	auto fail = [&](const std::string& message) -> SoftwareMaterialPtr
+		{
+			if (error)
+			{
+				*error = message;
+			}
+			return nullptr;
+		};
+
+	if (desc.textures.size() != 4)
+	{
+		return fail("Material " + desc.name + " needs 4 textures");
+	}
+
+	auto material = std::make_shared<SoftwareMaterial>();
+	material->name = desc.name;
+	material->shader = desc.shader;
+	material->memoryOwner = desc.name;
+
+	for (size_t i = 0; i < desc.textures.size(); i++)
+	{
+		const std::string& path = desc.textures[i].path;
+		if (path.size() < 4 || path.compare(path.size() - 4, 4, ".dds") != 0)
+		{
+			return fail("Only dds textures can be loaded on the cpu: " + path);
+		}
+
+		std::string textureError;
+		auto texture = std::make_shared<SoftwareTexture>();
+		if (!texture->LoadDDS(path, &textureError))
+		{
+			return fail(textureError);
+		}
+		material->textures[i] = texture;
+	}
+
+	//tracked only once everything loaded, the destructor of a failed material gives nothing back
+	for (const auto& texture : material->textures)
+	{
+		material->trackedBytes += texture->GetByteSize();
+	}
+	MemoryTracker::Get().Allocate(MemoryCategory::DecodedCache, material->trackedBytes, material->memoryOwner);
+
+	if (desc.IsNeural())
+	{
+		MemoryTracker::OwnerScope ownerScope(desc.name);
+		try
+		{
+			material->model = NeuralModel::LoadModel(desc.modelPath);
+			material->decoder = std::make_shared<NeuralDecoderCPU>(material->model);
+		}
+		catch (const std::exception& exception)
+		{
+			return fail(std::string(exception.what()) + ": " + desc.modelPath);
+		}
+
+		//feature grids + uv in, albedo, normal, ao and roughness out
+		if (material->decoder->GetInputCount() != 14 || material->decoder->GetOutputCount() != 8)
+		{
+			return fail("Decoder must map 14 inputs to 8 outputs: " + desc.modelPath);
+		}
+	}
+
+	return material;
+}
+
+static void FromTextures(const float texel[4][4], MaterialSample& outSample)
+{
+	for (int c = 0; c < 3; c++)
+	{
+		outSample.albedo[c] = texel[0][c];
+		outSample.normal[c] = texel[1][c];
+	}
+	outSample.ao = texel[2][0];
+	outSample.roughness = texel[3][0];
+}
+
+static void FromDecoderOutput(const float* output, MaterialSample& outSample)
+{
+	//the network writes albedo and normal as bgr
+	outSample.albedo[0] = output[2];
+	outSample.albedo[1] = output[1];
+	outSample.albedo[2] = output[0];
+	outSample.normal[0] = output[5];
+	outSample.normal[1] = output[4];
+	outSample.normal[2] = output[3];
+	outSample.ao = output[6];
+	outSample.roughness = output[7];
+}
+
+//rgb of the 4 feature grids, then u and v
+static void GetDecoderInput(const std::shared_ptr<const SoftwareTexture> grids[4], float u, float v, float* outInput)
+{
+	for (int t = 0; t < 4; t++)
+	{
+		float texel[4];
+		grids[t]->Sample(u, v, texel);
+		outInput[t * 3 + 0] = texel[0];
+		outInput[t * 3 + 1] = texel[1];
+		outInput[t * 3 + 2] = texel[2];
+	}
+	outInput[12] = u;
+	outInput[13] = v;
+}
+
+void SoftwareMaterial::GetDecoderInputs(const float* uvs, size_t count, float* outInputs) const
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		GetDecoderInput(textures, uvs[i * 2 + 0], uvs[i * 2 + 1], &outInputs[i * 14]);
+	}
+}
+
+void SoftwareMaterial::GetMaterialInputs(const float* uvs, size_t count, MaterialSample* outSamples) const
+{
+	if (!decoder)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			float texel[4][4];
+			for (int t = 0; t < 4; t++)
+			{
+				textures[t]->Sample(uvs[i * 2 + 0], uvs[i * 2 + 1], texel[t]);
+			}
+			FromTextures(texel, outSamples[i]);
+		}
+		return;
+	}
+
+	std::vector<float> decoderInputs(count * decoder->GetInputCount());
+	std::vector<float> decoderOutputs(count * decoder->GetOutputCount());
+	GetDecoderInputs(uvs, count, decoderInputs.data());
+	decoder->Decode(decoderInputs.data(), decoderOutputs.data(), count);
+	for (size_t i = 0; i < count; i++)
+	{
+		FromDecoderOutput(&decoderOutputs[i * 8], outSamples[i]);
+	}
+}
+
+void BakeMaterial(const SoftwareMaterial& material, uint32_t size, ThreadPool& threadPool, bool bDeterministic,
+	std::vector<float>& outTexels)
+{
+	PROFILE_ZONE("BakeMaterial");
+
+	//rows per tile, the decoder gets a row per call
+	const uint32_t tileRows = 8;
+	const uint32_t tileCount = (size + tileRows - 1) / tileRows;
+	outTexels.resize((size_t)size * size * BakeChannelCount);
+
+	const NeuralDecoderCPU* decoder = material.decoder.get();
+	threadPool.ParallelFor(tileCount, [&](uint32_t tile, uint32_t)
+		{
+			std::vector<MaterialSample> samples(size);
+			std::vector<float> decoderInputs;
+			std::vector<float> decoderOutputs;
+			if (decoder)
+			{
+				decoderInputs.resize((size_t)size * decoder->GetInputCount());
+				decoderOutputs.resize((size_t)size * decoder->GetOutputCount());
+			}
+
+			const uint32_t y1 = std::min((tile + 1) * tileRows, size);
+			for (uint32_t y = tile * tileRows; y < y1; y++)
+			{
+				const float v = (y + 0.5f) / size;
+				for (uint32_t x = 0; x < size; x++)
+				{
+					const float u = (x + 0.5f) / size;
+					float texel[4][4];
+					for (int t = 0; t < 4; t++)
+					{
+						if (bDeterministic)
+						{
+							DeterministicDecode::Sample(*material.textures[t], u, v, texel[t]);
+						}
+						else
+						{
+							material.textures[t]->Sample(u, v, texel[t]);
+						}
+					}
+
+					if (decoder)
+					{
+						float* input = &decoderInputs[(size_t)x * 14];
+						for (int t = 0; t < 4; t++)
+						{
+							input[t * 3 + 0] = texel[t][0];
+							input[t * 3 + 1] = texel[t][1];
+							input[t * 3 + 2] = texel[t][2];
+						}
+						input[12] = u;
+						input[13] = v;
+					}
+					else
+					{
+						FromTextures(texel, samples[x]);
+					}
+				}
+
+				if (decoder)
+				{
+					decoder->Decode(decoderInputs.data(), decoderOutputs.data(), size,
+						bDeterministic ? DecoderKernel::Deterministic : decoder->GetKernel());
+					for (uint32_t x = 0; x < size; x++)
+					{
+						FromDecoderOutput(&decoderOutputs[(size_t)x * 8], samples[x]);
+					}
+				}
+
+				float* row = &outTexels[(size_t)y * size * BakeChannelCount];
+				for (uint32_t x = 0; x < size; x++)
+				{
+					float* texel = row + (size_t)x * BakeChannelCount;
+					const MaterialSample& sample = samples[x];
+					for (int c = 0; c < 3; c++)
+					{
+						texel[c] = sample.albedo[c];
+						texel[3 + c] = sample.normal[c];
+					}
+					texel[6] = sample.ao;
+					texel[7] = sample.roughness;
+				}
+			}
+		});
+}
+
+UniversalDecoder::UniversalDecoder(NeuralModelPtr inModel)
+	: model(inModel)
+{
+	hash = HashDecoderModel(*model);
+	decoder = std::make_shared<NeuralDecoderCPU>(model);
+}
+
+int UniversalDecoder::AddMaterial(const SoftwareMaterial& material, std::string* error)
+{
+	auto fail = [&](const std::string& message)
+		{
+			if (error)
+			{
+				*error = message;
+			}
+			return -1;
+		};
+
+	if (!material.IsNeural())
+	{
+		return fail("Material " + material.name + " has no decoder");
+	}
+	//the grids were trained against this network, any other weights decode them wrong
+	if (material.model != model && HashDecoderModel(*material.model) != hash)
+	{
+		return fail("Material " + material.name + " has a decoder of its own, not the universal one");
+	}
+
+	FeatureGrids grids;
+	for (int t = 0; t < 4; t++)
+	{
+		grids[t] = material.textures[t];
+	}
+	materialGrids.push_back(grids);
+	return (int)materialGrids.size() - 1;
+}
+
+void UniversalDecoder::GetMaterialInputs(const UniversalDecodeRequest* requests, size_t count, MaterialSample* outSamples) const
+{
+	std::vector<float> decoderInputs(count * decoder->GetInputCount());
+	std::vector<float> decoderOutputs(count * decoder->GetOutputCount());
+	for (size_t i = 0; i < count; i++)
+	{
+		const UniversalDecodeRequest& request = requests[i];
+		GetDecoderInput(materialGrids[request.materialIndex].data(), request.u, request.v, &decoderInputs[i * 14]);
+	}
+
+	decoder->Decode(decoderInputs.data(), decoderOutputs.data(), count);
+	for (size_t i = 0; i < count; i++)
+	{
+		FromDecoderOutput(&decoderOutputs[i * 8], outSamples[i]);
+	}
+}
+
+static const float PI = 3.14159265359f;
+
+static float Dot(const float a[3], const float b[3])
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static void Normalize(float v[3])
+{
+	float length = std::sqrt(Dot(v, v));
+	v[0] /= length;
+	v[1] /= length;
+	v[2] /= length;
+}
+
+static float DistributionGGX(float NdotH, float roughness)
+{
+	float a = roughness * roughness;
+	float a2 = a * a;
+	float NdotH2 = NdotH * NdotH;
+	float denom = (NdotH2 * (a2 - 1.0f) + 1.0f);
+	denom = PI * denom * denom;
+	return a2 / denom;
+}
+
+static float GeometrySchlickGGX(float NdotV, float roughness)
+{
+	float r = (roughness + 1.0f);
+	float k = (r * r) / 8.0f;
+	return NdotV / (NdotV * (1.0f - k) + k);
+}
+
+void SoftwareRenderer::ShadePixel(const MaterialSample& material, const RectConstantBuffer& constants, float outRGBA[4])
+{
+	float N[3] = { material.normal[0] * 2.0f - 1.0f, material.normal[1] * 2.0f - 1.0f, material.normal[2] * 2.0f - 1.0f };
+	Normalize(N);
+
+	float L[3] = { constants.lightpos, 0.0f, 1.0f };
+	Normalize(L);
+	float V[3] = { 0.0f, 0.0f, 1.0f };
+	float H[3] = { V[0] + L[0], V[1] + L[1], V[2] + L[2] };
+	Normalize(H);
+
+	float NdotL = std::fmax(Dot(N, L), 0.0f);
+	float NdotV = std::fmax(Dot(N, V), 0.0f);
+	float NdotH = std::fmax(Dot(N, H), 0.0f);
+	float LdotH = std::fmax(Dot(L, H), 0.0f);
+
+	float D = DistributionGGX(NdotH, material.roughness);
+	float G = GeometrySchlickGGX(NdotV, material.roughness) * GeometrySchlickGGX(NdotL, material.roughness);
+	float fresnelWeight = std::pow(1.0f - LdotH, 5.0f);
+	float specularDenom = 4.0f * std::fmax(0.001f, NdotV) * std::fmax(0.001f, NdotL);
+	float lightIntensity = constants.intensity * NdotL;
+
+	for (int c = 0; c < 3; c++)
+	{
+		float F0 = 0.04f + (material.albedo[c] - 0.04f) * constants.metalness;
+		float F = F0 + (1.0f - F0) * fresnelWeight;
+		float diffuse = (1.0f - F) * (material.albedo[c] / PI);
+		float specular = (F * D * G) / specularDenom;
+		outRGBA[c] = (diffuse + specular) * lightIntensity * material.ao;
+	}
+	outRGBA[3] = 1.0f;
+}
+
+SoftwareRenderer::SoftwareRenderer(uint32_t threadCount, uint32_t inTileSize)
+	: threadPool(threadCount), tileSize(inTileSize > 0 ? inTileSize : DefaultTileSize)
+{
+}
+
+void SoftwareRenderer::Render(const SoftwareMaterial& material, const RectConstantBuffer& constants, uint32_t width, uint32_t height,
+	std::vector<float>& outRGBA, SoftwareRenderStats* stats)
+{
+	PROFILE_ZONE("SoftwareRenderer::Render");
+
+	using Clock = std::chrono::steady_clock;
+	auto start = Clock::now();
+
+	outRGBA.resize((size_t)width * height * 4);
+
+	uint32_t tilesX = (width + tileSize - 1) / tileSize;
+	uint32_t tilesY = (height + tileSize - 1) / tileSize;
+
+	//stage times per thread, padded so threads don't share cache lines
+	struct alignas(64) ThreadTimes
+	{
+		double sampleMs = 0.0;
+		double decodeMs = 0.0;
+		double shadeMs = 0.0;
+	};
+	std::vector<ThreadTimes> threadTimes(threadPool.GetThreadCount());
+
+	const float screenRatio = 16.0f / 9.0f;
+	const NeuralDecoderCPU* decoder = material.decoder.get();
+
+	threadPool.ParallelFor(tilesX * tilesY, [&](uint32_t tileIndex, uint32_t threadIndex)
+		{
+			PROFILE_ZONE("SoftwareRenderer::Tile");
+
+			uint32_t x0 = (tileIndex % tilesX) * tileSize;
+			uint32_t y0 = (tileIndex / tilesX) * tileSize;
+			uint32_t x1 = x0 + tileSize < width ? x0 + tileSize : width;
+			uint32_t y1 = y0 + tileSize < height ? y0 + tileSize : height;
+			uint32_t rowWidth = x1 - x0;
+
+			std::vector<MaterialSample> samples(rowWidth);
+			std::vector<float> decoderInputs;
+			std::vector<float> decoderOutputs;
+			if (decoder)
+			{
+				decoderInputs.resize((size_t)rowWidth * decoder->GetInputCount());
+				decoderOutputs.resize((size_t)rowWidth * decoder->GetOutputCount());
+			}
+
+			ThreadTimes& times = threadTimes[threadIndex];
+
+			//one row of the tile at a time keeps the decoder inputs in cache
+			for (uint32_t y = y0; y < y1; y++)
+			{
+				auto sampleStart = Clock::now();
+				for (uint32_t x = x0; x < x1; x++)
+				{
+					//scale the texture coordinates pivoted on the center, then fix the aspect ratio
+					float u = ((x + 0.5f) / width - 0.5f) * constants.scale + 0.5f;
+					float v = (((y + 0.5f) / height - 0.5f) * constants.scale + 0.5f) / screenRatio;
+
+					float texel[4][4];
+					for (int i = 0; i < 4; i++)
+					{
+						material.textures[i]->Sample(u, v, texel[i]);
+					}
+
+					if (decoder)
+					{
+						float* input = &decoderInputs[(size_t)(x - x0) * 14];
+						for (int i = 0; i < 4; i++)
+						{
+							input[i * 3 + 0] = texel[i][0];
+							input[i * 3 + 1] = texel[i][1];
+							input[i * 3 + 2] = texel[i][2];
+						}
+						input[12] = u;
+						input[13] = v;
+					}
+					else
+					{
+						FromTextures(texel, samples[x - x0]);
+					}
+				}
+
+				auto decodeStart = Clock::now();
+				if (decoder)
+				{
+					decoder->Decode(decoderInputs.data(), decoderOutputs.data(), rowWidth);
+
+					for (uint32_t i = 0; i < rowWidth; i++)
+					{
+						FromDecoderOutput(&decoderOutputs[(size_t)i * 8], samples[i]);
+					}
+				}
+
+				auto shadeStart = Clock::now();
+				float* row = &outRGBA[((size_t)y * width + x0) * 4];
+				for (uint32_t i = 0; i < rowWidth; i++)
+				{
+					ShadePixel(samples[i], constants, row + (size_t)i * 4);
+				}
+				auto shadeEnd = Clock::now();
+
+				times.sampleMs += std::chrono::duration<double, std::milli>(decodeStart - sampleStart).count();
+				times.decodeMs += std::chrono::duration<double, std::milli>(shadeStart - decodeStart).count();
+				times.shadeMs += std::chrono::duration<double, std::milli>(shadeEnd - shadeStart).count();
+			}
+		});
+
+	if (stats)
+	{
+		*stats = SoftwareRenderStats();
+		for (const ThreadTimes& times : threadTimes)
+		{
+			stats->sampleMs += times.sampleMs;
+			stats->decodeMs += times.decodeMs;
+			stats->shadeMs += times.shadeMs;
+		}
+		stats->totalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		stats->threadCount = threadPool.GetThreadCount();
+		stats->tileCount = tilesX * tilesY;
+	}
+}
+
+void SoftwareRenderer::ToRGBA8(const std::vector<float>& rgba, std::vector<uint8_t>& outRGBA8)
+{
+	outRGBA8.resize(rgba.size());
+	for (size_t i = 0; i < rgba.size(); i++)
+	{
+		//nan goes to 0 like the output merger
+		float value = rgba[i] > 0.0f ? (rgba[i] < 1.0f ? rgba[i] : 1.0f) : 0.0f;
+		outRGBA8[i] = (uint8_t)(value * 255.0f + 0.5f);
+	}
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ConstantBuffers.h"
+#include "MaterialLibrary.h"
+#include "NeuralDecoderCPU.h"
+#include "ThreadPool.h"
+
+// Top mip of a texture expanded to RGBA float, sampled like the gpu linear wrap sampler
+struct SoftwareTexture
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	std::vector<float> texels;
+
+	bool LoadDDS(const std::string& path, std::string* error = nullptr);
+
+	//bilinear, wrap addressing, mip 0 like SampleLevel(..., 0)
+	void Sample(float u, float v, float outRGBA[4]) const;
+
+	uint64_t GetByteSize() const { return texels.size() * sizeof(float); }
+};
+
+typedef std::shared_ptr<struct SoftwareMaterial> SoftwareMaterialPtr;
+
+// Material inputs of one pixel, same as MaterialInputs in the shader
+struct MaterialSample
+{
+	float albedo[3];
+	float normal[3];
+	float ao;
+	float roughness;
+};
+
+// Cpu side copy of a material, conventional textures or feature grids plus decoder
+struct SoftwareMaterial
+{
+	std::string name;
+	MaterialShader shader = MaterialShader::PBR;
+
+	//shared with the software backend, which keeps one copy per texture
+	std::shared_ptr<const SoftwareTexture> textures[4];
+
+	NeuralModelPtr model;
+	std::shared_ptr<NeuralDecoderCPU> decoder;
+
+	std::string memoryOwner;
+	uint64_t trackedBytes = 0;
+
+	~SoftwareMaterial();
+
+	bool IsNeural() const { return decoder != nullptr; }
+
+	//GetMaterialInputs of the shader at count texture coordinates, uvs holds u, v pairs
+	void GetMaterialInputs(const float* uvs, size_t count, MaterialSample* outSamples) const;
+
+	//features the decoder reads at count texture coordinates, neural materials only
+	void GetDecoderInputs(const float* uvs, size_t count, float* outInputs) const;
+
+	//nullptr and error filled when a texture or the model can't be loaded on the cpu
+	static SoftwareMaterialPtr Create(const MaterialDesc& desc, std::string* error = nullptr);
+};
+
+//channels per texel of a bake: albedo rgb, normal rgb, ao, roughness
+const uint32_t BakeChannelCount = 8;
+
+//material inputs at the texel centers of a size x size grid, what baking the material to textures writes.
+//Tiles of rows run on the pool, they are cut by size alone and each texel is written by one of them, so neither
+//the thread count nor the order tiles finish in changes a value. bDeterministic samples and decodes through
+//DeterministicDecode and the texels are the same bits on every machine, otherwise the decoder's own kernel runs
+//and JIT and Baked use FMA where the cpu has it
+void BakeMaterial(const SoftwareMaterial& material, uint32_t size, ThreadPool& threadPool, bool bDeterministic,
+	std::vector<float>& outTexels);
+
+// Pixel of one material of a UniversalDecoder
+struct UniversalDecodeRequest
+{
+	uint32_t materialIndex = 0;
+	float u = 0.0f;
+	float v = 0.0f;
+};
+
+// One decoder network shared by many neural materials, each with feature grids of its own.
+// The grids sit in an array indexed by material. Pixels of any mix of materials are gathered into one input
+// block and decoded by a single call, the weights stay in cache and the per call cost is paid once for all of them.
+class UniversalDecoder
+{
+public:
+	explicit UniversalDecoder(NeuralModelPtr inModel);
+
+	//index of the feature grids of material, -1 and error filled when its decoder has other weights
+	int AddMaterial(const SoftwareMaterial& material, std::string* error = nullptr);
+
+	size_t GetMaterialCount() const { return materialGrids.size(); }
+
+	const NeuralModelPtr& GetModel() const { return model; }
+	NeuralDecoderCPU& GetDecoder() { return *decoder; }
+
+	//GetMaterialInputs of every request, the decoder runs once for all of them
+	void GetMaterialInputs(const UniversalDecodeRequest* requests, size_t count, MaterialSample* outSamples) const;
+
+private:
+	typedef std::array<std::shared_ptr<const SoftwareTexture>, 4> FeatureGrids;
+
+	NeuralModelPtr model;
+	//HashDecoderModel of the model, a material's decoder must match it
+	uint64_t hash = 0;
+	std::shared_ptr<NeuralDecoderCPU> decoder;
+	std::vector<FeatureGrids> materialGrids;
+};
+
+// Where the time of one software frame went.
+// Stage times are summed over worker threads, total is wall clock.
+struct SoftwareRenderStats
+{
+	double sampleMs = 0.0;
+	double decodeMs = 0.0;
+	double shadeMs = 0.0;
+	double totalMs = 0.0;
+
+	uint32_t threadCount = 0;
+	uint32_t tileCount = 0;
+};
+
+// Reference implementation of PSMain in PixelShader.hlsl.
+// Renders the full screen rect of a material into an RGBA float image, tiles run on a thread pool.
+class SoftwareRenderer
+{
+public:
+	static const uint32_t DefaultTileSize = 64;
+
+	//0 threads uses every hardware thread
+	explicit SoftwareRenderer(uint32_t threadCount = 0, uint32_t inTileSize = DefaultTileSize);
+
+	void Render(const SoftwareMaterial& material, const RectConstantBuffer& constants, uint32_t width, uint32_t height,
+		std::vector<float>& outRGBA, SoftwareRenderStats* stats = nullptr);
+
+	uint32_t GetThreadCount() const { return threadPool.GetThreadCount(); }
+	uint32_t GetTileSize() const { return tileSize; }
+
+	//PSMain after GetMaterialInputs
+	static void ShadePixel(const MaterialSample& material, const RectConstantBuffer& constants, float outRGBA[4]);
+
+	//clamp to [0, 1] and quantize like the R8G8B8A8_UNORM back buffer
+	static void ToRGBA8(const std::vector<float>& rgba, std::vector<uint8_t>& outRGBA8);
+
+private:
+	ThreadPool threadPool;
+	uint32_t tileSize;
+};
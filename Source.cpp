@@ -2,6 +2,7 @@
 #include <iostream>
 #include <windowsx.h>
 #include <filesystem>
+#include <algorithm>
 #include <windows.h>
 #include "psapi.h"
 
@@ -9,8 +10,17 @@
 #include "Texture2D.h"
 #include <pix3.h>
 #include "NeuralModel.h"
+#include "NeuralModelPool.h"
 #include "Material.h"
+#include "MaterialLibrary.h"
 #include "Shader.h"
+#include "QualityGovernor.h"
+#include "FrameStats.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "Benchmark.h"
+#include "D3D12BenchmarkTarget.h"
+#include "DecoderCompiler.h"
 
 LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
 {
@@ -51,7 +61,7 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
 	return 0;	
 }
 
-// FrameTime Counter class
+// Frame delta time from the performance counter
 class FrameTimer
 {
 public:
@@ -71,37 +81,10 @@ public:
 		return deltaTime;
 	}
 
-	//update state
-	void Update(float deltaTime)
-	{
-		frameCounter++;
-		elapsedTime += deltaTime;
-		if (elapsedTime >= 1.0f)
-		{
-			fps = (float)frameCounter;
-			frameCounter = 0;
-			elapsedTime = 0.0f;
-		}
-	}
-
-	//get fps
-	float GetFPS() const
-	{
-		return fps;
-	}
-
-	//get frame time
-	float GetFrameTime() const
-	{
-		return 1.0f / fps;
-	}
 private:
 	__int64 countsPerSecond;
 	float secondsPerCount;
 	__int64 prevTime;
-	int frameCounter = 0;
-	float fps = 0.0f;
-	float elapsedTime = 0.0f;
 };
 
 //struct for Performance stats
@@ -110,6 +93,9 @@ struct PerformanceStats
 	float fps = 0.0f;
 	float frameTime = 0.0f;
 
+	//percentiles over the frame stats window
+	FrameStats::Summary frameSummary;
+
 	//memory
 	float memoryUsage = 0.0f;
 	float memoryBudget = 0.0f;
@@ -118,6 +104,95 @@ struct PerformanceStats
 //global instance
 PerformanceStats gPerformanceStats;
 
+//per frame timings
+FrameStats gFrameStats;
+
+//adaptive decoder selection state
+struct AdaptiveQuality
+{
+	bool bEnable = false;
+
+	//materials of the same source ordered from best quality to cheapest, the governor picks one of them
+	std::vector<MaterialPtr> chain;
+
+	QualityGovernor governor;
+};
+
+AdaptiveQuality gAdaptiveQuality;
+
+//relative cost guess of a material, neural materials are dominated by decoder multiply-adds
+float EstimateMaterialCost(const MaterialPtr& material)
+{
+	//sampling and shading, roughly worth this many multiply-adds per pixel
+	const float baseCost = 64.0f;
+
+	auto neuralMaterial = std::dynamic_pointer_cast<NeuralTextureMaterial>(material);
+	if (neuralMaterial && neuralMaterial->model)
+	{
+		return baseCost + (float)neuralMaterial->model->GetMultiplyAddCount();
+	}
+	return baseCost;
+}
+
+//build governor levels from material names, best quality first
+void InitAdaptiveQuality(std::unordered_map<std::string, MaterialPtr>& materialMap, const std::vector<std::string>& names)
+{
+	std::vector<QualityLevel> levels;
+	float maxCost = 0.0f;
+	for (const std::string& name : names)
+	{
+		auto it = materialMap.find(name);
+		if (it == materialMap.end())
+		{
+			continue;
+		}
+
+		gAdaptiveQuality.chain.push_back(it->second);
+
+		QualityLevel level;
+		level.name = name;
+		level.relativeCost = EstimateMaterialCost(it->second);
+		if (level.relativeCost > maxCost)
+		{
+			maxCost = level.relativeCost;
+		}
+		levels.push_back(level);
+	}
+
+	for (QualityLevel& level : levels)
+	{
+		level.relativeCost /= maxCost;
+	}
+
+	gAdaptiveQuality.governor.SetLevels(levels);
+}
+
+//pick the material to draw, the governor may swap the selection for a cheaper variant but never a more expensive one.
+//gpuTimeMs is what the decoder costs, frame time would hide it behind vsync
+MaterialPtr SelectDrawMaterial(const MaterialPtr& selectedMaterial, float gpuTimeMs)
+{
+	auto& chain = gAdaptiveQuality.chain;
+	QualityGovernor& governor = gAdaptiveQuality.governor;
+	auto selected = std::find(chain.begin(), chain.end(), selectedMaterial);
+
+	if (!gAdaptiveQuality.bEnable || selected == chain.end())
+	{
+		governor.Reset(0);
+		return selectedMaterial;
+	}
+
+	//a new selection starts the governor on it
+	int selectedLevel = (int)(selected - chain.begin());
+	if (governor.GetBestLevel() != selectedLevel)
+	{
+		governor.SetBestLevel(selectedLevel);
+		governor.Reset(selectedLevel);
+	}
+
+	int level = governor.Update(gpuTimeMs);
+	return chain[level];
+}
+
 //extract function draw texture info to imgui
 void DrawTextureInfo(TextureSlot& textureSlot)
 {
@@ -127,7 +202,7 @@ void DrawTextureInfo(TextureSlot& textureSlot)
 	//draw texture name
 	ImGui::Text(name.c_str());
 
-	ImGui::Image(textureSlot.texture->gpuHandle.ptr, ImVec2(128, 128));
+	ImGui::Image(textureSlot.texture->GetGpuHandle().ptr, ImVec2(128, 128));
 
 	ImGui::SameLine();
 
@@ -162,15 +237,103 @@ void ImGuiTextureCheckBox(bool& bEnable, const std::string& name, std::shared_pt
 	}
 }
 
-void DrawImGui(ImGuiHandler& ImGuiHandler, D3D12GraphicsDevice& device, Window& window, FrameTimer& frameTimer, std::unordered_map<std::string, MaterialPtr>& materialMap, MaterialPtr& CurrentMaterial);
+void DrawImGui(ImGuiHandler& ImGuiHandler, D3D12GraphicsDevice& device, Window& window, FrameStats& frameStats, std::unordered_map<std::string, MaterialPtr>& materialMap, MaterialPtr& CurrentMaterial);
+
+//chrome trace of every zone recorded so far
+void WriteTrace()
+{
+	std::cout << "Writing trace.json, " << Profiler::GetZoneCount() << " zones" << std::endl;
+	Profiler::WriteChromeTrace("trace.json");
+}
 
 void main(int argc, char** argv)
 {
+	PROFILE_THREAD_NAME("Main");
+
+	//write a chrome trace of the whole run on exit
+	bool bWriteTrace = false;
+
+	//headless benchmark, --cpu runs it on the reference renderer without a device
+	bool bBenchmark = false;
+	bool bSoftwareBenchmark = false;
+
+	//frames recorded ahead of the gpu, --frame-latency=N with N from 1 to 3
+	UINT frameLatency = 2;
+
+	//--precompile-shaders[=path] writes the shader archive and exits
+	bool bPrecompileShaders = false;
+	std::string shaderArchivePath = ShaderArchivePath;
+
+	//--bake-decoders writes BakedDecoder_<model>.cpp and Shaders/Baked/<model>.hlsl and exits
+	bool bBakeDecoders = false;
+
 	for (int i = 0; i < argc; i++)
 	{
 		gAppState.arguments.push_back(argv[i]);
 
 		std::cout << "Argument " << i << ": " << argv[i] << std::endl;
+
+		if (gAppState.arguments.back() == "-trace")
+		{
+			bWriteTrace = true;
+		}
+		else if (gAppState.arguments.back() == "--benchmark")
+		{
+			bBenchmark = true;
+		}
+		else if (gAppState.arguments.back() == "--cpu")
+		{
+			bSoftwareBenchmark = true;
+		}
+		else if (gAppState.arguments.back().rfind("--frame-latency=", 0) == 0)
+		{
+			frameLatency = (UINT)std::strtoul(gAppState.arguments.back().c_str() + strlen("--frame-latency="), nullptr, 10);
+		}
+		else if (gAppState.arguments.back() == "--bake-decoders")
+		{
+			bBakeDecoders = true;
+		}
+		else if (gAppState.arguments.back().rfind("--precompile-shaders", 0) == 0)
+		{
+			bPrecompileShaders = true;
+			if (gAppState.arguments.back().rfind("--precompile-shaders=", 0) == 0)
+			{
+				shaderArchivePath = gAppState.arguments.back().substr(strlen("--precompile-shaders="));
+			}
+		}
+	}
+
+	//generated sources of the library models, they change which shaders there are to precompile
+	if (bBakeDecoders)
+	{
+		exit(BakeLibraryDecoders());
+	}
+
+	if (bPrecompileShaders)
+	{
+		exit(PrecompileShaders(shaderArchivePath));
+	}
+
+	//precompiled permutations, compiles the archive misses are kept as loose files next to it
+	std::string shaderCacheError;
+	ShaderCache::Get().SetDirectory("Shaders/Cache");
+	if (ShaderCache::Get().LoadArchive(ShaderArchivePath, &shaderCacheError))
+	{
+		std::cout << "Shader archive: " << ShaderCache::Get().GetEntryCount() << " shaders" << std::endl;
+	}
+	else
+	{
+		std::cout << shaderCacheError << std::endl;
+	}
+
+	if (bBenchmark && bSoftwareBenchmark)
+	{
+		int result = RunSoftwareBenchmark(gAppState.arguments);
+		if (bWriteTrace)
+		{
+			WriteTrace();
+		}
+		exit(result);
 	}
 
 	//create window sized 800x600
@@ -181,6 +344,19 @@ void main(int argc, char** argv)
 
 	//create d3d12 graphics device
 	device.Initialize(window.GetHandle(), window.GetWidth(), window.GetHeight());
+	device.SetFrameLatency(frameLatency);
+	std::cout << "Frame latency: " << device.GetFrameLatency() << std::endl;
+
+	if (bBenchmark)
+	{
+		int result = RunD3D12Benchmark(device, window, gAppState.arguments);
+		device.Cleanup();
+		if (bWriteTrace)
+		{
+			WriteTrace();
+		}
+		exit(result);
+	}
 
 	//frame timer
 	FrameTimer frameTimer;
@@ -190,140 +366,46 @@ void main(int argc, char** argv)
 	statex.dwLength = sizeof(statex);
 	GlobalMemoryStatusEx(&statex);
 	gPerformanceStats.memoryBudget = (float)statex.ullTotalPhys / 1024.0f / 1024.0f;
+	MemoryTracker::Get().SetBudget(MemoryDomain::CPU, (uint64_t)statex.ullTotalPhys);
 
-	auto model = NeuralModel::LoadModel("textures/NeuralCompressed/v23/decodermodel.json");
-	
 	gAppState.imguiHandler.Initialize(window.GetHandle(), device);
 	ImGuiHandler& ImGuiHandler = gAppState.imguiHandler;
 	
 	std::unordered_map<std::string, MaterialPtr> materialMap;
 
-	auto Texture4K = Texture2D::CreateFromFile(device, L"textures/PavingStones131_4K-Color.png");
-	auto NormalTexture = Texture2D::CreateFromFile(device, L"textures/PavingStones131_4K-NormalDX.png");
-	auto AOTexture = Texture2D::CreateFromFile(device, L"textures/PavingStones131_4K-AO.png");
-	auto RoughnessTexture = Texture2D::CreateFromFile(device, L"textures/PavingStones131_4K-Roughness.png");
-
-	MaterialPtr material_4K_png = std::make_shared<Material>();
-	material_4K_png->SetTexture(0, Texture4K, "Albeo");
-	material_4K_png->SetTexture(1, NormalTexture, "Normals");
-	material_4K_png->SetTexture(2, AOTexture, "AO");
-	material_4K_png->SetTexture(3, RoughnessTexture, "Roughness");
-
-	material_4K_png->vertexShader = ShaderMap::Get().GetShader<VertexShader>(device, "FullScreenRectVS");
-	material_4K_png->pixelShader = ShaderMap::Get().GetShader<PixelShader>(device, "FullScreenRectPS");
-
-	materialMap["4K_PNG"] = material_4K_png;
-
-	auto Texture4KDDS = Texture2D::CreateFromDDS(device, L"textures/4K_DDS/PavingStones131_4K-Color.dds");
-	auto Normal4KDDS = Texture2D::CreateFromDDS(device, L"textures/4K_DDS/PavingStones131_4K-NormalDX.dds");
-	auto AO4KDDS = Texture2D::CreateFromDDS(device, L"textures/4K_DDS/PavingStones131_4K-AO.dds");
-	auto Roughness4KDDS = Texture2D::CreateFromDDS(device, L"textures/4K_DDS/PavingStones131_4K-Roughness.dds");
-
-	MaterialPtr material_4K_dds = std::make_shared<Material>();
-	material_4K_dds->SetTexture(0, Texture4KDDS, "Albeo");
-	material_4K_dds->SetTexture(1, Normal4KDDS, "Normals");
-	material_4K_dds->SetTexture(2, AO4KDDS, "AO");
-	material_4K_dds->SetTexture(3, Roughness4KDDS, "Roughness");
-
-	material_4K_dds->vertexShader = ShaderMap::Get().GetShader<VertexShader>(device, "FullScreenRectVS");
-	material_4K_dds->pixelShader = ShaderMap::Get().GetShader<PixelShader>(device, "FullScreenRectPS");
-
-	materialMap["4K_DDS"] = material_4K_dds;
-
-	auto Texture1KDDS = Texture2D::CreateFromDDS(device, L"textures/1K_DDS/PavingStones131_1K-Color.dds");
-	auto Normal1KDDS = Texture2D::CreateFromDDS(device, L"textures/1K_DDS/PavingStones131_1K-NormalDX.dds");
-	auto AO1KDDS = Texture2D::CreateFromDDS(device, L"textures/1K_DDS/PavingStones131_1K-AO.dds");
-	auto Roughness1KDDS = Texture2D::CreateFromDDS(device, L"textures/1K_DDS/PavingStones131_1K-Roughness.dds");
-
-	MaterialPtr material_1K_dds = std::make_shared<Material>();
-	material_1K_dds->SetTexture(0, Texture1KDDS, "Albeo");
-	material_1K_dds->SetTexture(1, Normal1KDDS, "Normals");
-	material_1K_dds->SetTexture(2, AO1KDDS, "AO");
-	material_1K_dds->SetTexture(3, Roughness1KDDS, "Roughness");
-
-	material_1K_dds->vertexShader = ShaderMap::Get().GetShader<VertexShader>(device, "FullScreenRectVS");
-	material_1K_dds->pixelShader = ShaderMap::Get().GetShader<PixelShader>(device, "FullScreenRectPS");
-
-	materialMap["1K_DDS"] = material_1K_dds;
-
-	auto featuregrid0 = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/v23/compressed0.dds");
-	auto featuregrid1 = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/v23/compressed1.dds");
-	auto featuregrid2 = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/v23/compressed2.dds");
-	auto featuregrid3 = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/v23/compressed3.dds");
-	
-	auto material_1k_neural = std::make_shared<NeuralTextureMaterial>();
-	material_1k_neural->SetTexture(0, featuregrid0, "FeatureGrid0");
-	material_1k_neural->SetTexture(1, featuregrid1, "FeatureGrid1");
-	material_1k_neural->SetTexture(2, featuregrid2, "FeatureGrid2");
-	material_1k_neural->SetTexture(3, featuregrid3, "FeatureGrid3");
-
-	material_1k_neural->vertexShader = ShaderMap::Get().GetShader<VertexShader>(device, "FullScreenRectVS");
-	material_1k_neural->pixelShader = ShaderMap::Get().GetShader<NeuralPixelShader>(device, "NeuralFullScreenRectPS");
-
-	material_1k_neural->model = model;
-
-	materialMap["1K_Neural"] = material_1k_neural;
-
-
-	// light weight neural texture material 1k, 32 nodes
-	auto featuregrid0_light_1k = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/1024_32/compressed0.dds");
-	auto featuregrid1_light_1k = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/1024_32/compressed1.dds");
-	auto featuregrid2_light_1k = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/1024_32/compressed2.dds");
-	auto featuregrid3_light_1k = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/1024_32/compressed3.dds");
-
-	auto material_light_neural_1k = std::make_shared<NeuralTextureMaterial>();
-	material_light_neural_1k->SetTexture(0, featuregrid0_light_1k, "FeatureGrid0");
-	material_light_neural_1k->SetTexture(1, featuregrid1_light_1k, "FeatureGrid1");
-	material_light_neural_1k->SetTexture(2, featuregrid2_light_1k, "FeatureGrid2");
-	material_light_neural_1k->SetTexture(3, featuregrid3_light_1k, "FeatureGrid3");
-
-	material_light_neural_1k->vertexShader = ShaderMap::Get().GetShader<VertexShader>(device, "FullScreenRectVS");
-	material_light_neural_1k->pixelShader = ShaderMap::Get().GetShader<NeuralPixelShaderLight<32>>(device, "Light32NeuralFullScreenRectPS");
-
-	material_light_neural_1k->model = NeuralModel::LoadModel("textures/NeuralCompressed/1024_32/decodermodel.json");
-
-	materialMap["1K_Neural_Light_32"] = material_light_neural_1k;
-
-	// light weight neural texture material 2k, 32 nodes
-	auto featuregrid0_light_2k = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/2048_32/compressed0.dds");
-	auto featuregrid1_light_2k = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/2048_32/compressed1.dds");
-	auto featuregrid2_light_2k = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/2048_32/compressed2.dds");
-	auto featuregrid3_light_2k = Texture2D::CreateFromDDS(device, L"textures/NeuralCompressed/2048_32/compressed3.dds");
-
-	auto material_light_neural_2k = std::make_shared<NeuralTextureMaterial>();
-	material_light_neural_2k->SetTexture(0, featuregrid0_light_2k, "FeatureGrid0");
-	material_light_neural_2k->SetTexture(1, featuregrid1_light_2k, "FeatureGrid1");
-	material_light_neural_2k->SetTexture(2, featuregrid2_light_2k, "FeatureGrid2");
-	material_light_neural_2k->SetTexture(3, featuregrid3_light_2k, "FeatureGrid3");
-
-	material_light_neural_2k->vertexShader = ShaderMap::Get().GetShader<VertexShader>(device, "FullScreenRectVS");
-	material_light_neural_2k->pixelShader = ShaderMap::Get().GetShader<NeuralPixelShaderLight<32>>(device, "Light32NeuralFullScreenRectPS");
-
-	material_light_neural_2k->model = NeuralModel::LoadModel("textures/NeuralCompressed/2048_32/decodermodel.json");
+	for (const MaterialDesc& desc : GetMaterialLibrary())
+	{
+		materialMap[desc.name] = CreateMaterial(device, desc);
+	}
 
-	materialMap["2K_Neural_Light_32"] = material_light_neural_2k;
+	auto CurrentMaterial = materialMap["4K_PNG"];
 
-	auto CurrentMaterial = material_4K_png;
+	//decoder variants of the 1K paving stones, conventional BC textures as the last resort
+	InitAdaptiveQuality(materialMap, { "1K_Neural", "1K_Neural_Light_32", "1K_DDS" });
 
 	//main loop
 	while (!gAppState.bRquestedExit)
 	{
+		PROFILE_ZONE("Frame");
+
 		//delta time
 		float deltaTime = frameTimer.GetDeltaTime();
 
-		//update frame timer
-		frameTimer.Update(deltaTime);
+		//record the previous frame, gpu time is of the last frame that finished
+		const FrameTimings& frameTimings = device.GetLastFrameTimings();
+		FrameSample sample;
+		sample.frameMs = deltaTime * 1000.0f;
+		sample.gpuMs = frameTimings.gpuMs;
+		sample.waitMs = frameTimings.waitMs;
+		sample.cpuMs = sample.frameMs > sample.waitMs ? sample.frameMs - sample.waitMs : 0.0f;
+		gFrameStats.Push(sample);
 
-		//fps
-		float fps = frameTimer.GetFPS();
-		//prevent fps set to 0
-		if (fps == 0.0f)
-		{
-			fps = 1.0f;
-		}
+		gPerformanceStats.frameSummary = gFrameStats.Summarize();
 
-		gPerformanceStats.fps = fps;
-		gPerformanceStats.frameTime = frameTimer.GetFrameTime();
+		//prevent fps set to 0
+		float meanFrameMs = gPerformanceStats.frameSummary.frame.mean;
+		gPerformanceStats.fps = meanFrameMs > 0.0f ? 1000.0f / meanFrameMs : 1.0f;
+		gPerformanceStats.frameTime = meanFrameMs / 1000.0f;
 		
 		//get memory usage of this process
 		PROCESS_MEMORY_COUNTERS_EX pmc;
@@ -335,13 +417,14 @@ void main(int argc, char** argv)
 		device.PreRender();
 
 		//psudeo code to Add pass to draw fullscreen rect
-		device.DrawFullScreenRect(CurrentMaterial);
+		//frames without gpu timestamps fall back to the frame time
+		device.DrawFullScreenRect(SelectDrawMaterial(CurrentMaterial, sample.gpuMs > 0.0f ? sample.gpuMs : sample.frameMs));
 
 		//render
 		device.Render(deltaTime);
 
 
-		DrawImGui(ImGuiHandler, device, window, frameTimer, materialMap, CurrentMaterial);
+		DrawImGui(ImGuiHandler, device, window, gFrameStats, materialMap, CurrentMaterial);
 
 		device.Present();
 
@@ -350,13 +433,124 @@ void main(int argc, char** argv)
 
 	// Cleanup
 	ImGuiHandler.Shutdown();
+
+	//materials give their descriptors back before the device reports leaks
+	gAdaptiveQuality.chain.clear();
+	CurrentMaterial.reset();
+	materialMap.clear();
+
+	//decoders no material holds any more, what's left is still referenced somewhere
+	NeuralModelPool::Get().Collect();
+	if (NeuralModelPool::Get().GetModelCount() > 0)
+	{
+		std::cout << NeuralModelPool::Get().GetModelCount() << " decoder models still referenced after the materials were released" << std::endl;
+	}
+	NeuralModelPool::Get().Clear();
 	device.Cleanup();
+
+	if (bWriteTrace)
+	{
+		WriteTrace();
+	}
+}
+
+//frame time percentiles, graph, distribution and csv export
+void DrawFrameStats(FrameStats& frameStats, float width)
+{
+	const FrameStats::Summary& summary = gPerformanceStats.frameSummary;
+
+	ImGui::Text("%-6s %6s %6s %6s %6s", "(ms)", "p50", "p90", "p99", "max");
+	auto DrawRow = [](const char* label, const TimingStatistics& stats)
+	{
+		ImGui::Text("%-6s %6.2f %6.2f %6.2f %6.2f", label, stats.p50, stats.p90, stats.p99, stats.max);
+	};
+	DrawRow("Frame", summary.frame);
+	DrawRow("CPU", summary.cpu);
+	DrawRow("GPU", summary.gpu);
+	DrawRow("Wait", summary.wait);
+
+	//graph of the newest frames, scaled so a 30fps frame fits
+	std::vector<FrameSample> samples;
+	frameStats.Snapshot(samples, 240);
+	std::vector<float> frameTimes;
+	frameTimes.reserve(samples.size());
+	for (const FrameSample& sample : samples)
+	{
+		frameTimes.push_back(sample.frameMs);
+	}
+
+	float graphMax = summary.frame.max > 33.3f ? summary.frame.max : 33.3f;
+	ImGui::PlotLines("##FrameGraph", frameTimes.data(), (int)frameTimes.size(), 0, "Frame Time", 0.0f, graphMax, ImVec2(width, 60));
+
+	std::vector<float> histogram = BuildHistogram(frameTimes, 32, graphMax);
+	ImGui::PlotHistogram("##FrameHistogram", histogram.data(), (int)histogram.size(), 0, "Distribution", 0.0f, FLT_MAX, ImVec2(width, 40));
+
+	static const char* exported = nullptr;
+	if (ImGui::Button("Export CSV"))
+	{
+		exported = frameStats.ExportCSV("frametimes.csv") ? "frametimes.csv" : nullptr;
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("Save Trace"))
+	{
+		exported = Profiler::WriteChromeTrace("trace.json") ? "trace.json" : nullptr;
+	}
+	if (exported)
+	{
+		ImGui::SameLine();
+		ImGui::Text("%s", exported);
+	}
+}
+
+//tracked memory per category and per material
+void DrawMemoryBreakdown()
+{
+	const float MB = 1024.0f * 1024.0f;
+	MemoryTracker& tracker = MemoryTracker::Get();
+
+	for (MemoryDomain domain : { MemoryDomain::GPU, MemoryDomain::CPU })
+	{
+		const char* label = domain == MemoryDomain::GPU ? "GPU" : "CPU";
+		ImVec4 color = tracker.IsOverBudget(domain) ? ImVec4(1.0f, 0.3f, 0.3f, 1.0f) : ImGui::GetStyleColorVec4(ImGuiCol_Text);
+		ImGui::TextColored(color, "%s: %.1fMB (peak %.1fMB, budget %.0fMB)", label,
+			tracker.GetCurrent(domain) / MB, tracker.GetPeak(domain) / MB, tracker.GetBudget(domain) / MB);
+	}
+
+	for (const MemoryCategoryUsage& usage : tracker.GetCategoryUsage())
+	{
+		if (usage.peak == 0)
+		{
+			continue;
+		}
+		ImGui::Text("%-20s %8.2fMB (peak %.2f)", GetMemoryCategoryName(usage.category), usage.current / MB, usage.peak / MB);
+	}
+
+	DescriptorAllocatorStats descriptors = heapAllocator.Allocator.GetStats();
+	ImGui::Text("Descriptors %u/%u (peak %u, pending free %u, largest free range %u)", descriptors.allocatedDescriptors, descriptors.capacity,
+		descriptors.peakDescriptors, descriptors.pendingFreeDescriptors, descriptors.largestFreeRange);
+
+	ImGui::Separator();
+	for (const MemoryOwnerUsage& usage : tracker.GetOwnerUsage())
+	{
+		if (ImGui::TreeNode(usage.owner.c_str(), "%s: %.2fMB", usage.owner.c_str(), usage.GetTotal() / MB))
+		{
+			for (int i = 0; i < (int)MemoryCategory::Count; i++)
+			{
+				if (usage.bytes[i] > 0)
+				{
+					ImGui::Text("%-20s %8.2fMB", GetMemoryCategoryName((MemoryCategory)i), usage.bytes[i] / MB);
+				}
+			}
+			ImGui::TreePop();
+		}
+	}
 }
 
-void DrawImGui(ImGuiHandler& ImGuiHandler, D3D12GraphicsDevice& device, Window& window, FrameTimer& frameTimer, std::unordered_map<std::string, MaterialPtr>& materialMap, MaterialPtr& CurrentMaterial)
+void DrawImGui(ImGuiHandler& ImGuiHandler, D3D12GraphicsDevice& device, Window& window, FrameStats& frameStats, std::unordered_map<std::string, MaterialPtr>& materialMap, MaterialPtr& CurrentMaterial)
 {
 	if (ImGuiHandler.IsInitialized())
 	{
+		PROFILE_ZONE("DrawImGui");
 		PIXScopedEvent(device.GetCommandList(), 0, L"ImGui");
 
 		//	//imgui render
@@ -367,7 +561,7 @@ void DrawImGui(ImGuiHandler& ImGuiHandler, D3D12GraphicsDevice& device, Window&
 		int posX = window.GetWidth() - 300;
 		int posY = 0;
 		ImGui::SetNextWindowPos(ImVec2((float)posX, (float)posY));
-		ImGui::SetNextWindowSize(ImVec2(uiwidth, 400), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(uiwidth, 560), ImGuiCond_Once);
 		ImGui::SetNextWindowBgAlpha(0.35f);
 
 		ImGuiWindowFlags window_flags = 0;
@@ -375,16 +569,47 @@ void DrawImGui(ImGuiHandler& ImGuiHandler, D3D12GraphicsDevice& device, Window&
 
 		bool open = false;
 		ImGui::Begin("Performance", &open, window_flags);
-		ImGui::Text("FPS: %.2f", frameTimer.GetFPS());
-		ImGui::Text("Frame Time: %.2fms", frameTimer.GetFrameTime() * 1000);
+		ImGui::Text("FPS: %.2f", gPerformanceStats.fps);
+		ImGui::Text("Frame Time: %.2fms", gPerformanceStats.frameTime * 1000);
+		DrawFrameStats(frameStats, uiwidth - 20.0f);
 		ImGui::Separator();
 		ImGui::Text("Memory Usage: %.2f/%.2fGB", gPerformanceStats.memoryUsage / 1024.0f, gPerformanceStats.memoryBudget / 1024.0f);
+		if (ImGui::CollapsingHeader("Memory Breakdown"))
+		{
+			DrawMemoryBreakdown();
+		}
+
+		//adaptive decoder selection
+		ImGui::SeparatorText("Adaptive Quality");
+		QualityGovernor& governor = gAdaptiveQuality.governor;
+		ImGui::Checkbox("Enable##AdaptiveQuality", &gAdaptiveQuality.bEnable);
+		ImGui::SliderFloat("GPU Target (ms)", &governor.GetSettings().target, 2.0f, 50.0f);
+		if (gAdaptiveQuality.bEnable && !governor.GetLevels().empty())
+		{
+			const auto& levels = governor.GetLevels();
+			ImGui::Text("Level: %s (%.2fms)", levels[governor.GetLevel()].name.c_str(), governor.GetSmoothedCost());
+
+			//newest decisions first
+			const auto& decisions = governor.GetDecisions();
+			int shown = 0;
+			for (auto it = decisions.rbegin(); it != decisions.rend() && shown < 4; ++it, ++shown)
+			{
+				ImGui::Text("#%llu %s -> %s (%.1fms, %s)", (unsigned long long)it->frame,
+					levels[it->fromLevel].name.c_str(), levels[it->toLevel].name.c_str(), it->smoothedCost, it->reason);
+			}
+		}
 
 
 		static bool vsync = false;
 		ImGui::Checkbox("VSYNC", &vsync);
 		device.SetVsync(vsync);
 
+		int frameLatency = (int)device.GetFrameLatency();
+		if (ImGui::SliderInt("Frame Latency", &frameLatency, 1, (int)FrameScheduler::MaxFrameLatency))
+		{
+			device.SetFrameLatency((UINT)frameLatency);
+		}
+
 		//Slider to change view scale
 		ImGui::SeparatorText("View");
 		ImGui::SliderFloat("View Scale", &device.rectConstantBuffer.scale, 0.2f, 2.0f);
@@ -402,7 +627,7 @@ void DrawImGui(ImGuiHandler& ImGuiHandler, D3D12GraphicsDevice& device, Window&
 		ImGui::End();
 
 		//Resource Description view window
-		posY = 400;
+		posY = 560;
 		ImGui::SetNextWindowPos(ImVec2((float)posX, (float)posY));
 		ImGui::SetNextWindowSize(ImVec2(300, 500), ImGuiCond_Once);
 		ImGui::SetNextWindowBgAlpha(0.35f);
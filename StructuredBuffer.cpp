@@ -3,8 +3,16 @@
 #include "Graphics.h"
 #include <iostream>
 
-void StructuredBuffer::Initialize(D3D12GraphicsDevice& device, void* data, size_t elementSize, size_t elementCount)
+StructuredBuffer::~StructuredBuffer()
 {
+	MemoryTracker::Get().Free(memoryCategory, trackedBytes, memoryOwner);
+	heapAllocator.Free(descriptor);
+}
+
+void StructuredBuffer::Initialize(D3D12GraphicsDevice& device, void* data, size_t elementSize, size_t elementCount, MemoryCategory category)
+{
+	this->elementSize = elementSize;
+	this->elementCount = elementCount;
 	size_t bufferSize = elementSize * elementCount;
 
 	//create default heap
@@ -13,36 +21,56 @@ void StructuredBuffer::Initialize(D3D12GraphicsDevice& device, void* data, size_
 
 	device.GetDevice()->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_COMMON, 0, IID_PPV_ARGS(&bufferResource));
 
-	//create upload heap
-	D3D12_HEAP_PROPERTIES heapPropsUpload(D3D12_HEAP_TYPE_UPLOAD);
-	device.GetDevice()->CreateCommittedResource(&heapPropsUpload, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, 0, IID_PPV_ARGS(&bufferUpload));
+	//report the default heap, staging memory belongs to the device upload ring
+	memoryCategory = category;
+	memoryOwner = MemoryTracker::GetCurrentOwner();
+	trackedBytes = bufferSize;
+	MemoryTracker::Get().Allocate(memoryCategory, trackedBytes, memoryOwner);
 
-	//copy data
-	void* mappedBuffer;
-	CHECKHR(bufferUpload->Map(0, 0, &mappedBuffer));
-	memcpy(mappedBuffer, data, bufferSize);
-	bufferUpload->Unmap(0, 0);
+	//copy data to the upload ring
+	UploadAllocation upload = device.AllocateUpload(bufferSize, 16);
+	memcpy(upload.cpuAddress, data, bufferSize);
 
 	//copy data to default heap
-	device.GetCommandList()->CopyResource(bufferResource.Get(), bufferUpload.Get());
+	device.GetCommandList()->CopyBufferRegion(bufferResource.Get(), 0, upload.resource, upload.offset, bufferSize);
 
-	heapAllocator.Alloc(&cpuHandle, &gpuHandle);
+	descriptor = heapAllocator.Alloc(1, memoryOwner.c_str());
+	CreateView(device, heapAllocator.GetCpuHandle(descriptor));
+}
 
+void StructuredBuffer::CreateView(D3D12GraphicsDevice& device, D3D12_CPU_DESCRIPTOR_HANDLE destination) const
+{
 	//Create SRV
 	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
 	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
 	srvDesc.Format = DXGI_FORMAT_UNKNOWN;
-	srvDesc.Buffer.FirstElement = 0;
+	srvDesc.Buffer.FirstElement = firstElement;
 	srvDesc.Buffer.NumElements = (UINT)elementCount;
 	srvDesc.Buffer.StructureByteStride = (UINT)elementSize;
 	srvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
 
-	device.GetDevice()->CreateShaderResourceView(bufferResource.Get(), &srvDesc, cpuHandle);
+	device.GetDevice()->CreateShaderResourceView(bufferResource.Get(), &srvDesc, destination);
+}
+
+std::shared_ptr<StructuredBuffer> StructuredBuffer::CreateRange(D3D12GraphicsDevice& device, size_t first, size_t count) const
+{
+	//the memory stays reported once, under the buffer that created the resource
+	auto range = std::make_shared<StructuredBuffer>();
+	range->bufferResource = bufferResource;
+	range->elementSize = elementSize;
+	range->firstElement = firstElement + first;
+	range->elementCount = count;
+	range->memoryCategory = memoryCategory;
+	range->memoryOwner = memoryOwner;
+
+	range->descriptor = heapAllocator.Alloc(1, memoryOwner.c_str());
+	range->CreateView(device, heapAllocator.GetCpuHandle(range->descriptor));
+	return range;
 }
 
 void StructuredBuffer::Bind(D3D12GraphicsDevice& device, UINT rootParameterIndex)
 {
 	ID3D12GraphicsCommandList* commandList = device.GetCommandList();
-	commandList->SetGraphicsRootDescriptorTable(rootParameterIndex, gpuHandle);
+	commandList->SetGraphicsRootDescriptorTable(rootParameterIndex, heapAllocator.GetGpuHandle(descriptor));
 }
@@ -2,20 +2,39 @@
 #include <wrl\client.h>
 #include <d3d12.h>
 #include <memory>
+#include <string>
+#include "MemoryTracker.h"
+#include "DescriptorAllocator.h"
 
 class StructuredBuffer
 {
 public:
 	Microsoft::WRL::ComPtr<ID3D12Resource> bufferResource;
-	Microsoft::WRL::ComPtr<ID3D12Resource> bufferUpload;
 
-	// heap handles
-	D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle;
-	D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
+	//shader resource view in the global heap
+	DescriptorHandle descriptor;
 
-	void Initialize(class D3D12GraphicsDevice& device, void* data, size_t elementSize, size_t elementCount);
+	size_t elementSize = 0;
+	size_t elementCount = 0;
+	//first element the view starts at, a range of another buffer's resource
+	size_t firstElement = 0;
+
+	//bytes reported to the MemoryTracker, returned on destruction
+	MemoryCategory memoryCategory = MemoryCategory::StructuredBuffer;
+	std::string memoryOwner;
+	UINT64 trackedBytes = 0;
+
+	~StructuredBuffer();
+
+	void Initialize(class D3D12GraphicsDevice& device, void* data, size_t elementSize, size_t elementCount, MemoryCategory category = MemoryCategory::StructuredBuffer);
 
 	void Bind(class D3D12GraphicsDevice& device, UINT rootParameterIndex);
+
+	//write the shader resource view of the buffer to any descriptor, a slot of a descriptor table
+	void CreateView(class D3D12GraphicsDevice& device, D3D12_CPU_DESCRIPTOR_HANDLE destination) const;
+
+	//elements [first, first + count) as a buffer of their own, sharing the resource. The shader indexes it from 0
+	std::shared_ptr<StructuredBuffer> CreateRange(class D3D12GraphicsDevice& device, size_t first, size_t count) const;
 };
 
 typedef std::shared_ptr<StructuredBuffer> StructuredBufferPtr;
@@ -7,31 +7,92 @@
 #include "ThirdParty/WICTextureLoader12.h"
 #include "ThirdParty/DDSTextureLoader12.h"
 #include <iostream>
+#include "Profiler.h"
 
-void Texture2D::Release()
+Texture2D::~Texture2D()
 {
-	if (texture)
+	ReleaseTrackedMemory();
+	heapAllocator.Free(descriptor);
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE Texture2D::GetGpuHandle() const
+{
+	return heapAllocator.GetGpuHandle(descriptor);
+}
+
+void Texture2D::CreateView(D3D12GraphicsDevice& device, D3D12_CPU_DESCRIPTOR_HANDLE destination) const
+{
+	D3D12_RESOURCE_DESC resourceDesc = texture->GetDesc();
+	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+	srvDesc.Format = resourceDesc.Format;
+	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	srvDesc.Texture2D.MipLevels = resourceDesc.MipLevels;
+	device.GetDevice()->CreateShaderResourceView(texture.Get(), &srvDesc, destination);
+}
+
+void Texture2D::TrackMemory(D3D12GraphicsDevice& device)
+{
+	memoryOwner = MemoryTracker::GetCurrentOwner();
+
+	//actual allocation of the resource including every mip
+	D3D12_RESOURCE_DESC resourceDesc = texture->GetDesc();
+	trackedTextureBytes = device.GetDevice()->GetResourceAllocationInfo(0, 1, &resourceDesc).SizeInBytes;
+	MemoryTracker::Get().Allocate(MemoryCategory::Texture, trackedTextureBytes, memoryOwner);
+
+	//decoded copy kept until the upload command ran
+	for (const D3D12_SUBRESOURCE_DATA& subresource : subresources)
 	{
-		texture.Reset();
+		trackedDecodedBytes += (UINT64)subresource.SlicePitch;
+	}
+	MemoryTracker::Get().Allocate(MemoryCategory::DecodedCache, trackedDecodedBytes, memoryOwner);
+}
+
+void Texture2D::QueueUpload(D3D12GraphicsDevice& device, const Texture2DPtr& texture)
+{
+	//every subresource goes through the device upload ring, a large texture over several frames
+	texture->bUploadPending = true;
+	device.UploadTexture(texture->texture.Get(), texture->subresources, [texture](D3D12GraphicsDevice& device)
+		{
+			texture->bUploadPending = false;
+			texture->CleanupCPUMemory();
+		});
+}
+
+void Texture2D::ReleaseTrackedMemory()
+{
+	MemoryTracker& tracker = MemoryTracker::Get();
+	if (trackedTextureBytes)
+	{
+		tracker.Free(MemoryCategory::Texture, trackedTextureBytes, memoryOwner);
+		trackedTextureBytes = 0;
 	}
-	if (uploadBuffer)
+	if (trackedDecodedBytes)
 	{
-		uploadBuffer.Reset();
+		tracker.Free(MemoryCategory::DecodedCache, trackedDecodedBytes, memoryOwner);
+		trackedDecodedBytes = 0;
 	}
+}
 
-	//free descriptor handle
-	if (cpuHandle.ptr)
+void Texture2D::Release()
+{
+	if (texture)
 	{
-		heapAllocator.Free(cpuHandle, gpuHandle);
-		cpuHandle.ptr = 0;
-		gpuHandle.ptr = 0;
+		texture.Reset();
 	}
 
+	ReleaseTrackedMemory();
+
+	//free descriptor, frames in flight may still read it
+	heapAllocator.Free(descriptor);
+
 	CleanupCPUMemory();
 }
 
 std::shared_ptr<Texture2D> Texture2D::CreateFromFile(D3D12GraphicsDevice& device, const wchar_t* filename)
 {
+	PROFILE_ZONE("Texture2D::CreateFromFile");
+
 	std::wcout << "Loading texture: " << filename << std::endl;
 
 	//filename to fullpath
@@ -45,7 +106,10 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromFile(D3D12GraphicsDevice& device
 	D3D12_SUBRESOURCE_DATA& subresource = texture->subresources[0]; // Add this member
 
 	//Load bmp using WICLoader
-	DirectX::LoadWICTextureFromFile(device.GetDevice(), fullpath, &texture->texture, texture->decodedData, texture->subresources[0]);
+	{
+		PROFILE_ZONE("LoadWICTextureFromFile");
+		DirectX::LoadWICTextureFromFile(device.GetDevice(), fullpath, &texture->texture, texture->decodedData, texture->subresources[0]);
+	}
 
 	if (!texture->texture)
 	{
@@ -53,46 +117,22 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromFile(D3D12GraphicsDevice& device
 		return nullptr;
 	}
 
+	//report gpu and decoded memory
+	texture->TrackMemory(device);
+
 	//alloc descriptor
-	heapAllocator.Alloc(&texture->cpuHandle, &texture->gpuHandle);
+	texture->descriptor = heapAllocator.Alloc(1, texture->memoryOwner.c_str());
 
 	device.AddRenderCommand([texture](D3D12GraphicsDevice& device)
 		{
-			//subresource data
-			D3D12_SUBRESOURCE_DATA& subresource = texture->subresources[0];
-
-
-			//create gpu upload buffer
-			UINT64 uploadBufferSize = GetRequiredIntermediateSize(texture->texture.Get(), 0, 1);
-			D3D12_HEAP_PROPERTIES heapProps = {};
-			heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
-			D3D12_RESOURCE_DESC bufferDesc = {};
-			bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-			bufferDesc.Width = uploadBufferSize;
-			bufferDesc.Height = 1;
-			bufferDesc.DepthOrArraySize = 1;
-			bufferDesc.MipLevels = 1;
-			bufferDesc.Format = DXGI_FORMAT_UNKNOWN;
-			bufferDesc.SampleDesc.Count = 1;
-			bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-			bufferDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-			CHECKHR(device.GetDevice()->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, 0, IID_PPV_ARGS(&texture->uploadBuffer)));
+			PROFILE_ZONE("UploadTexture");
 
 			//copy texture
-			UpdateSubresources(device.GetCommandList(), texture->texture.Get(), texture->uploadBuffer.Get(), 0, 0, 1, &subresource);
+			Texture2D::QueueUpload(device, texture);
 
 
-			auto Desc = texture->texture->GetDesc();
 			//create shader resource view
-			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-			srvDesc.Format = Desc.Format;
-			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-			srvDesc.Texture2D.MipLevels = texture->GetDesc().MipLevels;
-
-			device.GetDevice()->CreateShaderResourceView(texture->texture.Get(), &srvDesc, texture->cpuHandle);
-
-			texture->CleanupCPUMemory();
+			texture->CreateView(device, heapAllocator.GetCpuHandle(texture->descriptor));
 		});
 
 
@@ -116,11 +156,11 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromFile(D3D12GraphicsDevice& device
 	desc.MipLevels = Desc.MipLevels;
 	desc.Format = GetFormatString(Desc.Format);
 
-	texture->uncompressedByteSize = (UINT)GetRequiredIntermediateSize(texture->texture.Get(), 0, 1);
+	texture->uncompressedByteSize = GetRequiredIntermediateSize(texture->texture.Get(), 0, 1);
 
 	//get file size using std::filesystem
 	std::filesystem::path path = fullpath;
-	texture->compressedByteSize = (UINT)std::filesystem::file_size(path);
+	texture->compressedByteSize = (UINT64)std::filesystem::file_size(path);
 
 	std::wcout << "Texture loaded: " << texture->name << std::endl;
 
@@ -129,6 +169,8 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromFile(D3D12GraphicsDevice& device
 
 std::shared_ptr<Texture2D> Texture2D::CreateFromMemory(D3D12GraphicsDevice& device, const TextureCreateParams& Params)
 {
+	PROFILE_ZONE("Texture2D::CreateFromMemory");
+
 	std::shared_ptr<Texture2D> texture = std::make_shared<Texture2D>();
 
 	size_t size = Params.data.size() * sizeof(uint8_t);
@@ -141,14 +183,8 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromMemory(D3D12GraphicsDevice& devi
 		&desc, D3D12_RESOURCE_STATE_COPY_DEST, 0,
 		IID_PPV_ARGS(&texture->texture));
 
-	// Create upload buffer
-	CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(size);
-	CD3DX12_HEAP_PROPERTIES heapPropsUpload = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-	UINT64 uploadBufferSize = GetRequiredIntermediateSize(texture->texture.Get(), 0, 1);
-	device.GetDevice()->CreateCommittedResource(&heapPropsUpload,
-		D3D12_HEAP_FLAG_NONE,
-		&bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, 0,
-		IID_PPV_ARGS(&texture->uploadBuffer));
+	//report gpu memory, the source data belongs to the caller
+	texture->TrackMemory(device);
 
 	// Copy data to upload buffer in render command
 	D3D12_SUBRESOURCE_DATA subresource = {};
@@ -160,23 +196,16 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromMemory(D3D12GraphicsDevice& devi
 	texture->subresources.push_back(subresource);
 
 	//alloc descriptor
-	heapAllocator.Alloc(&texture->cpuHandle, &texture->gpuHandle);
+	texture->descriptor = heapAllocator.Alloc(1, texture->memoryOwner.c_str());
 
 	device.AddRenderCommand([texture](D3D12GraphicsDevice& device)
 		{
-			//subresource data
-			D3D12_SUBRESOURCE_DATA& subresource = texture->subresources[0];
+			PROFILE_ZONE("UploadTexture");
+
 			//copy texture
-			UpdateSubresources(device.GetCommandList(), texture->texture.Get(), texture->uploadBuffer.Get(), 0, 0, 1, &subresource);
-			auto Desc = texture->texture->GetDesc();
+			Texture2D::QueueUpload(device, texture);
 			//create shader resource view
-			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-			srvDesc.Format = Desc.Format;
-			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-			srvDesc.Texture2D.MipLevels = texture->GetDesc().MipLevels;
-			device.GetDevice()->CreateShaderResourceView(texture->texture.Get(), &srvDesc, texture->cpuHandle);
-			texture->CleanupCPUMemory();
+			texture->CreateView(device, heapAllocator.GetCpuHandle(texture->descriptor));
 		});
 
 	//fill texture desc
@@ -191,6 +220,8 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromMemory(D3D12GraphicsDevice& devi
 
 std::shared_ptr<Texture2D> Texture2D::CreateFromDDS(D3D12GraphicsDevice& device, const wchar_t* filename)
 {
+	PROFILE_ZONE("Texture2D::CreateFromDDS");
+
 	std::wcout << L"Creating texture from DDS: " << filename << std::endl;
 
 	std::shared_ptr<Texture2D> texture = std::make_shared<Texture2D>();
@@ -198,44 +229,27 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromDDS(D3D12GraphicsDevice& device,
 	wchar_t fullpath[MAX_PATH];
 	GetFullPathName(filename, MAX_PATH, fullpath, 0);
 	//Load DDS using WICLoader
-	DirectX::LoadDDSTextureFromFile(device.GetDevice(), fullpath, &texture->texture, texture->decodedData, texture->subresources);
+	{
+		PROFILE_ZONE("LoadDDSTextureFromFile");
+		DirectX::LoadDDSTextureFromFile(device.GetDevice(), fullpath, &texture->texture, texture->decodedData, texture->subresources);
+	}
 	if (!texture->texture)
 	{
 		std::wcout << "Failed to load texture: " << std::wstring(fullpath) << std::endl;
 		return nullptr;
 	}
+	//report gpu and decoded memory
+	texture->TrackMemory(device);
 	//alloc descriptor
-	heapAllocator.Alloc(&texture->cpuHandle, &texture->gpuHandle);
+	texture->descriptor = heapAllocator.Alloc(1, texture->memoryOwner.c_str());
 	device.AddRenderCommand([texture](D3D12GraphicsDevice& device)
 		{
-			//subresource data
-			D3D12_SUBRESOURCE_DATA& subresource = texture->subresources[0];
-			//create gpu upload buffer
-			UINT64 uploadBufferSize = GetRequiredIntermediateSize(texture->texture.Get(), 0, 1);
-			D3D12_HEAP_PROPERTIES heapProps = {};
-			heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
-			D3D12_RESOURCE_DESC bufferDesc = {};
-			bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-			bufferDesc.Width = uploadBufferSize;
-			bufferDesc.Height = 1;
-			bufferDesc.DepthOrArraySize = 1;
-			bufferDesc.MipLevels = 1;
-			bufferDesc.Format = DXGI_FORMAT_UNKNOWN;
-			bufferDesc.SampleDesc.Count = 1;
-			bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-			bufferDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-			CHECKHR(device.GetDevice()->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, 0, IID_PPV_ARGS(&texture->uploadBuffer)));
-			//copy texture
-			UpdateSubresources(device.GetCommandList(), texture->texture.Get(), texture->uploadBuffer.Get(), 0, 0, 1, &subresource);
-			auto Desc = texture->texture->GetDesc();
+			PROFILE_ZONE("UploadTexture");
+
+			//copy every mip, not only the top level
+			Texture2D::QueueUpload(device, texture);
 			//create shader resource view
-			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-			srvDesc.Format = Desc.Format;
-			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-			srvDesc.Texture2D.MipLevels = texture->GetDesc().MipLevels;
-			device.GetDevice()->CreateShaderResourceView(texture->texture.Get(), &srvDesc, texture->cpuHandle);
-			texture->CleanupCPUMemory();
+			texture->CreateView(device, heapAllocator.GetCpuHandle(texture->descriptor));
 		});
 	//set name string after last '/' or '\'
 	std::wstring fullpathStr = fullpath;
@@ -255,10 +269,10 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromDDS(D3D12GraphicsDevice& device,
 	desc.Height = Desc.Height;
 	desc.MipLevels = Desc.MipLevels;
 	desc.Format = GetFormatString(Desc.Format);
-	texture->uncompressedByteSize = (UINT)GetRequiredIntermediateSize(texture->texture.Get(), 0, 1);
+	texture->uncompressedByteSize = GetRequiredIntermediateSize(texture->texture.Get(), 0, 1);
 	//get file size using std::filesystem
 	std::filesystem::path path = fullpath;
-	texture->compressedByteSize = (UINT)std::filesystem::file_size(path);
+	texture->compressedByteSize = (UINT64)std::filesystem::file_size(path);
 
 	std::wcout << "Texture loaded: " << texture->name << std::endl;
 
@@ -4,6 +4,8 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "MemoryTracker.h"
+#include "DescriptorAllocator.h"
 
 
 // Get common simple names from DXGI format (ex. RGBA16, RGB)
@@ -31,19 +33,25 @@ public:
 	//simple texture descriptor
 	TextureDesc desc;
 
-	//descriptor handle
-	D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle;
-	D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
-
-	//upload buffer
-	Microsoft::WRL::ComPtr<ID3D12Resource> uploadBuffer;
+	//shader resource view in the global heap
+	DescriptorHandle descriptor;
 
 	//texture name
 	std::wstring name;
 
 	//byte sizes data for debug
-	UINT uncompressedByteSize = 0;
-	UINT compressedByteSize = 0;
+	UINT64 uncompressedByteSize = 0;
+	UINT64 compressedByteSize = 0;
+
+	//bytes reported to the MemoryTracker, returned on release
+	std::string memoryOwner;
+	UINT64 trackedTextureBytes = 0;
+	UINT64 trackedDecodedBytes = 0;
+
+	//render thread: rows still waiting for room in the upload ring, materials bind the white texture meanwhile
+	bool bUploadPending = false;
+
+	~Texture2D();
 
 	//GetDesc
 	TextureDesc GetDesc() const
@@ -51,6 +59,12 @@ public:
 		return desc;
 	}
 
+	//gpu handle of the shader resource view, for ImGui
+	D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandle() const;
+
+	//write the shader resource view of the texture to any descriptor, a slot of a descriptor table
+	void CreateView(class D3D12GraphicsDevice& device, D3D12_CPU_DESCRIPTOR_HANDLE destination) const;
+
 	//Cleanup subresource data after texture created
 	void CleanupCPUMemory()
 	{
@@ -62,11 +76,26 @@ public:
 		{
 			subresources.clear();
 		}
+		if (trackedDecodedBytes)
+		{
+			MemoryTracker::Get().Free(MemoryCategory::DecodedCache, trackedDecodedBytes, memoryOwner);
+			trackedDecodedBytes = 0;
+		}
 	}
 
 	//release texture
 	void Release();
 
+	//report the gpu resource and the decoded cpu copy to the MemoryTracker
+	void TrackMemory(class D3D12GraphicsDevice& device);
+
+	//render thread: queue the copy of the subresources through the device upload ring, the decoded data is
+	//released once the last row is recorded
+	static void QueueUpload(class D3D12GraphicsDevice& device, const Texture2DPtr& texture);
+
+	//give every tracked byte back to the MemoryTracker
+	void ReleaseTrackedMemory();
+
 	// Add Create from file static method return ComPtr
 	static Texture2DPtr CreateFromFile(class D3D12GraphicsDevice& device, const wchar_t* filename);
 
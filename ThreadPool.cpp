@@ -0,0 +1,104 @@
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include <string>
+
+uint32_t ThreadPool::GetHardwareThreadCount()
+{
+	uint32_t count = std::thread::hardware_concurrency();
+	return count > 0 ? count : 1;
+}
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+{
+	if (threadCount == 0)
+	{
+		threadCount = GetHardwareThreadCount();
+	}
+
+	for (uint32_t i = 1; i < threadCount; i++)
+	{
+		workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		bStop = true;
+	}
+	wakeCondition.notify_all();
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::RunTasks(const Task& task, uint32_t count, uint32_t threadIndex)
+{
+	for (uint32_t index = nextIndex.fetch_add(1); index < count; index = nextIndex.fetch_add(1))
+	{
+		task(index, threadIndex);
+	}
+}
+
+void ThreadPool::ParallelFor(uint32_t count, const Task& task)
+{
+	if (workers.empty() || count <= 1)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			task(i, 0);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		currentTask = &task;
+		taskCount = count;
+		nextIndex = 0;
+		busyWorkers = (uint32_t)workers.size();
+		generation++;
+	}
+	wakeCondition.notify_all();
+
+	RunTasks(task, count, 0);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	doneCondition.wait(lock, [this] { return busyWorkers == 0; });
+	currentTask = nullptr;
+}
+
+void ThreadPool::WorkerLoop(uint32_t threadIndex)
+{
+	std::string threadName = "Worker " + std::to_string(threadIndex);
+	PROFILE_THREAD_NAME(threadName.c_str());
+
+	uint64_t seenGeneration = 0;
+	while (true)
+	{
+		const Task* task;
+		uint32_t count;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			wakeCondition.wait(lock, [&] { return bStop || generation != seenGeneration; });
+			if (bStop)
+			{
+				return;
+			}
+			seenGeneration = generation;
+			task = currentTask;
+			count = taskCount;
+		}
+
+		RunTasks(*task, count, threadIndex);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (--busyWorkers == 0)
+		{
+			doneCondition.notify_one();
+		}
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads for data parallel cpu work.
+// The calling thread takes part in every ParallelFor, so a pool of 1 runs everything inline.
+class ThreadPool
+{
+public:
+	typedef std::function<void(uint32_t index, uint32_t threadIndex)> Task;
+
+	//0 uses every hardware thread
+	explicit ThreadPool(uint32_t threadCount = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	//threads including the caller, threadIndex passed to tasks is below this
+	uint32_t GetThreadCount() const { return (uint32_t)workers.size() + 1; }
+
+	//run task for every index in [0, count), returns when all are done
+	void ParallelFor(uint32_t count, const Task& task);
+
+	static uint32_t GetHardwareThreadCount();
+
+private:
+	void WorkerLoop(uint32_t threadIndex);
+	void RunTasks(const Task& task, uint32_t count, uint32_t threadIndex);
+
+	std::vector<std::thread> workers;
+
+	std::mutex mutex;
+	std::condition_variable wakeCondition;
+	std::condition_variable doneCondition;
+
+	const Task* currentTask = nullptr;
+	uint32_t taskCount = 0;
+	std::atomic<uint32_t> nextIndex{ 0 };
+	uint32_t busyWorkers = 0;
+	uint64_t generation = 0;
+	bool bStop = false;
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+// Checks of the viewer's portable core, one file per subsystem. Each returns false and lists what failed in
+// outMessage, or says what it covered when it passed
+bool CheckQualityGovernor(std::string& outMessage);
+bool CheckFrameStats(std::string& outMessage);
+bool CheckMemoryTracker(std::string& outMessage);
+bool CheckRenderCommandQueue(std::string& outMessage);
+bool CheckUploadRing(std::string& outMessage);
+bool CheckDescriptorAllocator(std::string& outMessage);
+bool CheckFrameScheduler(std::string& outMessage);
+bool CheckProfiler(std::string& outMessage);
@@ -0,0 +1,67 @@
+// Unit tests of the viewer's portable core, the code that runs the same without a device: every check drives one
+// subsystem with synthetic input, simulated fences or producer threads and compares it with what it must do.
+// Rendering is covered by the golden image test, this needs no images or other files.
+// --filter=substring runs only the checks whose name contains it.
+#include "UnitTest.h"
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+struct UnitTest
+{
+	const char* name;
+	bool (*check)(std::string& outMessage);
+};
+
+static const UnitTest UnitTests[] =
+{
+	{ "quality governor", CheckQualityGovernor },
+	{ "frame stats", CheckFrameStats },
+	{ "memory tracker", CheckMemoryTracker },
+	{ "render command queue", CheckRenderCommandQueue },
+	{ "upload ring", CheckUploadRing },
+	{ "descriptor allocator", CheckDescriptorAllocator },
+	{ "frame scheduler", CheckFrameScheduler },
+	{ "profiler", CheckProfiler },
+};
+
+int main(int argc, char** argv)
+{
+	std::string filter;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument.rfind("--filter=", 0) == 0)
+		{
+			filter = argument.substr(9);
+		}
+		else
+		{
+			std::cout << "Unknown argument " << argument << std::endl;
+			std::cout << "Usage: UnitTest [--filter=substring]" << std::endl;
+			return 2;
+		}
+	}
+
+	uint32_t failed = 0;
+	uint32_t run = 0;
+	for (const UnitTest& test : UnitTests)
+	{
+		if (!filter.empty() && std::string(test.name).find(filter) == std::string::npos)
+		{
+			continue;
+		}
+		run++;
+
+		std::string message;
+		bool bPassed = test.check(message);
+		std::cout << (bPassed ? "pass " : "FAIL ") << test.name << ": " << message << std::endl;
+		if (!bPassed)
+		{
+			failed++;
+		}
+	}
+
+	std::cout << run - failed << "/" << run << " checks passed" << std::endl;
+	return failed == 0 ? 0 : 1;
+}
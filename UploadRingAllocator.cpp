@@ -0,0 +1,147 @@
+#include "UploadRingAllocator.h"
+#include <algorithm>
+#include <cassert>
+
+static uint64_t AlignUp(uint64_t value, uint64_t alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+UploadRingAllocator::UploadRingAllocator(uint64_t capacity)
+	: capacity(capacity)
+{
+}
+
+bool UploadRingAllocator::Allocate(uint64_t size, uint64_t alignment, Allocation& outAllocation)
+{
+	assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+	if (size == 0 || size > capacity || usedBytes + size > capacity)
+	{
+		failedCount++;
+		return false;
+	}
+
+	//empty ring, start over at the front to keep the largest free run
+	if (usedBytes == 0)
+	{
+		head = 0;
+		tail = 0;
+	}
+
+	uint64_t offset = 0;
+	uint64_t consumed = 0;
+	uint64_t aligned = AlignUp(head, alignment);
+	if (head >= tail)
+	{
+		//free runs are [head, capacity) and [0, tail)
+		if (aligned + size <= capacity)
+		{
+			offset = aligned;
+			consumed = aligned + size - head;
+		}
+		else if (size <= tail)
+		{
+			//skip the rest of the ring, it comes back when this frame retires
+			offset = 0;
+			consumed = capacity - head + size;
+		}
+		else
+		{
+			failedCount++;
+			return false;
+		}
+	}
+	else
+	{
+		//free run is [head, tail)
+		if (aligned + size > tail)
+		{
+			failedCount++;
+			return false;
+		}
+		offset = aligned;
+		consumed = aligned + size - head;
+	}
+
+	head = offset + size;
+	if (head == capacity)
+	{
+		head = 0;
+	}
+
+	usedBytes += consumed;
+	openFrameBytes += consumed;
+	if (usedBytes > peakBytes)
+	{
+		peakBytes = usedBytes;
+	}
+	allocationCount++;
+
+	outAllocation.offset = offset;
+	outAllocation.size = size;
+	return true;
+}
+
+uint32_t UploadRingAllocator::AllocateRows(uint64_t rowPitch, uint32_t rowCount, uint64_t maxBytes, uint64_t alignment, Allocation& outAllocation)
+{
+	assert(rowPitch != 0);
+
+	uint64_t fitCount = std::min<uint64_t>(std::min(GetLargestFreeRange(alignment), maxBytes) / rowPitch, rowCount);
+	if (fitCount == 0)
+	{
+		failedCount++;
+		return 0;
+	}
+	if (!Allocate(fitCount * rowPitch, alignment, outAllocation))
+	{
+		return 0;
+	}
+	return (uint32_t)fitCount;
+}
+
+uint64_t UploadRingAllocator::GetLargestFreeRange(uint64_t alignment) const
+{
+	if (usedBytes == 0)
+	{
+		return capacity;
+	}
+
+	uint64_t aligned = AlignUp(head, alignment);
+	uint64_t largest = 0;
+	if (head >= tail)
+	{
+		//before the end, or from the front after a wrap
+		largest = std::max(aligned < capacity ? capacity - aligned : 0, tail);
+	}
+	else if (aligned < tail)
+	{
+		largest = tail - aligned;
+	}
+	return std::min(largest, capacity - usedBytes);
+}
+
+void UploadRingAllocator::FinishFrame(uint64_t fenceValue)
+{
+	if (openFrameBytes == 0)
+	{
+		return;
+	}
+
+	FrameMarker marker;
+	marker.fenceValue = fenceValue;
+	marker.end = head;
+	marker.bytes = openFrameBytes;
+	frames.push_back(marker);
+	openFrameBytes = 0;
+}
+
+void UploadRingAllocator::Retire(uint64_t completedFenceValue)
+{
+	while (!frames.empty() && frames.front().fenceValue <= completedFenceValue)
+	{
+		tail = frames.front().end;
+		usedBytes -= frames.front().bytes;
+		frames.pop_front();
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+// Linear ring of staging memory recycled by fence value.
+// Ranges are handed out back to back, wrapping to the start when the end is reached. Every range allocated
+// during a frame is tagged with the fence value signaled after that frame by FinishFrame, and returns to
+// the ring once Retire sees the fence complete. Only offsets are managed, the device maps them into one
+// persistent upload buffer, tests drive the fence values by hand.
+class UploadRingAllocator
+{
+public:
+	static const uint64_t DefaultCapacity = 64ull * 1024 * 1024;
+
+	struct Allocation
+	{
+		uint64_t offset = 0;
+		uint64_t size = 0;
+	};
+
+	explicit UploadRingAllocator(uint64_t capacity = DefaultCapacity);
+
+	//alignment must be a power of two. False when the ring has no room until older frames retire
+	bool Allocate(uint64_t size, uint64_t alignment, Allocation& outAllocation);
+
+	//largest band of whole rows, up to rowCount and maxBytes, that fits the free run at the head. Copies larger
+	//than the ring go through it one band per frame. Returns the rows allocated, 0 when not even one fits
+	uint32_t AllocateRows(uint64_t rowPitch, uint32_t rowCount, uint64_t maxBytes, uint64_t alignment, Allocation& outAllocation);
+
+	//tags everything allocated since the last call with the fence value signaled after it
+	void FinishFrame(uint64_t fenceValue);
+
+	//gives back the ranges of every frame whose fence value is at most completedFenceValue
+	void Retire(uint64_t completedFenceValue);
+
+	uint64_t GetCapacity() const { return capacity; }
+
+	//bytes held by frames in flight and the open frame, alignment and wrap padding included
+	uint64_t GetUsedBytes() const { return usedBytes; }
+	uint64_t GetPeakBytes() const { return peakBytes; }
+
+	uint64_t GetAllocationCount() const { return allocationCount; }
+	uint64_t GetFailedCount() const { return failedCount; }
+
+	//frames tagged by FinishFrame and not retired yet
+	size_t GetPendingFrameCount() const { return frames.size(); }
+
+private:
+	//bytes Allocate can hand out at once with this alignment
+	uint64_t GetLargestFreeRange(uint64_t alignment) const;
+
+	struct FrameMarker
+	{
+		uint64_t fenceValue = 0;
+		//head after the last allocation of the frame, the new tail once it retires
+		uint64_t end = 0;
+		uint64_t bytes = 0;
+	};
+
+	uint64_t capacity = 0;
+
+	//next free byte and oldest byte still in use
+	uint64_t head = 0;
+	uint64_t tail = 0;
+	uint64_t usedBytes = 0;
+
+	//bytes of the frame not finished yet
+	uint64_t openFrameBytes = 0;
+	std::deque<FrameMarker> frames;
+
+	uint64_t peakBytes = 0;
+	uint64_t allocationCount = 0;
+	uint64_t failedCount = 0;
+};
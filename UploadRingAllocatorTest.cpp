@@ -0,0 +1,152 @@
+#include "UnitTest.h"
+#include "UploadRingAllocator.h"
+#include <string>
+
+//the upload ring against a simulated fence: ranges keep their alignment, a range that doesn't fit before the end
+//wraps and pads the rest, the ring fills to its capacity, oversize requests are refused and frames come back
+//only once the fence passed them. A copy four times the ring streams through it in bands of rows
+bool CheckUploadRing(std::string& outMessage)
+{
+	const uint64_t capacity = 1024;
+	UploadRingAllocator ring(capacity);
+	UploadRingAllocator::Allocation allocation;
+	std::string failures;
+
+	//frame 1
+	if (!ring.Allocate(10, 1, allocation) || allocation.offset != 0)
+	{
+		failures += ", first range not at the start";
+	}
+	if (!ring.Allocate(100, 256, allocation) || allocation.offset != 256 || ring.GetUsedBytes() != 356)
+	{
+		failures += ", aligned range at " + std::to_string(allocation.offset) + " instead of 256";
+	}
+	if (!ring.Allocate(234, 2, allocation) || allocation.offset != 356 || ring.GetUsedBytes() != 590)
+	{
+		failures += ", range after an aligned one at " + std::to_string(allocation.offset);
+	}
+	ring.FinishFrame(1);
+
+	//frame 2 ends 124 bytes short of the end
+	if (!ring.Allocate(300, 8, allocation) || allocation.offset != 592)
+	{
+		failures += ", second frame starts at " + std::to_string(allocation.offset);
+	}
+	ring.FinishFrame(2);
+
+	//the gpu finished frame 1, frame 3 wraps past the unused end
+	uint64_t completedFenceValue = 1;
+	ring.Retire(completedFenceValue);
+	if (ring.GetUsedBytes() != 302)
+	{
+		failures += ", " + std::to_string(ring.GetUsedBytes()) + " bytes used after frame 1 retired";
+	}
+	if (!ring.Allocate(200, 16, allocation) || allocation.offset != 0 || ring.GetUsedBytes() != 302 + 132 + 200)
+	{
+		failures += ", wrapped range at " + std::to_string(allocation.offset) + " with " + std::to_string(ring.GetUsedBytes()) + " bytes used";
+	}
+
+	//what is left before frame 2, then nothing
+	if (!ring.Allocate(390, 1, allocation) || allocation.offset != 200 || ring.GetUsedBytes() != capacity)
+	{
+		failures += ", ring not full after filling it, " + std::to_string(ring.GetUsedBytes()) + " bytes used";
+	}
+	if (ring.Allocate(1, 1, allocation))
+	{
+		failures += ", full ring gave out a byte";
+	}
+	ring.FinishFrame(3);
+
+	UploadRingAllocator empty(capacity);
+	if (empty.Allocate(capacity + 1, 1, allocation) || empty.Allocate(0, 1, allocation) || !empty.Allocate(capacity, 256, allocation))
+	{
+		failures += ", oversize or empty requests weren't refused, or the whole ring was";
+	}
+
+	//frames come back in fence order and no further than the fence
+	completedFenceValue = 1;
+	ring.Retire(completedFenceValue);
+	if (ring.GetUsedBytes() != capacity || ring.Allocate(1, 1, allocation))
+	{
+		failures += ", a frame retired before its fence value";
+	}
+	completedFenceValue = 2;
+	ring.Retire(completedFenceValue);
+	if (ring.GetUsedBytes() != capacity - 302 || ring.GetPendingFrameCount() != 1 || ring.Allocate(400, 1, allocation))
+	{
+		failures += ", frame 2 didn't retire alone";
+	}
+	completedFenceValue = 3;
+	ring.Retire(completedFenceValue);
+	if (ring.GetUsedBytes() != 0 || ring.GetPendingFrameCount() != 0 || !ring.Allocate(capacity, 1, allocation) || allocation.offset != 0)
+	{
+		failures += ", drained ring doesn't start over at the front";
+	}
+
+	if (ring.GetAllocationCount() != 7 || ring.GetFailedCount() != 3 || ring.GetPeakBytes() != capacity)
+	{
+		failures += ", counted " + std::to_string(ring.GetAllocationCount()) + " allocations and " + std::to_string(ring.GetFailedCount()) + " failures";
+	}
+
+	//18 rows of 256 bytes through the 1024 byte ring, at most 640 bytes a frame and three frames in flight, like
+	//the device records texture uploads
+	UploadRingAllocator streaming(capacity);
+	const uint64_t rowPitch = 256;
+	const uint32_t rowCount = 18;
+	const uint64_t frameBudget = 640;
+	const uint64_t frameLatency = 3;
+	uint32_t copiedRows = 0;
+	uint64_t frameCount = 0;
+	uint64_t stalledFrameCount = 0;
+	while (copiedRows < rowCount && frameCount < 100)
+	{
+		frameCount++;
+		if (frameCount > frameLatency)
+		{
+			streaming.Retire(frameCount - frameLatency);
+		}
+
+		uint64_t budget = frameBudget;
+		uint32_t frameRows = 0;
+		while (copiedRows < rowCount && budget >= rowPitch)
+		{
+			uint32_t bandRows = streaming.AllocateRows(rowPitch, rowCount - copiedRows, budget, 256, allocation);
+			if (bandRows == 0)
+			{
+				break;
+			}
+			if (allocation.size != bandRows * rowPitch || allocation.offset % 256 != 0 || allocation.offset + allocation.size > capacity)
+			{
+				failures += ", band of " + std::to_string(bandRows) + " rows at " + std::to_string(allocation.offset) + " with " +
+					std::to_string(allocation.size) + " bytes";
+			}
+			budget -= allocation.size;
+			copiedRows += bandRows;
+			frameRows += bandRows;
+		}
+		if (frameRows == 0)
+		{
+			stalledFrameCount++;
+		}
+		streaming.FinishFrame(frameCount);
+	}
+	if (copiedRows != rowCount || streaming.GetPeakBytes() > capacity || stalledFrameCount == 0 || frameCount < rowCount * rowPitch / frameBudget)
+	{
+		failures += ", streamed " + std::to_string(copiedRows) + " of " + std::to_string(rowCount) + " rows in " + std::to_string(frameCount) +
+			" frames, " + std::to_string(stalledFrameCount) + " waiting on the fence, peak " + std::to_string(streaming.GetPeakBytes()) + " bytes";
+	}
+	if (streaming.GetFailedCount() != stalledFrameCount)
+	{
+		failures += ", " + std::to_string(streaming.GetFailedCount()) + " bands refused in " + std::to_string(stalledFrameCount) + " stalled frames";
+	}
+
+	if (!failures.empty())
+	{
+		outMessage = failures.substr(2);
+		return false;
+	}
+	outMessage = std::to_string(ring.GetAllocationCount()) + " allocations, " + std::to_string(ring.GetFailedCount()) + " refused, peak " +
+		std::to_string(ring.GetPeakBytes()) + " of " + std::to_string(capacity) + " bytes, " + std::to_string(rowCount * rowPitch) +
+		" byte copy in " + std::to_string(frameCount) + " frames";
+	return true;
+}